@@ -51,6 +51,8 @@ private:
     ComponentWriter(ComponentWriter const& rhs);
     ComponentWriter& operator=(ComponentWriter const& rhs);
 
+protected:
+
     /*!
      *  Write the bus interfaces.
      *
@@ -24,7 +24,11 @@ views_(new QList<QSharedPointer<View> > ()),
     componentInstantiations_(new QList<QSharedPointer<ComponentInstantiation> > ()),
     designInstantiations_(new QList<QSharedPointer<DesignInstantiation> > ()),
     designConfigurationInstantiations_(new QList<QSharedPointer<DesignConfigurationInstantiation> > ()),
-    ports_(new QList<QSharedPointer<Port> > ())
+    ports_(new QList<QSharedPointer<Port> > ()),
+    portIndex_(),
+    indexedPorts_(),
+    indexedNameGeneration_(-1),
+    portIndexMutex_()
 {
 
 }
@@ -37,7 +41,11 @@ views_(new QList<QSharedPointer<View> > ()),
     componentInstantiations_(new QList<QSharedPointer<ComponentInstantiation> > ()),
     designInstantiations_(new QList<QSharedPointer<DesignInstantiation> > ()),
     designConfigurationInstantiations_(new QList<QSharedPointer<DesignConfigurationInstantiation> > ()),
-    ports_(new QList<QSharedPointer<Port> > ())
+    ports_(new QList<QSharedPointer<Port> > ()),
+    portIndex_(),
+    indexedPorts_(),
+    indexedNameGeneration_(-1),
+    portIndexMutex_()
 {
     copyViews(other);
     copyComponentInstantiations(other);
@@ -347,13 +355,12 @@ QList<VLNV> Model::getHierarchyRefs() const
 //-----------------------------------------------------------------------------
 QSharedPointer<Port> Model::getPort(QString const& name) const
 {
-    foreach (QSharedPointer<Port> port, *ports_)
+    int portIndex = findPortIndex(name);
+    if (portIndex != -1)
     {
-        if (port->name() == name)
-        {
-            return port;
-        }
+        return ports_->at(portIndex);
     }
+
     return QSharedPointer<Port>();
 }
 
@@ -362,15 +369,7 @@ QSharedPointer<Port> Model::getPort(QString const& name) const
 //-----------------------------------------------------------------------------
 bool Model::hasPort(QString const& name) const
 {
-    foreach (QSharedPointer<Port> port, *ports_)
-    {
-        if (port->name() == name)
-        {
-            return true;
-        }
-    }
-
-    return false;
+    return findPortIndex(name) != -1;
 }
 
 //-----------------------------------------------------------------------------
@@ -379,6 +378,8 @@ bool Model::hasPort(QString const& name) const
 QStringList Model::getPortNames() const
 {
     QStringList portNames;
+    portNames.reserve(ports_->size());
+
     foreach (QSharedPointer<Port> port, *ports_)
     {
         portNames.append(port->name());
@@ -518,3 +519,37 @@ void Model::copyPorts(Model const& other) const
         ports_->append(copy);
     }
 }
+
+//-----------------------------------------------------------------------------
+// Function: Model::findPortIndex()
+//-----------------------------------------------------------------------------
+int Model::findPortIndex(QString const& name) const
+{
+    QMutexLocker indexLock(&portIndexMutex_);
+
+    // The port list can be modified without the model, but any modification detaches it from the indexed copy.
+    if (!ports_->isSharedWith(indexedPorts_) || indexedNameGeneration_ != Port::nameGeneration())
+    {
+        rebuildPortIndex();
+    }
+
+    return portIndex_.value(name, -1);
+}
+
+//-----------------------------------------------------------------------------
+// Function: Model::rebuildPortIndex()
+//-----------------------------------------------------------------------------
+void Model::rebuildPortIndex() const
+{
+    indexedPorts_ = *ports_;
+    indexedNameGeneration_ = Port::nameGeneration();
+
+    portIndex_.clear();
+    portIndex_.reserve(ports_->size());
+
+    // Insert in reverse order so that the first of equally named ports is indexed.
+    for (int i = ports_->size() - 1; i >= 0; --i)
+    {
+        portIndex_.insert(ports_->at(i)->name(), i);
+    }
+}
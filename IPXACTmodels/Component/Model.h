@@ -22,7 +22,9 @@
 
 #include <IPXACTmodels/ipxactmodels_global.h>
 
+#include <QHash>
 #include <QList>
+#include <QMutex>
 #include <QSharedPointer>
 #include <QStringList>
 
@@ -194,6 +196,9 @@ public:
     
 	/*!
      *  Get the specific port of the model.
+     *
+     *  Ports are found through a name index, so the lookup does not depend on the number of ports. The index is
+     *  rebuilt when the port list or the name of any port has changed since the index was built.
      *
 	 *      @param [in] name    Name of the port.
 	 *
@@ -282,6 +287,20 @@ private:
      */
     void copyPorts(const Model& other) const;
 
+    /*!
+     *  Find the position of a port in the port list.
+     *
+     *      @param [in] name    Name of the port.
+     *
+     *      @return The position of the first port with the given name, or -1 if no such port exists.
+     */
+    int findPortIndex(QString const& name) const;
+
+    /*!
+     *  Rebuild the port name index from the port list.
+     */
+    void rebuildPortIndex() const;
+
 	//! Contains the views for this model.
     QSharedPointer<QList<QSharedPointer<View> > > views_;
 
@@ -296,6 +315,18 @@ private:
 
 	//! Contains the ports for this model.
     QSharedPointer<QList<QSharedPointer<Port> > > ports_;
+
+    //! Positions of the ports in the port list by port name. Rebuilt on demand.
+    mutable QHash<QString, int> portIndex_;
+
+    //! The port list the index was built from. Shares its data with the port list until the list is modified.
+    mutable QList<QSharedPointer<Port> > indexedPorts_;
+
+    //! The port name generation the index was built with.
+    mutable int indexedNameGeneration_;
+
+    //! Guards the port name index against concurrent lookups.
+    mutable QMutex portIndexMutex_;
 };
 
 #endif // MODEL_H
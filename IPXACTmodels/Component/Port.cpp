@@ -17,6 +17,14 @@
 #include <IPXACTmodels/kactusExtensions/Kactus2Position.h>
 #include <IPXACTmodels/kactusExtensions/Kactus2Value.h>
 
+#include <QAtomicInt>
+
+namespace
+{
+    //! Incremented every time the name of a port changes.
+    QAtomicInt portNameGeneration;
+}
+
 //-----------------------------------------------------------------------------
 // Function: Port::Port()
 //-----------------------------------------------------------------------------
@@ -65,6 +73,7 @@ Port & Port::operator=( const Port &other )
 		NameGroup::operator=(other);
         Extendable::operator=(other);
         isPresent_ = other.isPresent_;
+        portNameGeneration.fetchAndAddOrdered(1);
 
 		if (other.wire_)
         {
@@ -100,6 +109,23 @@ Port::~Port()
     configurableArrays_.clear();
 }
 
+//-----------------------------------------------------------------------------
+// Function: Port::setName()
+//-----------------------------------------------------------------------------
+void Port::setName(QString const& name)
+{
+    NameGroup::setName(name);
+    portNameGeneration.fetchAndAddOrdered(1);
+}
+
+//-----------------------------------------------------------------------------
+// Function: Port::nameGeneration()
+//-----------------------------------------------------------------------------
+int Port::nameGeneration()
+{
+    return portNameGeneration.loadAcquire();
+}
+
 //-----------------------------------------------------------------------------
 // Function: Port::getWire()
 //-----------------------------------------------------------------------------
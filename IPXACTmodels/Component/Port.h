@@ -57,6 +57,20 @@ public:
 	 *  The destructor.
 	 */
 	~Port();
+
+    /*!
+     *  Sets the name of the port.
+     *
+     *      @param [in] name   The name to set.
+     */
+    virtual void setName(QString const& name) override;
+
+    /*!
+     *  Get the generation of port names. The generation changes every time the name of any port changes.
+     *
+     *      @return The current port name generation.
+     */
+    static int nameGeneration();
     
     /*!
      *  Get a pointer to the wire element.
@@ -17,7 +17,8 @@
 //-----------------------------------------------------------------------------
 // Function: PortReader::PortReader()
 //-----------------------------------------------------------------------------
-PortReader::PortReader(): CommonItemsReader()
+PortReader::PortReader(): CommonItemsReader(),
+sharedValues_()
 {
 
 }
@@ -40,7 +41,8 @@ QSharedPointer<Port> PortReader::createPortFrom(QDomNode const& portNode) const
     NameGroupReader nameReader;
     nameReader.parseNameGroup(portNode, newPort);
 
-    newPort->setIsPresent(portNode.firstChildElement(QStringLiteral("ipxact:isPresent")).firstChild().nodeValue());
+    newPort->setIsPresent(
+        sharedValue(portNode.firstChildElement(QStringLiteral("ipxact:isPresent")).firstChild().nodeValue()));
 
     QDomElement wireElement = portNode.firstChildElement(QStringLiteral("ipxact:wire"));
     if (!wireElement.isNull())
@@ -100,8 +102,10 @@ void PortReader::parseWireVectors(QDomElement const& vectorsElement, QSharedPoin
     for (int vectorIndex = 0; vectorIndex < vectorNodeList.count(); ++vectorIndex)
     {
         QDomNode vectorNode = vectorNodeList.at(vectorIndex);
-        newWire->setVectorLeftBound(vectorNode.firstChildElement(QStringLiteral("ipxact:left")).firstChild().nodeValue());
-        newWire->setVectorRightBound(vectorNode.firstChildElement(QStringLiteral("ipxact:right")).firstChild().nodeValue());
+        newWire->setVectorLeftBound(
+            sharedValue(vectorNode.firstChildElement(QStringLiteral("ipxact:left")).firstChild().nodeValue()));
+        newWire->setVectorRightBound(
+            sharedValue(vectorNode.firstChildElement(QStringLiteral("ipxact:right")).firstChild().nodeValue()));
     }
 
 }
@@ -120,7 +124,7 @@ QSharedPointer<QList<QSharedPointer<WireTypeDef> > > PortReader::parseWireTypeDe
         QDomElement wireTypeDefinitionElement = wireYypeDefinitionNodeList.at(wireTypeIndex).toElement();
 
         QDomElement nameElement = wireTypeDefinitionElement.firstChildElement(QStringLiteral("ipxact:typeName"));
-        QString typeName = nameElement.firstChild().nodeValue();
+        QString typeName = sharedValue(nameElement.firstChild().nodeValue());
         QSharedPointer<WireTypeDef> newWireTypeDefinition (new WireTypeDef(typeName));
         if (!nameElement.attribute(attributeName).isEmpty())
         {
@@ -147,7 +151,7 @@ void PortReader::parseTypeDefinitions(QDomElement const& wireTypeDefinitionEleme
     QSharedPointer<QStringList> definitionList(new QStringList());
     for (int typeDefinitionIndex = 0; typeDefinitionIndex < typeDefinitionList.count(); ++typeDefinitionIndex)
     {
-        QString definition = typeDefinitionList.at(typeDefinitionIndex).firstChild().nodeValue();
+        QString definition = sharedValue(typeDefinitionList.at(typeDefinitionIndex).firstChild().nodeValue());
         definitionList->append(definition);
     }
     if (!definitionList->isEmpty())
@@ -167,7 +171,7 @@ void PortReader::parseViewReferences(QDomElement const& wireTypeDefinitionElemen
 
     for (int viewIndex = 0; viewIndex < viewRefNodeList.count(); ++viewIndex)
     {
-        QString viewName = viewRefNodeList.at(viewIndex).firstChild().nodeValue();
+        QString viewName = sharedValue(viewRefNodeList.at(viewIndex).firstChild().nodeValue());
         viewRefs->append(viewName);
     }
 
@@ -190,7 +194,7 @@ void PortReader::parseWireDefaultValue(QDomElement const& wireElement, QSharedPo
         for (int driverIndex = 0; driverIndex < driverNodeList.count(); ++driverIndex)
         {
             QDomNode driverDefaultNode = driverNodeList.at(driverIndex).firstChildElement(QStringLiteral("ipxact:defaultValue"));
-            QString defaultValue = driverDefaultNode.firstChild().nodeValue();
+            QString defaultValue = sharedValue(driverDefaultNode.firstChild().nodeValue());
             newWire->setDefaultDriverValue(defaultValue);
         }
     }
@@ -307,8 +311,10 @@ void PortReader::parseArrays(QDomNode const& portNode, QSharedPointer<Port> newP
     {
         QDomNode arrayNode = arrayNodeList.at(arrayIndex);
 
-        QString arrayLeft = arrayNode.firstChildElement(QStringLiteral("ipxact:left")).firstChild().nodeValue();
-        QString arrayRight = arrayNode.firstChildElement(QStringLiteral("ipxact:right")).firstChild().nodeValue();
+        QString arrayLeft =
+            sharedValue(arrayNode.firstChildElement(QStringLiteral("ipxact:left")).firstChild().nodeValue());
+        QString arrayRight =
+            sharedValue(arrayNode.firstChildElement(QStringLiteral("ipxact:right")).firstChild().nodeValue());
 
         QSharedPointer<Array> newArray (new Array(arrayLeft, arrayRight));
 
@@ -352,4 +358,24 @@ void PortReader::parsePosition(QDomElement const& positionElement, QSharedPointe
     int positionX = positionElement.attribute(QStringLiteral("x")).toInt();
     int positionY = positionElement.attribute(QStringLiteral("y")).toInt();
     newPort->setDefaultPos(QPointF(positionX, positionY));
-}
\ No newline at end of file
+}
+
+//-----------------------------------------------------------------------------
+// Function: PortReader::sharedValue()
+//-----------------------------------------------------------------------------
+QString PortReader::sharedValue(QString const& value) const
+{
+    if (value.isEmpty())
+    {
+        return value;
+    }
+
+    QSet<QString>::const_iterator sharedPosition = sharedValues_.constFind(value);
+    if (sharedPosition != sharedValues_.constEnd())
+    {
+        return *sharedPosition;
+    }
+
+    sharedValues_.insert(value);
+    return value;
+}
@@ -18,9 +18,14 @@
 
 #include <QSharedPointer>
 #include <QDomNode>
+#include <QSet>
+#include <QString>
 
 //-----------------------------------------------------------------------------
 //! Reader class for IP-XACT port element.
+//!
+//! Values that typically repeat between ports, such as vector bounds and type names, share the same string data
+//! in all the ports created by one reader.
 //-----------------------------------------------------------------------------
 class IPXACTMODELS_EXPORT PortReader : public CommonItemsReader
 {
@@ -160,6 +165,22 @@ private:
      *      @param [in] newPort             The contianing port item.
      */
     void parsePosition(QDomElement const& positionElement, QSharedPointer<Port> newPort) const;
+
+    /*!
+     *  Get a string sharing its data with the equal values read earlier.
+     *
+     *      @param [in] value   The read value.
+     *
+     *      @return The shared copy of the value.
+     */
+    QString sharedValue(QString const& value) const;
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The repeating values read by this reader.
+    mutable QSet<QString> sharedValues_;
 };
 
 #endif // PORTREADER_H
\ No newline at end of file
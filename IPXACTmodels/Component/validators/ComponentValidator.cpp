@@ -59,6 +59,7 @@
 #include <IPXACTmodels/common/Assertion.h>
 
 #include <QRegularExpression>
+#include <QSet>
 
 //-----------------------------------------------------------------------------
 // Function: ComponentValidator::ComponentValidator()
@@ -446,7 +447,7 @@ bool ComponentValidator::hasValidPorts(QSharedPointer<Component> component)
 
     if (!component->getPorts()->isEmpty())
     {
-        QVector<QString> portNames;
+        QSet<QString> portNames;
         for (QSharedPointer<Port> port : *component->getPorts())
         {
             if (portNames.contains(port->name()) || !portValidator_->validate(port))
@@ -455,7 +456,7 @@ bool ComponentValidator::hasValidPorts(QSharedPointer<Component> component)
             }
             else
             {
-                portNames.append(port->name());
+                portNames.insert(port->name());
             }
         }
     }
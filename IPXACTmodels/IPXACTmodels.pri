@@ -85,6 +85,7 @@ HEADERS += ./generaldeclarations.h \
     ./common/ParameterWriter.h \
     ./common/ProtocolReader.h \
     ./common/ProtocolWriter.h \
+    ./common/DocumentMetadata.h \
     ./common/validators/AssertionValidator.h \
     ./common/validators/CellSpecificationValidator.h \
     ./common/validators/ParameterValidator.h \
@@ -259,7 +260,8 @@ HEADERS += ./generaldeclarations.h \
     ./Catalog/CatalogWriter.h \
     ./Catalog/validators/CatalogValidator.h \
     ./utilities/BusDefinitionUtils.h \
-    ./utilities/XmlUtils.h
+    ./utilities/XmlUtils.h \
+    ./utilities/StructuralHash.h
 SOURCES += ./generaldeclarations.cpp \
     ./kactusExtensions/ApiDefinition.cpp \
     ./kactusExtensions/ApiDefinitionReader.cpp \
@@ -335,6 +337,7 @@ SOURCES += ./generaldeclarations.cpp \
     ./common/TransactionalTypes.cpp \
     ./common/Vector.cpp \
     ./common/VLNV.cpp \
+    ./common/DocumentMetadata.cpp \
     ./common/validators/AssertionValidator.cpp \
     ./common/validators/CellSpecificationValidator.cpp \
     ./common/validators/namevalidator.cpp \
@@ -508,4 +511,5 @@ SOURCES += ./generaldeclarations.cpp \
     ./Catalog/IpxactFile.cpp \
     ./Catalog/validators/CatalogValidator.cpp \
     ./utilities/BusDefinitionUtils.cpp \
-    ./utilities/XmlUtils.cpp
+    ./utilities/XmlUtils.cpp \
+    ./utilities/StructuralHash.cpp
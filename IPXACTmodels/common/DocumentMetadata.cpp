@@ -0,0 +1,91 @@
+//-----------------------------------------------------------------------------
+// File: DocumentMetadata.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: Kactus2 team
+// Date: 19.10.2026
+//
+// Description:
+// Summary of an IP-XACT document for filtering the library without the full document.
+//-----------------------------------------------------------------------------
+
+#include "DocumentMetadata.h"
+
+#include <IPXACTmodels/common/Document.h>
+
+#include <IPXACTmodels/Component/Component.h>
+
+//-----------------------------------------------------------------------------
+// Function: DocumentMetadata::create()
+//-----------------------------------------------------------------------------
+DocumentMetadata DocumentMetadata::create(QSharedPointer<Document const> document)
+{
+    DocumentMetadata metadata;
+    if (document.isNull())
+    {
+        return metadata;
+    }
+
+    metadata.type = document->getVlnv().getType();
+    metadata.implementation = document->getImplementation();
+    metadata.hierarchy = document->getHierarchy();
+    metadata.firmness = document->getFirmness();
+    metadata.tags = document->getTags();
+
+    if (metadata.type == VLNV::COMPONENT)
+    {
+        QSharedPointer<Component const> component = document.staticCast<Component const>();
+        metadata.hasSystemViews = component->hasSystemViews();
+        metadata.hasDesign = component->isHierarchical();
+    }
+
+    return metadata;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentMetadata::operator<<()
+//-----------------------------------------------------------------------------
+QDataStream& operator<<(QDataStream& stream, DocumentMetadata const& metadata)
+{
+    stream << static_cast<qint32>(metadata.type) << static_cast<qint32>(metadata.implementation) <<
+        static_cast<qint32>(metadata.hierarchy) << static_cast<qint32>(metadata.firmness) <<
+        metadata.hasSystemViews << metadata.hasDesign;
+
+    stream << static_cast<qint32>(metadata.tags.size());
+    for (TagData const& tag : metadata.tags)
+    {
+        stream << tag.name_ << tag.color_;
+    }
+
+    return stream;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentMetadata::operator>>()
+//-----------------------------------------------------------------------------
+QDataStream& operator>>(QDataStream& stream, DocumentMetadata& metadata)
+{
+    qint32 type = 0;
+    qint32 implementation = 0;
+    qint32 hierarchy = 0;
+    qint32 firmness = 0;
+    stream >> type >> implementation >> hierarchy >> firmness >> metadata.hasSystemViews >> metadata.hasDesign;
+
+    metadata.type = static_cast<VLNV::IPXactType>(type);
+    metadata.implementation = static_cast<KactusAttribute::Implementation>(implementation);
+    metadata.hierarchy = static_cast<KactusAttribute::ProductHierarchy>(hierarchy);
+    metadata.firmness = static_cast<KactusAttribute::Firmness>(firmness);
+
+    qint32 tagCount = 0;
+    stream >> tagCount;
+
+    metadata.tags.clear();
+    for (qint32 i = 0; i < tagCount && stream.status() == QDataStream::Ok; ++i)
+    {
+        TagData tag;
+        stream >> tag.name_ >> tag.color_;
+        metadata.tags.append(tag);
+    }
+
+    return stream;
+}
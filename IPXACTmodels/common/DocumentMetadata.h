@@ -0,0 +1,83 @@
+//-----------------------------------------------------------------------------
+// File: DocumentMetadata.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: Kactus2 team
+// Date: 19.10.2026
+//
+// Description:
+// Summary of an IP-XACT document for filtering the library without the full document.
+//-----------------------------------------------------------------------------
+
+#ifndef DOCUMENTMETADATA_H
+#define DOCUMENTMETADATA_H
+
+#include <IPXACTmodels/ipxactmodels_global.h>
+
+#include <IPXACTmodels/common/TagData.h>
+#include <IPXACTmodels/common/VLNV.h>
+#include <IPXACTmodels/kactusExtensions/KactusAttribute.h>
+
+#include <QDataStream>
+#include <QSharedPointer>
+#include <QVector>
+
+class Document;
+
+//-----------------------------------------------------------------------------
+//! Summary of an IP-XACT document for filtering the library without the full document.
+//-----------------------------------------------------------------------------
+struct IPXACTMODELS_EXPORT DocumentMetadata
+{
+    //! The type of the document.
+    VLNV::IPXactType type = VLNV::INVALID;
+
+    //! The implementation of the document.
+    KactusAttribute::Implementation implementation = KactusAttribute::KTS_IMPLEMENTATION_COUNT;
+
+    //! The product hierarchy of the document.
+    KactusAttribute::ProductHierarchy hierarchy = KactusAttribute::KTS_PRODHIER_COUNT;
+
+    //! The firmness of the document.
+    KactusAttribute::Firmness firmness = KactusAttribute::KTS_REUSE_LEVEL_COUNT;
+
+    //! Flag for a component containing system views.
+    bool hasSystemViews = false;
+
+    //! Flag for a component containing a design through a hierarchical view.
+    bool hasDesign = false;
+
+    //! The tags of the document.
+    QVector<TagData> tags;
+
+    /*!
+     *  Create the metadata of a document.
+     *
+     *      @param [in] document    The selected document.
+     *
+     *      @return The metadata of the document, or empty metadata for a missing document.
+     */
+    static DocumentMetadata create(QSharedPointer<Document const> document);
+};
+
+/*!
+ *  Write document metadata to a data stream.
+ *
+ *      @param [in] stream      The target stream.
+ *      @param [in] metadata    The metadata to write.
+ *
+ *      @return The target stream.
+ */
+IPXACTMODELS_EXPORT QDataStream& operator<<(QDataStream& stream, DocumentMetadata const& metadata);
+
+/*!
+ *  Read document metadata from a data stream.
+ *
+ *      @param [in] stream      The source stream.
+ *      @param [out] metadata   The read metadata.
+ *
+ *      @return The source stream.
+ */
+IPXACTMODELS_EXPORT QDataStream& operator>>(QDataStream& stream, DocumentMetadata& metadata);
+
+#endif // DOCUMENTMETADATA_H
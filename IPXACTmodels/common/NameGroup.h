@@ -65,7 +65,7 @@ public:
      *
      *      @param [in] name   The name to set.     
      */
-    void setName(QString const& name);
+    virtual void setName(QString const& name);
 
     /*!
      *  Gets the displayName element in the name group.
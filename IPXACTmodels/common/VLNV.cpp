@@ -40,8 +40,9 @@ namespace
 //-----------------------------------------------------------------------------
 // Function: VLNV::VLNV()
 //-----------------------------------------------------------------------------
-VLNV::VLNV(): vendor_(), library_(), name_(), version_(), type_(VLNV::INVALID)
+VLNV::VLNV(): vendor_(), library_(), name_(), version_(), type_(VLNV::INVALID), hash_(0)
 {
+    updateHash();
 }
 
 //-----------------------------------------------------------------------------
@@ -53,9 +54,11 @@ VLNV::VLNV(QString const& type,
     library_(library),
     name_(name),
     version_(version),
-    type_(INVALID)
+    type_(INVALID),
+    hash_(0)
 {
 	type_ = string2Type(type);
+    updateHash();
 }
 
 //-----------------------------------------------------------------------------
@@ -67,8 +70,10 @@ VLNV::VLNV(IPXactType const& type,
     library_(library),
     name_(name),
     version_(version),
-    type_(type)
+    type_(type),
+    hash_(0)
 {
+    updateHash();
 }
 
 //-----------------------------------------------------------------------------
@@ -79,7 +84,8 @@ vendor_(),
     library_(),
     name_(), 
     version_(),
-    type_(type)
+    type_(type),
+    hash_(0)
 {
     QStringList vlnvFields = parseStr.split(separator);
     if (vlnvFields.count() == 4)
@@ -89,6 +95,8 @@ vendor_(),
         name_ = vlnvFields.at(2);
         version_ = vlnvFields.at(3);
     }
+
+    updateHash();
 }
 
 //-----------------------------------------------------------------------------
@@ -105,6 +113,7 @@ QString VLNV::getVendor() const
 void VLNV::setVendor(QString const& vendor)
 {
     vendor_ = vendor.simplified();
+    updateHash();
 }
 
 //-----------------------------------------------------------------------------
@@ -121,6 +130,7 @@ QString VLNV::getLibrary() const
 void VLNV::setLibrary(QString const& library)
 {
     library_ = library.simplified();
+    updateHash();
 }
 
 //-----------------------------------------------------------------------------
@@ -137,6 +147,7 @@ QString VLNV::getName() const
 void VLNV::setName(QString const& name)
 {
     name_ = name.simplified();
+    updateHash();
 }
 
 //-----------------------------------------------------------------------------
@@ -153,6 +164,7 @@ QString VLNV::getVersion() const
 void VLNV::setVersion(QString const& version)
 {
     version_ = version.simplified();
+    updateHash();
 }
 
 //-----------------------------------------------------------------------------
@@ -197,6 +209,7 @@ void VLNV::clear()
     name_.clear();
     version_.clear();
     type_ = VLNV::INVALID;
+    updateHash();
 }
 
 //-----------------------------------------------------------------------------
@@ -257,6 +270,14 @@ QString VLNV::toString(QString const& separator) const
     return vendor_ % separator % library_ % separator % name_ % separator % version_;
 }
 
+//-----------------------------------------------------------------------------
+// Function: VLNV::getHash()
+//-----------------------------------------------------------------------------
+uint VLNV::getHash() const
+{
+    return hash_;
+}
+
 //-----------------------------------------------------------------------------
 // Function: VLNV::operator<()
 //-----------------------------------------------------------------------------
@@ -326,7 +347,9 @@ bool VLNV::operator>(const VLNV &other) const
 //-----------------------------------------------------------------------------
 bool VLNV::operator==(VLNV const& other) const
 {
-	return vendor_ == other.vendor_ &&
+    // Differing hashes tell the VLNVs apart without comparing the strings.
+	return hash_ == other.hash_ &&
+        vendor_ == other.vendor_ &&
 		library_ == other.library_ &&
 		name_ == other.name_ &&
 		version_ == other.version_;
@@ -358,3 +381,22 @@ QString VLNV::IPXactType2String(IPXactType const& type)
 {
     return types.key(type, QStringLiteral("invalid"));	
 }
+
+//-----------------------------------------------------------------------------
+// Function: VLNV::updateHash()
+//-----------------------------------------------------------------------------
+void VLNV::updateHash()
+{
+    uint hash = qHash(vendor_);
+    hash = 31 * hash + qHash(library_);
+    hash = 31 * hash + qHash(name_);
+    hash_ = 31 * hash + qHash(version_);
+}
+
+//-----------------------------------------------------------------------------
+// Function: qHash()
+//-----------------------------------------------------------------------------
+uint qHash(VLNV const& vlnv, uint seed)
+{
+    return vlnv.getHash() ^ seed;
+}
@@ -14,6 +14,7 @@
 
 #include <IPXACTmodels/ipxactmodels_global.h>
 
+#include <QHash>
 #include <QMetaType>
 #include <QString>
 #include <QStringList>
@@ -191,6 +192,14 @@ public:
 	*/
 	QString toString(QString const& separator = QLatin1String(":")) const;
 
+    /*!
+     *  Gets the hash of the vendor, library, name and version. The hash is computed when the fields change, so
+     *  that the VLNV can be used as a hash key without hashing the strings on each lookup.
+     *
+     *      @return The hash of the identification fields.
+     */
+    uint getHash() const;
+
 	//! The assignment operator for the class
 	VLNV &operator=(const VLNV &other) = default;
 
@@ -243,6 +252,9 @@ public:
    
 private:
 
+    //! Computes the hash of the identification fields.
+    void updateHash();
+
 	//! The name of the vendor
 	QString vendor_;
 
@@ -257,8 +269,21 @@ private:
 
 	//! The type of the document the VLNV-tag belongs to
 	IPXactType type_;
+
+    //! The hash of the vendor, library, name and version.
+    uint hash_;
 };
 
+/*!
+ *  Gets the hash of a VLNV for hash-based containers. The type is not hashed, similar to the comparison.
+ *
+ *      @param [in] vlnv    The VLNV to hash.
+ *      @param [in] seed    The seed for the hash.
+ *
+ *      @return The hash of the VLNV.
+ */
+IPXACTMODELS_EXPORT uint qHash(VLNV const& vlnv, uint seed = 0);
+
 // With this declaration, VLNV can be used as a QVariant.
 Q_DECLARE_METATYPE(VLNV);
 
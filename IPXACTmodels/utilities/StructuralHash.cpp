@@ -0,0 +1,537 @@
+//-----------------------------------------------------------------------------
+// File: StructuralHash.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 19.10.2026
+//
+// Description:
+// Stable content hashes for IP-XACT documents and their major elements.
+//-----------------------------------------------------------------------------
+
+#include "StructuralHash.h"
+
+#include <IPXACTmodels/AbstractionDefinition/AbstractionDefinition.h>
+#include <IPXACTmodels/BusDefinition/BusDefinition.h>
+#include <IPXACTmodels/Catalog/Catalog.h>
+#include <IPXACTmodels/Component/BusInterface.h>
+#include <IPXACTmodels/Component/Component.h>
+#include <IPXACTmodels/Component/MemoryMap.h>
+#include <IPXACTmodels/Component/Port.h>
+#include <IPXACTmodels/Component/View.h>
+#include <IPXACTmodels/common/Parameter.h>
+#include <IPXACTmodels/Design/Design.h>
+#include <IPXACTmodels/designConfiguration/DesignConfiguration.h>
+
+#include <IPXACTmodels/kactusExtensions/ApiDefinition.h>
+#include <IPXACTmodels/kactusExtensions/ComDefinition.h>
+
+#include <IPXACTmodels/AbstractionDefinition/AbstractionDefinitionWriter.h>
+#include <IPXACTmodels/BusDefinition/BusDefinitionWriter.h>
+#include <IPXACTmodels/Catalog/CatalogWriter.h>
+#include <IPXACTmodels/Component/BusInterfaceWriter.h>
+#include <IPXACTmodels/Component/ComponentWriter.h>
+#include <IPXACTmodels/Component/MemoryMapWriter.h>
+#include <IPXACTmodels/Component/PortWriter.h>
+#include <IPXACTmodels/Component/ViewWriter.h>
+#include <IPXACTmodels/common/ParameterWriter.h>
+#include <IPXACTmodels/Design/DesignWriter.h>
+#include <IPXACTmodels/designConfiguration/DesignConfigurationWriter.h>
+
+#include <IPXACTmodels/kactusExtensions/ApiDefinitionWriter.h>
+#include <IPXACTmodels/kactusExtensions/ComDefinitionWriter.h>
+
+#include <QCryptographicHash>
+#include <QIODevice>
+#include <QXmlStreamWriter>
+
+namespace
+{
+    //! The algorithm used for all the hashes.
+    const QCryptographicHash::Algorithm HASH_ALGORITHM = QCryptographicHash::Sha1;
+
+    //! The smallest cache size at which the entries of deleted elements are removed.
+    const int MINIMUM_PRUNE_LIMIT = 1024;
+
+    //-----------------------------------------------------------------------------
+    //! Write-only device passing the written data directly to a hash.
+    //-----------------------------------------------------------------------------
+    class HashingDevice : public QIODevice
+    {
+    public:
+
+        explicit HashingDevice(QCryptographicHash& hash): QIODevice(), hash_(hash)
+        {
+            open(QIODevice::WriteOnly);
+        }
+
+    protected:
+
+        qint64 readData(char* /*data*/, qint64 /*maxSize*/) override final
+        {
+            return -1;
+        }
+
+        qint64 writeData(char const* data, qint64 size) override final
+        {
+            hash_.addData(data, static_cast<int>(size));
+            return size;
+        }
+
+    private:
+
+        //! The hash receiving the written data.
+        QCryptographicHash& hash_;
+    };
+
+    //-----------------------------------------------------------------------------
+    //! Writer for the component content not covered by the element hashes.
+    //-----------------------------------------------------------------------------
+    class ComponentRemainderWriter : public ComponentWriter
+    {
+    public:
+
+        void writeRemainder(QXmlStreamWriter& writer, QSharedPointer<Component> component) const
+        {
+            writeTopComments(writer, component);
+            writeXmlProcessingInstructions(writer, component);
+
+            writer.writeStartElement(QStringLiteral("ipxact:component"));
+            writeNamespaceDeclarations(writer, component);
+            writeVLNVElements(writer, component->getVlnv());
+            writeIndirectInterfaces(writer, component);
+            writeChannels(writer, component);
+            writeRemapStates(writer, component);
+            writeAddressSpaces(writer, component);
+            writeInstantiations(writer, component);
+            writeComponentGenerators(writer, component);
+            writeChoices(writer, component);
+            writeFileSets(writer, component);
+            writeCPUs(writer, component);
+            writeOtherClockDrivers(writer, component);
+            writeResetTypes(writer, component);
+            writeDescription(writer, component);
+            writeAssertions(writer, component);
+            writeComponentExtensions(writer, component);
+            writer.writeEndElement(); // ipxact:component
+        }
+    };
+
+    //-----------------------------------------------------------------------------
+    // Function: hashWrittenXml()
+    //-----------------------------------------------------------------------------
+    template <typename WriteFunction>
+    QByteArray hashWrittenXml(WriteFunction write)
+    {
+        QCryptographicHash hash(HASH_ALGORITHM);
+        HashingDevice device(hash);
+
+        QXmlStreamWriter writer(&device);
+        write(writer);
+
+        return hash.result();
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: writeDocument()
+    //-----------------------------------------------------------------------------
+    // Writes the documents not hashed by their elements.
+    void writeDocument(QXmlStreamWriter& writer, QSharedPointer<Document> document)
+    {
+        VLNV::IPXactType documentType = document->getVlnv().getType();
+        if (documentType == VLNV::ABSTRACTIONDEFINITION)
+        {
+            AbstractionDefinitionWriter().writeAbstractionDefinition(writer,
+                document.dynamicCast<AbstractionDefinition>());
+        }
+        else if (documentType == VLNV::BUSDEFINITION)
+        {
+            BusDefinitionWriter().writeBusDefinition(writer, document.dynamicCast<BusDefinition>());
+        }
+        else if (documentType == VLNV::CATALOG)
+        {
+            CatalogWriter().writeCatalog(writer, document.dynamicCast<Catalog>());
+        }
+        else if (documentType == VLNV::DESIGNCONFIGURATION)
+        {
+            DesignConfigurationWriter().writeDesignConfiguration(writer,
+                document.dynamicCast<DesignConfiguration>());
+        }
+        else if (documentType == VLNV::APIDEFINITION)
+        {
+            ApiDefinitionWriter().writeApiDefinition(writer, document.dynamicCast<ApiDefinition>());
+        }
+        else if (documentType == VLNV::COMDEFINITION)
+        {
+            ComDefinitionWriter().writeComDefinition(writer, document.dynamicCast<ComDefinition>());
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: StructuralHash::StructuralHash()
+//-----------------------------------------------------------------------------
+StructuralHash::StructuralHash():
+cache_(),
+pruneLimit_(MINIMUM_PRUNE_LIMIT)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: StructuralHash::documentHash()
+//-----------------------------------------------------------------------------
+StructuralHash::Digest StructuralHash::documentHash(QSharedPointer<Document const> document)
+{
+    if (document.isNull())
+    {
+        return Digest();
+    }
+
+    VLNV::IPXactType documentType = document->getVlnv().getType();
+    if (documentType == VLNV::COMPONENT)
+    {
+        return componentHash(document.dynamicCast<Component const>());
+    }
+    else if (documentType == VLNV::DESIGN)
+    {
+        return designHash(document.dynamicCast<Design const>());
+    }
+
+    Digest digest;
+    if (findCached(document, digest))
+    {
+        return digest;
+    }
+
+    // The writers do not modify the written models.
+    QSharedPointer<Document> writtenDocument = document.constCast<Document>();
+    return store(document, hashWrittenXml([&writtenDocument](QXmlStreamWriter& writer)
+        {
+            writeDocument(writer, writtenDocument);
+        }));
+}
+
+//-----------------------------------------------------------------------------
+// Function: StructuralHash::componentHash()
+//-----------------------------------------------------------------------------
+StructuralHash::Digest StructuralHash::componentHash(QSharedPointer<Component const> component)
+{
+    if (component.isNull())
+    {
+        return Digest();
+    }
+
+    // The element lists are read on every call, so added, removed and reordered elements change the hash.
+    QCryptographicHash hash(HASH_ALGORITHM);
+    hash.addData(componentRemainderHash(component));
+
+    addListHash(hash, *component->getBusInterfaces(), &StructuralHash::busInterfaceHash);
+    addListHash(hash, *component->getMemoryMaps(), &StructuralHash::memoryMapHash);
+    addListHash(hash, *component->getViews(), &StructuralHash::viewHash);
+    addListHash(hash, *component->getPorts(), &StructuralHash::portHash);
+    addListHash(hash, *component->getParameters(), &StructuralHash::parameterHash);
+
+    return hash.result();
+}
+
+//-----------------------------------------------------------------------------
+// Function: StructuralHash::designHash()
+//-----------------------------------------------------------------------------
+StructuralHash::Digest StructuralHash::designHash(QSharedPointer<Design const> design)
+{
+    if (design.isNull())
+    {
+        return Digest();
+    }
+
+    Digest digest;
+    if (findCached(design, digest))
+    {
+        return digest;
+    }
+
+    QSharedPointer<Design> writtenDesign = design.constCast<Design>();
+    return store(design, hashWrittenXml([&writtenDesign](QXmlStreamWriter& writer)
+        {
+            DesignWriter().writeDesign(writer, writtenDesign);
+        }));
+}
+
+//-----------------------------------------------------------------------------
+// Function: StructuralHash::busInterfaceHash()
+//-----------------------------------------------------------------------------
+StructuralHash::Digest StructuralHash::busInterfaceHash(QSharedPointer<BusInterface const> busInterface)
+{
+    if (busInterface.isNull())
+    {
+        return Digest();
+    }
+
+    Digest digest;
+    if (findCached(busInterface, digest))
+    {
+        return digest;
+    }
+
+    QSharedPointer<BusInterface> writtenInterface = busInterface.constCast<BusInterface>();
+    return store(busInterface, hashWrittenXml([&writtenInterface](QXmlStreamWriter& writer)
+        {
+            BusInterfaceWriter().writebusinterface(writer, writtenInterface);
+        }));
+}
+
+//-----------------------------------------------------------------------------
+// Function: StructuralHash::memoryMapHash()
+//-----------------------------------------------------------------------------
+StructuralHash::Digest StructuralHash::memoryMapHash(QSharedPointer<MemoryMap const> memoryMap)
+{
+    if (memoryMap.isNull())
+    {
+        return Digest();
+    }
+
+    Digest digest;
+    if (findCached(memoryMap, digest))
+    {
+        return digest;
+    }
+
+    QSharedPointer<MemoryMap> writtenMap = memoryMap.constCast<MemoryMap>();
+    return store(memoryMap, hashWrittenXml([&writtenMap](QXmlStreamWriter& writer)
+        {
+            MemoryMapWriter().writeMemoryMap(writer, writtenMap);
+        }));
+}
+
+//-----------------------------------------------------------------------------
+// Function: StructuralHash::viewHash()
+//-----------------------------------------------------------------------------
+StructuralHash::Digest StructuralHash::viewHash(QSharedPointer<View const> view)
+{
+    if (view.isNull())
+    {
+        return Digest();
+    }
+
+    Digest digest;
+    if (findCached(view, digest))
+    {
+        return digest;
+    }
+
+    QSharedPointer<View> writtenView = view.constCast<View>();
+    return store(view, hashWrittenXml([&writtenView](QXmlStreamWriter& writer)
+        {
+            ViewWriter().writeView(writer, writtenView);
+        }));
+}
+
+//-----------------------------------------------------------------------------
+// Function: StructuralHash::parameterHash()
+//-----------------------------------------------------------------------------
+StructuralHash::Digest StructuralHash::parameterHash(QSharedPointer<Parameter const> parameter)
+{
+    if (parameter.isNull())
+    {
+        return Digest();
+    }
+
+    Digest digest;
+    if (findCached(parameter, digest))
+    {
+        return digest;
+    }
+
+    QSharedPointer<Parameter> writtenParameter = parameter.constCast<Parameter>();
+    return store(parameter, hashWrittenXml([&writtenParameter](QXmlStreamWriter& writer)
+        {
+            ParameterWriter().writeParameter(writer, writtenParameter);
+        }));
+}
+
+//-----------------------------------------------------------------------------
+// Function: StructuralHash::portHash()
+//-----------------------------------------------------------------------------
+StructuralHash::Digest StructuralHash::portHash(QSharedPointer<Port const> port)
+{
+    if (port.isNull())
+    {
+        return Digest();
+    }
+
+    Digest digest;
+    if (findCached(port, digest))
+    {
+        return digest;
+    }
+
+    QSharedPointer<Port> writtenPort = port.constCast<Port>();
+    return store(port, hashWrittenXml([&writtenPort](QXmlStreamWriter& writer)
+        {
+            PortWriter().writePort(writer, writtenPort);
+        }));
+}
+
+//-----------------------------------------------------------------------------
+// Function: StructuralHash::portListHash()
+//-----------------------------------------------------------------------------
+StructuralHash::Digest StructuralHash::portListHash(QList<QSharedPointer<Port> > const& ports)
+{
+    QCryptographicHash hash(HASH_ALGORITHM);
+    for (QSharedPointer<Port> const& port : ports)
+    {
+        hash.addData(portHash(port));
+    }
+
+    return hash.result();
+}
+
+//-----------------------------------------------------------------------------
+// Function: StructuralHash::invalidate()
+//-----------------------------------------------------------------------------
+void StructuralHash::invalidate(void const* element)
+{
+    cache_.remove(element);
+}
+
+//-----------------------------------------------------------------------------
+// Function: StructuralHash::invalidate()
+//-----------------------------------------------------------------------------
+void StructuralHash::invalidate(Component const* component)
+{
+    cache_.remove(component);
+
+    for (QSharedPointer<BusInterface> const& busInterface : *component->getBusInterfaces())
+    {
+        cache_.remove(busInterface.data());
+    }
+
+    for (QSharedPointer<MemoryMap> const& memoryMap : *component->getMemoryMaps())
+    {
+        cache_.remove(memoryMap.data());
+    }
+
+    for (QSharedPointer<View> const& view : *component->getViews())
+    {
+        cache_.remove(view.data());
+    }
+
+    for (QSharedPointer<Port> const& port : *component->getPorts())
+    {
+        cache_.remove(port.data());
+    }
+
+    for (QSharedPointer<Parameter> const& parameter : *component->getParameters())
+    {
+        cache_.remove(parameter.data());
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: StructuralHash::clear()
+//-----------------------------------------------------------------------------
+void StructuralHash::clear()
+{
+    cache_.clear();
+    pruneLimit_ = MINIMUM_PRUNE_LIMIT;
+}
+
+//-----------------------------------------------------------------------------
+// Function: StructuralHash::cacheSize()
+//-----------------------------------------------------------------------------
+int StructuralHash::cacheSize() const
+{
+    return cache_.size();
+}
+
+//-----------------------------------------------------------------------------
+// Function: StructuralHash::findCached()
+//-----------------------------------------------------------------------------
+bool StructuralHash::findCached(QSharedPointer<void const> const& element, Digest& digest)
+{
+    auto entry = cache_.find(element.data());
+    if (entry == cache_.end())
+    {
+        return false;
+    }
+
+    if (entry->element_.toStrongRef() != element)
+    {
+        // The cached element has been deleted and its address reused.
+        cache_.erase(entry);
+        return false;
+    }
+
+    digest = entry->digest_;
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: StructuralHash::store()
+//-----------------------------------------------------------------------------
+StructuralHash::Digest StructuralHash::store(QSharedPointer<void const> const& element, Digest const& digest)
+{
+    if (cache_.size() >= pruneLimit_)
+    {
+        removeExpiredEntries();
+        pruneLimit_ = qMax(MINIMUM_PRUNE_LIMIT, 2 * cache_.size());
+    }
+
+    CacheEntry& entry = cache_[element.data()];
+    entry.element_ = element;
+    entry.digest_ = digest;
+
+    return digest;
+}
+
+//-----------------------------------------------------------------------------
+// Function: StructuralHash::addListHash()
+//-----------------------------------------------------------------------------
+template <typename Element>
+void StructuralHash::addListHash(QCryptographicHash& hash, QList<QSharedPointer<Element> > const& elements,
+    Digest (StructuralHash::*elementHash)(QSharedPointer<Element const>))
+{
+    hash.addData(QByteArray::number(elements.size()));
+    for (QSharedPointer<Element> const& element : elements)
+    {
+        hash.addData((this->*elementHash)(element));
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: StructuralHash::componentRemainderHash()
+//-----------------------------------------------------------------------------
+StructuralHash::Digest StructuralHash::componentRemainderHash(QSharedPointer<Component const> component)
+{
+    Digest digest;
+    if (findCached(component, digest))
+    {
+        return digest;
+    }
+
+    QSharedPointer<Component> writtenComponent = component.constCast<Component>();
+    return store(component, hashWrittenXml([&writtenComponent](QXmlStreamWriter& writer)
+        {
+            ComponentRemainderWriter().writeRemainder(writer, writtenComponent);
+        }));
+}
+
+//-----------------------------------------------------------------------------
+// Function: StructuralHash::removeExpiredEntries()
+//-----------------------------------------------------------------------------
+void StructuralHash::removeExpiredEntries()
+{
+    auto entry = cache_.begin();
+    while (entry != cache_.end())
+    {
+        if (entry->element_.isNull())
+        {
+            entry = cache_.erase(entry);
+        }
+        else
+        {
+            ++entry;
+        }
+    }
+}
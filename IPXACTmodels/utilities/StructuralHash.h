@@ -0,0 +1,250 @@
+//-----------------------------------------------------------------------------
+// File: StructuralHash.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 19.10.2026
+//
+// Description:
+// Stable content hashes for IP-XACT documents and their major elements.
+//-----------------------------------------------------------------------------
+
+#ifndef STRUCTURALHASH_H
+#define STRUCTURALHASH_H
+
+#include <IPXACTmodels/ipxactmodels_global.h>
+
+#include <QByteArray>
+#include <QHash>
+#include <QList>
+#include <QSharedPointer>
+#include <QWeakPointer>
+
+class BusInterface;
+class Component;
+class Design;
+class Document;
+class MemoryMap;
+class Parameter;
+class Port;
+class View;
+
+class QCryptographicHash;
+
+//-----------------------------------------------------------------------------
+//! Stable content hashes for IP-XACT documents and their major elements.
+//!
+//! The hash of an element is calculated over its IP-XACT serialization, so two elements have the same hash
+//! exactly when they would be written identically to a file. Hashes are stable between runs and can be used as
+//! keys for on-disk caches.
+//!
+//! Calculated hashes are cached by element, so the hash of an unchanged document or element is found without
+//! serializing it again. The hash of a component is combined on every call from the cached hashes of its bus
+//! interfaces, memory maps, views, ports and parameters and of the rest of the component. Adding, removing or
+//! reordering these elements therefore changes the component hash without any invalidation.
+//!
+//! The cache does not observe the models. An element modified in place must be invalidated before it is hashed
+//! again, and a component with invalidate(Component const*) after any of its own fields or elements has been
+//! modified in place. The library hashes only its own copies of the documents, which are never modified, so it
+//! does not need to invalidate anything. The cache holds no references to the elements. The entries of deleted
+//! elements are removed when they are next looked up or when the cache grows, and they are never reused for a
+//! new element created in the same address.
+//-----------------------------------------------------------------------------
+class IPXACTMODELS_EXPORT StructuralHash
+{
+public:
+
+    //! Type of the calculated hashes.
+    using Digest = QByteArray;
+
+    /*!
+     *  The constructor.
+     */
+    StructuralHash();
+
+    /*!
+     *  The destructor.
+     */
+    ~StructuralHash() = default;
+
+    /*!
+     *  Get the hash of a document of any type.
+     *
+     *      @param [in] document    The selected document.
+     *
+     *      @return The document hash.
+     */
+    Digest documentHash(QSharedPointer<Document const> document);
+
+    /*!
+     *  Get the hash of a component.
+     *
+     *      @param [in] component   The selected component.
+     *
+     *      @return The component hash.
+     */
+    Digest componentHash(QSharedPointer<Component const> component);
+
+    /*!
+     *  Get the hash of a design.
+     *
+     *      @param [in] design  The selected design.
+     *
+     *      @return The design hash.
+     */
+    Digest designHash(QSharedPointer<Design const> design);
+
+    /*!
+     *  Get the hash of a bus interface.
+     *
+     *      @param [in] busInterface    The selected bus interface.
+     *
+     *      @return The bus interface hash.
+     */
+    Digest busInterfaceHash(QSharedPointer<BusInterface const> busInterface);
+
+    /*!
+     *  Get the hash of a memory map.
+     *
+     *      @param [in] memoryMap   The selected memory map.
+     *
+     *      @return The memory map hash.
+     */
+    Digest memoryMapHash(QSharedPointer<MemoryMap const> memoryMap);
+
+    /*!
+     *  Get the hash of a view.
+     *
+     *      @param [in] view    The selected view.
+     *
+     *      @return The view hash.
+     */
+    Digest viewHash(QSharedPointer<View const> view);
+
+    /*!
+     *  Get the hash of a parameter.
+     *
+     *      @param [in] parameter   The selected parameter.
+     *
+     *      @return The parameter hash.
+     */
+    Digest parameterHash(QSharedPointer<Parameter const> parameter);
+
+    /*!
+     *  Get the hash of a port.
+     *
+     *      @param [in] port    The selected port.
+     *
+     *      @return The port hash.
+     */
+    Digest portHash(QSharedPointer<Port const> port);
+
+    /*!
+     *  Get the combined hash of a list of ports. The order of the ports affects the hash.
+     *
+     *      @param [in] ports   The selected ports.
+     *
+     *      @return The port list hash.
+     */
+    Digest portListHash(QList<QSharedPointer<Port> > const& ports);
+
+    /*!
+     *  Discard the cached hash of a modified element.
+     *
+     *      @param [in] element     The modified element.
+     */
+    void invalidate(void const* element);
+
+    /*!
+     *  Discard the cached hashes of a modified component and of all its bus interfaces, memory maps, views, ports
+     *  and parameters.
+     *
+     *      @param [in] component   The modified component.
+     */
+    void invalidate(Component const* component);
+
+    /*!
+     *  Discard all the cached hashes.
+     */
+    void clear();
+
+    /*!
+     *  Get the number of cached hashes.
+     *
+     *      @return The number of cached hashes, including the ones of deleted elements not yet removed.
+     */
+    int cacheSize() const;
+
+    // No copying. No assignments.
+    StructuralHash(StructuralHash const& rhs) = delete;
+    StructuralHash& operator=(StructuralHash const& rhs) = delete;
+
+private:
+
+    //! Cached hash of one element.
+    struct CacheEntry
+    {
+        //! The hashed element, used to detect reuse of the address of a removed element.
+        QWeakPointer<void const> element_;
+
+        //! The hash of the element.
+        Digest digest_;
+    };
+
+    /*!
+     *  Find the cached hash of an element.
+     *
+     *      @param [in] element     The selected element.
+     *      @param [out] digest     The cached hash, if found.
+     *
+     *      @return True, if a valid hash was found in the cache, otherwise false.
+     */
+    bool findCached(QSharedPointer<void const> const& element, Digest& digest);
+
+    /*!
+     *  Store the hash of an element in the cache.
+     *
+     *      @param [in] element     The hashed element.
+     *      @param [in] digest      The hash of the element.
+     *
+     *      @return The stored hash.
+     */
+    Digest store(QSharedPointer<void const> const& element, Digest const& digest);
+
+    /*!
+     *  Add the size of an element list and the hashes of its elements to a hash.
+     *
+     *      @param [in] hash            The hash to add to.
+     *      @param [in] elements        The hashed elements.
+     *      @param [in] elementHash     The function giving the hash of a single element.
+     */
+    template <typename Element>
+    void addListHash(QCryptographicHash& hash, QList<QSharedPointer<Element> > const& elements,
+        Digest (StructuralHash::*elementHash)(QSharedPointer<Element const>));
+
+    /*!
+     *  Get the hash of the component content not covered by the element hashes.
+     *
+     *      @param [in] component   The selected component.
+     *
+     *      @return The hash of the rest of the component.
+     */
+    Digest componentRemainderHash(QSharedPointer<Component const> component);
+
+    /*!
+     *  Remove the cached hashes of deleted elements.
+     */
+    void removeExpiredEntries();
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The cached hashes by element address.
+    QHash<void const*, CacheEntry> cache_;
+
+    //! The cache size at which the entries of deleted elements are next removed.
+    int pruneLimit_;
+};
+
+#endif // STRUCTURALHASH_H
@@ -19,6 +19,7 @@ HEADERS += ./editors/ComponentEditor/treeStructure/SingleIndirectInterfaceItem.h
     ./common/utils.h \
     ./common/IEditProvider.h \
     ./common/GenericEditProvider.h \
+    ./common/Profiler.h \
     ./common/widgets/listManager/dirlistmanagermodel.h \
     ./common/widgets/listManager/listmanagermodel.h \
     ./common/widgets/listManager/listmanager.h \
@@ -178,6 +179,7 @@ HEADERS += ./editors/ComponentEditor/treeStructure/SingleIndirectInterfaceItem.h
     ./wizards/ComponentWizard/ComponentWizardConclusionPage.h \
     ./wizards/ComponentWizard/ComponentWizardImportPage.h \
     ./wizards/ComponentWizard/ComponentWizardGeneralInfoPage.h \
+    ./wizards/ComponentWizard/ImportCommand.h \
     ./wizards/ComponentWizard/ImportEditor/ImportEditor.h \
     ./wizards/ComponentWizard/ImportEditor/ImportHighlighter.h \
     ./wizards/BusInterfaceWizard/BusInterfaceWizardBusDefinitionPage.h \
@@ -225,6 +227,7 @@ HEADERS += ./editors/ComponentEditor/treeStructure/SingleIndirectInterfaceItem.h
     ./Plugins/PluginSystem/ImportPlugin/ModelParameterSource.h \
     ./Plugins/PluginSystem/ImportPlugin/ModelParameterVisualizer.h \
     ./Plugins/PluginSystem/ImportPlugin/ImportPlugin.h \
+    ./Plugins/PluginSystem/ImportPlugin/ParallelImportSupport.h \
     ./Plugins/common/SourceHighlightStyle.h \
     ./Plugins/common/LanguageHighlighter.h \
     ./library/DocumentFileAccess.h \
@@ -244,6 +247,9 @@ HEADERS += ./editors/ComponentEditor/treeStructure/SingleIndirectInterfaceItem.h
     ./library/LibraryTreeView.h \
     ./library/LibraryLoader.h \
     ./library/LibraryWidget.h \
+    ./library/LibraryMetadataCache.h \
+    ./library/DocumentSaveExecutor.h \
+    ./library/LibraryFileWatcher.h \
     ./library/VLNVDialer/dialerwidget.h \
     ./library/VLNVDialer/filterwidget.h \
     ./library/VLNVDialer/firmnessgroup.h \
@@ -256,6 +262,7 @@ HEADERS += ./editors/ComponentEditor/treeStructure/SingleIndirectInterfaceItem.h
     ./library/HierarchyView/hierarchyfilter.h \
     ./library/HierarchyView/hierarchyitem.h \
     ./library/HierarchyView/hierarchymodel.h \
+    ./library/HierarchyView/HierarchyGraph.h \
     ./editors/ApiDefinitionEditor/ApiFunctionColumns.h \
     ./editors/ApiDefinitionEditor/ApiDefinitionEditor.h \
     ./editors/ApiDefinitionEditor/ApiFunctionEditor.h \
@@ -342,6 +349,7 @@ HEADERS += ./editors/ComponentEditor/treeStructure/SingleIndirectInterfaceItem.h
     ./editors/ComponentEditor/busInterfaces/portmaps/PortMapTreeDelegate.h \
     ./editors/ComponentEditor/busInterfaces/portmaps/PortMapTreeSortProxyModel.h \
     ./editors/ComponentEditor/busInterfaces/portmaps/PortListSortProxyModel.h \
+    ./editors/ComponentEditor/busInterfaces/portmaps/JaroWinklerMatcher.h \
     ./editors/ComponentEditor/busInterfaces/general/BridgeColumns.h \
     ./editors/ComponentEditor/busInterfaces/general/bridgesdelegate.h \
     ./editors/ComponentEditor/busInterfaces/general/bridgeseditor.h \
@@ -603,6 +611,7 @@ HEADERS += ./editors/ComponentEditor/treeStructure/SingleIndirectInterfaceItem.h
     ./editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/memorymapsvisualizer.h \
     ./editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/memorymapview.h \
     ./editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/registergraphitem.h \
+    ./editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/registeritemprovider.h \
     ./editors/ComponentEditor/memoryMaps/memoryMapsExpressionCalculators/AddressBlockExpressionsGatherer.h \
     ./editors/ComponentEditor/memoryMaps/memoryMapsExpressionCalculators/FieldExpressionsGatherer.h \
     ./editors/ComponentEditor/memoryMaps/memoryMapsExpressionCalculators/MemoryMapExpressionsGatherer.h \
@@ -852,6 +861,7 @@ SOURCES += ./VersionHelper.cpp \
     ./common/NameGenerationPolicy.cpp \
     ./common/TextEditProvider.cpp \
     ./common/utils.cpp \
+    ./common/Profiler.cpp \
     ./common/dialogs/comboSelector/comboselector.cpp \
     ./common/dialogs/propertyPageDialog/PropertyPageDialog.cpp \
     ./common/dialogs/propertyPageDialog/PropertyPageView.cpp \
@@ -992,6 +1002,7 @@ SOURCES += ./VersionHelper.cpp \
     ./wizards/ComponentWizard/ComponentWizardViewsPage.cpp \
     ./wizards/ComponentWizard/ImportRunner.cpp \
     ./wizards/ComponentWizard/ViewListModel.cpp \
+    ./wizards/ComponentWizard/ImportCommand.cpp \
     ./wizards/ComponentWizard/ImportEditor/ImportEditor.cpp \
     ./wizards/ComponentWizard/ImportEditor/ImportHighlighter.cpp \
     ./wizards/BusInterfaceWizard/BusInterfaceWizard.cpp \
@@ -1039,6 +1050,9 @@ SOURCES += ./VersionHelper.cpp \
     ./library/LibraryUtils.cpp \
     ./library/LibraryWidget.cpp \
     ./library/TableViewDialog.cpp \
+    ./library/LibraryMetadataCache.cpp \
+    ./library/DocumentSaveExecutor.cpp \
+    ./library/LibraryFileWatcher.cpp \
     ./library/VLNVDialer/dialerwidget.cpp \
     ./library/VLNVDialer/filterwidget.cpp \
     ./library/VLNVDialer/firmnessgroup.cpp \
@@ -1051,6 +1065,7 @@ SOURCES += ./VersionHelper.cpp \
     ./library/HierarchyView/hierarchymodel.cpp \
     ./library/HierarchyView/hierarchyview.cpp \
     ./library/HierarchyView/hierarchywidget.cpp \
+    ./library/HierarchyView/HierarchyGraph.cpp \
     ./editors/ApiDefinitionEditor/ApiDefinitionEditor.cpp \
     ./editors/ApiDefinitionEditor/ApiFunctionEditor.cpp \
     ./editors/ApiDefinitionEditor/ApiFunctionModel.cpp \
@@ -1084,6 +1099,7 @@ SOURCES += ./VersionHelper.cpp \
     ./editors/ComponentEditor/busInterfaces/portmaps/PortMapTreeModel.cpp \
     ./editors/ComponentEditor/busInterfaces/portmaps/PortMapTreeSortProxyModel.cpp \
     ./editors/ComponentEditor/busInterfaces/portmaps/PortMapTreeView.cpp \
+    ./editors/ComponentEditor/busInterfaces/portmaps/JaroWinklerMatcher.cpp \
     ./editors/ComponentEditor/busInterfaces/general/bridgesdelegate.cpp \
     ./editors/ComponentEditor/busInterfaces/general/bridgeseditor.cpp \
     ./editors/ComponentEditor/busInterfaces/general/bridgesmodel.cpp \
@@ -1241,6 +1257,7 @@ SOURCES += ./VersionHelper.cpp \
     ./editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/memorymapview.cpp \
     ./editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/registerfilegraphitem.cpp \
     ./editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/registergraphitem.cpp \
+    ./editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/registeritemprovider.cpp \
     ./editors/ComponentEditor/memoryMaps/memoryMapsExpressionCalculators/AddressBlockExpressionsGatherer.cpp \
     ./editors/ComponentEditor/memoryMaps/memoryMapsExpressionCalculators/FieldExpressionsGatherer.cpp \
     ./editors/ComponentEditor/memoryMaps/memoryMapsExpressionCalculators/MemoryMapExpressionsGatherer.cpp \
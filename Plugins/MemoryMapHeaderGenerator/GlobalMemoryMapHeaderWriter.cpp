@@ -27,6 +27,39 @@
 #include <QDate>
 #include <QDir>
 #include <QDesktopServices>
+#include <QRunnable>
+#include <QThreadPool>
+#include <QVector>
+
+#include <functional>
+
+namespace
+{
+    //-----------------------------------------------------------------------------
+    //! Creates the content of one header file in a background thread.
+    //-----------------------------------------------------------------------------
+    class HeaderContentTask : public QRunnable
+    {
+    public:
+
+        explicit HeaderContentTask(std::function<void()> const& work):
+        QRunnable(),
+            work_(work)
+        {
+
+        }
+
+        void run() override
+        {
+            work_();
+        }
+
+    private:
+
+        //! The work to run.
+        std::function<void()> work_;
+    };
+}
 
 //-----------------------------------------------------------------------------
 // Function: GlobalMemoryMapHeaderWriter::GlobalMemoryMapHeaderWriter()
@@ -38,7 +71,8 @@ BaseMemoryMapHeaderWriter(utility),
 parentObject_(parentObject),
 componentDesign_(componentDesign),
 componentDesignConfig_(componentDesignConfig),
-operatedInterfaces_(),
+resolvedInstances_(),
+connectedInterfaces_(),
 saveOptions_()
 {
 
@@ -63,8 +97,6 @@ void GlobalMemoryMapHeaderWriter::writeMemoryMapHeader(QSharedPointer<Component>
 
     bool changed = false;
 
-	operatedInterfaces_.clear();
-    
     GlobalHeaderSaveModel model(utility_->getLibraryInterface(), parentObject_);
     model.setDesign(globalComponent, componentDesign_);
 
@@ -88,8 +120,40 @@ void GlobalMemoryMapHeaderWriter::writeMemoryMapHeader(QSharedPointer<Component>
 
     informStartOfGeneration();
 
-	foreach (GlobalHeaderSaveModel::SaveFileOptions* headerOpt, options)
+    resolveDesign();
+
+    // The headers only read the resolved design, so they are created concurrently and written in order.
+    int headerCount = options.size();
+    QVector<QString> headerContents(headerCount);
+
+    if (headerCount < 2)
     {
+        for (int i = 0; i < headerCount; ++i)
+        {
+            headerContents[i] = createHeaderContent(*options.at(i));
+        }
+    }
+    else
+    {
+        QThreadPool threadPool;
+        for (int i = 0; i < headerCount; ++i)
+        {
+            GlobalHeaderSaveModel::SaveFileOptions const* headerOpt = options.at(i);
+            QString& content = headerContents[i];
+
+            threadPool.start(new HeaderContentTask([this, headerOpt, &content]()
+            {
+                content = createHeaderContent(*headerOpt);
+            }));
+        }
+
+        threadPool.waitForDone();
+    }
+
+	for (int i = 0; i < headerCount; ++i)
+    {
+        GlobalHeaderSaveModel::SaveFileOptions* headerOpt = options.at(i);
+
 		QFile file(headerOpt->fileInfo_.absoluteFilePath());
 
         checkDirectoryStructure(headerOpt->fileInfo_.dir());
@@ -101,26 +165,8 @@ void GlobalMemoryMapHeaderWriter::writeMemoryMapHeader(QSharedPointer<Component>
 		}
 
 		QTextStream stream(&file);
-
-        QString description (" * Header file generated by Kactus2 for instance \"" + headerOpt->instance_ +
-            "\" interface \"" + headerOpt->interface_ + "\".\n"+
-            " * This file contains addresses of the memories and registers defined in the memory maps " +
-            "of connected components.\n" +
-            " * Source component: " + headerOpt->comp_.toString() + ".\n" +
-        	"*/\n");
-
-        QString headerGuard ("__" + headerOpt->instance_.toUpper() + "_" + headerOpt->interface_.toUpper() + "_H");
-
-        writeTopOfHeaderFile(stream, headerOpt->fileInfo_.fileName(), headerGuard, description);
-
-		QSharedPointer<ActiveInterface> cpuMasterInterface(new ActiveInterface(headerOpt->instance_, 
-            headerOpt->interface_));
-		operatedInterfaces_.append(cpuMasterInterface);
-
-		// start the address parsing from the cpu's interface
-		parseInterface(0, stream, cpuMasterInterface);
-
-		stream << "#endif /* " << headerGuard << " */" << endl << endl;
+        stream << headerContents.at(i);
+        stream.flush();
 
         file.close();
 
@@ -131,10 +177,6 @@ void GlobalMemoryMapHeaderWriter::writeMemoryMapHeader(QSharedPointer<Component>
 
 		// a header file was added
 		changed = true;
-
-		// the list must be cleared when moving to completely new master interface so each header generation
-        // starts from scratch.
-		operatedInterfaces_.clear();
 	}
 
 	if (changed)
@@ -145,24 +187,117 @@ void GlobalMemoryMapHeaderWriter::writeMemoryMapHeader(QSharedPointer<Component>
 
 	// clear the members for next generation run
     componentDesign_.clear();
-	operatedInterfaces_.clear();
-
+    resolvedInstances_.clear();
+    connectedInterfaces_.clear();
 
     informGenerationComplete();
 }
 
 //-----------------------------------------------------------------------------
-// Function: GlobalMemoryMapHeaderWriter::parseInterface()
+// Function: GlobalMemoryMapHeaderWriter::resolveDesign()
 //-----------------------------------------------------------------------------
-void GlobalMemoryMapHeaderWriter::parseInterface(qint64 offset, QTextStream& stream, QSharedPointer<ActiveInterface> interface)
+void GlobalMemoryMapHeaderWriter::resolveDesign()
 {
+    resolvedInstances_.clear();
+    connectedInterfaces_.clear();
+
     Q_ASSERT(componentDesign_);
-    Q_ASSERT(componentDesign_->containsHWInstance(interface->getComponentReference()));
+
+    // Instances of the same component share the model, which is only read during the generation.
+    QHash<VLNV, QSharedPointer<Component> > components;
+
+    foreach (QSharedPointer<ComponentInstance> instance, *componentDesign_->getComponentInstances())
+    {
+        VLNV componentVLNV = *instance->getComponentRef();
+        if (!components.contains(componentVLNV))
+        {
+            components.insert(componentVLNV,
+                utility_->getLibraryInterface()->getModel(componentVLNV).dynamicCast<Component>());
+        }
+
+        ResolvedInstance resolved;
+        resolved.uuid_ = instance->getUuid();
+        resolved.description_ = instance->getDescription();
+        resolved.component_ = components.value(componentVLNV);
+
+        if (resolved.component_)
+        {
+            resolved.finder_ = createParameterFinder(instance, resolved.component_);
+        }
+
+        // Instance names are case insensitive in the design. The first instance with the name is used.
+        QString instanceKey = instance->getInstanceName().toLower();
+        if (!resolvedInstances_.contains(instanceKey))
+        {
+            resolvedInstances_.insert(instanceKey, resolved);
+        }
+    }
+
+    foreach (QSharedPointer<Interconnection> connection, *componentDesign_->getInterconnections())
+    {
+        QSharedPointer<ActiveInterface> startInterface = connection->getStartInterface();
+        QPair<QString, QString> startKey(startInterface->getComponentReference(),
+            startInterface->getBusReference());
+
+        connectedInterfaces_[startKey].append(*connection->getActiveInterfaces());
+
+        foreach (QSharedPointer<ActiveInterface> active, *connection->getActiveInterfaces())
+        {
+            QPair<QString, QString> activeKey(active->getComponentReference(), active->getBusReference());
+            if (activeKey != startKey)
+            {
+                connectedInterfaces_[activeKey].append(startInterface);
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: GlobalMemoryMapHeaderWriter::createHeaderContent()
+//-----------------------------------------------------------------------------
+QString GlobalMemoryMapHeaderWriter::createHeaderContent(GlobalHeaderSaveModel::SaveFileOptions const& headerOptions)
+{
+    QString content;
+    QTextStream stream(&content);
+
+    QString description (" * Header file generated by Kactus2 for instance \"" + headerOptions.instance_ +
+        "\" interface \"" + headerOptions.interface_ + "\".\n"+
+        " * This file contains addresses of the memories and registers defined in the memory maps " +
+        "of connected components.\n" +
+        " * Source component: " + headerOptions.comp_.toString() + ".\n" +
+        "*/\n");
+
+    QString headerGuard ("__" + headerOptions.instance_.toUpper() + "_" + headerOptions.interface_.toUpper() +
+        "_H");
+
+    writeTopOfHeaderFile(stream, headerOptions.fileInfo_.fileName(), headerGuard, description);
+
+    // Each header starts from scratch with the interfaces it has parsed.
+    QList<QSharedPointer<ActiveInterface> > operatedInterfaces;
+
+    QSharedPointer<ActiveInterface> cpuMasterInterface(new ActiveInterface(headerOptions.instance_,
+        headerOptions.interface_));
+    operatedInterfaces.append(cpuMasterInterface);
+
+    // start the address parsing from the cpu's interface
+    parseInterface(0, stream, cpuMasterInterface, operatedInterfaces);
+
+    stream << "#endif /* " << headerGuard << " */" << endl << endl;
+
+    return content;
+}
+
+//-----------------------------------------------------------------------------
+// Function: GlobalMemoryMapHeaderWriter::parseInterface()
+//-----------------------------------------------------------------------------
+void GlobalMemoryMapHeaderWriter::parseInterface(qint64 offset, QTextStream& stream,
+    QSharedPointer<ActiveInterface> interface, QList<QSharedPointer<ActiveInterface> >& operatedInterfaces)
+{
+    Q_ASSERT(resolvedInstances_.contains(interface->getComponentReference().toLower()));
 
 	// parse the component containing the interface
-	VLNV compVLNV = componentDesign_->getHWComponentVLNV(interface->getComponentReference());
-	QSharedPointer<Document> libComp = utility_->getLibraryInterface()->getModel(compVLNV);
-	QSharedPointer<Component> component = libComp.dynamicCast<Component>();
+	QSharedPointer<Component> component =
+        resolvedInstances_.value(interface->getComponentReference().toLower()).component_;
 	Q_ASSERT(component);
 
     QSharedPointer<BusInterface> busInterface = component->getBusInterface(interface->getBusReference());    
@@ -171,19 +306,19 @@ void GlobalMemoryMapHeaderWriter::parseInterface(qint64 offset, QTextStream& str
         General::InterfaceMode interfaceMode = busInterface->getInterfaceMode();
         if (interfaceMode == General::MASTER)
         {
-            parseMasterInterface(offset, component, stream, interface);
+            parseMasterInterface(offset, component, stream, interface, operatedInterfaces);
         }
         else if (interfaceMode == General::SLAVE)
         {
-            parseSlaveInterface(offset, component, stream, interface);
+            parseSlaveInterface(offset, component, stream, interface, operatedInterfaces);
         }
         else if (interfaceMode == General::MIRROREDSLAVE)
         {
-            parseMirroredSlaveInterface(offset, component, stream, interface);
+            parseMirroredSlaveInterface(offset, component, stream, interface, operatedInterfaces);
         }
         else if (interfaceMode == General::MIRROREDMASTER)
         {
-            parseMirroredMasterInterface(offset, component, stream, interface);
+            parseMirroredMasterInterface(offset, component, stream, interface, operatedInterfaces);
         }
     }    
 }
@@ -192,10 +327,11 @@ void GlobalMemoryMapHeaderWriter::parseInterface(qint64 offset, QTextStream& str
 // Function: GlobalMemoryMapHeaderWriter::parseMasterInterface()
 //-----------------------------------------------------------------------------
 void GlobalMemoryMapHeaderWriter::parseMasterInterface(qint64 offset, QSharedPointer<Component> component,
-    QTextStream& stream, QSharedPointer<ActiveInterface> interface)
+    QTextStream& stream, QSharedPointer<ActiveInterface> interface,
+    QList<QSharedPointer<ActiveInterface> >& operatedInterfaces)
 {
-    QString instanceID = getInstanceID(interface->getComponentReference());
-    QSharedPointer<ListParameterFinder> finder = createParameterFinder(instanceID, component);
+    QSharedPointer<ListParameterFinder> finder =
+        resolvedInstances_.value(interface->getComponentReference().toLower()).finder_;
 
     QString masterBaseAddress = component->getBusInterface(interface->getBusReference())->getMaster()->getBaseAddress();
 
@@ -204,10 +340,10 @@ void GlobalMemoryMapHeaderWriter::parseMasterInterface(qint64 offset, QSharedPoi
     QList<QSharedPointer<ActiveInterface> > connected = getConnectedInterfaces(interface);
     foreach (QSharedPointer<ActiveInterface> targetInterface, connected)
     {
-        if (!operatedInterfaces_.contains(targetInterface))
+        if (!operatedInterfaces.contains(targetInterface))
         {
-            operatedInterfaces_.append(targetInterface);
-            parseInterface(offset, stream, targetInterface);
+            operatedInterfaces.append(targetInterface);
+            parseInterface(offset, stream, targetInterface, operatedInterfaces);
         }
     }
 }
@@ -216,7 +352,8 @@ void GlobalMemoryMapHeaderWriter::parseMasterInterface(qint64 offset, QSharedPoi
 // Function: GlobalMemoryMapHeaderWriter::parseSlaveInterface()
 //-----------------------------------------------------------------------------
 void GlobalMemoryMapHeaderWriter::parseSlaveInterface(qint64 offset, QSharedPointer<Component> component,
-    QTextStream& stream, QSharedPointer<ActiveInterface> interface)
+    QTextStream& stream, QSharedPointer<ActiveInterface> interface,
+    QList<QSharedPointer<ActiveInterface> >& operatedInterfaces)
 {
     QSharedPointer<SlaveInterface> slave = component->getBusInterface(interface->getBusReference())->getSlave();
     Q_ASSERT(slave);
@@ -233,22 +370,22 @@ void GlobalMemoryMapHeaderWriter::parseSlaveInterface(qint64 offset, QSharedPoin
 
     if (memMap && memMap->hasMemoryBlocks())
     {
+        ResolvedInstance instance = resolvedInstances_.value(interface->getComponentReference().toLower());
+
         stream << "/*" << endl;
         stream << " * Instance: " << interface->getComponentReference() << " Interface: " << interface->getBusReference() << endl;
         stream << " * Instance base address: 0x" << QString::number(offset, 16) << endl;
         stream << " * Source component: " << component->getVlnv().toString() << endl;
 
         // if there is a description for the component instance
-        QString instanceDesc = componentDesign_->getHWInstanceDescription(interface->getComponentReference());
+        QString instanceDesc = instance.description_;
         if (!instanceDesc.isEmpty())
         {
             stream << " * Description:" << endl;
             stream << " * " << instanceDesc << endl;
         }
 
-        QString instanceID = getInstanceID(interface->getComponentReference());
-
-        QSharedPointer<ListParameterFinder> finder = createParameterFinder(instanceID, component);
+        QSharedPointer<ListParameterFinder> finder = instance.finder_;
 
         stream << " * The defines for the memory map \"" << memMap->name() << "\":" << endl;
         stream << "*/" << endl << endl;
@@ -281,13 +418,13 @@ void GlobalMemoryMapHeaderWriter::parseSlaveInterface(qint64 offset, QSharedPoin
 
             QSharedPointer<ActiveInterface> masterIF(new ActiveInterface(interface->getComponentReference(),
                 masterRef));
-            if (operatedInterfaces_.contains(masterIF))
+            if (operatedInterfaces.contains(masterIF))
             {
                 continue;
             }
 
-            operatedInterfaces_.append(masterIF);
-            parseInterface(offset, stream, masterIF);
+            operatedInterfaces.append(masterIF);
+            parseInterface(offset, stream, masterIF, operatedInterfaces);
         }
     }
 }
@@ -296,13 +433,14 @@ void GlobalMemoryMapHeaderWriter::parseSlaveInterface(qint64 offset, QSharedPoin
 // Function: GlobalMemoryMapHeaderWriter::parseMirroredSlaveInterface()
 //-----------------------------------------------------------------------------
 void GlobalMemoryMapHeaderWriter::parseMirroredSlaveInterface(qint64 offset, QSharedPointer<Component> component,
-    QTextStream& stream, QSharedPointer<ActiveInterface> interface)
+    QTextStream& stream, QSharedPointer<ActiveInterface> interface,
+    QList<QSharedPointer<ActiveInterface> >& operatedInterfaces)
 {
     // increase the offset by the remap address of the mirrored slave interface
     QSharedPointer<BusInterface> busInterface = component->getBusInterface(interface->getBusReference());
 
-    QString instanceId = getInstanceID(interface->getComponentReference());
-    QSharedPointer<ListParameterFinder> finder = createParameterFinder(instanceId, component);
+    QSharedPointer<ListParameterFinder> finder =
+        resolvedInstances_.value(interface->getComponentReference().toLower()).finder_;
 
     foreach (QSharedPointer<MirroredSlaveInterface::RemapAddress> remap, 
         *busInterface->getMirroredSlave()->getRemapAddresses())
@@ -313,10 +451,10 @@ void GlobalMemoryMapHeaderWriter::parseMirroredSlaveInterface(qint64 offset, QSh
         QList<QSharedPointer<ActiveInterface> > connected = getConnectedInterfaces(interface);
         foreach (QSharedPointer<ActiveInterface> targetInterface, connected)
         {
-            if (!operatedInterfaces_.contains(targetInterface))
+            if (!operatedInterfaces.contains(targetInterface))
             {
-                operatedInterfaces_.append(targetInterface);
-                parseInterface(offset, stream, targetInterface);
+                operatedInterfaces.append(targetInterface);
+                parseInterface(offset, stream, targetInterface, operatedInterfaces);
             }
         }
     }
@@ -326,7 +464,8 @@ void GlobalMemoryMapHeaderWriter::parseMirroredSlaveInterface(qint64 offset, QSh
 // Function: GlobalMemoryMapHeaderWriter::parseMirroredMaster()
 //-----------------------------------------------------------------------------
 void GlobalMemoryMapHeaderWriter::parseMirroredMasterInterface(qint64 offset, QSharedPointer<Component> component,
-    QTextStream& stream, QSharedPointer<ActiveInterface> interface)
+    QTextStream& stream, QSharedPointer<ActiveInterface> interface,
+    QList<QSharedPointer<ActiveInterface> >& operatedInterfaces)
 {
     // mirrored master interfaces are connected via channels
     // find the interfaces connected to the specified mirrored master interface
@@ -357,10 +496,10 @@ void GlobalMemoryMapHeaderWriter::parseMirroredMasterInterface(qint64 offset, QS
     {
         QSharedPointer<ActiveInterface> connectedInterface(new ActiveInterface(interface->getComponentReference(),
             busif->name()));
-        if (!operatedInterfaces_.contains(connectedInterface))
+        if (!operatedInterfaces.contains(connectedInterface))
         {
-            operatedInterfaces_.append(connectedInterface);
-            parseInterface(offset, stream, connectedInterface);
+            operatedInterfaces.append(connectedInterface);
+            parseInterface(offset, stream, connectedInterface, operatedInterfaces);
         }
     }
 }
@@ -377,19 +516,18 @@ void GlobalMemoryMapHeaderWriter::displayMemoryMapHeader(QString const& filePath
 }
 
 //-----------------------------------------------------------------------------
-// Function: GlobalMemoryMapHeaderWriter::checkConfigurableElementValues()
+// Function: GlobalMemoryMapHeaderWriter::createParameterFinder()
 //-----------------------------------------------------------------------------
-QSharedPointer<ListParameterFinder> GlobalMemoryMapHeaderWriter::createParameterFinder(QString const& instanceID,
-    QSharedPointer<Component> component)
+QSharedPointer<ListParameterFinder> GlobalMemoryMapHeaderWriter::createParameterFinder(
+    QSharedPointer<ComponentInstance> instance, QSharedPointer<Component> component) const
 {
     QSharedPointer<QList<QSharedPointer<Parameter> > > configurableElementValues
         (new QList<QSharedPointer<Parameter> > ());
 
     QMap<QString, QString> configurableElementsInInstance;
-
-    if (componentDesign_)
+    foreach (QSharedPointer<ConfigurableElementValue> configurable, *instance->getConfigurableElementValues())
     {
-        configurableElementsInInstance = getConfigurableElementsFromInstance(instanceID);
+        configurableElementsInInstance.insert(configurable->getReferenceId(), configurable->getConfigurableValue());
     }
 
     foreach (QSharedPointer<Parameter> parameterPointer, *component->getParameters())
@@ -411,75 +549,12 @@ QSharedPointer<ListParameterFinder> GlobalMemoryMapHeaderWriter::createParameter
     return listFinder;
 }
 
-//-----------------------------------------------------------------------------
-// Function: GlobalMemoryMapHeaderWriter::getConfigurableElementsFromInstance()
-//-----------------------------------------------------------------------------
-QMap<QString, QString> GlobalMemoryMapHeaderWriter::getConfigurableElementsFromInstance(QString const& instanceId)
-    const
-{
-    QMap<QString, QString> configurableElements;
-
-    foreach (QSharedPointer<ComponentInstance> instance, *componentDesign_->getComponentInstances())
-    {
-        if (instance->getUuid() == instanceId)
-        {
-            foreach (QSharedPointer<ConfigurableElementValue> configurable,
-                *instance->getConfigurableElementValues())
-            {
-                configurableElements.insert(configurable->getReferenceId(), configurable->getConfigurableValue());
-            }
-
-            break;
-        }
-    }
-
-    return configurableElements;
-}
-
-//-----------------------------------------------------------------------------
-// Function: GlobalMemoryMapHeaderWriter::getInstanceID()
-//-----------------------------------------------------------------------------
-QString GlobalMemoryMapHeaderWriter::getInstanceID(QString const& interfaceReference) const
-{
-    foreach (QSharedPointer<ComponentInstance> instance, *componentDesign_->getComponentInstances())
-    {
-        if (instance->getInstanceName() == interfaceReference)
-        {
-            return instance->getUuid();
-        }
-    }
-
-    // This should not be reached.
-    return QString();
-}
-
 //-----------------------------------------------------------------------------
 // Function: GlobalMemoryMapHeaderWriter::getConnectedInterfaces()
 //-----------------------------------------------------------------------------
 QList<QSharedPointer<ActiveInterface> > GlobalMemoryMapHeaderWriter::getConnectedInterfaces(
-    QSharedPointer<ActiveInterface> interface)
+    QSharedPointer<ActiveInterface> interface) const
 {
-    QList<QSharedPointer<ActiveInterface> > connectedInterfaces;
-
-    foreach (QSharedPointer<Interconnection> connection, *componentDesign_->getInterconnections())
-    {
-        if (connection->getStartInterface()->getComponentReference() == interface->getComponentReference() &&
-            connection->getStartInterface()->getBusReference() == interface->getBusReference())
-        {
-            connectedInterfaces.append(*connection->getActiveInterfaces());
-        }
-        else
-        {
-            foreach (QSharedPointer<ActiveInterface> active, *connection->getActiveInterfaces())
-            {
-                if (active->getComponentReference() == interface->getComponentReference() &&
-                    active->getBusReference() == interface->getBusReference())
-                {
-                    connectedInterfaces.append(connection->getStartInterface());
-                }
-            }
-        }
-    }
-
-    return connectedInterfaces;
+    return connectedInterfaces_.value(QPair<QString, QString>(interface->getComponentReference(),
+        interface->getBusReference()));
 }
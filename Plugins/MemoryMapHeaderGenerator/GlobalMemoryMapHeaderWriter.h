@@ -28,7 +28,9 @@
 #include <QSharedPointer>
 #include <QString>
 #include <QFileInfo>
+#include <QHash>
 #include <QList>
+#include <QPair>
 #include <QTextStream>
 
 class IPluginUtility;
@@ -84,14 +86,47 @@ private:
 	//! No assignment
     GlobalMemoryMapHeaderWriter& operator=(const GlobalMemoryMapHeaderWriter& other);
 
+    //! The component instance of the design resolved for the header generation.
+    struct ResolvedInstance
+    {
+        //! The uuid of the instance.
+        QString uuid_;
+
+        //! The description of the instance.
+        QString description_;
+
+        //! The component of the instance.
+        QSharedPointer<Component> component_;
+
+        //! The parameter finder containing the configurable element values of the instance.
+        QSharedPointer<ListParameterFinder> finder_;
+    };
+
+    /*!
+     *  Resolves the components, the configurable element values and the connections of the design instances
+     *  once for all the generated headers.
+     */
+    void resolveDesign();
+
+    /*!
+     *  Creates the content of a header file.
+     *
+     *      @param [in] headerOptions   The options of the header to create.
+     *
+     *      @return The content of the header file.
+     */
+    QString createHeaderContent(GlobalHeaderSaveModel::SaveFileOptions const& headerOptions);
+
     /*!
 	 *  Parse the interface and its connections.
 	 *
-	 *      @param [in] offset      The current offset.
-	 *      @param [in] stream      The text stream to write into.
-	 *      @param [in] interface   Identifies the current interface to parse.
+	 *      @param [in] offset              The current offset.
+	 *      @param [in] stream              The text stream to write into.
+	 *      @param [in] interface           Identifies the current interface to parse.
+	 *      @param [in] operatedInterfaces  The interfaces already parsed for the current header.
 	 */
-	void parseInterface(qint64 offset, QTextStream& stream, QSharedPointer<ActiveInterface> interface);
+	void parseInterface(qint64 offset, QTextStream& stream, QSharedPointer<ActiveInterface> interface,
+        QList<QSharedPointer<ActiveInterface> >& operatedInterfaces);
 
     /*!
      *  Parse the master interface.
@@ -102,7 +137,7 @@ private:
      *      @param [in] interFace   Identifies the current interface to parse.
      */
     void parseMasterInterface(qint64 offset, QSharedPointer<Component> component, QTextStream& stream,
-        QSharedPointer<ActiveInterface> interface);
+        QSharedPointer<ActiveInterface> interface, QList<QSharedPointer<ActiveInterface> >& operatedInterfaces);
 
     /*!
      *  Parse the slave interface.
@@ -113,7 +148,7 @@ private:
      *      @param [in] interFace   Identifies the current interface to parse.
      */
     void parseSlaveInterface(qint64 offset, QSharedPointer<Component> component, QTextStream& stream,
-        QSharedPointer<ActiveInterface> interface);
+        QSharedPointer<ActiveInterface> interface, QList<QSharedPointer<ActiveInterface> >& operatedInterfaces);
 
     /*!
      *  Parse the mirrored slave interface.
@@ -124,7 +159,7 @@ private:
      *      @param [in] interFace   Identifies the current interface to parse.
      */
     void parseMirroredSlaveInterface(qint64 offset, QSharedPointer<Component> component, QTextStream& stream,
-        QSharedPointer<ActiveInterface> interface);
+        QSharedPointer<ActiveInterface> interface, QList<QSharedPointer<ActiveInterface> >& operatedInterfaces);
 
     /*!
      *  Parse the mirrored master interface.
@@ -135,36 +170,18 @@ private:
      *      @param [in] interFace   Identifies the current interface to parse.
      */
     void parseMirroredMasterInterface(qint64 offset, QSharedPointer<Component> component, QTextStream& stream,
-        QSharedPointer<ActiveInterface> interface);
+        QSharedPointer<ActiveInterface> interface, QList<QSharedPointer<ActiveInterface> >& operatedInterfaces);
 
     /*!
      *  Creates the parameter finder using configurable element values of the instance.
      *
-     *      @param [in] instanceID  The uuid of the instance of the configurable element values.
+     *      @param [in] instance    The instance of the configurable element values.
      *      @param [in] component   The component of the instance.
      *
      *      @return A list parameter finder containing the configurable element values of the instance.
      */
-    QSharedPointer<ListParameterFinder> createParameterFinder(QString const& instanceID,
-        QSharedPointer<Component> component);
-
-    /*!
-     *  Gets the uuid of an instance.
-     *
-     *      @param [in] interfaceReference  The name of the component instance.
-     *
-     *      @return Uuid of the instance.
-     */
-    QString getInstanceID(QString const& interfaceReference) const;
-
-    /*!
-     *  Get configurable elements from the selected instance.
-     *
-     *      @param [in] instanceId  The id of the selected instance.
-     *
-     *      @return Map containing the configurable elements from the selected instance as ID / value pairs.
-     */
-    QMap<QString, QString> getConfigurableElementsFromInstance(QString const& instanceId) const;
+    QSharedPointer<ListParameterFinder> createParameterFinder(QSharedPointer<ComponentInstance> instance,
+        QSharedPointer<Component> component) const;
 
     /*!
      *  Get the connected interfaces.
@@ -173,7 +190,7 @@ private:
      *
      *      @return A list of interfaces connected to the selected interface.
      */
-    QList<QSharedPointer<ActiveInterface> > getConnectedInterfaces(QSharedPointer<ActiveInterface> interface);
+    QList<QSharedPointer<ActiveInterface> > getConnectedInterfaces(QSharedPointer<ActiveInterface> interface) const;
     
     //-----------------------------------------------------------------------------
     // Data.
@@ -188,8 +205,11 @@ private:
     //! The hw design configuration of the component.
     QSharedPointer<DesignConfiguration> componentDesignConfig_;
 
-    //! A list of interfaces that have been checked.
-    QList<QSharedPointer<ActiveInterface> > operatedInterfaces_;
+    //! The resolved instances of the design by their instance names in lower case.
+    QHash<QString, ResolvedInstance> resolvedInstances_;
+
+    //! The interfaces connected to each instance interface, identified by the instance and bus references.
+    QHash<QPair<QString, QString>, QList<QSharedPointer<ActiveInterface> > > connectedInterfaces_;
 
     //! A list of save options for the writer.
     QList<GlobalHeaderSaveModel::SaveFileOptions*> saveOptions_;
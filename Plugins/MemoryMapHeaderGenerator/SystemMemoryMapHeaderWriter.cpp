@@ -204,11 +204,41 @@ void SystemMemoryMapHeaderWriter::writeMemoryMapHeader(QSharedPointer<Component>
 void SystemMemoryMapHeaderWriter::searchInstanceFiles(QSharedPointer<const Component> component,
     const QString& hwViewName)
 {
-    if (!component->hasView(hwViewName))
+    // The CPUs are indexed by their ids, so each design instance is matched with one lookup.
+    QHash<QString, int> unresolvedCPUs;
+    for (int i = 0; i < systemGeneratorSettings_.size(); ++i)
+    {
+        SystemHeaderSaveModel::SysHeaderOptions const& systemHeaderOption = systemGeneratorSettings_.at(i);
+        if (!systemHeaderOption.found_ && !unresolvedCPUs.contains(systemHeaderOption.instanceId_))
+        {
+            unresolvedCPUs.insert(systemHeaderOption.instanceId_, i);
+        }
+    }
+
+    QSet<QString> searchedViews;
+    searchDesignInstances(component, hwViewName, unresolvedCPUs, searchedViews);
+}
+
+//-----------------------------------------------------------------------------
+// Function: SystemMemoryMapHeaderWriter::searchDesignInstances()
+//-----------------------------------------------------------------------------
+void SystemMemoryMapHeaderWriter::searchDesignInstances(QSharedPointer<const Component> component,
+    QString const& hwViewName, QHash<QString, int>& unresolvedCPUs, QSet<QString>& searchedViews)
+{
+    if (unresolvedCPUs.isEmpty() || !component->hasView(hwViewName))
     {
         return;
     }
 
+    // A component used in several places of the hierarchy has the same instances in each of them.
+    QString viewKey = component->getVlnv().toString() + QLatin1Char('/') + hwViewName;
+    if (searchedViews.contains(viewKey))
+    {
+        return;
+    }
+
+    searchedViews.insert(viewKey);
+
     VLNV hierRef = component->getHierRef(hwViewName);
 
     if (!hierRef.isValid())
@@ -246,56 +276,52 @@ void SystemMemoryMapHeaderWriter::searchInstanceFiles(QSharedPointer<const Compo
 
     foreach (QSharedPointer<const ComponentInstance> instance, *design->getComponentInstances())
     {
-        bool matched = false;
-
         // check if the instance matches one of the searched CPUs
-        for (int i = 0; i < systemGeneratorSettings_.size(); ++i)
+        QHash<QString, int>::iterator cpuIndex = unresolvedCPUs.find(instance->getUuid());
+        if (cpuIndex != unresolvedCPUs.end())
         {
-            SystemHeaderSaveModel::SysHeaderOptions& systemHeaderOption = systemGeneratorSettings_[i];
+            SystemHeaderSaveModel::SysHeaderOptions& systemHeaderOption =
+                systemGeneratorSettings_[cpuIndex.value()];
+            unresolvedCPUs.erase(cpuIndex);
 
-            // if the CPU was already found before
-            if (systemHeaderOption.found_)
+            systemHeaderOption.found_ = true;
+
+            QSharedPointer<const FileSet> instanceFileSet =
+                component->findFileSetById(systemHeaderOption.instanceId_);
+
+            if (!instanceFileSet)
             {
                 continue;
             }
 
-            else if (instance->getUuid() == systemHeaderOption.instanceId_)
+            QString sourcePath = utility_->getLibraryInterface()->getPath(component->getVlnv());
+            foreach (QString const& fileType, usedFileTypes)
             {
-                systemHeaderOption.found_ = true;
-                matched = true;
-
-                QSharedPointer<const FileSet> instanceFileSet =
-                    component->findFileSetById(systemHeaderOption.instanceId_);
-
-                if (!instanceFileSet)
+                foreach (QString const& relativePath, instanceFileSet->findFilesByFileType(fileType))
                 {
-                    break;
-                }
+                    QString absolutePath = General::getAbsolutePath(sourcePath, relativePath);
 
-                QString sourcePath = utility_->getLibraryInterface()->getPath(component->getVlnv());
-                foreach (QString const& fileType, usedFileTypes)
-                {
-                    foreach (QString const& relativePath, instanceFileSet->findFilesByFileType(fileType))
-                    {
-                        QString absolutePath = General::getAbsolutePath(sourcePath, relativePath);
-
-                        QFileInfo info(absolutePath);
-                        systemHeaderOption.includeFiles_.append(info);
-                    }
+                    QFileInfo info(absolutePath);
+                    systemHeaderOption.includeFiles_.append(info);
                 }
-
-                break;
             }
         }
-
-        if (!matched)
+        else
         {
             VLNV instanceVLNV = *instance->getComponentRef();
             QSharedPointer<const Document> libComp = utility_->getLibraryInterface()->getModelReadOnly(instanceVLNV);
             QSharedPointer<const Component> instanceComponent = libComp.dynamicCast<const Component>();
-            Q_ASSERT(instanceComponent);
+            if (!instanceComponent)
+            {
+                continue;
+            }
+
+            QString activeView;
+            if (desConf)
+            {
+                activeView = desConf->getActiveView(instance->getInstanceName());
+            }
 
-            QString activeView = desConf->getActiveView(instance->getInstanceName());
             if (activeView.isEmpty())
             {
                 QStringList hierViewNames = instanceComponent->getHierViews();
@@ -317,22 +343,10 @@ void SystemMemoryMapHeaderWriter::searchInstanceFiles(QSharedPointer<const Compo
         }
     }
 
-    bool allFound = true;
-    foreach (const SystemHeaderSaveModel::SysHeaderOptions& systemHeaderOption, systemGeneratorSettings_)
-    {
-        if (!systemHeaderOption.found_)
-        {
-            allFound = false;
-        }
-    }
-
-    // if there is at least one more CPU instance to find
-    if (!allFound)
+    // the remaining CPU instances are searched from the designs below this level
+    foreach (SystemMemoryMapHeaderWriter::HierParsingInfo info, instancesToParse)
     {
-        foreach (SystemMemoryMapHeaderWriter::HierParsingInfo info, instancesToParse)
-        {
-            searchInstanceFiles(info.comp_, info.activeView_);
-        }
+        searchDesignInstances(info.comp_, info.activeView_, unresolvedCPUs, searchedViews);
     }
 }
 
@@ -29,7 +29,9 @@
 #include <QSharedPointer>
 #include <QString>
 #include <QFileInfo>
+#include <QHash>
 #include <QList>
+#include <QSet>
 #include <QTextStream>
 
 class IPluginUtility;
@@ -83,6 +85,17 @@ private:
 	 */
 	void searchInstanceFiles(QSharedPointer<const Component> component, const QString& hwViewName);
 
+    /*!
+     *  Search the CPU instances in the design of a hierarchical view and the designs below it.
+     *
+     *      @param [in]     component       The hierarchical component to search.
+     *      @param [in]     hwViewName      The name of the hierarchical view on the component.
+     *      @param [in/out] unresolvedCPUs  The indexes of the CPUs not yet found by their instance ids.
+     *      @param [in/out] searchedViews   The component views already searched.
+     */
+    void searchDesignInstances(QSharedPointer<const Component> component, QString const& hwViewName,
+        QHash<QString, int>& unresolvedCPUs, QSet<QString>& searchedViews);
+
     /*!
      *  Find the system view currently used in the system design.
      *
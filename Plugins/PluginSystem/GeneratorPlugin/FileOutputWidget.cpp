@@ -24,6 +24,9 @@ namespace
     const QString WARNING_FILE_EXISTS("<b>One or more of the output files already exists and will "
         "be overwritten.</b>");
 
+    const QString WARNING_CHANGED_FILE_EXISTS("<b>One or more of the output files already exists and will "
+        "be overwritten, if its content changes.</b>");
+
     enum Columns
     {
         COLUMN_VLNV = 0,
@@ -39,6 +42,7 @@ namespace
 FileOutputWidget::FileOutputWidget(QSharedPointer<OutputControl> configuration) : 
     model_(configuration),
     pathEditor_(new QLineEdit(this)),
+    incrementalBox_(new QCheckBox(tr("Write only changed files and remove outdated ones"), this)),
     generalWarningLabel_(new QLabel),
     fileTable_(new QTableWidget)
 {
@@ -58,6 +62,10 @@ FileOutputWidget::FileOutputWidget(QSharedPointer<OutputControl> configuration)
     QPushButton* browseButton = new QPushButton(tr("Browse"), this);
     pathSelectionLayout->addWidget(browseButton);
 
+    incrementalBox_->setChecked(model_->isIncremental());
+    incrementalBox_->setToolTip(tr("Unchanged files keep their timestamps, so dependent builds are not rerun. "
+        "Files generated by a previous run into the directory but no longer generated are removed."));
+
     // Stuff that comes on top of the file table.
     QHBoxLayout* headerLayout = new QHBoxLayout();
     QLabel* tableHeader = new QLabel("Output files:");
@@ -94,6 +102,7 @@ FileOutputWidget::FileOutputWidget(QSharedPointer<OutputControl> configuration)
     // Add everything it their proper position in the final layout.
     QVBoxLayout* topLayout = new QVBoxLayout(this);
     topLayout->addLayout(pathSelectionLayout);
+    topLayout->addWidget(incrementalBox_);
     topLayout->addLayout(headerLayout);
     topLayout->addWidget(fileTable_);
     topLayout->addLayout(bottomLayout);
@@ -104,6 +113,7 @@ FileOutputWidget::FileOutputWidget(QSharedPointer<OutputControl> configuration)
     connect(pathEditor_, SIGNAL(editingFinished()), this,
         SLOT(onPathEdited()), Qt::UniqueConnection);
     connect(browseButton, SIGNAL(clicked(bool)), this, SLOT(onBrowse()), Qt::UniqueConnection);
+    connect(incrementalBox_, SIGNAL(toggled(bool)), this, SLOT(onIncrementalToggled(bool)), Qt::UniqueConnection);
     connect(fileTable_, SIGNAL(itemChanged(QTableWidgetItem*)),
         this, SLOT(onItemChanged(QTableWidgetItem*)), Qt::UniqueConnection);
     connect(fileTable_, SIGNAL(itemSelectionChanged()),
@@ -202,6 +212,16 @@ void FileOutputWidget::onBrowse()
     }
 }
 
+//-----------------------------------------------------------------------------
+// Function: FileOutputWidget::onIncrementalToggled()
+//-----------------------------------------------------------------------------
+void FileOutputWidget::onIncrementalToggled(bool incremental)
+{
+    model_->setIncremental(incremental);
+
+    checkExistence();
+}
+
 //-----------------------------------------------------------------------------
 // Function: FileOutputWidget::onItemChanged()
 //-----------------------------------------------------------------------------
@@ -282,7 +302,14 @@ void FileOutputWidget::checkExistence()
     if (existingFiles)
     {
         // Warn user if it already exists
-        generalWarningLabel_->setText(WARNING_FILE_EXISTS);
+        if (model_->isIncremental())
+        {
+            generalWarningLabel_->setText(WARNING_CHANGED_FILE_EXISTS);
+        }
+        else
+        {
+            generalWarningLabel_->setText(WARNING_FILE_EXISTS);
+        }
     }
     else
     {
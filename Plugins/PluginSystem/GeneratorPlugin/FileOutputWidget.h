@@ -12,6 +12,7 @@
 #ifndef FILEOUTPUTWIDGET_H
 #define FILEOUTPUTWIDGET_H
 
+#include <QCheckBox>
 #include <QLineEdit>
 #include <QLabel>
 #include <QTableWidget>
@@ -58,6 +59,9 @@ private slots:
     // Received when user click the browse button. Opens a dialog and updates the changes to the path editor.
     void onBrowse();
 
+    // Received when user toggles the incremental output. Will tell to model and update the warnings.
+    void onIncrementalToggled(bool incremental);
+
     // Received when user makes a change to the table.
     void onItemChanged(QTableWidgetItem *item);
 
@@ -84,6 +88,9 @@ private:
     //! Editor for the path of the generated file.
     QLineEdit* pathEditor_;
 
+    //! Selects whether only the changed files are written.
+    QCheckBox* incrementalBox_;
+
     //! Warning is display here, namely for an existing file being overwritten.
     QLabel* generalWarningLabel_;
 
@@ -22,6 +22,75 @@
 #include <QFileInfo>
 #include <QRegularExpression>
 #include <QDateTime>
+#include <QRunnable>
+#include <QThreadPool>
+#include <QVector>
+
+namespace
+{
+    //-----------------------------------------------------------------------------
+    //! Renders the content of one output in a background thread.
+    //-----------------------------------------------------------------------------
+    class RenderTask : public QRunnable
+    {
+    public:
+
+        RenderTask(QSharedPointer<GenerationOutput> output, QString const& outputDirectory):
+        QRunnable(),
+            output_(output),
+            outputDirectory_(outputDirectory)
+        {
+
+        }
+
+        void run() override
+        {
+            output_->write(outputDirectory_);
+        }
+
+    private:
+
+        //! The output to render.
+        QSharedPointer<GenerationOutput> output_;
+
+        //! The directory of the output files.
+        QString outputDirectory_;
+    };
+
+    //-----------------------------------------------------------------------------
+    //! Renders and writes one streamed output in a background thread.
+    //-----------------------------------------------------------------------------
+    class StreamTask : public QRunnable
+    {
+    public:
+
+        StreamTask(OutputControl const* outputControl, QSharedPointer<GenerationOutput> output,
+            OutputControl::WriteResult& result):
+        QRunnable(),
+            outputControl_(outputControl),
+            output_(output),
+            result_(result)
+        {
+
+        }
+
+        void run() override
+        {
+            result_ = outputControl_->writeOutput(output_);
+        }
+
+    private:
+
+        //! The output control writing the output.
+        OutputControl const* outputControl_;
+
+        //! The output to write.
+        QSharedPointer<GenerationOutput> output_;
+
+        //! The result of writing the output.
+        OutputControl::WriteResult& result_;
+    };
+}
 
 //-----------------------------------------------------------------------------
 // Function: GenerationControl::GenerationControl()
@@ -99,28 +168,55 @@ bool GenerationControl::writeDocuments()
     QString componentPath = library_->getPath(input_.component->getVlnv());
 
     bool fails = false;
+    int changedFiles = 0;
+    int unchangedFiles = 0;
+
+    QList<QSharedPointer<GenerationOutput> > outputs = *outputControl_->getOutputs();
+    QVector<OutputControl::WriteResult> results(outputs.size(), OutputControl::WRITE_FAILED);
+
+    // Streamed outputs are rendered only when written, so they are written concurrently to keep rendering
+    // them in parallel. The results are handled in the order of the outputs.
+    if (outputControl_->isStreaming() && outputs.size() > 1)
+    {
+        QThreadPool threadPool;
+        for (int i = 0; i < outputs.size(); ++i)
+        {
+            threadPool.start(new StreamTask(outputControl_.data(), outputs.at(i), results[i]));
+        }
+
+        threadPool.waitForDone();
+    }
+    else
+    {
+        for (int i = 0; i < outputs.size(); ++i)
+        {
+            results[i] = outputControl_->writeOutput(outputs.at(i));
+        }
+    }
 
     // Go through each potential file.
-    foreach(QSharedPointer<GenerationOutput> output, *outputControl_->getOutputs())
+    for (int i = 0; i < outputs.size(); ++i)
     {
+        QSharedPointer<GenerationOutput> output = outputs.at(i);
+
         // Form the path from the determined output path plus determined file name.
         QString absFilePath = outputControl_->getOutputPath() + "/" + output->fileName_;
 
-        // Try to open the file.
-        QFile outputFile(absFilePath); 
-        if (!outputFile.open(QIODevice::WriteOnly))
+        OutputControl::WriteResult result = results.at(i);
+        if (result == OutputControl::WRITE_FAILED)
         {
             input_.messages->showError(QObject::tr("Could not open output file for writing: %1").arg(absFilePath));
             fails = true;
             continue;
         }
-
-        // Put the content to the file and close it.
-        QTextStream outputStream(&outputFile);
-
-        outputStream << output->fileContent_;
-
-        outputFile.close();
+        else if (result == OutputControl::WRITE_UNCHANGED)
+        {
+            unchangedFiles++;
+        }
+        else
+        {
+            changedFiles++;
+        }
 
         if (viewSelection_->getSaveToFileset())
         {
@@ -135,6 +231,31 @@ bool GenerationControl::writeDocuments()
         }
     }
 
+    if (outputControl_->isIncremental())
+    {
+        QString generationId = input_.component->getVlnv().toString();
+        if (viewSelection_->getView())
+        {
+            generationId.append(QLatin1Char(' ') + viewSelection_->getView()->name());
+        }
+
+        QStringList removedFiles;
+        if (!outputControl_->removeStaleOutputs(generationId, removedFiles))
+        {
+            input_.messages->showError(QObject::tr("Could not update the list of generated files in %1.").arg(
+                outputControl_->getOutputPath()));
+            fails = true;
+        }
+
+        foreach (QString const& removedFile, removedFiles)
+        {
+            input_.messages->showMessage(QObject::tr("Removed outdated output file %1.").arg(removedFile));
+        }
+
+        input_.messages->showMessage(QObject::tr("Output files: %1 changed, %2 unchanged, %3 removed.").arg(
+            QString::number(changedFiles), QString::number(unchangedFiles), QString::number(removedFiles.size())));
+    }
+
     // Return false if something fails.
     return !fails && saveChanges();
 }
@@ -207,13 +328,19 @@ void GenerationControl::parseDocuments()
         }
 
         // Write outputs.
-        input_.messages->showMessage(QObject::tr("Writing content for preview %1.").
-            arg(QDateTime::currentDateTime().toString(Qt::LocalDate)));
+        if (!outputControl_->isStreaming())
+        {
+            input_.messages->showMessage(QObject::tr("Writing content for preview %1.").
+                arg(QDateTime::currentDateTime().toString(Qt::LocalDate)));
+        }
 
         // Pass the topmost design.
         QList<QSharedPointer<GenerationOutput> > documents = factory_->prepareDesign(designs);
 
-        // Go through the parsed designs.
+        // Go through the parsed designs. The documents are independent, so their contents are rendered
+        // concurrently, but they are proposed in the order of the designs. Streamed outputs are rendered
+        // concurrently when they are written.
+        QThreadPool threadPool;
         foreach(QSharedPointer<GenerationOutput> output, documents)
         {
             if (!output)
@@ -221,12 +348,20 @@ void GenerationControl::parseDocuments()
                 continue;
             }
 
-            // Write the contents to a file.
-            output->write(outputControl_->getOutputPath());
+            if (documents.size() > 1 && !outputControl_->isStreaming())
+            {
+                threadPool.start(new RenderTask(output, outputControl_->getOutputPath()));
+            }
+            else if (!outputControl_->isStreaming())
+            {
+                output->write(outputControl_->getOutputPath());
+            }
 
             // Append to the list of proposed outputs.
             outputControl_->getOutputs()->append(output);
         }
+
+        threadPool.waitForDone();
     }
     else
     {
@@ -248,9 +383,12 @@ void GenerationControl::parseDocuments()
         }
 
         // Write outputs.
-        input_.messages->showMessage(QObject::tr("Writing content for preview %1.").
-            arg(QDateTime::currentDateTime().toString(Qt::LocalDate)));
-        output->write(outputControl_->getOutputPath());
+        if (!outputControl_->isStreaming())
+        {
+            input_.messages->showMessage(QObject::tr("Writing content for preview %1.").
+                arg(QDateTime::currentDateTime().toString(Qt::LocalDate)));
+            output->write(outputControl_->getOutputPath());
+        }
 
         // Append to the list of proposed outputs.
         outputControl_->getOutputs()->append(output);
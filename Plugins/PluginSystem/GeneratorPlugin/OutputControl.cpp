@@ -16,11 +16,131 @@
 #include <IPXACTmodels/Component/FileSet.h>
 
 #include <QDir>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSaveFile>
+#include <QSet>
+#include <QTextStream>
+
+namespace
+{
+    //! The file listing the outputs of the incremental generation runs in an output directory.
+    const QString MANIFEST_FILE = QStringLiteral(".kactus2_outputs.json");
+
+    //-----------------------------------------------------------------------------
+    //! Passes the written content into a file and compares its stable content line by line with a
+    //! previously written file, so neither content is held in memory.
+    //-----------------------------------------------------------------------------
+    class StableContentComparator : public QIODevice
+    {
+    public:
+
+        StableContentComparator(QSharedPointer<GenerationOutput> output, QIODevice& target,
+            QIODevice* existingFile):
+        QIODevice(),
+            output_(output),
+            target_(target),
+            existingStream_(),
+            pendingLine_(),
+            sameContent_(existingFile != nullptr)
+        {
+            if (existingFile)
+            {
+                existingStream_.setDevice(existingFile);
+                existingStream_.setCodec("UTF-8");
+            }
+        }
+
+        bool isSameContent()
+        {
+            // The last line may lack the line end.
+            if (sameContent_ && !pendingLine_.isEmpty())
+            {
+                compareLine(pendingLine_);
+                pendingLine_.clear();
+            }
+
+            return sameContent_ && existingStream_.atEnd();
+        }
+
+    protected:
+
+        qint64 readData(char* /*data*/, qint64 /*maxSize*/) override
+        {
+            return -1;
+        }
+
+        qint64 writeData(const char* data, qint64 length) override
+        {
+            if (target_.write(data, length) != length)
+            {
+                return -1;
+            }
+
+            if (sameContent_)
+            {
+                pendingLine_.append(data, length);
+
+                int lineEnd = pendingLine_.indexOf('\n');
+                int lineStart = 0;
+                while (lineEnd != -1 && sameContent_)
+                {
+                    compareLine(pendingLine_.mid(lineStart, lineEnd - lineStart));
+                    lineStart = lineEnd + 1;
+                    lineEnd = pendingLine_.indexOf('\n', lineStart);
+                }
+
+                pendingLine_.remove(0, lineStart);
+            }
+
+            return length;
+        }
+
+    private:
+
+        void compareLine(QByteArray line)
+        {
+            if (line.endsWith('\r'))
+            {
+                line.chop(1);
+            }
+
+            if (existingStream_.atEnd())
+            {
+                sameContent_ = false;
+                return;
+            }
+
+            // The written content is encoded with the same codec the existing file is read with.
+            const QString writtenLine = QString::fromUtf8(line) + QLatin1Char('\n');
+            const QString existingLine = existingStream_.readLine() + QLatin1Char('\n');
+
+            sameContent_ = output_->stableContent(writtenLine) == output_->stableContent(existingLine);
+        }
+
+        //! The output defining the stable content.
+        QSharedPointer<GenerationOutput> output_;
+
+        //! The device the content is written into.
+        QIODevice& target_;
+
+        //! The stream reading the previously written file.
+        QTextStream existingStream_;
+
+        //! The written content after the last compared line.
+        QByteArray pendingLine_;
+
+        //! Flag for indicating that the content written so far matches the previous file.
+        bool sameContent_;
+    };
+}
 
 //-----------------------------------------------------------------------------
 // Function: OutputControl::OutputControl()
 //-----------------------------------------------------------------------------
-OutputControl::OutputControl() : outputPath_(), outputs_(new QList<QSharedPointer<GenerationOutput> >)
+OutputControl::OutputControl() : outputPath_(), incremental_(false), streaming_(false),
+    outputs_(new QList<QSharedPointer<GenerationOutput> >)
 {
 }
 
@@ -86,6 +206,207 @@ QString OutputControl::getOutputPath() const
     return outputPath_;
 }
 
+//-----------------------------------------------------------------------------
+// Function: OutputControl::setIncremental()
+//-----------------------------------------------------------------------------
+void OutputControl::setIncremental(bool incremental)
+{
+    incremental_ = incremental;
+}
+
+//-----------------------------------------------------------------------------
+// Function: OutputControl::isIncremental()
+//-----------------------------------------------------------------------------
+bool OutputControl::isIncremental() const
+{
+    return incremental_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: OutputControl::setStreaming()
+//-----------------------------------------------------------------------------
+void OutputControl::setStreaming(bool streaming)
+{
+    streaming_ = streaming;
+}
+
+//-----------------------------------------------------------------------------
+// Function: OutputControl::isStreaming()
+//-----------------------------------------------------------------------------
+bool OutputControl::isStreaming() const
+{
+    return streaming_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: OutputControl::writeOutput()
+//-----------------------------------------------------------------------------
+OutputControl::WriteResult OutputControl::writeOutput(QSharedPointer<GenerationOutput> output) const
+{
+    QString filePath = outputPath_ + QLatin1Char('/') + output->fileName_;
+
+    if (streaming_)
+    {
+        return streamOutput(output, filePath);
+    }
+
+    // Rewriting an unchanged file would only update its timestamp and trigger rebuilds of its dependents.
+    if (incremental_)
+    {
+        QFile existingFile(filePath);
+        if (existingFile.open(QIODevice::ReadOnly))
+        {
+            QTextStream inputStream(&existingFile);
+            inputStream.setCodec("UTF-8");
+            if (output->stableContent(inputStream.readAll()) == output->stableContent(output->fileContent_))
+            {
+                return WRITE_UNCHANGED;
+            }
+        }
+    }
+
+    QFile outputFile(filePath);
+    if (!outputFile.open(QIODevice::WriteOnly))
+    {
+        return WRITE_FAILED;
+    }
+
+    // The outputs are always written as UTF-8 to read them back the same regardless of the locale.
+    QTextStream outputStream(&outputFile);
+    outputStream.setCodec("UTF-8");
+    outputStream << output->fileContent_;
+    outputStream.flush();
+
+    if (outputStream.status() != QTextStream::Ok)
+    {
+        return WRITE_FAILED;
+    }
+
+    return WRITE_CHANGED;
+}
+
+//-----------------------------------------------------------------------------
+// Function: OutputControl::streamOutput()
+//-----------------------------------------------------------------------------
+OutputControl::WriteResult OutputControl::streamOutput(QSharedPointer<GenerationOutput> output,
+    QString const& filePath) const
+{
+    // The previous file stays intact until the new content has been completely written and committed.
+    QSaveFile outputFile(filePath);
+    if (!outputFile.open(QIODevice::WriteOnly))
+    {
+        return WRITE_FAILED;
+    }
+
+    QFile existingFile(filePath);
+    bool compareContent = incremental_ && existingFile.open(QIODevice::ReadOnly);
+
+    StableContentComparator comparator(output, outputFile, compareContent ? &existingFile : nullptr);
+    comparator.open(QIODevice::WriteOnly);
+
+    QTextStream outputStream(&comparator);
+    outputStream.setCodec("UTF-8");
+    output->writeStream(outputStream, outputPath_);
+    outputStream.flush();
+
+    if (outputStream.status() != QTextStream::Ok)
+    {
+        outputFile.cancelWriting();
+        return WRITE_FAILED;
+    }
+
+    // Rewriting an unchanged file would only update its timestamp and trigger rebuilds of its dependents.
+    if (compareContent && comparator.isSameContent())
+    {
+        outputFile.cancelWriting();
+        return WRITE_UNCHANGED;
+    }
+
+    // The previous file cannot be replaced while it is open on all platforms.
+    existingFile.close();
+
+    if (!outputFile.commit())
+    {
+        return WRITE_FAILED;
+    }
+
+    return WRITE_CHANGED;
+}
+
+//-----------------------------------------------------------------------------
+// Function: OutputControl::removeStaleOutputs()
+//-----------------------------------------------------------------------------
+bool OutputControl::removeStaleOutputs(QString const& generationId, QStringList& removedFiles) const
+{
+    QDir outputDirectory(outputPath_);
+    const QString manifestPath = outputDirectory.filePath(MANIFEST_FILE);
+
+    QJsonObject generations;
+
+    QFile manifestFile(manifestPath);
+    if (manifestFile.open(QIODevice::ReadOnly))
+    {
+        generations = QJsonDocument::fromJson(manifestFile.readAll()).object().value(
+            QStringLiteral("generations")).toObject();
+        manifestFile.close();
+    }
+
+    QStringList listedFiles;
+    for (QSharedPointer<GenerationOutput> const& output : *outputs_)
+    {
+        listedFiles.append(output->fileName_);
+    }
+
+    // Files listed by other generation runs into the same directory are never removed.
+    QSet<QString> otherFiles;
+    for (QJsonObject::const_iterator i = generations.constBegin(); i != generations.constEnd(); ++i)
+    {
+        if (i.key() != generationId)
+        {
+            for (QJsonValue const& fileName : i.value().toArray())
+            {
+                otherFiles.insert(fileName.toString());
+            }
+        }
+    }
+
+    const QString directoryPrefix = outputDirectory.absolutePath() + QLatin1Char('/');
+    for (QJsonValue const& previousFile : generations.value(generationId).toArray())
+    {
+        QString fileName = previousFile.toString();
+        if (fileName.isEmpty() || listedFiles.contains(fileName) || otherFiles.contains(fileName))
+        {
+            continue;
+        }
+
+        QString filePath = QDir::cleanPath(outputDirectory.absoluteFilePath(fileName));
+        if (filePath.startsWith(directoryPrefix) == false || QFile::exists(filePath) == false)
+        {
+            continue;
+        }
+
+        if (QFile::remove(filePath))
+        {
+            removedFiles.append(fileName);
+        }
+        else
+        {
+            // Keep the file listed, so that the removal is tried again on the next run.
+            listedFiles.append(fileName);
+        }
+    }
+
+    generations.insert(generationId, QJsonArray::fromStringList(listedFiles));
+
+    QJsonObject manifest;
+    manifest.insert(QStringLiteral("generations"), generations);
+
+    QSaveFile saveFile(manifestPath);
+    return saveFile.open(QIODevice::WriteOnly) &&
+        saveFile.write(QJsonDocument(manifest).toJson()) != -1 &&
+        saveFile.commit();
+}
+
 //-----------------------------------------------------------------------------
 // Function: OutputControl::getFileNames()
 //-----------------------------------------------------------------------------
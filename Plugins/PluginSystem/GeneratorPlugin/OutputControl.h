@@ -13,8 +13,10 @@
 #define OUTPUTCONTROL_H
 
 #include <QString>
+#include <QStringList>
 #include <QMap>
 #include <QSharedPointer>
+#include <QTextStream>
 
 #include "ViewSelection.h"
 
@@ -35,6 +37,28 @@ struct GenerationOutput
      *  Writes the content.
      */
 	virtual void write(QString const& outputDirectory) = 0;
+
+    /*!
+     *  Writes the content directly into a stream. The default implementation renders the content into
+     *  fileContent_ first, so outputs able to write their content piecewise should override this.
+     *
+     *      @param [in] outputStream        The stream to write into.
+     *      @param [in] outputDirectory     The directory of the output file.
+     */
+    virtual void writeStream(QTextStream& outputStream, QString const& outputDirectory)
+    {
+        write(outputDirectory);
+        outputStream << fileContent_;
+    }
+
+    /*!
+     *  Gets the part of the given content that stays the same between generation runs with the same input.
+     *
+     *      @param [in] content     The content of the output or of a previously written file.
+     *
+     *      @return The content without e.g. generation timestamps.
+     */
+    virtual QString stableContent(QString const& content) const { return content; }
     
     /*!
      *  Finds position for body text highlight in document, if any exists.
@@ -52,6 +76,14 @@ class OutputControl
 {
 public:
 
+    //! The result of writing a single output file.
+    enum WriteResult
+    {
+        WRITE_FAILED = 0,   //!< The file could not be written.
+        WRITE_CHANGED,      //!< The file was written with new content.
+        WRITE_UNCHANGED     //!< The file already had the same content and was not written.
+    };
+
 	//! The constructor.
     OutputControl();
 
@@ -78,6 +110,56 @@ public:
      *      @return The path to output file.
      */
     QString getOutputPath() const;
+
+    /*!
+     *  Sets the incremental output mode. In the incremental mode, only the changed files are written and
+     *  the files generated by a previous run but not by the current one are removed.
+     *
+     *      @param [in] incremental     If true, the output is incremental.
+     */
+    void setIncremental(bool incremental);
+
+    /*!
+     *  Checks if the output is incremental.
+     *
+     *      @return True, if only the changed files are written, otherwise false.
+     */
+    bool isIncremental() const;
+
+    /*!
+     *  Sets the streaming output mode. In the streaming mode, the outputs are not rendered for preview, but
+     *  written piecewise directly into their files when written.
+     *
+     *      @param [in] streaming       If true, the outputs are streamed into their files.
+     */
+    void setStreaming(bool streaming);
+
+    /*!
+     *  Checks if the outputs are streamed into their files.
+     *
+     *      @return True, if the outputs are streamed, otherwise false.
+     */
+    bool isStreaming() const;
+
+    /*!
+     *  Writes an output into its file in the output path.
+     *
+     *      @param [in] output  The output to write.
+     *
+     *      @return The result of writing.
+     */
+    WriteResult writeOutput(QSharedPointer<GenerationOutput> output) const;
+
+    /*!
+     *  Removes the files generated by a previous incremental run that are not generated by this run and
+     *  updates the manifest of generated files in the output path.
+     *
+     *      @param [in] generationId    Identifies the generation run, e.g. by the top component and view.
+     *      @param [out] removedFiles   The names of the removed files.
+     *
+     *      @return True, if the manifest could be updated, otherwise false.
+     */
+    bool removeStaleOutputs(QString const& generationId, QStringList& removedFiles) const;
     
     /*!
      *  Gets reference to the output file paths.
@@ -100,8 +182,23 @@ private:
 	OutputControl(OutputControl const& rhs);
 	OutputControl& operator=(OutputControl const& rhs);
 
+    /*!
+     *  Streams an output into its file. The file is replaced only after the output has been completely
+     *  written and, in the incremental mode, found to differ from the previous file.
+     *
+     *      @param [in] output      The output to write.
+     *      @param [in] filePath    The path of the output file.
+     *
+     *      @return The result of writing.
+     */
+    WriteResult streamOutput(QSharedPointer<GenerationOutput> output, QString const& filePath) const;
+
     //! The base directory for output paths.
     QString outputPath_;
+    //! If true, only the changed files are written and stale files are removed.
+    bool incremental_;
+    //! If true, the outputs are streamed directly into their files.
+    bool streaming_;
     //! The directory of the component which may refer to the files.
     QString componentPath_;
     //! The potential new files.
@@ -0,0 +1,36 @@
+//-----------------------------------------------------------------------------
+// File: ParallelImportSupport.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: Kactus2 team
+// Date: 19.10.2026
+//
+// Description:
+// Interface for import plugins able to run several imports at the same time.
+//-----------------------------------------------------------------------------
+
+#ifndef PARALLELIMPORTSUPPORT_H
+#define PARALLELIMPORTSUPPORT_H
+
+class ImportPlugin;
+
+//-----------------------------------------------------------------------------
+//! Interface for import plugins able to run several imports at the same time.
+//-----------------------------------------------------------------------------
+class ParallelImportSupport
+{
+public:
+
+    //! The destructor.
+    virtual ~ParallelImportSupport() {};
+
+    /*!
+     *  Creates a new importer with its own parsing state. The created importers can run their imports in
+     *  separate threads at the same time.
+     *
+     *      @return The created importer. The caller takes the ownership of the importer.
+     */
+    virtual ImportPlugin* createImporter() const = 0;
+};
+
+#endif // PARALLELIMPORTSUPPORT_H
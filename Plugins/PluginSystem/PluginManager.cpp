@@ -11,14 +11,70 @@
 
 #include "PluginManager.h"
 
+#include "CommandLineSupport.h"
 #include "IPlugin.h"
 
 #include <IPXACTmodels/utilities/XmlUtils.h>
 
+#include <common/Profiler.h>
+
 #include <QCoreApplication>
+#include <QDateTime>
 #include <QDir>
+#include <QJsonObject>
+#include <QMap>
 #include <QPluginLoader>
+#include <QRunnable>
+#include <QThreadPool>
+
+namespace
+{
+    //! The metadata of a file in the plugin paths.
+    struct PluginFileInfo
+    {
+        //! The absolute path of the file.
+        QString filePath;
+
+        //! The size of the file when the metadata was read.
+        qint64 size = 0;
+
+        //! The modification time of the file when the metadata was read.
+        qint64 lastModified = 0;
+
+        //! Flag for indicating that the metadata must be read from the file.
+        bool readRequired = true;
+
+        //! Flag for indicating that the file is a plugin.
+        bool isPlugin = false;
+
+        //! The command of the plugin given in the plugin metadata.
+        QString command;
+    };
+
+    //-----------------------------------------------------------------------------
+    //! Reads the metadata of a file without loading the plugin.
+    //-----------------------------------------------------------------------------
+    class MetaDataTask : public QRunnable
+    {
+    public:
+
+        explicit MetaDataTask(PluginFileInfo* info): QRunnable(), info_(info) {}
+
+        virtual void run() override
+        {
+            QJsonObject metaData = QPluginLoader(info_->filePath).metaData();
+
+            info_->isPlugin = !metaData.isEmpty();
+            info_->command = metaData.value(QStringLiteral("MetaData")).toObject().value(
+                QStringLiteral("Command")).toString();
+        }
 
+    private:
+
+        //! The file whose metadata is read.
+        PluginFileInfo* info_;
+    };
+}
 
 //-----------------------------------------------------------------------------
 // Function: PluginManager::addPlugin()
@@ -33,6 +89,11 @@ void PluginManager::addPlugin(IPlugin* plugin)
 //-----------------------------------------------------------------------------
 QList<IPlugin*> PluginManager::getAllPlugins() const
 {
+    for (PluginRecord& record : records_)
+    {
+        loadRecord(record);
+    }
+
     return plugins_;
 }
 
@@ -44,7 +105,7 @@ QList<IPlugin*> PluginManager::getActivePlugins() const
     QSettings settings;
     QList<IPlugin*> activePlugins;
 
-    foreach (IPlugin* plugin, plugins_)
+    foreach (IPlugin* plugin, getAllPlugins())
     {
         if (settings.value(QStringLiteral("PluginSettings/") + XmlUtils::removeWhiteSpace(plugin->getName()) + 
             QStringLiteral("/Active"), true).toBool())
@@ -56,13 +117,84 @@ QList<IPlugin*> PluginManager::getActivePlugins() const
     return activePlugins;
 }
 
+//-----------------------------------------------------------------------------
+// Function: PluginManager::getCommands()
+//-----------------------------------------------------------------------------
+QStringList PluginManager::getCommands() const
+{
+    QStringList commands;
+
+    for (IPlugin* plugin : plugins_)
+    {
+        CommandLineSupport* support = dynamic_cast<CommandLineSupport*>(plugin);
+        if (support && !commands.contains(support->getCommand()))
+        {
+            commands.append(support->getCommand());
+        }
+    }
+
+    for (PluginRecord const& record : records_)
+    {
+        if (!record.loaded && !record.command.isEmpty() && !commands.contains(record.command))
+        {
+            commands.append(record.command);
+        }
+    }
+
+    return commands;
+}
+
+//-----------------------------------------------------------------------------
+// Function: PluginManager::findCommandLinePlugin()
+//-----------------------------------------------------------------------------
+CommandLineSupport* PluginManager::findCommandLinePlugin(QString const& command) const
+{
+    for (PluginRecord& record : records_)
+    {
+        if (record.command == command)
+        {
+            loadRecord(record);
+        }
+    }
+
+    for (IPlugin* plugin : plugins_)
+    {
+        CommandLineSupport* support = dynamic_cast<CommandLineSupport*>(plugin);
+        if (support && support->getCommand().compare(command) == 0)
+        {
+            return support;
+        }
+    }
+
+    // Plugins without the command in their metadata are found only by loading them.
+    for (PluginRecord& record : records_)
+    {
+        if (!record.loaded && record.command.isEmpty())
+        {
+            const int loadedCount = plugins_.size();
+            loadRecord(record);
+
+            if (plugins_.size() > loadedCount)
+            {
+                CommandLineSupport* support = dynamic_cast<CommandLineSupport*>(plugins_.last());
+                if (support && support->getCommand().compare(command) == 0)
+                {
+                    return support;
+                }
+            }
+        }
+    }
+
+    return nullptr;
+}
+
 //-----------------------------------------------------------------------------
 // Function: PluginManager::setPluginPaths()
 //-----------------------------------------------------------------------------
 void PluginManager::setPluginPaths(QStringList const& pluginPaths)
 {
     plugins_.clear();
-    plugins_ = findPluginsInPaths(pluginPaths);
+    records_ = discoverPlugins(pluginPaths);
 }
 
 //-----------------------------------------------------------------------------
@@ -70,11 +202,48 @@ void PluginManager::setPluginPaths(QStringList const& pluginPaths)
 //-----------------------------------------------------------------------------
 QList<IPlugin*> PluginManager::findPluginsInPaths(QStringList const& pluginPaths)
 {
+    ProfilingScope profilingScope("PluginManager::findPluginsInPaths");
+
     QList<IPlugin*> plugins;
 
+    for (PluginRecord const& record : discoverPlugins(pluginPaths))
+    {
+        IPlugin* plugin = loadPlugin(record.filePath, plugins);
+        if (plugin != 0)
+        {
+            plugins.append(plugin);
+        }
+    }
+
+    return plugins;
+}
+
+//-----------------------------------------------------------------------------
+// Function: PluginManager::discoverPlugins()
+//-----------------------------------------------------------------------------
+QVector<PluginManager::PluginRecord> PluginManager::discoverPlugins(QStringList const& pluginPaths)
+{
+    ProfilingScope profilingScope("PluginManager::discoverPlugins");
+
     QSettings settings;
-    settings.beginGroup(QStringLiteral("PluginSettings"));
 
+    QMap<QString, PluginFileInfo> cachedFiles;
+    const int cacheSize = settings.beginReadArray(QStringLiteral("PluginCache"));
+    for (int i = 0; i < cacheSize; ++i)
+    {
+        settings.setArrayIndex(i);
+
+        PluginFileInfo cached;
+        cached.filePath = settings.value(QStringLiteral("Path")).toString();
+        cached.size = settings.value(QStringLiteral("Size")).toLongLong();
+        cached.lastModified = settings.value(QStringLiteral("Modified")).toLongLong();
+        cached.isPlugin = settings.value(QStringLiteral("IsPlugin")).toBool();
+        cached.command = settings.value(QStringLiteral("Command")).toString();
+        cachedFiles.insert(cached.filePath, cached);
+    }
+    settings.endArray();
+
+    QVector<PluginFileInfo> files;
     foreach (QString const& dirName, pluginPaths)
     {
         QDir pluginDirectory(dirName);
@@ -85,26 +254,116 @@ QList<IPlugin*> PluginManager::findPluginsInPaths(QStringList const& pluginPaths
 
         foreach (QFileInfo const& fileInfo, pluginDirectory.entryInfoList(QDir::Files))
         {
-            QPluginLoader loader(fileInfo.absoluteFilePath());
-            IPlugin* plugin = qobject_cast<IPlugin*>(loader.instance());
+            PluginFileInfo file;
+            file.filePath = fileInfo.absoluteFilePath();
+            file.size = fileInfo.size();
+            file.lastModified = fileInfo.lastModified().toMSecsSinceEpoch();
 
-            if (plugin != 0 && isUnique(plugin, plugins))
+            QMap<QString, PluginFileInfo>::const_iterator cached = cachedFiles.constFind(file.filePath);
+            if (cached != cachedFiles.constEnd() && cached->size == file.size &&
+                cached->lastModified == file.lastModified)
             {
-                plugins.append(plugin);
-
-                settings.beginGroup(XmlUtils::removeWhiteSpace(plugin->getName()));
-                if (plugin->getSettingsModel())
-                {
-                    plugin->getSettingsModel()->loadSettings(settings);
-                }
-                settings.endGroup();
+                file.readRequired = false;
+                file.isPlugin = cached->isPlugin;
+                file.command = cached->command;
             }
+
+            files.append(file);
         }
     }
 
-    settings.endGroup();
+    bool cacheChanged = files.size() != cacheSize;
 
-    return plugins;
+    // The files are not appended after this, so the tasks can refer to them.
+    QThreadPool threadPool;
+    for (PluginFileInfo& file : files)
+    {
+        if (file.readRequired)
+        {
+            threadPool.start(new MetaDataTask(&file));
+            cacheChanged = true;
+        }
+    }
+    threadPool.waitForDone();
+
+    if (cacheChanged)
+    {
+        settings.beginWriteArray(QStringLiteral("PluginCache"), files.size());
+        for (int i = 0; i < files.size(); ++i)
+        {
+            PluginFileInfo const& file = files.at(i);
+
+            settings.setArrayIndex(i);
+            settings.setValue(QStringLiteral("Path"), file.filePath);
+            settings.setValue(QStringLiteral("Size"), file.size);
+            settings.setValue(QStringLiteral("Modified"), file.lastModified);
+            settings.setValue(QStringLiteral("IsPlugin"), file.isPlugin);
+            settings.setValue(QStringLiteral("Command"), file.command);
+        }
+        settings.endArray();
+    }
+
+    QVector<PluginRecord> records;
+    for (PluginFileInfo const& file : files)
+    {
+        if (file.isPlugin)
+        {
+            PluginRecord record;
+            record.filePath = file.filePath;
+            record.command = file.command;
+            records.append(record);
+        }
+    }
+
+    return records;
+}
+
+//-----------------------------------------------------------------------------
+// Function: PluginManager::loadPlugin()
+//-----------------------------------------------------------------------------
+IPlugin* PluginManager::loadPlugin(QString const& filePath, QList<IPlugin*> const& knownPlugins)
+{
+    ProfilingScope profilingScope("PluginManager::loadPlugin");
+    Profiler::getInstance().addCount("Plugins loaded");
+
+    QPluginLoader loader(filePath);
+    IPlugin* plugin = qobject_cast<IPlugin*>(loader.instance());
+
+    if (plugin == 0 || !isUnique(plugin, knownPlugins))
+    {
+        return 0;
+    }
+
+    if (plugin->getSettingsModel())
+    {
+        QSettings settings;
+        settings.beginGroup(QStringLiteral("PluginSettings"));
+        settings.beginGroup(XmlUtils::removeWhiteSpace(plugin->getName()));
+        plugin->getSettingsModel()->loadSettings(settings);
+        settings.endGroup();
+        settings.endGroup();
+    }
+
+    return plugin;
+}
+
+//-----------------------------------------------------------------------------
+// Function: PluginManager::loadRecord()
+//-----------------------------------------------------------------------------
+void PluginManager::loadRecord(PluginRecord& record) const
+{
+    if (record.loaded)
+    {
+        return;
+    }
+
+    record.loaded = true;
+
+    IPlugin* plugin = loadPlugin(record.filePath, plugins_);
+    if (plugin != 0)
+    {
+        plugins_.append(plugin);
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -136,7 +395,7 @@ PluginManager& PluginManager::getInstance()
 //-----------------------------------------------------------------------------
 // Function: PluginManager::PluginManager()
 //-----------------------------------------------------------------------------
-PluginManager::PluginManager(): plugins_()
+PluginManager::PluginManager(): records_(), plugins_()
 {
     
 }
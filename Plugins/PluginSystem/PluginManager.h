@@ -13,13 +13,19 @@
 #define PLUGINMANAGER_H
 
 #include <QString>
+#include <QStringList>
 #include <QList>
 #include <QObject>
+#include <QVector>
 
+class CommandLineSupport;
 class IPlugin;
 
 //-----------------------------------------------------------------------------
 //! Plugin manager which manages loaded plugins.
+//!
+//! The plugins in the plugin paths are discovered from their metadata without loading them. The metadata of
+//! each plugin file is cached until the file changes. A plugin is loaded when it is first used.
 //-----------------------------------------------------------------------------
 class PluginManager
 {
@@ -36,17 +42,33 @@ public:
     void addPlugin(IPlugin* plugin);
 
     /*!
-     *  returns the list of active plugins.
+     *  returns the list of active plugins. The plugins are loaded, if needed.
      */
     QList<IPlugin*> getActivePlugins() const;
 
     /*!
-     *  Returns the list of all loaded plugins.
+     *  Returns the list of all plugins. The plugins are loaded, if needed.
      */
     QList<IPlugin*> getAllPlugins() const;
 
     /*!
-     *  Loads the plugins from given paths.
+     *  Get the commands of the plugins supporting the command line without loading the plugins.
+     *
+     *      @return The available commands.
+     */
+    QStringList getCommands() const;
+
+    /*!
+     *  Find the plugin running the given command. Only the plugin running the command is loaded.
+     *
+     *      @param [in] command     The command to run.
+     *
+     *      @return The plugin running the command, or null if no plugin supports the command.
+     */
+    CommandLineSupport* findCommandLinePlugin(QString const& command) const;
+
+    /*!
+     *  Discovers the plugins in the given paths. The plugins are loaded when they are first used.
      *
      *      @param [in] pluginPaths   The paths containing the plugins.
      */
@@ -75,15 +97,59 @@ private:
      
     //! The constructor. Private to enforce the use of getInstance() to get access.
     PluginManager();
-    
+
+    //! A plugin file discovered in the plugin paths.
+    struct PluginRecord
+    {
+        //! The absolute path of the plugin file.
+        QString filePath;
+
+        //! The command of the plugin given in the plugin metadata, if the plugin supports the command line.
+        QString command;
+
+        //! Flag for indicating that loading the plugin has been attempted.
+        bool loaded = false;
+    };
+
+    /*!
+     *  Discover the plugin files in the given paths using the plugin metadata.
+     *
+     *  The metadata of the files not found in the metadata cache is read in parallel.
+     *
+     *      @param [in] pluginPaths   Paths to directories to search for plugins.
+     *
+     *      @return The discovered plugin files.
+     */
+    static QVector<PluginRecord> discoverPlugins(QStringList const& pluginPaths);
+
+    /*!
+     *  Load a plugin and its settings.
+     *
+     *      @param [in] filePath        The path of the plugin file.
+     *      @param [in] knownPlugins    The plugins already loaded.
+     *
+     *      @return The loaded plugin, or null if the file could not be loaded or the plugin is already known.
+     */
+    static IPlugin* loadPlugin(QString const& filePath, QList<IPlugin*> const& knownPlugins);
+
+    /*!
+     *  Load a discovered plugin, unless it has already been loaded.
+     *
+     *      @param [in] record  The discovered plugin file.
+     */
+    void loadRecord(PluginRecord& record) const;
+
     static bool isUnique(IPlugin* plugin, QList<IPlugin*> const& plugins);
 
     //-----------------------------------------------------------------------------
     // Data.
     //-----------------------------------------------------------------------------
     
+    //! The plugin files discovered in the plugin paths.
+    mutable QVector<PluginRecord> records_;
+
     //! The list of loaded plugins.
-    QList<IPlugin*> plugins_;
+    mutable QList<IPlugin*> plugins_;
 };
 
 //-----------------------------------------------------------------------------
@@ -54,13 +54,73 @@
 #include <QFileInfo>
 #include <QTime>
 #include <QDate>
+#include <QRunnable>
 #include <QSettings>
+#include <QThreadPool>
+#include <QVector>
 
 static const QString BLACK_BOX_DECL_START = "-- ##KACTUS2_BLACK_BOX_DECLARATIONS_BEGIN##";
 static const QString BLACK_BOX_DECL_END = "-- ##KACTUS2_BLACK_BOX_DECLARATIONS_END##";
 static const QString BLACK_BOX_ASSIGN_START = "-- ##KACTUS2_BLACK_BOX_ASSIGNMENTS_BEGIN##";
 static const QString BLACK_BOX_ASSIGN_END = "-- ##KACTUS2_BLACK_BOX_ASSIGNMENTS_END##";
 
+namespace
+{
+    //-----------------------------------------------------------------------------
+    //! Renders one VHDL element into a string in a background thread.
+    //-----------------------------------------------------------------------------
+    template <class Element>
+    class RenderTask : public QRunnable
+    {
+    public:
+
+        RenderTask(QSharedPointer<Element> element, QString& result):
+        QRunnable(),
+        element_(element),
+        result_(result)
+        {
+
+        }
+
+        void run() override
+        {
+            QTextStream stream(&result_);
+            element_->write(stream);
+            stream << endl;
+        }
+
+    private:
+
+        //! The element to render.
+        QSharedPointer<Element> element_;
+
+        //! The rendered element.
+        QString& result_;
+    };
+
+    //-----------------------------------------------------------------------------
+    //! Renders the given elements in parallel and writes them to the stream in the given order.
+    //-----------------------------------------------------------------------------
+    template <class Element>
+    void writeInParallel(QList<QSharedPointer<Element> > const& elements, QTextStream& vhdlStream)
+    {
+        // The results are stored by index, so the output does not depend on the rendering order.
+        QVector<QString> results(elements.size());
+
+        QThreadPool threadPool;
+        for (int i = 0; i < elements.size(); ++i)
+        {
+            threadPool.start(new RenderTask<Element>(elements.at(i), results[i]));
+        }
+        threadPool.waitForDone();
+
+        for (QString const& result : results)
+        {
+            vhdlStream << result;
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: vhdlgenerator2::VhdlGenerator2()
 //-----------------------------------------------------------------------------
@@ -1412,11 +1472,8 @@ void VhdlGenerator2::writeSignalDeclarations( QTextStream& vhdlStream )
 //-----------------------------------------------------------------------------
 void VhdlGenerator2::writeComponentDeclarations( QTextStream& vhdlStream )
 {
-	foreach (QSharedPointer<VhdlComponentDeclaration> comp, components_)
-    {
-		comp->write(vhdlStream);
-		vhdlStream << endl;
-	}
+    // Each declaration has its own expression parser, so the declarations can be rendered concurrently.
+    writeInParallel(components_.values(), vhdlStream);
 }
 
 //-----------------------------------------------------------------------------
@@ -1424,11 +1481,8 @@ void VhdlGenerator2::writeComponentDeclarations( QTextStream& vhdlStream )
 //-----------------------------------------------------------------------------
 void VhdlGenerator2::writeComponentInstances( QTextStream& vhdlStream )
 {
-	foreach (QSharedPointer<VhdlComponentInstance> instance, instances_)
-    {
-		instance->write(vhdlStream);
-		vhdlStream << endl;
-	}
+    // The instances only write the names and mappings resolved in the parsing.
+    writeInParallel(instances_.values(), vhdlStream);
 }
 
 //-----------------------------------------------------------------------------
@@ -294,14 +294,14 @@ private:
 	void writeSignalDeclarations( QTextStream& vhdlStream );
 	
 	/*!
-     *  Write the declarations of components.
+     *  Write the declarations of components. The declarations are rendered in parallel.
 	 *
 	 *      @param [in] vhdlStream  The text stream to write into.
 	 */
 	void writeComponentDeclarations( QTextStream& vhdlStream );
 	
 	/*!
-     *  Write the instances of components.
+     *  Write the instances of components. The instances are rendered in parallel.
 	 *
 	 *      @param [in] vhdlStream  The text stream to write into.
 	 */
@@ -191,6 +191,14 @@ QString VHDLimport::getComponentName(QString const& componentDeclaration) const
     return match.captured(1);
 }
 
+//-----------------------------------------------------------------------------
+// Function: VHDLimport::createImporter()
+//-----------------------------------------------------------------------------
+ImportPlugin* VHDLimport::createImporter() const
+{
+    return new VHDLimport();
+}
+
 //-----------------------------------------------------------------------------
 // Function: VHDLimport::setHighlighter()
 //-----------------------------------------------------------------------------
@@ -18,6 +18,7 @@
 #include <Plugins/PluginSystem/ImportPlugin/ImportPlugin.h>
 #include <Plugins/PluginSystem/ImportPlugin/HighlightSource.h>
 #include <Plugins/PluginSystem/ImportPlugin/ModelParameterSource.h>
+#include <Plugins/PluginSystem/ImportPlugin/ParallelImportSupport.h>
 
 #include "IPXACTmodels/Component/ComponentInstantiation.h"
 
@@ -39,7 +40,7 @@ class View;
 //! Class VHDLimport.
 //-----------------------------------------------------------------------------
 class VHDLIMPORT_EXPORT VHDLimport : public QObject, public ImportPlugin, public HighlightSource, 
-    public ModelParameterSource
+    public ModelParameterSource, public ParallelImportSupport
 {
     Q_OBJECT
     Q_PLUGIN_METADATA(IID "kactus2.plugins.vhdlimportplugin" FILE "vhdlimportplugin.json")
@@ -159,6 +160,13 @@ public:
      */
     virtual QString getComponentName(QString const& componentDeclaration) const override final;
 
+    /*!
+     *  Creates a new VHDL importer with its own parsing state.
+     *
+     *      @return The created importer. The caller takes the ownership of the importer.
+     */
+    virtual ImportPlugin* createImporter() const override final;
+
 private:
 
     //! No copying.
@@ -219,7 +219,8 @@ QString VerilogGeneratorPlugin::getCommand() const
 //-----------------------------------------------------------------------------
 void VerilogGeneratorPlugin::process(QStringList const& arguments, IPluginUtility* utility)
 {
-    HDLCommandLineParser parser(getCommand());
+    const bool incrementalOutput = true;
+    HDLCommandLineParser parser(getCommand(), incrementalOutput);
     HDLCommandLineParser::ParseResults parseResult = parser.parseArguments(arguments);
 
     if (parseResult.cancelRun)
@@ -267,6 +268,14 @@ void VerilogGeneratorPlugin::process(QStringList const& arguments, IPluginUtilit
     }
 
     MessagePasser messages;
+    connect(&messages, &MessagePasser::noticeMessage, [utility](QString const& message)
+    {
+        utility->printInfo(message);
+    });
+    connect(&messages, &MessagePasser::errorMessage, [utility](QString const& message)
+    {
+        utility->printError(message);
+    });
 
     GenerationTuple input;
     input.component = component;
@@ -282,6 +291,10 @@ void VerilogGeneratorPlugin::process(QStringList const& arguments, IPluginUtilit
     GenerationControl configuration(utility->getLibraryInterface(), &factory, input, &settings_);
     configuration.getOutputControl()->setOutputPath(parseResult.path);
     configuration.getViewSelection()->setSaveToFileset(false);
+    configuration.getOutputControl()->setIncremental(parseResult.incremental);
+
+    // There is no preview on the command line, so the files are written without keeping them in memory.
+    configuration.getOutputControl()->setStreaming(true);
 
     configuration.parseDocuments();
     if (configuration.writeDocuments())
@@ -12,6 +12,7 @@
 #include "VerilogDocument.h"
 
 #include <QDateTime>
+#include <QRegularExpression>
 #include <QTextStream>
 
 #include <Plugins/VerilogImport/VerilogSyntax.h>
@@ -26,10 +27,18 @@ VerilogDocument::VerilogDocument()
 //-----------------------------------------------------------------------------
 // Function: VerilogDocument::write()
 //-----------------------------------------------------------------------------
-void VerilogDocument::write(QString const& /*outputDirectory*/)
+void VerilogDocument::write(QString const& outputDirectory)
 {
     fileContent_.clear();
     QTextStream outputStream(&fileContent_);
+    writeStream(outputStream, outputDirectory);
+}
+
+//-----------------------------------------------------------------------------
+// Function: VerilogDocument::writeStream()
+//-----------------------------------------------------------------------------
+void VerilogDocument::writeStream(QTextStream& outputStream, QString const& /*outputDirectory*/)
+{
     headerWriter_->write(outputStream, fileName_, QDateTime::currentDateTime());
     topWriter_->write(outputStream);
 }
@@ -43,6 +52,19 @@ void VerilogDocument::getBodyHighlight(int& begin, int& end) const
     VerilogSyntax::findImplementation(fileContent_, begin, end, error);
 }
 
+//-----------------------------------------------------------------------------
+// Function: VerilogDocument::stableContent()
+//-----------------------------------------------------------------------------
+QString VerilogDocument::stableContent(QString const& content) const
+{
+    static const QRegularExpression timestampLine(QStringLiteral("^// Creation (date|time) : .*\\n"),
+        QRegularExpression::MultilineOption);
+
+    QString stable(content);
+    stable.remove(timestampLine);
+    return stable;
+}
+
 //-----------------------------------------------------------------------------
 // Function: VerilogDocument::selectImplementation()
 //-----------------------------------------------------------------------------
@@ -75,6 +75,14 @@ struct VerilogDocument : public GenerationOutput
      *      @param [in] outputDirectory         The possible output directory.
      */
 	virtual void write(QString const& outputDirectory) override;
+
+    /*!
+     *  Writes the content directly into a stream without rendering it into fileContent_.
+     *
+     *      @param [in] outputStream            The stream to write into.
+     *      @param [in] outputDirectory         The possible output directory.
+     */
+    virtual void writeStream(QTextStream& outputStream, QString const& outputDirectory) override;
     
     /*!
      *  Finds position for body text highlight in document, if any exists.
@@ -84,6 +92,15 @@ struct VerilogDocument : public GenerationOutput
      */
     virtual void getBodyHighlight(int& begin, int& end) const override;
 
+    /*!
+     *  Gets the given content without the creation date and time of the file header.
+     *
+     *      @param [in] content     The content of the output or of a previously written file.
+     *
+     *      @return The content without the generation timestamps.
+     */
+    virtual QString stableContent(QString const& content) const override;
+
     /*!
      *  Finds the module implementation in Verilog code.
      *
@@ -25,6 +25,42 @@
 
 #include <Plugins/PluginSystem/GeneratorPlugin/GenerationControl.h>
 
+#include <QRunnable>
+#include <QTextCodec>
+#include <QTextStream>
+#include <QThreadPool>
+#include <QVector>
+
+#include <functional>
+
+namespace
+{
+    //-----------------------------------------------------------------------------
+    //! Creates the writers of one design in a background thread.
+    //-----------------------------------------------------------------------------
+    class DesignWriterTask : public QRunnable
+    {
+    public:
+
+        explicit DesignWriterTask(std::function<void()> const& work):
+        QRunnable(),
+            work_(work)
+        {
+
+        }
+
+        void run() override
+        {
+            work_();
+        }
+
+    private:
+
+        //! The work to run.
+        std::function<void()> work_;
+    };
+}
+
 //-----------------------------------------------------------------------------
 // Function: VerilogWriterFactory::VerilogWriterFactory()
 //-----------------------------------------------------------------------------
@@ -63,7 +99,9 @@ QSharedPointer<GenerationOutput> VerilogWriterFactory::prepareComponent(QString
     }
 
     // Create writers for module header etc.
-    initializeComponentWriters(document, component);
+    QSettings settings;
+    initializeComponentWriters(document, component, library_->getPath(component->getComponent()->getVlnv()),
+        settings.value("General/Username").toString());
 
     // Create writers.
     QSharedPointer<TextBodyWriter> implementationWriter(new TextBodyWriter(document->implementation_));
@@ -80,20 +118,67 @@ QSharedPointer<GenerationOutput> VerilogWriterFactory::prepareComponent(QString
 //-----------------------------------------------------------------------------
 QList<QSharedPointer<GenerationOutput> > VerilogWriterFactory::prepareDesign(QList<QSharedPointer<MetaDesign> >& designs)
 {
-    QList<QSharedPointer<GenerationOutput> > retval;
+    const int designCount = designs.size();
+
+    // The library and the settings are not safe to use from the worker threads, so read them beforehand.
+    QSettings settings;
+    const QString currentUser = settings.value("General/Username").toString();
 
+    QStringList componentXmlPaths;
     foreach(QSharedPointer<MetaDesign> mDesign, designs)
     {
-        QSharedPointer<VerilogDocument> document = QSharedPointer<VerilogDocument>(new VerilogDocument);
-        initializeComponentWriters(document, mDesign->getTopInstance());
-        document->fileName_ = mDesign->getTopInstance()->getModuleName() + ".v";
-        document->vlnv_ = mDesign->getTopInstance()->getComponent()->getVlnv().toString();
+        QSharedPointer<MetaInstance> topInstance = mDesign->getTopInstance();
+        if (topInstance && topInstance->getComponent())
+        {
+            componentXmlPaths.append(library_->getPath(topInstance->getComponent()->getVlnv()));
+        }
+        else
+        {
+            componentXmlPaths.append(QString());
+        }
+    }
+
+    // Each design writes only its own slot, so the results keep the order of the designs.
+    QVector<QSharedPointer<VerilogDocument> > documents(designCount);
+    QVector<QString> errors(designCount);
+
+    if (designCount < 2)
+    {
+        for (int i = 0; i < designCount; ++i)
+        {
+            documents[i] = createDesignDocument(designs.at(i), componentXmlPaths.at(i), currentUser, errors[i]);
+        }
+    }
+    else
+    {
+        QThreadPool threadPool;
+        for (int i = 0; i < designCount; ++i)
+        {
+            QSharedPointer<MetaDesign> mDesign = designs.at(i);
+            QString const& componentXmlPath = componentXmlPaths.at(i);
+            QSharedPointer<VerilogDocument>& document = documents[i];
+            QString& error = errors[i];
+
+            threadPool.start(new DesignWriterTask([this, mDesign, componentXmlPath, currentUser, &document, &error]()
+            {
+                document = createDesignDocument(mDesign, componentXmlPath, currentUser, error);
+            }));
+        }
 
-        initializeDesignWriters(document, mDesign);
+        threadPool.waitForDone();
+    }
 
-        // Finally, add them to the top writer in desired order.
-        addWritersToTopInDesiredOrder(document);
-        retval.append(document);
+    QList<QSharedPointer<GenerationOutput> > retval;
+    for (int i = 0; i < designCount; ++i)
+    {
+        if (documents.at(i))
+        {
+            retval.append(documents.at(i));
+        }
+        else
+        {
+            messages_->showError(QObject::tr("Design %1: %2").arg(QString::number(i + 1), errors.at(i)));
+        }
     }
 
     return retval;
@@ -152,14 +237,56 @@ bool VerilogWriterFactory::readImplementation(QSharedPointer<VerilogDocument> do
         return false;
     }
 
-    // Read the content.
-    QTextStream inputStream(&outputFile);
-    QString fileContent = inputStream.readAll();
+    // Read the content. The file is mapped and only the part from the override tag onwards is decoded, since
+    // everything above the tag is regenerated. The outputs are written as UTF-8, unless the file has a BOM.
+    QString fileContent;
+    bool tagFound = false;
+
+    const qint64 fileSize = outputFile.size();
+    uchar* mappedContent = fileSize > 0 ? outputFile.map(0, fileSize) : nullptr;
+    if (mappedContent != nullptr)
+    {
+        const QByteArray mappedBytes = QByteArray::fromRawData(reinterpret_cast<const char*>(mappedContent),
+            int(fileSize));
+        QTextCodec* codec = QTextCodec::codecForUtfText(mappedBytes, QTextCodec::codecForName("UTF-8"));
+
+        // The tag is ASCII, so it can only be found from the bytes of an ASCII-compatible encoding.
+        const int tagIndex = mappedBytes.indexOf(VerilogSyntax::TAG_OVERRIDE.toLatin1());
+        tagFound = tagIndex != -1;
+        if (tagFound)
+        {
+            fileContent = codec->toUnicode(mappedBytes.constData() + tagIndex, mappedBytes.size() - tagIndex);
+        }
+        else
+        {
+            fileContent = codec->toUnicode(mappedBytes);
+        }
+
+        outputFile.unmap(mappedContent);
+    }
+    else
+    {
+        QTextStream inputStream(&outputFile);
+        inputStream.setCodec("UTF-8");
+        fileContent = inputStream.readAll();
+    }
+
     // Remove carriage return.
     fileContent.remove('\r');
 
-    // The document sub class is supposed to know how to find its implementation.
-    if (!document->selectImplementation(fileContent, implementation, postModule, error))
+    bool implementationFound = false;
+    if (tagFound)
+    {
+        implementationFound =
+            VerilogSyntax::selectTaggedImplementation(fileContent, implementation, postModule, error);
+    }
+    else
+    {
+        // The document sub class is supposed to know how to find its implementation.
+        implementationFound = document->selectImplementation(fileContent, implementation, postModule, error);
+    }
+
+    if (!implementationFound)
     {
         messages_->showError(QObject::tr("File %1: %2").arg(document->fileName_, error));
 
@@ -172,16 +299,45 @@ bool VerilogWriterFactory::readImplementation(QSharedPointer<VerilogDocument> do
     return true;
 }
 
+//-----------------------------------------------------------------------------
+// Function: VerilogWriterFactory::createDesignDocument()
+//-----------------------------------------------------------------------------
+QSharedPointer<VerilogDocument> VerilogWriterFactory::createDesignDocument(QSharedPointer<MetaDesign> design,
+    QString const& componentXmlPath, QString const& currentUser, QString& error) const
+{
+    QSharedPointer<MetaInstance> topInstance = design->getTopInstance();
+    if (!topInstance || !topInstance->getComponent())
+    {
+        error = QObject::tr("The design has no top component.");
+        return QSharedPointer<VerilogDocument>();
+    }
+
+    if (topInstance->getModuleName().isEmpty())
+    {
+        error = QObject::tr("The top component %1 has no module name.").arg(
+            topInstance->getComponent()->getVlnv().toString());
+        return QSharedPointer<VerilogDocument>();
+    }
+
+    QSharedPointer<VerilogDocument> document = QSharedPointer<VerilogDocument>(new VerilogDocument);
+    initializeComponentWriters(document, topInstance, componentXmlPath, currentUser);
+    document->fileName_ = topInstance->getModuleName() + ".v";
+    document->vlnv_ = topInstance->getComponent()->getVlnv().toString();
+
+    initializeDesignWriters(document, design);
+
+    // Finally, add them to the top writer in desired order.
+    addWritersToTopInDesiredOrder(document);
+
+    return document;
+}
+
 //-----------------------------------------------------------------------------
 // Function: VerilogWriterFactory::initializeComponentWriters()
 //-----------------------------------------------------------------------------
 void VerilogWriterFactory::initializeComponentWriters(QSharedPointer<VerilogDocument> document,
-    QSharedPointer<MetaComponent> component)
+    QSharedPointer<MetaComponent> component, QString const& componentXmlPath, QString const& currentUser) const
 {
-    QSettings settings;
-    QString currentUser = settings.value("General/Username").toString();
-    QString componentXmlPath = library_->getPath(component->getComponent()->getVlnv());
-
     document->headerWriter_ = QSharedPointer<VerilogHeaderWriter>(new VerilogHeaderWriter(component->getComponent()->getVlnv(), 
         componentXmlPath, currentUser, component->getComponent()->getDescription(), kactusVersion_, generatorVersion_));
 
@@ -193,7 +349,7 @@ void VerilogWriterFactory::initializeComponentWriters(QSharedPointer<VerilogDocu
 // Function: VerilogWriterFactory::initializeDesignWriters()
 //-----------------------------------------------------------------------------
 void VerilogWriterFactory::initializeDesignWriters(QSharedPointer<VerilogDocument> document,
-    QSharedPointer<MetaDesign> design)
+    QSharedPointer<MetaDesign> design) const
 {
     document->instanceWriters_.clear();
 
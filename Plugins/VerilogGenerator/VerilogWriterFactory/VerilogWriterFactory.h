@@ -56,9 +56,12 @@ public:
     /*!
      *  Creates writers for the given meta designs.
      *
+     *  The writers of independent designs are created concurrently in a thread pool. The designs must not be
+     *  modified while the writers are created. Designs that cannot be written are reported as errors.
+     *
      *      @param [in] designs             The designs that will yield documents.
      *
-     *      @return The objects that bundles the writers. Will be null, if could not be created.
+     *      @return The objects that bundles the writers in the order of the designs.
      */
     virtual QList<QSharedPointer<GenerationOutput> > prepareDesign(QList<QSharedPointer<MetaDesign> >& designs)
         override final;
@@ -94,13 +97,29 @@ private:
      */
     bool readImplementation(QSharedPointer<VerilogDocument> document, QString const& outputPath);
 
+    /*!
+     *  Creates the document and its writers for a design. Safe to call concurrently for different designs.
+     *
+     *      @param [in] design                  The design, which data will be written.
+     *      @param [in] componentXmlPath        The path of the IP-XACT file of the top component.
+     *      @param [in] currentUser             The name of the user running the generation.
+     *      @param [out] error                  The reason, if the document could not be created.
+     *
+     *      @return The created document, or null if the design could not be written.
+     */
+    QSharedPointer<VerilogDocument> createDesignDocument(QSharedPointer<MetaDesign> design,
+        QString const& componentXmlPath, QString const& currentUser, QString& error) const;
+
     /*!
      *  Initializes writers for component.
      *
      *      @param [in] document        	    The document, which will get writers for writing component.
      *      @param [in] component		        The component, which data will be written.
+     *      @param [in] componentXmlPath        The path of the IP-XACT file of the component.
+     *      @param [in] currentUser             The name of the user running the generation.
      */
-    void initializeComponentWriters(QSharedPointer<VerilogDocument> document, QSharedPointer<MetaComponent> component);
+    void initializeComponentWriters(QSharedPointer<VerilogDocument> document, QSharedPointer<MetaComponent> component,
+        QString const& componentXmlPath, QString const& currentUser) const;
     
     /*!
      *  Initializes writers for the given design.
@@ -108,7 +127,7 @@ private:
      *      @param [in] document        	The document, which will get writers for writing design.
 	 *      @param [in] design		        The design, which data will be written.
      */
-    void initializeDesignWriters(QSharedPointer<VerilogDocument> document, QSharedPointer<MetaDesign> design);
+    void initializeDesignWriters(QSharedPointer<VerilogDocument> document, QSharedPointer<MetaDesign> design) const;
    
     /*!
      *  Adds the generated writers to the top writer in correct order.            
@@ -21,7 +21,8 @@ HEADERS += ../../common/expressions/utilities.h \
     ./VerilogPortParser.h \
     ./VerilogSyntax.h \
     ./verilogimport_global.h \
-    ./VerilogImporter.h
+    ./VerilogImporter.h \
+    ./VerilogTokenizer.h
 SOURCES += ../../common/expressions/utilities.cpp \
     ../../common/NameGenerationPolicy.cpp \
     ../../editors/ComponentEditor/common/IPXactSystemVerilogParser.cpp \
@@ -31,4 +32,5 @@ SOURCES += ../../common/expressions/utilities.cpp \
     ./VerilogInstanceParser.cpp \
     ./VerilogParameterParser.cpp \
     ./VerilogPortParser.cpp \
-    ./VerilogSyntax.cpp
+    ./VerilogSyntax.cpp \
+    ./VerilogTokenizer.cpp
@@ -162,7 +162,10 @@ QString VerilogImporter::getComponentName(QString const& componentDeclaration) c
 void VerilogImporter::import(QString const& input, QString const& componentDeclaration,
     QSharedPointer<Component> targetComponent)
 {   
-    if (hasModuleDeclaration(componentDeclaration))
+    // The selected module is tokenized once for all the parsers.
+    const QVector<VerilogTokenizer::Token> tokens = VerilogTokenizer::tokenize(componentDeclaration);
+
+    if (hasModuleDeclaration(componentDeclaration, tokens))
     {
         highlightModule(input, componentDeclaration);
 
@@ -170,9 +173,9 @@ void VerilogImporter::import(QString const& input, QString const& componentDecla
 		setLanguageAndEnvironmentalIdentifiers(targetComponent, targetComponentInstantiation);
         importModelName(componentDeclaration, targetComponentInstantiation);
 
-        parameterParser_.import(componentDeclaration, targetComponent, targetComponentInstantiation);
-        portParser_.import(componentDeclaration, targetComponent, targetComponentInstantiation);
-        instanceParser_.import(input, componentDeclaration, targetComponent);
+        parameterParser_.import(componentDeclaration, tokens, targetComponent, targetComponentInstantiation);
+        portParser_.import(componentDeclaration, tokens, targetComponent, targetComponentInstantiation);
+        instanceParser_.import(input, componentDeclaration, tokens, targetComponent);
     }
 }
 
@@ -197,19 +200,28 @@ void VerilogImporter::setExpressionParser(QSharedPointer<ExpressionParser> parse
 }
 
 //-----------------------------------------------------------------------------
-// Function: VerilogImporter::hasModuleDeclaration()
+// Function: VerilogImporter::createImporter()
 //-----------------------------------------------------------------------------
-bool VerilogImporter::hasModuleDeclaration(QString const& input)
+ImportPlugin* VerilogImporter::createImporter() const
 {
-	QRegularExpression multilineComment(VerilogSyntax::MULTILINE_COMMENT);
-
-	QString inspect = input;
-	inspect = inspect.remove(VerilogSyntax::COMMENTLINE).remove(multilineComment);
+    return new VerilogImporter();
+}
 
-    int moduleBegin = inspect.indexOf(VerilogSyntax::MODULE_BEGIN);
-    int moduleEnd = inspect.indexOf(VerilogSyntax::MODULE_END, moduleBegin);
+//-----------------------------------------------------------------------------
+// Function: VerilogImporter::hasModuleDeclaration()
+//-----------------------------------------------------------------------------
+bool VerilogImporter::hasModuleDeclaration(QString const& input,
+    QVector<VerilogTokenizer::Token> const& tokens) const
+{
+    for (int i = VerilogTokenizer::findModule(input, tokens) + 1; i < tokens.size(); ++i)
+    {
+        if (VerilogTokenizer::isKeyword(input, tokens, i, QLatin1String("endmodule")))
+        {
+            return true;
+        }
+    }
 
-    return moduleBegin != -1 && moduleEnd != -1;
+    return false;
 }
 
 //-----------------------------------------------------------------------------
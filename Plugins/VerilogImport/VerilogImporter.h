@@ -21,9 +21,11 @@
 #include <Plugins/PluginSystem/ImportPlugin/ExpressionSupport.h>
 #include <Plugins/PluginSystem/ImportPlugin/ImportPlugin.h>
 #include <Plugins/PluginSystem/ImportPlugin/HighlightSource.h>
+#include <Plugins/PluginSystem/ImportPlugin/ParallelImportSupport.h>
 
 #include <QSharedPointer>
 #include <QString>
+#include <QVector>
 
 class Component;
 class View;
@@ -32,7 +34,7 @@ class View;
 //! Import plugin for verilog source files.
 //-----------------------------------------------------------------------------
 class VERILOGIMPORT_EXPORT VerilogImporter: public QObject, public ImportPlugin, public HighlightSource, 
-    public ExpressionSupport
+    public ExpressionSupport, public ParallelImportSupport
 {
     Q_OBJECT
     Q_PLUGIN_METADATA(IID "kactus2.plugins.verilogimportplugin" FILE "verilogimportplugin.json")
@@ -148,6 +150,13 @@ public:
      */
     virtual void setExpressionParser(QSharedPointer<ExpressionParser> parser) override final;
 
+    /*!
+     *  Creates a new Verilog importer with its own parsing state.
+     *
+     *      @return The created importer. The caller takes the ownership of the importer.
+     */
+    virtual ImportPlugin* createImporter() const override final;
+
 private:
 
 	// Disable copying.
@@ -159,10 +168,11 @@ private:
      *  Checks if the given input has a valid module declaration.
      *
      *      @param [in] input   The input to search for module declaration.
+     *      @param [in] tokens  The tokens of the input.
      *
      *      @return True, if a valid module was found, otherwise false.
      */
-    bool hasModuleDeclaration(QString const& input);
+    bool hasModuleDeclaration(QString const& input, QVector<VerilogTokenizer::Token> const& tokens) const;
 
     /*!
      *  Highlights the module section in the input.
@@ -10,7 +10,6 @@
 //-----------------------------------------------------------------------------
 
 #include "VerilogInstanceParser.h"
-#include "VerilogSyntax.h"
 
 #include <common/expressions/utilities.h>
 
@@ -48,18 +47,31 @@ void VerilogInstanceParser::setHighlighter(Highlighter* highlighter)
 void VerilogInstanceParser::import(QString const& input, QString const& componentDeclaration,
     QSharedPointer<Component> targetComponent)
 {
-    QVector<QRegularExpressionMatch> instanceDeclarations = findInstances(input, componentDeclaration);
+    import(input, componentDeclaration, VerilogTokenizer::tokenize(componentDeclaration), targetComponent);
+}
+
+//-----------------------------------------------------------------------------
+// Function: VerilogInstanceParser::import()
+//-----------------------------------------------------------------------------
+void VerilogInstanceParser::import(QString const& input, QString const& componentDeclaration,
+    QVector<VerilogTokenizer::Token> const& tokens, QSharedPointer<Component> targetComponent)
+{
+    QVector<InstanceDeclaration> instanceDeclarations = findInstances(componentDeclaration, tokens);
 
     if (!instanceDeclarations.isEmpty())
     {
         QSharedPointer<Kactus2Group> instancesGroup(new Kactus2Group(InstanceData::VERILOGINSTANCES));
 
-        for (auto& instanceMatch : instanceDeclarations)
+        const int declarationOffset = input.indexOf(componentDeclaration);
+
+        for (auto& instance : instanceDeclarations)
         {
-            QString instanceModuleName = instanceMatch.captured(1);
-            QString parameterDeclarations = instanceMatch.captured(2);
-            QString instanceName = instanceMatch.captured(3);
-            QString connectionDeclarations = instanceMatch.captured(4);
+            highlightInstance(instance, declarationOffset);
+
+            QString instanceModuleName = instance.moduleName_;
+            QString parameterDeclarations = instance.parameters_;
+            QString instanceName = instance.instanceName_;
+            QString connectionDeclarations = instance.connections_;
 
             QSharedPointer<Kactus2Group> instanceExtension(new Kactus2Group(InstanceData::SINGLEINSTANCE));
 
@@ -103,95 +115,156 @@ void VerilogInstanceParser::import(QString const& input, QString const& componen
 //-----------------------------------------------------------------------------
 // Function: VerilogInstanceParser::findInstances()
 //-----------------------------------------------------------------------------
-QVector<QRegularExpressionMatch> VerilogInstanceParser::findInstances(QString const& input,
-    QString const& componentDeclaration)
+QVector<VerilogInstanceParser::InstanceDeclaration> VerilogInstanceParser::findInstances(
+    QString const& componentDeclaration, QVector<VerilogTokenizer::Token> const& tokens) const
 {
-    QVector<QRegularExpressionMatch> instances;
-    QString inspect = componentDeclaration;
+    QVector<InstanceDeclaration> instances;
 
-    QRegularExpression multilineComment(VerilogSyntax::MULTILINE_COMMENT);
-    QRegularExpression strayComment(VerilogSyntax::COMMENT);
-    inspect = inspect.remove(VerilogSyntax::COMMENTLINE).remove(multilineComment).remove(strayComment);
+    const int tokenCount = tokens.size();
 
-    QString expressionString =
-        "\\b([a-zA-Z_][\\w$]*)(\\s+#(?:(?:.|\\n)(?!(?:[)]\\s*[a-zA-Z_]|;)))*(?:.|\\n)\\))?\\s+([a-zA-Z_][\\w$]*)\\s*(\\((?:(?:.|\\n)(?!\\);))*\\s*\\)+;)";
-    QRegularExpression instanceExpression(expressionString);
-    QRegularExpressionMatchIterator instanceMatchIterator = instanceExpression.globalMatch(inspect);
+    auto isSymbol = [&componentDeclaration, &tokens, tokenCount](int index, char symbol)
+    {
+        return index < tokenCount && tokens.at(index).type == VerilogTokenizer::SYMBOL &&
+            componentDeclaration.at(tokens.at(index).start) == QLatin1Char(symbol);
+    };
 
-    QRegularExpressionMatchIterator multilineCommentIterator = multilineComment.globalMatch(input);
+    auto isIdentifier = [&tokens, tokenCount](int index)
+    {
+        return index < tokenCount && tokens.at(index).type == VerilogTokenizer::IDENTIFIER;
+    };
 
-    while (instanceMatchIterator.hasNext())
+    // An instance is: module_name [#(parameters)] instance_name (connections);
+    int moduleIndex = VerilogTokenizer::nextCodeToken(tokens, 0);
+    while (moduleIndex < tokenCount)
     {
-        QRegularExpressionMatch instanceMatch = instanceMatchIterator.next();
+        int nextIndex = VerilogTokenizer::nextCodeToken(tokens, moduleIndex + 1);
+
+        VerilogTokenizer::Token const& moduleToken = tokens.at(moduleIndex);
+        if (moduleToken.type != VerilogTokenizer::IDENTIFIER || componentDeclaration.midRef(
+            moduleToken.start, moduleToken.length).compare(QLatin1String("module"), Qt::CaseInsensitive) == 0)
+        {
+            moduleIndex = nextIndex;
+            continue;
+        }
 
-        QString instanceModuleName = instanceMatch.captured(1);
-        if (instanceMatch.captured(1).compare(QStringLiteral("module"), Qt::CaseInsensitive) != 0)
+        int parametersBegin = -1;
+        int parametersEnd = -1;
+        int position = nextIndex;
+        if (isSymbol(position, '#'))
         {
-            instances.append(instanceMatch);
-            highlightInstance(input, componentDeclaration, instanceMatch, multilineCommentIterator);
+            parametersBegin = position;
+            parametersEnd = closingParenthesis(componentDeclaration, tokens,
+                VerilogTokenizer::nextCodeToken(tokens, position + 1));
+            position = parametersEnd == -1 ? tokenCount :
+                VerilogTokenizer::nextCodeToken(tokens, parametersEnd + 1);
         }
+
+        const int nameIndex = position;
+        const int connectionsBegin = isIdentifier(nameIndex) ?
+            VerilogTokenizer::nextCodeToken(tokens, nameIndex + 1) : tokenCount;
+        const int connectionsEnd = closingParenthesis(componentDeclaration, tokens, connectionsBegin);
+        const int semicolonIndex = connectionsEnd == -1 ? tokenCount :
+            VerilogTokenizer::nextCodeToken(tokens, connectionsEnd + 1);
+
+        if (!isSymbol(semicolonIndex, ';'))
+        {
+            moduleIndex = nextIndex;
+            continue;
+        }
+
+        VerilogTokenizer::Token const& nameToken = tokens.at(nameIndex);
+
+        InstanceDeclaration instance;
+        instance.moduleName_ = componentDeclaration.mid(moduleToken.start, moduleToken.length);
+        instance.instanceName_ = componentDeclaration.mid(nameToken.start, nameToken.length);
+        instance.moduleNameStart_ = moduleToken.start;
+        instance.instanceNameStart_ = nameToken.start;
+
+        if (parametersBegin != -1)
+        {
+            instance.parameters_ =
+                VerilogTokenizer::textWithoutComments(componentDeclaration, tokens, parametersBegin, parametersEnd);
+        }
+
+        instance.connections_ =
+            VerilogTokenizer::textWithoutComments(componentDeclaration, tokens, connectionsBegin, semicolonIndex);
+
+        instances.append(instance);
+
+        moduleIndex = VerilogTokenizer::nextCodeToken(tokens, semicolonIndex + 1);
     }
 
     return instances;
 }
 
 //-----------------------------------------------------------------------------
-// Function: VerilogInstanceParser::highlightInstance()
+// Function: VerilogInstanceParser::closingParenthesis()
 //-----------------------------------------------------------------------------
-void VerilogInstanceParser::highlightInstance(QString const& input, QString const& moduleDeclaration,
-    QRegularExpressionMatch const& instanceMatch, QRegularExpressionMatchIterator const& multilineCommentIterator)
+int VerilogInstanceParser::closingParenthesis(QString const& declaration,
+    QVector<VerilogTokenizer::Token> const& tokens, int position) const
 {
-    QString instanceModuleName = instanceMatch.captured(1);
-    QString instanceName = instanceMatch.captured(3);
+    int depth = 0;
+    for (int i = position; i < tokens.size(); ++i)
+    {
+        if (tokens.at(i).type == VerilogTokenizer::COMMENT)
+        {
+            continue;
+        }
 
-    QRegularExpression inputInstanceExpression("\\b(" + instanceModuleName +
-        "\\s+(?:[^;])*?" +
-        instanceName + ")\\s*(\\((?:(?:.|\\n)(?!\\);))*\\s*\\)+;)", QRegularExpression::DotMatchesEverythingOption);
+        if (tokens.at(i).type != VerilogTokenizer::SYMBOL)
+        {
+            if (depth == 0)
+            {
+                return -1;
+            }
 
-    QRegularExpressionMatchIterator instanceIntroductionIterator = inputInstanceExpression.globalMatch(input);
-    while (instanceIntroductionIterator.hasNext())
-    {
-        QRegularExpressionMatch instanceIntroductionMatch = instanceIntroductionIterator.next();
-        if (!matchIsWithinComments(instanceIntroductionMatch, multilineCommentIterator))
+            continue;
+        }
+
+        const QChar symbol = declaration.at(tokens.at(i).start);
+        if (symbol == QLatin1Char('('))
         {
-            QString matchedIntroduction = instanceIntroductionMatch.captured(1);
-            int instanceModuleBeginIndex =
-                instanceIntroductionMatch.capturedStart() + matchedIntroduction.indexOf(instanceModuleName);
-            int instanceModuleEndIndex = instanceModuleBeginIndex + instanceModuleName.length();
-
-            int instanceNameBeginIndex =
-                instanceIntroductionMatch.capturedStart() + matchedIntroduction.lastIndexOf(instanceName);
-            int instanceNameEndIndex = instanceNameBeginIndex + instanceName.length();
-
-            highlighter_->applyHighlight(
-                instanceModuleBeginIndex, instanceModuleEndIndex, ImportColors::INSTANCECOLOR);
-            highlighter_->applyHighlight(
-                instanceNameBeginIndex, instanceNameEndIndex, ImportColors::INSTANCECOLOR);
+            ++depth;
+        }
+        else if (depth == 0)
+        {
+            return -1;
+        }
+        else if (symbol == QLatin1Char(')'))
+        {
+            --depth;
+            if (depth == 0)
+            {
+                return i;
+            }
+        }
+        else if (symbol == QLatin1Char(';'))
+        {
+            // A statement cannot end inside the parentheses of an instance.
+            return -1;
         }
     }
+
+    return -1;
 }
 
 //-----------------------------------------------------------------------------
-// Function: VerilogInstanceParser::matchIsWithinComments()
+// Function: VerilogInstanceParser::highlightInstance()
 //-----------------------------------------------------------------------------
-bool VerilogInstanceParser::matchIsWithinComments(QRegularExpressionMatch const& expressionMatch,
-    QRegularExpressionMatchIterator commentMatchIterator) const
+void VerilogInstanceParser::highlightInstance(InstanceDeclaration const& instance, int declarationOffset)
 {
-    int expressionStart = expressionMatch.capturedStart();
-
-    while (commentMatchIterator.hasNext())
+    if (highlighter_ == nullptr || declarationOffset == -1)
     {
-        QRegularExpressionMatch commentMatch = commentMatchIterator.next();
-        int commentStart = commentMatch.capturedStart();
-        int commentEnd = commentMatch.capturedEnd();
-
-        if (expressionStart > commentStart && expressionStart < commentEnd)
-        {
-            return true;
-        }
+        return;
     }
 
-    return false;
+    const int moduleNameBegin = declarationOffset + instance.moduleNameStart_;
+    const int instanceNameBegin = declarationOffset + instance.instanceNameStart_;
+
+    highlighter_->applyHighlight(moduleNameBegin, moduleNameBegin + instance.moduleName_.length(),
+        ImportColors::INSTANCECOLOR);
+    highlighter_->applyHighlight(instanceNameBegin, instanceNameBegin + instance.instanceName_.length(),
+        ImportColors::INSTANCECOLOR);
 }
 
 //-----------------------------------------------------------------------------
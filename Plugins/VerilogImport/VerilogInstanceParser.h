@@ -12,10 +12,12 @@
 #ifndef VERILOGINSTANCEPARSER_H
 #define VERILOGINSTANCEPARSER_H
 
+#include "VerilogTokenizer.h"
+
 #include <Plugins/PluginSystem/ImportPlugin/HighlightSource.h>
 
 #include <QSharedPointer>
-#include <QRegularExpressionMatchIterator>
+#include <QVector>
 
 class Component;
 class Kactus2Group;
@@ -51,6 +53,17 @@ public:
     virtual void import(QString const& input, QString const& componentDeclaration,
         QSharedPointer<Component> targetComponent);
 
+    /*!
+     *  Runs the instance parsing for the given input using the tokens of the selected component declaration.
+     *
+     *      @param [in] input                   The input text to parse.
+     *      @param [in] componentDeclaration    The selected component declaration.
+     *      @param [in] tokens                  The tokens of the component declaration.
+     *      @param [in] targetComponent         The component to add all the imported instances to.
+     */
+    void import(QString const& input, QString const& componentDeclaration,
+        QVector<VerilogTokenizer::Token> const& tokens, QSharedPointer<Component> targetComponent);
+
     /*!
      *  Sets the given highlighter to be used by the generic parser.
      *
@@ -60,38 +73,58 @@ public:
 
 private:
 
+    //! A component instance found in the component declaration.
+    struct InstanceDeclaration
+    {
+        //! Name of the instantiated module.
+        QString moduleName_;
+
+        //! The parameter assignments without comments, e.g. #(.WIDTH(8)).
+        QString parameters_;
+
+        //! Name of the instance.
+        QString instanceName_;
+
+        //! The port connections without comments, e.g. (.clk(clk));
+        QString connections_;
+
+        //! Position of the module name in the component declaration.
+        int moduleNameStart_ = 0;
+
+        //! Position of the instance name in the component declaration.
+        int instanceNameStart_ = 0;
+    };
+
     /*!
-     *  Find matches for the component instances in the selected verilog file.
+     *  Find the component instances in the selected component declaration.
      *
-     *      @param [in] input                   The selected verilog file.
      *      @param [in] componentDeclaration    The selected component declaration.
+     *      @param [in] tokens                  The tokens of the component declaration.
      *
-     *      @return List of component instance matches.
+     *      @return List of the found component instances.
      */
-    QVector<QRegularExpressionMatch> findInstances(QString const& input, QString const& componentDeclaration);
+    QVector<InstanceDeclaration> findInstances(QString const& componentDeclaration,
+        QVector<VerilogTokenizer::Token> const& tokens) const;
 
     /*!
-     *  Highlight the selected component instance.
+     *  Find the closing parenthesis matching the opening parenthesis at the given token.
+     *
+     *      @param [in] declaration     The component declaration.
+     *      @param [in] tokens          The tokens of the component declaration.
+     *      @param [in] position        Index of the opening parenthesis token.
      *
-     *      @param [in] input                       The selected verilog file.
-     *      @param [in] moduleDeclaration           The selected component declaration.
-     *      @param [in] instanceMatch               The selected component instance match.
-     *      @param [in] multilineCommentIterator    Regular expression Match iterator for multi line comments.
+     *      @return Index of the closing parenthesis token or -1, if the parentheses are not balanced.
      */
-    void highlightInstance(QString const& input, QString const& moduleDeclaration,
-        QRegularExpressionMatch const& instanceMatch,
-        QRegularExpressionMatchIterator const& multilineCommentIterator);
+    int closingParenthesis(QString const& declaration, QVector<VerilogTokenizer::Token> const& tokens,
+        int position) const;
 
     /*!
-     *  Check if a regular expression match is located within comments.
-     *
-     *      @param [in] expressionMatch         The selected regular expression match.
-     *      @param [in] commentMatchIterator    Regular expression Match iterator for multi line comments.
+     *  Highlight the module name and the instance name of the selected component instance.
      *
-     *      @return True, if the match is located within comments, false otherwise.
+     *      @param [in] instance            The selected component instance.
+     *      @param [in] declarationOffset   Position of the component declaration in the highlighted file.
      */
-    bool matchIsWithinComments(QRegularExpressionMatch const& expressionMatch,
-        QRegularExpressionMatchIterator commentMatchIterator) const;
+    void highlightInstance(InstanceDeclaration const& instance, int declarationOffset);
 
     /*!
      *  Get a list of separated sub items and their values from the selected sub item declarations.
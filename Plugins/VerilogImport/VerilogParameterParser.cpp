@@ -10,7 +10,6 @@
 //-----------------------------------------------------------------------------
 
 #include "VerilogParameterParser.h"
-#include "VerilogSyntax.h"
 
 #include <IPXACTmodels/common/Parameter.h>
 
@@ -23,16 +22,76 @@
 
 #include <editors/ComponentEditor/common/IPXactSystemVerilogParser.h>
 
-#include <common/expressions/utilities.h>
-
 #include <QList>
+#include <QSet>
 #include <QString>
 #include <QRegularExpression>
 
 namespace
 {
-    const QRegularExpression TYPE_RULE("(\\w+)\\s+(?:(" + VerilogSyntax::RANGE + ")?\\s*(" + 
-        VerilogSyntax::RANGE + "))?\\s*" + VerilogSyntax::NAME_VALUE, QRegularExpression::CaseInsensitiveOption);
+    //-----------------------------------------------------------------------------
+    // Function: isParameterKeyword()
+    //-----------------------------------------------------------------------------
+    bool isParameterKeyword(QString const& input, QVector<VerilogTokenizer::Token> const& tokens, int index)
+    {
+        return VerilogTokenizer::isKeyword(input, tokens, index, QLatin1String("parameter"), Qt::CaseInsensitive);
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: isConditionalDirective()
+    //-----------------------------------------------------------------------------
+    bool isConditionalDirective(QString const& input, VerilogTokenizer::Token const& token)
+    {
+        if (token.type != VerilogTokenizer::MACRO)
+        {
+            return false;
+        }
+
+        QStringRef directive = VerilogTokenizer::tokenText(input, token);
+        return directive == QLatin1String("`ifdef") || directive == QLatin1String("`ifndef") ||
+            directive == QLatin1String("`elsif") || directive == QLatin1String("`else") ||
+            directive == QLatin1String("`endif");
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: bracketDepthChange()
+    //-----------------------------------------------------------------------------
+    int bracketDepthChange(QString const& input, VerilogTokenizer::Token const& token)
+    {
+        if (token.type != VerilogTokenizer::SYMBOL)
+        {
+            return 0;
+        }
+
+        const QChar symbol = input.at(token.start);
+        if (symbol == QLatin1Char('(') || symbol == QLatin1Char('[') || symbol == QLatin1Char('{'))
+        {
+            return 1;
+        }
+        else if (symbol == QLatin1Char(')') || symbol == QLatin1Char(']') || symbol == QLatin1Char('}'))
+        {
+            return -1;
+        }
+
+        return 0;
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: lineStart()
+    //-----------------------------------------------------------------------------
+    int lineStart(QString const& input, int position)
+    {
+        return position == 0 ? 0 : input.lastIndexOf(QLatin1Char('\n'), position - 1) + 1;
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: startsLine()
+    //-----------------------------------------------------------------------------
+    bool startsLine(QString const& input, int position)
+    {
+        const int begin = lineStart(input, position);
+        return input.midRef(begin, position - begin).trimmed().isEmpty();
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -63,12 +122,31 @@ void VerilogParameterParser::setHighlighter(Highlighter* highlighter)
 void VerilogParameterParser::import(QString const& componentDeclaration, QSharedPointer<Component> targetComponent,
     QSharedPointer<ComponentInstantiation> targetComponentInstantiation)
 {
-    QStringList declarations = findDeclarations(componentDeclaration);
+    import(componentDeclaration, VerilogTokenizer::tokenize(componentDeclaration), targetComponent,
+        targetComponentInstantiation);
+}
 
+//-----------------------------------------------------------------------------
+// Function: VerilogParameterParser::import()
+//-----------------------------------------------------------------------------
+void VerilogParameterParser::import(QString const& componentDeclaration,
+    QVector<VerilogTokenizer::Token> const& tokens, QSharedPointer<Component> targetComponent,
+    QSharedPointer<ComponentInstantiation> targetComponentInstantiation)
+{
     QList<QSharedPointer<ModuleParameter> > parsedParameters;
-    for (QString const& declaration : declarations)
+    for (QPair<int, int> const& declaration : findParameterDeclarations(componentDeclaration, tokens))
     {
-        parsedParameters.append(parseParameters(declaration));
+        if (highlighter_)
+        {
+            const int begin = tokens.at(declaration.first).start;
+            const int end = tokens.at(declaration.second).start + tokens.at(declaration.second).length;
+
+            highlighter_->applyHighlight(componentDeclaration.mid(begin, end - begin),
+                ImportColors::MODELPARAMETER, componentDeclaration);
+        }
+
+        parsedParameters.append(
+            parseParameters(componentDeclaration, tokens, declaration.first, declaration.second));
     }
 
     if (targetComponentInstantiation.isNull() == false)
@@ -98,243 +176,345 @@ void VerilogParameterParser::import(QString const& componentDeclaration, QShared
 // Function: VerilogParameterParser::findDeclarations()
 //-----------------------------------------------------------------------------
 QStringList VerilogParameterParser::findDeclarations(QString const& input)
-{    
-    return findParameterDeclarations(input, findParameterSection(input));
+{
+    const QVector<VerilogTokenizer::Token> tokens = VerilogTokenizer::tokenize(input);
+
+    QStringList declarations;
+    for (QPair<int, int> const& declaration : findParameterDeclarations(input, tokens))
+    {
+        declarations.append(declarationText(input, tokens, declaration.first, declaration.second));
+    }
+
+    return declarations;
 }
 
 //-----------------------------------------------------------------------------
-// Function: VerilogParameterParser::findParameterSection()
+// Function: VerilogParameterParser::parseParameters()
 //-----------------------------------------------------------------------------
-QString VerilogParameterParser::findParameterSection(QString const &input)
+QList<QSharedPointer<ModuleParameter> > VerilogParameterParser::parseParameters(QString const &input)
 {
-    QString inspect = VerilogSyntax::cullStrayComments(input);
-
-    // Priority on parameters declared in ANSI-style at module header.
-    // Otherwise, search the whole input.
-    QRegularExpression parameterStart(QStringLiteral("#\\s*[(]"));
-    QRegularExpressionMatch match = parameterStart.match(inspect);
-
-    int beginIndex = match.capturedEnd();
-    int endIndex = -1;
-    if (beginIndex != -1)
+    const QVector<VerilogTokenizer::Token> tokens = VerilogTokenizer::tokenize(input);
+    if (tokens.isEmpty())
     {
-        endIndex =
-            ExpressionUtilities::findMatchingEndParenthesis(inspect, beginIndex - 1, VerilogSyntax::COMMENT);
+        return QList<QSharedPointer<ModuleParameter> >();
     }
 
-    int length = input.length();
-    if (beginIndex == -1)
+    return parseParameters(input, tokens, 0, tokens.size() - 1);
+}
+
+//-----------------------------------------------------------------------------
+// Function: VerilogParameterParser::findParameterSection()
+//-----------------------------------------------------------------------------
+QPair<int, int> VerilogParameterParser::findParameterSection(QString const& input,
+    QVector<VerilogTokenizer::Token> const& tokens) const
+{
+    // Priority on parameters declared in ANSI-style at module header.
+    const int moduleIndex = VerilogTokenizer::findModule(input, tokens);
+    if (moduleIndex != tokens.size())
     {
-        ++length;
+        const int nameIndex = VerilogTokenizer::nextCodeToken(tokens, moduleIndex + 1);
+        const int hashIndex = VerilogTokenizer::nextCodeToken(tokens, nameIndex + 1);
+        const int parametersBegin = VerilogTokenizer::nextCodeToken(tokens, hashIndex + 1);
+
+        if (VerilogTokenizer::isSymbol(input, tokens, hashIndex, '#') &&
+            VerilogTokenizer::isSymbol(input, tokens, parametersBegin, '('))
+        {
+            const int parametersEnd = VerilogTokenizer::closingBracket(input, tokens, parametersBegin);
+            return qMakePair(parametersBegin + 1, parametersEnd == -1 ? tokens.size() : parametersEnd);
+        }
     }
-    else if (endIndex != -1)
+
+    // Otherwise, search until the end of the module.
+    int sectionEnd = 0;
+    while (sectionEnd < tokens.size() &&
+        !VerilogTokenizer::isKeyword(input, tokens, sectionEnd, QLatin1String("endmodule")))
     {
-        length = endIndex - beginIndex;
+        ++sectionEnd;
     }
 
-    return inspect.mid(beginIndex, length);
+    return qMakePair(0, sectionEnd);
 }
 
 //-----------------------------------------------------------------------------
-// Function: VerilogParameterParser::parseParameters()
+// Function: VerilogParameterParser::findParameterDeclarations()
 //-----------------------------------------------------------------------------
-QList<QSharedPointer<ModuleParameter> > VerilogParameterParser::parseParameters(QString const &input)
+QVector<QPair<int, int> > VerilogParameterParser::findParameterDeclarations(QString const& input,
+    QVector<VerilogTokenizer::Token> const& tokens) const
 {
-    QList<QSharedPointer<ModuleParameter> > parameters;
-
-    // Find the type and the declaration. Only one per declaration is supported.
-    QString type = parseType(input);
-    QString bitWidthLeft = parseBitWidthLeft(input);
-    QString bitWidthRight = parseBitWidthRight(input);
-    QString arrayLeft = parseArrayLeft(input);
-    QString arrayRight = parseArrayRight(input);
-    QString description = parseDescription(input);
+    QVector<QPair<int, int> > declarations;
 
-    QString inputWithoutComments = input;
-    inputWithoutComments.remove(QRegularExpression(VerilogSyntax::COMMENT));
+    const QPair<int, int> section = findParameterSection(input, tokens);
 
-    QString parameterDefinition =  "(" + VerilogSyntax::NAMES + ")\\s*=((\\s*(" + 
-        VerilogSyntax::OPERATION_OR_ALPHANUMERIC + ")+\\s*)+)";
+    int depth = 0;
+    int position = section.first;
+    while (position < section.second)
+    {
+        if (depth == 0 && isParameterKeyword(input, tokens, position))
+        {
+            const int last = findDeclarationEnd(input, tokens, position, section.second);
+            declarations.append(qMakePair(position, last));
 
-    QRegularExpression parameterRule(parameterDefinition + "(\\s*,\\s*" + parameterDefinition + ")*", 
-        QRegularExpression::CaseInsensitiveOption);    
+            position = last + 1;
+            continue;
+        }
 
-    QRegularExpression splitRule(parameterDefinition, QRegularExpression::CaseInsensitiveOption);
+        depth = qMax(0, depth + bracketDepthChange(input, tokens.at(position)));
+        ++position;
+    }
 
-    QString parametersString = parameterRule.match(inputWithoutComments).captured();
+    return declarations;
+}
 
-    // We know for sure that each name value pair is separated by comma, and as such we get a list of them.
-    // Names are defined before the = operator.
-    foreach (QString const& parameter, 
-        parametersString.split(QRegularExpression(",(?=.*=)", QRegularExpression::DotMatchesEverythingOption)))
+//-----------------------------------------------------------------------------
+// Function: VerilogParameterParser::findDeclarationEnd()
+//-----------------------------------------------------------------------------
+int VerilogParameterParser::findDeclarationEnd(QString const& input, QVector<VerilogTokenizer::Token> const& tokens,
+    int first, int limit) const
+{
+    // The declaration ends at a semicolon, at a comma followed by another declaration or at a directive.
+    int last = first;
+    int depth = 0;
+    for (int i = first + 1; i < limit; ++i)
     {
-        // After acquiring a name value pair, we separate the name and the value from each other.
-        QString name = splitRule.match(parameter).captured(1).trimmed();
-        QString value = splitRule.match(parameter).captured(2).simplified();
+        VerilogTokenizer::Token const& token = tokens.at(i);
+        if (token.type == VerilogTokenizer::COMMENT)
+        {
+            continue;
+        }
 
-        // Each name value pair produces a new module parameter, but the type and the description is recycled.
-        QSharedPointer<ModuleParameter> moduleParameter =  QSharedPointer<ModuleParameter>(new ModuleParameter());      
-        moduleParameter->setName(name);
-        moduleParameter->setDataType(type);
-        moduleParameter->setType(createTypeFromDataType(type));
-        moduleParameter->setValue(value);
-        moduleParameter->setUsageType("nontyped");
-        moduleParameter->setVectorLeft(bitWidthLeft);
-        moduleParameter->setVectorRight(bitWidthRight);
-        moduleParameter->setArrayLeft(arrayLeft);
-        moduleParameter->setArrayRight(arrayRight);
-        moduleParameter->setDescription(description);
+        if (depth == 0 && (isConditionalDirective(input, token) || isParameterKeyword(input, tokens, i)))
+        {
+            break;
+        }
 
-        // No type plus has vectors, means that we set type as bit for compatibility.
-        if (!moduleParameter->getVectors()->isEmpty() && moduleParameter->getType().isEmpty())
+        depth += bracketDepthChange(input, token);
+        if (depth == 0 && VerilogTokenizer::isSymbol(input, tokens, i, ';'))
         {
-            moduleParameter->setType(QStringLiteral("bit"));
+            last = i;
+            break;
+        }
+        else if (depth == 0 && VerilogTokenizer::isSymbol(input, tokens, i, ',') &&
+            isParameterKeyword(input, tokens, VerilogTokenizer::nextCodeToken(tokens, i + 1)))
+        {
+            last = i;
+            break;
         }
 
-        parameters.append(moduleParameter);
+        last = i;
     }
 
-    return parameters;
-}
+    // A comment on the same line after the declaration describes it.
+    const int comment = VerilogTokenizer::trailingComment(input, tokens, last, limit);
+    if (comment != -1)
+    {
+        last = comment;
+    }
 
-//-----------------------------------------------------------------------------
-// Function: VerilogParameterParser::createTypeFromDataType()
-//-----------------------------------------------------------------------------
-QString VerilogParameterParser::createTypeFromDataType(QString const& dataType)
-{
-    QRegularExpression knownTypes(QStringLiteral("bit|byte|shortint|int|longint|shortreal|real|string"));
-    return knownTypes.match(dataType).captured();
+    return last;
 }
 
 //-----------------------------------------------------------------------------
-// Function: VerilogParameterParser::findDeclarations()
+// Function: VerilogParameterParser::declarationText()
 //-----------------------------------------------------------------------------
-QStringList VerilogParameterParser::findParameterDeclarations(QString const& componentDeclaration,
-    QString const& parameterArea)
+QString VerilogParameterParser::declarationText(QString const& input,
+    QVector<VerilogTokenizer::Token> const& tokens, int first, int last) const
 {
-    // List of detected parameter declarations.
-    QStringList declarations;
+    QString text;
 
-    // Rule used to detect parameter declarations.
-    QRegularExpression declarationRule("\\bparameter\\s+.*(?:"
-        "(;[ \\t]*" + VerilogSyntax::COMMENT + ")|"
-        "(;|$)|"
-        "(,([ \\t]*" + VerilogSyntax::COMMENT +")?(?=\\s*\\bparameter\\b)))",
-        QRegularExpression::CaseInsensitiveOption | QRegularExpression::InvertedGreedinessOption |
-        QRegularExpression::DotMatchesEverythingOption);
-
-    QRegularExpression commentBegin(QStringLiteral("//"));
-    QRegularExpression lineBegin(QStringLiteral("^|\\r?\\n"));
-
-    QRegularExpressionMatchIterator iter = declarationRule.globalMatch(parameterArea);
-    while (iter.hasNext())
-    {        
-        QRegularExpressionMatch match = iter.next();
-        QString declaration = match.captured();
-        int declarationBegin = match.capturedStart();
-
-        // Check keyword parameter is not inside a comment.
-        if (parameterArea.lastIndexOf(lineBegin, declarationBegin) > parameterArea.lastIndexOf(commentBegin, declarationBegin))
+    int copiedFrom = tokens.at(first).start;
+    for (int i = first; i <= last; ++i)
+    {
+        VerilogTokenizer::Token const& token = tokens.at(i);
+        if (token.type != VerilogTokenizer::COMMENT)
+        {
+            continue;
+        }
+
+        int removedFrom = token.start;
+        if (VerilogTokenizer::isLineComment(input, token))
         {
-            if (highlighter_)
+            // Comments after code are kept for the description. Comment lines are removed with the line break.
+            if (!startsLine(input, token.start))
             {
-                highlighter_->applyHighlight(declaration, ImportColors::MODELPARAMETER, componentDeclaration);
+                continue;
             }
 
-            declarations.append(declaration);
+            const int lineBreak = lineStart(input, token.start) - 1;
+            removedFrom = qMax(lineBreak, copiedFrom);
+            if (removedFrom == lineBreak && removedFrom > copiedFrom &&
+                input.at(removedFrom - 1) == QLatin1Char('\r'))
+            {
+                --removedFrom;
+            }
         }
+
+        text.append(input.midRef(copiedFrom, removedFrom - copiedFrom));
+        copiedFrom = token.start + token.length;
     }
 
-    return declarations;
+    text.append(input.midRef(copiedFrom, tokens.at(last).start + tokens.at(last).length - copiedFrom));
+    return text;
 }
 
 //-----------------------------------------------------------------------------
-// Function: VerilogParameterParser::parseType()
+// Function: VerilogParameterParser::parseParameters()
 //-----------------------------------------------------------------------------
-QString VerilogParameterParser::parseType(QString const& input)
+QList<QSharedPointer<ModuleParameter> > VerilogParameterParser::parseParameters(QString const& input,
+    QVector<VerilogTokenizer::Token> const& tokens, int first, int last)
 {
-    // The type is assumed to be the first word in the declaration.
-    QString type = TYPE_RULE.match(input).captured(1);
-    if (type == QLatin1String("parameter"))
+    QList<QSharedPointer<ModuleParameter> > parameters;
+
+    const int limit = last + 1;
+
+    // The type and the ranges before the first name are shared by all the parameters in the declaration.
+    QString type;
+    QVector<QPair<QString, QString> > ranges;
+
+    int position = VerilogTokenizer::nextCodeToken(tokens, first);
+    while (position < limit)
     {
-        type.clear();
+        const int next = VerilogTokenizer::nextCodeToken(tokens, position + 1);
+        if (tokens.at(position).type == VerilogTokenizer::IDENTIFIER)
+        {
+            if (VerilogTokenizer::isSymbol(input, tokens, next, '='))
+            {
+                break;
+            }
+
+            QString qualifier = VerilogTokenizer::tokenText(input, tokens.at(position)).toString();
+            if (!isParameterKeyword(input, tokens, position) && qualifier != QLatin1String("signed") &&
+                qualifier != QLatin1String("unsigned"))
+            {
+                type = qualifier;
+            }
+
+            position = next;
+        }
+        else if (VerilogTokenizer::isSymbol(input, tokens, position, '['))
+        {
+            const int rangeEnd = VerilogTokenizer::closingBracket(input, tokens, position);
+            if (rangeEnd == -1 || rangeEnd > last)
+            {
+                return parameters;
+            }
+
+            ranges.append(VerilogTokenizer::splitRange(input, tokens, position, rangeEnd));
+            position = VerilogTokenizer::nextCodeToken(tokens, rangeEnd + 1);
+        }
+        else
+        {
+            return parameters;
+        }
     }
 
-    return type;
-}
+    // With two ranges, the first one is the array and the second one the vector.
+    QPair<QString, QString> vectorBounds;
+    QPair<QString, QString> arrayBounds;
+    if (ranges.size() >= 2)
+    {
+        arrayBounds = ranges.at(ranges.size() - 2);
+    }
 
-//-----------------------------------------------------------------------------
-// Function: VerilogParameterParser::parseBitWidthLeft()
-//-----------------------------------------------------------------------------
-QString VerilogParameterParser::parseBitWidthLeft(QString const& declaration)
-{
-    QString bitRange = TYPE_RULE.match(declaration).captured(3);
+    if (!ranges.isEmpty())
+    {
+        vectorBounds = ranges.last();
+    }
 
-    QRegularExpressionMatch rangeMatch = VerilogSyntax::CAPTURING_RANGE.match(bitRange);
-    QString left = rangeMatch.captured(1);
+    QString description = parseDescription(input, tokens, first, last);
 
-    return left;
-}
+    // Each name value pair is separated by a comma.
+    while (position < limit && tokens.at(position).type == VerilogTokenizer::IDENTIFIER)
+    {
+        const int assignment = VerilogTokenizer::nextCodeToken(tokens, position + 1);
+        if (!VerilogTokenizer::isSymbol(input, tokens, assignment, '='))
+        {
+            break;
+        }
 
-//-----------------------------------------------------------------------------
-// Function: VerilogParameterParser::parseBitWidthRight()
-//-----------------------------------------------------------------------------
-QString VerilogParameterParser::parseBitWidthRight(QString const& declaration)
-{
-    QString bitRange = TYPE_RULE.match(declaration).captured(3);
+        const int valueBegin = VerilogTokenizer::nextCodeToken(tokens, assignment + 1);
+        int valueEnd = valueBegin;
+        int valueLast = -1;
+        int depth = 0;
+        while (valueEnd < limit)
+        {
+            depth += bracketDepthChange(input, tokens.at(valueEnd));
+            if (depth == 0 && (VerilogTokenizer::isSymbol(input, tokens, valueEnd, ',') ||
+                VerilogTokenizer::isSymbol(input, tokens, valueEnd, ';')))
+            {
+                break;
+            }
 
-    QRegularExpressionMatch rangeMatch = VerilogSyntax::CAPTURING_RANGE.match(bitRange);
-    QString right = rangeMatch.captured(2);
+            if (tokens.at(valueEnd).type != VerilogTokenizer::COMMENT)
+            {
+                valueLast = valueEnd;
+            }
 
-    return right;
-}
+            ++valueEnd;
+        }
 
-//-----------------------------------------------------------------------------
-// Function: VerilogParameterParser::parseArrayLeft()
-//-----------------------------------------------------------------------------
-QString VerilogParameterParser::parseArrayLeft(QString const& declaration)
-{
-    QString bitRange = TYPE_RULE.match(declaration).captured(2);
+        QString value;
+        if (valueLast != -1)
+        {
+            value = VerilogTokenizer::textWithoutComments(input, tokens, valueBegin, valueLast).simplified();
+        }
+
+        // Each name value pair produces a new module parameter, but the type and the description is recycled.
+        QSharedPointer<ModuleParameter> moduleParameter =  QSharedPointer<ModuleParameter>(new ModuleParameter());      
+        moduleParameter->setName(VerilogTokenizer::tokenText(input, tokens.at(position)).toString());
+        moduleParameter->setDataType(type);
+        moduleParameter->setType(createTypeFromDataType(type));
+        moduleParameter->setValue(value);
+        moduleParameter->setUsageType("nontyped");
+        moduleParameter->setVectorLeft(vectorBounds.first);
+        moduleParameter->setVectorRight(vectorBounds.second);
+        moduleParameter->setArrayLeft(arrayBounds.first);
+        moduleParameter->setArrayRight(arrayBounds.second);
+        moduleParameter->setDescription(description);
+
+        // No type plus has vectors, means that we set type as bit for compatibility.
+        if (!moduleParameter->getVectors()->isEmpty() && moduleParameter->getType().isEmpty())
+        {
+            moduleParameter->setType(QStringLiteral("bit"));
+        }
 
-    return VerilogSyntax::CAPTURING_RANGE.match(bitRange).captured(1);
+        parameters.append(moduleParameter);
+
+        if (valueEnd == limit || !VerilogTokenizer::isSymbol(input, tokens, valueEnd, ','))
+        {
+            break;
+        }
+
+        position = VerilogTokenizer::nextCodeToken(tokens, valueEnd + 1);
+    }
+
+    return parameters;
 }
 
 //-----------------------------------------------------------------------------
-// Function: VerilogParameterParser::parseArrayRight()
+// Function: VerilogParameterParser::createTypeFromDataType()
 //-----------------------------------------------------------------------------
-QString VerilogParameterParser::parseArrayRight(QString const& declaration)
+QString VerilogParameterParser::createTypeFromDataType(QString const& dataType)
 {
-    QString bitRange = TYPE_RULE.match(declaration).captured(2);
-
-    return VerilogSyntax::CAPTURING_RANGE.match(bitRange).captured(2);
+    QRegularExpression knownTypes(QStringLiteral("bit|byte|shortint|int|longint|shortreal|real|string"));
+    return knownTypes.match(dataType).captured();
 }
 
 //-----------------------------------------------------------------------------
 // Function: VerilogParameterParser::parseDescription()
 //-----------------------------------------------------------------------------
-QString VerilogParameterParser::parseDescription(QString const& input)
+QString VerilogParameterParser::parseDescription(QString const& input,
+    QVector<VerilogTokenizer::Token> const& tokens, int first, int last) const
 {
     QString description;
 
-    // If exist, the description is the last comment in the declaration.
-    QRegularExpression commentRule(VerilogSyntax::COMMENT, QRegularExpression::CaseInsensitiveOption);
-    int lastCommentIndex = input.lastIndexOf(commentRule);
-
-    if (lastCommentIndex != -1)
+    // If exist, the description is the last comment after code in the declaration.
+    for (int i = first; i <= last; ++i)
     {
-        QRegularExpressionMatch commmentMatch = commentRule.match(input, lastCommentIndex);
-
-        // Found the index. The description is starting index + length.
-        description = input.mid(commmentMatch.capturedStart(), commmentMatch.capturedLength());
-
-        // Some times the expression leaves the comment tag to the description.
-        if (description.startsWith("//"))
+        VerilogTokenizer::Token const& token = tokens.at(i);
+        if (VerilogTokenizer::isLineComment(input, token) && !startsLine(input, token.start))
         {
-            description = description.remove(0, 2);
+            description = VerilogTokenizer::commentText(input, token);
         }
-
-        // No need for extra white spaces.
-        description = description.trimmed();
     }
 
     return description;
@@ -391,17 +571,27 @@ void VerilogParameterParser::replaceNamesReferencesWithIds(
 
         moduleParameter->setValue(targetParameter->getValueId());
     }
+
+    // Names are resolved once, so the references are found without a search per parameter.
+    QHash<QString, QSharedPointer<Parameter> > parametersByName;
+    for (QSharedPointer<Parameter> parameter : *targetComponent->getParameters())
+    {
+        if (!parametersByName.contains(parameter->name()))
+        {
+            parametersByName.insert(parameter->name(), parameter);
+        }
+    }
     
     for (QSharedPointer<Parameter> parameter : *targetComponent->getParameters())
     {
-        replaceNameReferencesWithParameterIds(parameter, targetComponent);
+        replaceNameReferencesWithParameterIds(parameter, parametersByName);
     }
 
     if (targetComponentInstantiation.isNull() == false)
     {
         foreach(QSharedPointer<ModuleParameter> parameter, *targetComponentInstantiation->getModuleParameters())
         {
-            replaceNameReferencesWithParameterIds(parameter, targetComponent);
+            replaceNameReferencesWithParameterIds(parameter, parametersByName);
         }
     }
 }
@@ -410,47 +600,39 @@ void VerilogParameterParser::replaceNamesReferencesWithIds(
 // Function: VerilogParameterParser::replaceParameterNamesWithIds()
 //-----------------------------------------------------------------------------
 void VerilogParameterParser::replaceNameReferencesWithParameterIds(QSharedPointer<Parameter> parameter,
-    QSharedPointer<Component> targetComponent) const
+    QHash<QString, QSharedPointer<Parameter> > const& parametersByName) const
 {
-    foreach (QSharedPointer<Parameter> define, *targetComponent->getParameters())
-    {
-        QRegularExpression macroUsage("`?" + define->name() + "\\b");
-
-        QString parameterValue = replaceNameWithId(parameter->getValue(), macroUsage, define);
-        parameter->setValue(parameterValue);
-
-        QString bitWidthLeft = replaceNameWithId(parameter->getVectorLeft(), macroUsage, define);
-        parameter->setVectorLeft(bitWidthLeft);
-
-        QString bitWidthRight = replaceNameWithId(parameter->getVectorRight(), macroUsage, define);
-        parameter->setVectorRight(bitWidthRight);
-
-        QString arrayLeft = replaceNameWithId(parameter->getArrayLeft(), macroUsage, define);
-        parameter->setArrayLeft(arrayLeft);
-
-        QString arrayRight = replaceNameWithId(parameter->getArrayRight(), macroUsage, define);
-        parameter->setArrayRight(arrayRight);
-    }
+    parameter->setValue(replaceNamesWithIds(parameter->getValue(), parametersByName));
+    parameter->setVectorLeft(replaceNamesWithIds(parameter->getVectorLeft(), parametersByName));
+    parameter->setVectorRight(replaceNamesWithIds(parameter->getVectorRight(), parametersByName));
+    parameter->setArrayLeft(replaceNamesWithIds(parameter->getArrayLeft(), parametersByName));
+    parameter->setArrayRight(replaceNamesWithIds(parameter->getArrayRight(), parametersByName));
 }
 
 //-----------------------------------------------------------------------------
-// Function: VerilogParameterParser::replaceNameWithId()
+// Function: VerilogParameterParser::replaceNamesWithIds()
 //-----------------------------------------------------------------------------
-QString VerilogParameterParser::replaceNameWithId(QString const& expression, QRegularExpression& namePattern, 
-    QSharedPointer<Parameter> referenced) const
+QString VerilogParameterParser::replaceNamesWithIds(QString const& expression,
+    QHash<QString, QSharedPointer<Parameter> > const& parametersByName) const
 {
-    QString replaced = expression;
-    QRegularExpressionMatch match = namePattern.match(expression);
-    if (match.hasMatch())
+    QSet<Parameter*> referencedParameters;
+
+    return VerilogTokenizer::replaceIdentifiers(expression,
+        [&parametersByName, &referencedParameters](QString const& name, QString& replacement)
     {
-        replaced.replace(namePattern, referenced->getValueId());
+        QSharedPointer<Parameter> referenced = parametersByName.value(name);
+        if (referenced.isNull())
+        {
+            return false;
+        }
 
-        int count = match.capturedTexts().count();
-        for (int i = 0; i < count; i++)
+        if (!referencedParameters.contains(referenced.data()))
         {
+            referencedParameters.insert(referenced.data());
             referenced->increaseUsageCount();
         }
-    }
 
-    return replaced;
+        replacement = referenced->getValueId();
+        return true;
+    });
 }
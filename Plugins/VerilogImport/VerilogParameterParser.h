@@ -14,13 +14,18 @@
 
 #include <IPXACTmodels/generaldeclarations.h>
 
+#include <QHash>
+#include <QPair>
 #include <QSharedPointer>
 #include <QString>
+#include <QVector>
 #include <IPXACTmodels/common/ModuleParameter.h>
 
 #include <Plugins/PluginSystem/ImportPlugin/HighlightSource.h>
 #include "IPXACTmodels/Component/ComponentInstantiation.h"
 
+#include "VerilogTokenizer.h"
+
 class Component;
 
 //-----------------------------------------------------------------------------
@@ -41,7 +46,7 @@ public:
     VerilogParameterParser& operator=(VerilogParameterParser const& rhs) = delete;
 
     /*!
-     *  Runs the port parsing for the given input and adds the parsed ports to the given component.
+     *  Runs the parameter parsing for the given input and adds the parsed parameters to the given component.
      *
      *      @param [in] componentDeclaration            The selected component declaration from the input text.
      *      @param [in] targetComponent                 The component to add all the imported parameters to.
@@ -50,6 +55,19 @@ public:
     virtual void import(QString const& componentDeclaration, QSharedPointer<Component> targetComponent,
         QSharedPointer<ComponentInstantiation> targetComponentInstantiation);
 
+    /*!
+     *  Runs the parameter parsing for the given tokenized input and adds the parsed parameters to the given
+     *  component.
+     *
+     *      @param [in] componentDeclaration            The selected component declaration from the input text.
+     *      @param [in] tokens                          The tokens of the component declaration.
+     *      @param [in] targetComponent                 The component to add all the imported parameters to.
+     *      @param [in] targetComponentInstantiation    The instantiation to add all the imported parameters to.
+     */
+    void import(QString const& componentDeclaration, QVector<VerilogTokenizer::Token> const& tokens,
+        QSharedPointer<Component> targetComponent,
+        QSharedPointer<ComponentInstantiation> targetComponentInstantiation);
+
     /*!
      *  Sets the given highlighter to be used by the generic parser.
      *
@@ -80,84 +98,84 @@ private:
     /*!
      * Find the section in the input containing the parameter declarations.
      *
-     *     @param [in] input  The input text to search.
+     *     @param [in] input    The input text to search.
+     *     @param [in] tokens   The tokens of the input.
      *
-     *     @return The section of the text containing parameter declarations.
+     *     @return The index of the first token in the section and the index of the token ending the section.
      */
-     QString findParameterSection(QString const &input);
+    QPair<int, int> findParameterSection(QString const& input, QVector<VerilogTokenizer::Token> const& tokens) const;
 
     /*!
-     *  Finds parameter declarations from the given string.
+     *  Finds parameter declarations from the given input.
      *
-     *      @param [in] componentDeclaration    The component declaration containing the parameters.
-     *      @param [in] parameterArea           The input text containing the declarations.     
+     *      @param [in] input   The input text containing the declarations.
+     *      @param [in] tokens  The tokens of the input.
      *
-     *      @return   The resulting list of declarations.
+     *      @return The indexes of the first and the last token of each declaration.
      */
-     QStringList findParameterDeclarations(QString const& componentDeclaration, QString const& parameterArea);
+    QVector<QPair<int, int> > findParameterDeclarations(QString const& input,
+        QVector<VerilogTokenizer::Token> const& tokens) const;
 
     /*!
-     *  Create an IP-XACT type for the parameter according to the given data type.
+     *  Finds the last token of the parameter declaration beginning at the given token.
      *
-     *      @param [in] dataType    The selected data type.
+     *      @param [in] input   The input text containing the declaration.
+     *      @param [in] tokens  The tokens of the input.
+     *      @param [in] first   Index of the parameter keyword token beginning the declaration.
+     *      @param [in] limit   Index of the token ending the parameter section.
      *
-     *      @return The type matching the data type, or none if data type does not match any IP-XACT type.
+     *      @return Index of the last token in the declaration.
      */
-    QString createTypeFromDataType(QString const& dataType);
+    int findDeclarationEnd(QString const& input, QVector<VerilogTokenizer::Token> const& tokens,
+        int first, int limit) const;
 
     /*!
-     *  Tries to parse the type of the declared parameters.
+     *  Gets the text of a declaration without the multi-line comments and the comment lines.
      *
-     *      @param [in] input   The input text containing a declaration of parameters.
+     *      @param [in] input   The input text containing the declaration.
+     *      @param [in] tokens  The tokens of the input.
+     *      @param [in] first   Index of the first token in the declaration.
+     *      @param [in] last    Index of the last token in the declaration.
      *
-     *      @return   The parsed type.
+     *      @return The declaration text.
      */
-     QString parseType(QString const& input);
-     
-     /*!
-      *  Parses the left value of bit width of the parameter.
-      *
-      *     @param [in] declaration    The parameter declaration to parse.
-      *
-      *     @return The left value of the parameters bit width vector.
-      */
-     QString parseBitWidthLeft(QString const& declaration);
+    QString declarationText(QString const& input, QVector<VerilogTokenizer::Token> const& tokens,
+        int first, int last) const;
 
-     /*!
-      *  Parses the right value of bit width of the parameter.
-      *
-      *      @param [in] declaration    The parameter declaration to parse.
-      *
-      *      @return The right value of the parameters bit width vector.
-      */
-     QString parseBitWidthRight(QString const& declaration);
+    /*!
+     *  Parses parameters out of the given declaration.
+     *
+     *      @param [in] input   The input text containing the declaration.
+     *      @param [in] tokens  The tokens of the input.
+     *      @param [in] first   Index of the first token in the declaration.
+     *      @param [in] last    Index of the last token in the declaration.
+     *
+     *      @return The parsed model parameters.
+     */
+    QList<QSharedPointer<ModuleParameter> > parseParameters(QString const& input,
+        QVector<VerilogTokenizer::Token> const& tokens, int first, int last);
 
-     /*!
-      *  Parses the left bound for the parameter array.
-      *
-      *      @param [in] declaration   The parameter declaration to parse.
-      *
-      *      @return The left array bound.
-      */
-     QString parseArrayLeft(QString const& declaration);
-     
-     /*!
-      *  Parses the right bound for the parameter array.
-      *
-      *      @param [in] declaration   The parameter declaration to parse.
-      *
-      *      @return The right array bound.
-      */
-     QString parseArrayRight(QString const& declaration);
+    /*!
+     *  Create an IP-XACT type for the parameter according to the given data type.
+     *
+     *      @param [in] dataType    The selected data type.
+     *
+     *      @return The type matching the data type, or none if data type does not match any IP-XACT type.
+     */
+    QString createTypeFromDataType(QString const& dataType);
 
     /*!
-     *  Tries to parse the descriptions of the declared parameters.
+     *  Parses the description of the declared parameters from the last comment tailing a line in the declaration.
      *
-     *      @param [in] input   The input text containing a declaration of parameters.
+     *      @param [in] input   The input text containing the declaration.
+     *      @param [in] tokens  The tokens of the input.
+     *      @param [in] first   Index of the first token in the declaration.
+     *      @param [in] last    Index of the last token in the declaration.
      *
-     *      @return   The parsed description.
+     *      @return The parsed description.
      */
-     QString parseDescription(QString const& input);
+    QString parseDescription(QString const& input, QVector<VerilogTokenizer::Token> const& tokens,
+        int first, int last) const;
 
      /*!
       *  Copies the model parameter ids from the component to the parsed model parameters.
@@ -181,23 +199,22 @@ private:
       *  Replaces macro uses in parameter with corresponding id references.
       *
       *      @param [in] parameter          The parameter whose macro uses to replace.
-      *      @param [in] targetComponent    The containing component.
+      *      @param [in] parametersByName   The parameters of the containing component by their names.
       */
      void replaceNameReferencesWithParameterIds(QSharedPointer<Parameter> parameter, 
-         QSharedPointer<Component> targetComponent) const;
+         QHash<QString, QSharedPointer<Parameter> > const& parametersByName) const;
 
      /*!
-      *  Replaces a name reference in an expression with id.
-      *  Increases reference count of the referenced parameter accordingly.
+      *  Replaces the name references in an expression with ids.
+      *  Increases reference count of each referenced parameter once.
       *
-      *      @param [in] expression   The expression to replace the references in.
-      *      @param [in] namePattern  The pattern for name reference search.
-      *      @param [in] referenced   The parameter that matches the name pattern.
+      *      @param [in] expression         The expression to replace the references in.
+      *      @param [in] parametersByName   The parameters that may be referenced by their names.
       *
-      *      @return The expression where names have been replaced with the id of the referenced parameter.
+      *      @return The expression where names have been replaced with the ids of the referenced parameters.
       */
-     QString replaceNameWithId(QString const& expression, QRegularExpression& namePattern, 
-         QSharedPointer<Parameter> referenced) const;
+     QString replaceNamesWithIds(QString const& expression,
+         QHash<QString, QSharedPointer<Parameter> > const& parametersByName) const;
 
      //-----------------------------------------------------------------------------
      // Data.
@@ -11,8 +11,6 @@
 
 #include "VerilogPortParser.h"
 
-#include "VerilogSyntax.h"
-
 #include <Plugins/PluginSystem/ImportPlugin/ImportColors.h>
 
 #include <editors/ComponentEditor/common/ExpressionParser.h>
@@ -22,49 +20,46 @@
 #include <IPXACTmodels/Component/Port.h>
 
 #include <QString>
-#include <QRegularExpression>
+
+using VerilogTokenizer::Token;
 
 namespace
 {
-    //! Verilog port directions.
-    const QString PORT_DIRECTION("input|output|inout");
-
-    //! Verilog port types.
-    const QString PORT_TYPE("\\w+");
-
-    //! Subset of Verilog preprocessor commands.
-    const QString PREPROCESSOR_COMMAND("`(?:ifdef|ifndef|endif)[^\\r\\n]*");
-
-    //! Port declaration ends if preprocessor command is found. Preceding comment will be included.
-    const QString END_BEFORE_PREPROCESSOR("(?:[ \\t]*" + VerilogSyntax::COMMENT + ")?"
-        "(?=\\s*" + PREPROCESSOR_COMMAND + ")");
-
-    //! Port declaration ends if next port declaration is found.
-    const QString END_BEFORE_NEXT_ITEM("\\s*[,;][ \\t]*(?:"+ VerilogSyntax::COMMENT + ")?");
-
-    //! Port declaration ends if no more ports follow the declaration.
-    const QString LAST_PORT("(?:[ \\t]*" + VerilogSyntax::COMMENT + ")?(?=\\s*$)");
-
-    //! Port declaration must end with one of the conditions above.
-    const QString PORT_DECLARATION_END("(?:" + END_BEFORE_PREPROCESSOR + ")|"
-        "(?:" + END_BEFORE_NEXT_ITEM + ")|"
-        "(?:" + LAST_PORT +")");
+    //-----------------------------------------------------------------------------
+    // Function: directionOf()
+    //-----------------------------------------------------------------------------
+    DirectionTypes::Direction directionOf(QString const& input, QVector<Token> const& tokens, int index)
+    {
+        if (VerilogTokenizer::isKeyword(input, tokens, index, QLatin1String("input")))
+        {
+            return DirectionTypes::IN;
+        }
+        else if (VerilogTokenizer::isKeyword(input, tokens, index, QLatin1String("output")))
+        {
+            return DirectionTypes::OUT;
+        }
+        else if (VerilogTokenizer::isKeyword(input, tokens, index, QLatin1String("inout")))
+        {
+            return DirectionTypes::INOUT;
+        }
 
-    //! Verilog ports in both ANSI-C and Verilog-1995 style.
-    const QRegularExpression PORT_EXP("(" + PORT_DIRECTION + ")\\s+(?:wire\\s+)?(?:(" + PORT_TYPE + ")\\s+)?"
-        "(?:signed)?\\s*(?:(" + VerilogSyntax::RANGE +")?\\s*(" + VerilogSyntax::RANGE + "))?\\s*"
-        "(" + VerilogSyntax::NAMES + ")(?:" + PORT_DECLARATION_END + ")");
+        return DirectionTypes::DIRECTION_INVALID;
+    }
 
-    //! Verilog ports in Verilog-1995 style.
-    const QRegularExpression PORT_1995("(" + PORT_DIRECTION + ")\\s+"
-        "(?:(" + PORT_TYPE + ")\\s+)?(" + VerilogSyntax::RANGE + ")?\\s*"
-        "(" + VerilogSyntax::NAMES + ")\\s*[;](?:[ \\t]*"+ VerilogSyntax::COMMENT + ")?");
+    //-----------------------------------------------------------------------------
+    // Function: isPortName()
+    //-----------------------------------------------------------------------------
+    bool isPortName(QString const& input, QVector<Token> const& tokens, int index, int limit)
+    {
+        return index < limit && tokens.at(index).type == VerilogTokenizer::IDENTIFIER &&
+            directionOf(input, tokens, index) == DirectionTypes::DIRECTION_INVALID;
+    }
 }
 
 //-----------------------------------------------------------------------------
 // Function: VerilogPortParser::VerilogPortParser()
 //-----------------------------------------------------------------------------
-VerilogPortParser::VerilogPortParser(): highlighter_(0), parser_(new NullParser)
+VerilogPortParser::VerilogPortParser(): highlighter_(0), parser_(new NullParser), parametersByName_()
 {
 
 }
@@ -74,16 +69,34 @@ VerilogPortParser::VerilogPortParser(): highlighter_(0), parser_(new NullParser)
 //-----------------------------------------------------------------------------
 void VerilogPortParser::import(QString const& input, QSharedPointer<Component> targetComponent,
 	QSharedPointer<ComponentInstantiation> targetComponentInstantiation)
+{
+    import(input, VerilogTokenizer::tokenize(input), targetComponent, targetComponentInstantiation);
+}
+
+//-----------------------------------------------------------------------------
+// Function: VerilogPortParser::import()
+//-----------------------------------------------------------------------------
+void VerilogPortParser::import(QString const& input, QVector<VerilogTokenizer::Token> const& tokens,
+    QSharedPointer<Component> targetComponent, QSharedPointer<ComponentInstantiation> targetComponentInstantiation)
 {
     foreach (QSharedPointer<Port> existingPort, *targetComponent->getPorts())
     {
         existingPort->setDirection(DirectionTypes::DIRECTION_PHANTOM);
     }
 
-    foreach (QString portDeclaration, findPortDeclarations(input))
+    parametersByName_.clear();
+    foreach (QSharedPointer<Parameter> parameter, *targetComponent->getParameters())
     {
-        createPortFromDeclaration(portDeclaration, targetComponent, targetComponentInstantiation);
-        highlight(portDeclaration, input);
+        if (!parametersByName_.contains(parameter->name()))
+        {
+            parametersByName_.insert(parameter->name(), parameter);
+        }
+    }
+
+    for (PortDeclaration const& declaration : findPortDeclarations(input, tokens))
+    {
+        createPortFromDeclaration(declaration, targetComponent);
+        highlight(input.mid(declaration.begin_, declaration.end_ - declaration.begin_), input);
     }
 }
 
@@ -106,150 +119,285 @@ void VerilogPortParser::setExpressionParser(QSharedPointer<ExpressionParser> par
 //-----------------------------------------------------------------------------
 // Function: VerilogPortParser::findPortDeclarations()
 //-----------------------------------------------------------------------------
-QStringList VerilogPortParser::findPortDeclarations(QString const& input) const
+QVector<VerilogPortParser::PortDeclaration> VerilogPortParser::findPortDeclarations(QString const& input,
+    QVector<VerilogTokenizer::Token> const& tokens) const
 {
-    QString portSection = findPortsSection(removeIgnoredLines(input));
+    const int tokenCount = tokens.size();
 
-    return portDeclarationsIn(portSection);
-}
+    // The module header is: module name [#(parameters)] (ports); followed by the body and endmodule.
+    const int moduleIndex = VerilogTokenizer::findModule(input, tokens);
+    if (moduleIndex == tokenCount)
+    {
+        return QVector<PortDeclaration>();
+    }
 
-//-----------------------------------------------------------------------------
-// Function: VerilogPortParser::findPortsSection()
-//-----------------------------------------------------------------------------
-QString VerilogPortParser::findPortsSection(QString const& input) const
-{
-    bool noValidModule = input.indexOf(VerilogSyntax::MODULE_BEGIN) == -1 || 
-        input.indexOf(VerilogSyntax::MODULE_END) == -1;
+    const int nameIndex = VerilogTokenizer::nextCodeToken(tokens, moduleIndex + 1);
 
-    if (noValidModule)
+    int position = VerilogTokenizer::nextCodeToken(tokens, nameIndex + 1);
+    if (VerilogTokenizer::isSymbol(input, tokens, position, '#'))
     {
-        return QString();
+        const int parametersBegin = VerilogTokenizer::nextCodeToken(tokens, position + 1);
+        const int parametersEnd = VerilogTokenizer::isSymbol(input, tokens, parametersBegin, '(') ?
+            VerilogTokenizer::closingBracket(input, tokens, parametersBegin) : -1;
+        if (parametersEnd == -1)
+        {
+            return QVector<PortDeclaration>();
+        }
+
+        position = VerilogTokenizer::nextCodeToken(tokens, parametersEnd + 1);
     }
 
-    QString portSection;
-    if (hasVerilog1995Ports(input))
+    const int listBegin = position;
+    const int listEnd = VerilogTokenizer::isSymbol(input, tokens, listBegin, '(') ?
+        VerilogTokenizer::closingBracket(input, tokens, listBegin) : -1;
+    const int headerEnd = listEnd == -1 ? tokenCount : VerilogTokenizer::nextCodeToken(tokens, listEnd + 1);
+    if (!VerilogTokenizer::isSymbol(input, tokens, headerEnd, ';'))
     {
-        portSection = findVerilog1995PortsSectionInModule(input);
+        return QVector<PortDeclaration>();
     }
-    else
+
+    int moduleEnd = headerEnd + 1;
+    while (moduleEnd < tokenCount && !VerilogTokenizer::isKeyword(input, tokens, moduleEnd,
+        QLatin1String("endmodule")))
     {
-        portSection = findVerilog2001PortsSection(input);
+        ++moduleEnd;
     }
 
-    return portSection;
-}
+    if (moduleEnd == tokenCount)
+    {
+        return QVector<PortDeclaration>();
+    }
 
-//-----------------------------------------------------------------------------
-// Function: VerilogPortParser::hasVerilog1995Ports()
-//-----------------------------------------------------------------------------
-bool VerilogPortParser::hasVerilog1995Ports(QString const& input) const
-{
-    QString commentsRemoved = input;
-    commentsRemoved.remove(QRegularExpression(VerilogSyntax::COMMENT));
+    // Ports are declared in the header (ANSI-C style), if the port list has directions.
+    bool ansiStyle = false;
+    for (int i = listBegin + 1; i < listEnd && !ansiStyle; ++i)
+    {
+        ansiStyle = directionOf(input, tokens, i) != DirectionTypes::DIRECTION_INVALID;
+    }
+
+    if (!ansiStyle)
+    {
+        return findVerilog1995Ports(input, tokens, headerEnd + 1, moduleEnd);
+    }
+
+    QVector<PortDeclaration> declarations;
+
+    position = listBegin + 1;
+    while (position < listEnd)
+    {
+        if (directionOf(input, tokens, position) == DirectionTypes::DIRECTION_INVALID)
+        {
+            ++position;
+            continue;
+        }
 
-    bool hasPortsAfterModuleDeclaration = (commentsRemoved.indexOf(PORT_1995, findStartOfPortList(commentsRemoved)) != -1);
-    return hasPortsAfterModuleDeclaration;
+        PortDeclaration declaration;
+        if (parsePortDeclaration(input, tokens, position, listEnd, true, declaration))
+        {
+            declarations.append(declaration);
+        }
+    }
+
+    return declarations;
 }
 
 //-----------------------------------------------------------------------------
-// Function: VerilogPortParser::findStartOfPortList()
+// Function: VerilogPortParser::findVerilog1995Ports()
 //-----------------------------------------------------------------------------
-int VerilogPortParser::findStartOfPortList(QString const& input) const
+QVector<VerilogPortParser::PortDeclaration> VerilogPortParser::findVerilog1995Ports(QString const& input,
+    QVector<VerilogTokenizer::Token> const& tokens, int bodyBegin, int bodyEnd) const
 {
-    return input.lastIndexOf('(', input.indexOf(VerilogSyntax::MODULE_BEGIN)) + 1;
-}
+    QVector<PortDeclaration> declarations;
 
-//-----------------------------------------------------------------------------
-// Function: VerilogPortParser::findVerilog1995PortsSectionInModule()
-//-----------------------------------------------------------------------------
-QString VerilogPortParser::findVerilog1995PortsSectionInModule(QString const& input) const
-{    
-    QString section = input;
+    // The port list ends at the first statement after the ports that is not a port declaration.
+    int position = VerilogTokenizer::nextCodeToken(tokens, bodyBegin);
+    while (position < bodyEnd)
+    {
+        if (directionOf(input, tokens, position) != DirectionTypes::DIRECTION_INVALID)
+        {
+            int next = position;
+            PortDeclaration declaration;
+            if (parsePortDeclaration(input, tokens, next, bodyEnd, false, declaration))
+            {
+                declarations.append(declaration);
+                position = VerilogTokenizer::nextCodeToken(tokens, next);
+                continue;
+            }
+        }
 
-    int startOfPortList = section.indexOf(QRegularExpression("[)]\\s*;"), findStartOfPortList(input)); 
-    int endOfModule = section.indexOf(VerilogSyntax::MODULE_END, startOfPortList);
-    
-    QRegularExpression lastPort(PORT_1995.pattern() + "(?!\\s*(" + VerilogSyntax::COMMENT + ")?\\s*" + PORT_1995.pattern() + ")");
+        if (!declarations.isEmpty())
+        {
+            break;
+        }
 
-    int endOfPortList = qMin(lastPort.match(section, startOfPortList).capturedEnd(), endOfModule);
+        // Tasks and functions may declare their own inputs and outputs.
+        const bool isTask = VerilogTokenizer::isKeyword(input, tokens, position, QLatin1String("task"));
+        if (isTask || VerilogTokenizer::isKeyword(input, tokens, position, QLatin1String("function")))
+        {
+            const QLatin1String blockEnd = isTask ? QLatin1String("endtask") : QLatin1String("endfunction");
+            while (position < bodyEnd && !VerilogTokenizer::isKeyword(input, tokens, position, blockEnd))
+            {
+                ++position;
+            }
+        }
+        else
+        {
+            while (position < bodyEnd && !VerilogTokenizer::isSymbol(input, tokens, position, ';'))
+            {
+                ++position;
+            }
+        }
+
+        position = VerilogTokenizer::nextCodeToken(tokens, position + 1);
+    }
 
-    return section.mid(startOfPortList, endOfPortList - startOfPortList);
+    return declarations;
 }
 
 //-----------------------------------------------------------------------------
-// Function: VerilogPortParser::findVerilog2001PortsSection()
+// Function: VerilogPortParser::parsePortDeclaration()
 //-----------------------------------------------------------------------------
-QString VerilogPortParser::findVerilog2001PortsSection(QString const& input) const
+bool VerilogPortParser::parsePortDeclaration(QString const& input, QVector<VerilogTokenizer::Token> const& tokens,
+    int& position, int limit, bool ansiStyle, PortDeclaration& declaration) const
 {
-    QRegularExpression portsEnd("[)];");
+    declaration.direction_ = directionOf(input, tokens, position);
+    declaration.begin_ = tokens.at(position).start;
 
-    int portSectionBegin = findStartOfPortList(input);
-    int portSectionEnd = input.indexOf(portsEnd, portSectionBegin);
+    // The qualifiers e.g. wire, reg or signed are words followed by another word or a range.
+    QStringList qualifiers;
+    position = VerilogTokenizer::nextCodeToken(tokens, position + 1);
+    while (isPortName(input, tokens, position, limit))
+    {
+        const int next = VerilogTokenizer::nextCodeToken(tokens, position + 1);
+        if (next == limit || (tokens.at(next).type != VerilogTokenizer::IDENTIFIER &&
+            !VerilogTokenizer::isSymbol(input, tokens, next, '[')))
+        {
+            break;
+        }
 
-    bool noPortSection = (portSectionBegin == -1 || portSectionEnd == -1);
+        qualifiers.append(VerilogTokenizer::tokenText(input, tokens.at(position)).toString());
+        position = next;
+    }
 
-    if (noPortSection)
+    QVector<QPair<QString, QString> > ranges;
+    while (position < limit && VerilogTokenizer::isSymbol(input, tokens, position, '['))
     {
-        return QString();
+        const int rangeEnd = VerilogTokenizer::closingBracket(input, tokens, position);
+        if (rangeEnd == -1 || rangeEnd >= limit)
+        {
+            position = limit;
+            return false;
+        }
+
+        ranges.append(VerilogTokenizer::splitRange(input, tokens, position, rangeEnd));
+        position = VerilogTokenizer::nextCodeToken(tokens, rangeEnd + 1);
     }
 
-    int portSectionLength = portSectionEnd - portSectionBegin;
+    if (!ansiStyle && (qualifiers.size() > 1 || qualifiers.contains(QStringLiteral("signed")) ||
+        ranges.size() > 1))
+    {
+        return false;
+    }
 
-    return input.mid(portSectionBegin, portSectionLength);
-}
+    for (QString const& qualifier : qualifiers)
+    {
+        if (qualifier != QLatin1String("wire") && qualifier != QLatin1String("signed") &&
+            qualifier != QLatin1String("unsigned"))
+        {
+            declaration.type_ = qualifier;
+            break;
+        }
+    }
 
-//-----------------------------------------------------------------------------
-// Function: VerilogPortParser::removeIgnoredLines()
-//-----------------------------------------------------------------------------
-QString VerilogPortParser::removeIgnoredLines(QString const& portSection) const
-{
-    QString portSectionWithoutComments = portSection;
-    QRegularExpression multilineComment(VerilogSyntax::MULTILINE_COMMENT);
+    if (ranges.size() == 2)
+    {
+        declaration.arrayBounds_ = ranges.first();
+        declaration.vectorBounds_ = ranges.last();
+    }
+    else if (ranges.size() == 1)
+    {
+        declaration.vectorBounds_ = ranges.first();
+    }
 
-    return  portSectionWithoutComments.remove(VerilogSyntax::COMMENTLINE).remove(multilineComment);
-}
+    // Names are separated by commas. The declaration ends at a comma followed by another declaration.
+    int last = -1;
+    while (isPortName(input, tokens, position, limit))
+    {
+        declaration.names_.append(VerilogTokenizer::tokenText(input, tokens.at(position)).toString());
+        last = position;
 
-//-----------------------------------------------------------------------------
-// Function: VerilogPortParser::portDeclarationsIn()
-//-----------------------------------------------------------------------------
-QStringList VerilogPortParser::portDeclarationsIn(QString const& portSection) const
-{
-    QStringList portDeclarations;
+        const int separator = VerilogTokenizer::nextCodeToken(tokens, position + 1);
+        const int next = VerilogTokenizer::nextCodeToken(tokens, separator + 1);
+        if (!VerilogTokenizer::isSymbol(input, tokens, separator, ',') || !isPortName(input, tokens, next, limit))
+        {
+            break;
+        }
 
-    QRegularExpressionMatchIterator matches = PORT_EXP.globalMatch(portSection);
-    while (matches.hasNext())
+        position = next;
+    }
+
+    if (last == -1)
     {
-        portDeclarations.append(matches.next().captured());
+        return false;
     }
 
-    return portDeclarations;
+    const int nameComment = VerilogTokenizer::trailingComment(input, tokens, last, limit);
+    if (nameComment != -1)
+    {
+        declaration.description_ = VerilogTokenizer::commentText(input, tokens.at(nameComment));
+        last = nameComment;
+    }
+
+    // Header ports end at a comma, a macro e.g. `ifdef or the end of the port list. Body ports end at a semicolon.
+    position = VerilogTokenizer::nextCodeToken(tokens, last + 1);
+    if (ansiStyle && VerilogTokenizer::isSymbol(input, tokens, position, ','))
+    {
+        last = position;
+    }
+    else if (ansiStyle && position < limit && tokens.at(position).type != VerilogTokenizer::MACRO)
+    {
+        return false;
+    }
+    else if (!ansiStyle)
+    {
+        if (!VerilogTokenizer::isSymbol(input, tokens, position, ';'))
+        {
+            return false;
+        }
+
+        last = position;
+    }
+
+    const int separatorComment = tokens.at(last).type == VerilogTokenizer::COMMENT ? -1 :
+        VerilogTokenizer::trailingComment(input, tokens, last, limit);
+    if (separatorComment != -1)
+    {
+        if (declaration.description_.isEmpty())
+        {
+            declaration.description_ = VerilogTokenizer::commentText(input, tokens.at(separatorComment));
+        }
+
+        last = separatorComment;
+    }
+
+    declaration.end_ = tokens.at(last).start + tokens.at(last).length;
+    position = last + 1;
+    return true;
 }
 
 //-----------------------------------------------------------------------------
 // Function: VerilogPortParser::createPortFromDeclaration()
 //-----------------------------------------------------------------------------
-void VerilogPortParser::createPortFromDeclaration(QString const& portDeclaration,
-    QSharedPointer<Component> targetComponent,
-    QSharedPointer<ComponentInstantiation> targetComponentInstantiation) const
+void VerilogPortParser::createPortFromDeclaration(PortDeclaration const& declaration,
+    QSharedPointer<Component> targetComponent) const
 {
-    DirectionTypes::Direction direction = parseDirection(portDeclaration);
-
-    QString type = PORT_EXP.match(portDeclaration).captured(2);
-    if (type.compare(QLatin1String("signed")) == 0)
-    {
-        type.clear();
-    }
-
+    QString const& type = declaration.type_;
     QString typeDefinition;
 
-    QPair<QString, QString> vectorBounds = parseVectorBounds(portDeclaration, targetComponent, targetComponentInstantiation);
-    QPair<QString, QString> arrayBounds = parseArrayBounds(portDeclaration, targetComponent, targetComponentInstantiation);
-
-    QStringList portNames = parsePortNames(portDeclaration);
-
-    QString description = parseDescription(portDeclaration);
+    QPair<QString, QString> vectorBounds = parseLeftAndRight(declaration.vectorBounds_);
+    QPair<QString, QString> arrayBounds = parseLeftAndRight(declaration.arrayBounds_);
 
-    foreach(QString const& name, portNames)
+    foreach(QString const& name, declaration.names_)
     {
         QSharedPointer<Port> port;
         if (targetComponent->hasPort(name))
@@ -264,14 +412,14 @@ void VerilogPortParser::createPortFromDeclaration(QString const& portDeclaration
         }
 
         port->setName(name);
-        port->setDirection(direction);
+        port->setDirection(declaration.direction_);
         port->setLeftBound(vectorBounds.first);
         port->setRightBound(vectorBounds.second);
         port->setTypeName(type);
         port->setTypeDefinition(type, typeDefinition);
         port->setArrayLeft(arrayBounds.first);
         port->setArrayRight(arrayBounds.second);
-        port->setDescription(description);
+        port->setDescription(declaration.description_);
     }
 }
 
@@ -286,124 +434,52 @@ void VerilogPortParser::highlight(QString const& portDeclaration, QString const&
     }
 }
 
-//-----------------------------------------------------------------------------
-// Function: VerilogPortParser::parseDirection()
-//-----------------------------------------------------------------------------
-DirectionTypes::Direction VerilogPortParser::parseDirection(QString const& portDeclaration) const
-{
-    QString directionString = PORT_EXP.match(portDeclaration).captured(1);
-
-    DirectionTypes::Direction portDirection = DirectionTypes::DIRECTION_INVALID;
-    if (directionString == QLatin1String("input"))
-    {
-        portDirection = DirectionTypes::IN;
-    }
-    else if (directionString == QLatin1String("output"))
-    {
-        portDirection = DirectionTypes::OUT;
-    }
-    else if(directionString == QLatin1String("inout"))
-    {
-        portDirection = DirectionTypes::INOUT;
-    }
-
-    return portDirection;
-}
-
-//-----------------------------------------------------------------------------
-// Function: VerilogPortParser::parseArrayBounds()
-//-----------------------------------------------------------------------------
-QPair<QString, QString> VerilogPortParser::parseArrayBounds(QString const& portDeclaration,
-	QSharedPointer<Component> targetComponent, QSharedPointer<ComponentInstantiation> targetComponentInstantiation) const
-{
-    QString vectorBounds = PORT_EXP.match(portDeclaration).captured(3);
-
-    return parseLeftAndRight(vectorBounds, targetComponent, targetComponentInstantiation);
-}
-
 //-----------------------------------------------------------------------------
 // Function: VerilogPortParser::parseLeftAndRight()
 //-----------------------------------------------------------------------------
-QPair<QString, QString> VerilogPortParser::parseLeftAndRight(QString const& bounds,
-	QSharedPointer<Component> targetComponent, QSharedPointer<ComponentInstantiation> targetComponentInstantiation) const
+QPair<QString, QString> VerilogPortParser::parseLeftAndRight(QPair<QString, QString> const& bounds) const
 {
-    QString leftBound = QString();
-    QString rightBound = QString();
+    QString leftBound = bounds.first;
+    QString rightBound = bounds.second;
 
-    if (!bounds.isEmpty())
+    if (!leftBound.isEmpty())
     {
-        leftBound = VerilogSyntax::CAPTURING_RANGE.match(bounds).captured(1);
-        rightBound = VerilogSyntax::CAPTURING_RANGE.match(bounds).captured(2);
-
         bool leftValid = false;
         parser_->parseExpression(leftBound, &leftValid);
         if (leftValid == false)
         {
-            leftBound = replaceNameReferencesWithIds(leftBound, targetComponent);
+            leftBound = replaceNameReferencesWithIds(leftBound);
         }
+    }
 
+    if (!rightBound.isEmpty())
+    {
         bool rightValid = false;
         parser_->parseExpression(rightBound, &rightValid);
         if (rightValid == false)
         {
-            rightBound = replaceNameReferencesWithIds(rightBound, targetComponent);
+            rightBound = replaceNameReferencesWithIds(rightBound);
         }
     }
 
     return qMakePair(leftBound, rightBound);
 }
 
-//-----------------------------------------------------------------------------
-// Function: VerilogPortParser::parseVectorBounds()
-//-----------------------------------------------------------------------------
-QPair<QString, QString> VerilogPortParser::parseVectorBounds(QString const& portDeclaration,
-	QSharedPointer<Component> targetComponent, QSharedPointer<ComponentInstantiation> targetComponentInstantiation) const
-{
-    QString vectorBounds = PORT_EXP.match(portDeclaration).captured(4);
-
-    return parseLeftAndRight(vectorBounds, targetComponent, targetComponentInstantiation);
-}
-
 //-----------------------------------------------------------------------------
 // Function: VerilogPortParser::replaceNameReferencesWithIds()
 //-----------------------------------------------------------------------------
-QString VerilogPortParser::replaceNameReferencesWithIds(QString const& expression, 
-    QSharedPointer<Component> targetComponent) const
+QString VerilogPortParser::replaceNameReferencesWithIds(QString const& expression) const
 {
-    QString result = expression;
-
-        foreach (QSharedPointer<Parameter> define, *targetComponent->getParameters())
+    return VerilogTokenizer::replaceIdentifiers(expression, [this](QString const& name, QString& replacement)
+    {
+        QSharedPointer<Parameter> define = parametersByName_.value(name);
+        if (define.isNull())
         {
-            QRegularExpression macroUsage("`?" + define->name() + "\\b");
-            if (macroUsage.match(result).hasMatch())
-            {
-                result.replace(macroUsage, define->getValueId());
-
-                for(int i = 0; i < expression.count(macroUsage); i++)
-                {
-                    define->increaseUsageCount();
-                }
-            }
+            return false;
         }
 
-    return result;
-}
-
-//-----------------------------------------------------------------------------
-// Function: VerilogPortParser::parsePortNames()
-//-----------------------------------------------------------------------------
-QStringList VerilogPortParser::parsePortNames(QString const& portDeclaration) const
-{
-    QString names = PORT_EXP.match(portDeclaration).captured(5);
-    
-    return names.split(QRegularExpression(QStringLiteral("\\s*[,]\\s*")), QString::SkipEmptyParts);
-}
-
-//-----------------------------------------------------------------------------
-// Function: VerilogPortParser::parseDescription()
-//-----------------------------------------------------------------------------
-QString VerilogPortParser::parseDescription(QString const& portDeclaration) const
-{
-    QRegularExpression commentExp(VerilogSyntax::COMMENT);
-    return commentExp.match(portDeclaration).captured(1).trimmed();
+        define->increaseUsageCount();
+        replacement = define->getValueId();
+        return true;
+    });
 }
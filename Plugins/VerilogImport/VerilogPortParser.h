@@ -16,12 +16,18 @@
 
 #include <Plugins/PluginSystem/ImportPlugin/HighlightSource.h>
 
+#include "VerilogTokenizer.h"
+
+#include <QHash>
 #include <QSharedPointer>
 #include <QString>
+#include <QStringList>
+#include <QVector>
 #include "IPXACTmodels/Component/ComponentInstantiation.h"
 
 class Component;
 class ExpressionParser;
+class Parameter;
 
 //-----------------------------------------------------------------------------
 //! Parser for Verilog ports.
@@ -39,12 +45,25 @@ public:
     /*!
      *  Runs the port parsing for the given input and adds the parsed ports to the given component.
      *
-     *      @param [in] input               The input text to parse.
-     *      @param [in] targetComponent     The component to add all the imported ports to.
+     *      @param [in] input                           The input text to parse.
+     *      @param [in] targetComponent                 The component to add all the imported ports to.
+     *      @param [in] targetComponentInstantiation    The instantiation of the imported module.
      */
     virtual void import(QString const& input, QSharedPointer<Component> targetComponent,
         QSharedPointer<ComponentInstantiation> targetComponentInstantiation);
 
+    /*!
+     *  Runs the port parsing for the given tokenized input and adds the parsed ports to the given component.
+     *
+     *      @param [in] input                           The input text to parse.
+     *      @param [in] tokens                          The tokens of the input.
+     *      @param [in] targetComponent                 The component to add all the imported ports to.
+     *      @param [in] targetComponentInstantiation    The instantiation of the imported module.
+     */
+    void import(QString const& input, QVector<VerilogTokenizer::Token> const& tokens,
+        QSharedPointer<Component> targetComponent,
+        QSharedPointer<ComponentInstantiation> targetComponentInstantiation);
+
     /*!
      *  Sets the given highlighter to be used by the port parser.
      *
@@ -65,78 +84,72 @@ private:
     VerilogPortParser(VerilogPortParser const& rhs);
     VerilogPortParser& operator=(VerilogPortParser const& rhs);
 
-    /*!
-     *  Finds all port declarations from input.
-     *
-     *      @param [in] input   The input to search for port declarations.
-     *
-     *      @return Found port declarations.
-     */
-    QStringList findPortDeclarations(QString const& input) const;
-    
-    /*!
-     *  Finds the section defining the ports of an module.
-     *
-     *      @param [in] input   The input to search for port section.
-     *
-     *      @return The sections containing all ports in module.
-     */
-    QString findPortsSection(QString const& input) const;
+    //! A port declaration found in the input, e.g. input wire [7:0] data_in, data_out; // Data.
+    struct PortDeclaration
+    {
+        //! The direction of the declared ports.
+        DirectionTypes::Direction direction_ = DirectionTypes::DIRECTION_INVALID;
 
-    /*!
-     *  Checks if the given input has ports declared in Verilog-1995 style.
-     *
-     *      @param [in] input   The input to check.
-     *
-     *      @return True, if Verilog-1995 style ports are found, otherwise false.
-     */
-    bool hasVerilog1995Ports(QString const& input) const;
-    
-    /*!
-     *  Finds the end of module declaration in given input.
-     *
-     *      @param [in] input   The input to search for module declaration end.
-     *
-     *      @return The character index in the input for the end of module declaration.
-     */
-    int findStartOfPortList(QString const& input) const;
+        //! The type of the declared ports.
+        QString type_;
 
-    /*!
-     *  Finds the section in the input containing all Verilog-1995 style ports.
-     *
-     *      @param [in] input   The input to search for.
-     *
-     *      @return The section of the input containing all Verilog-1995 style ports.
-     */
-    QString findVerilog1995PortsSectionInModule(QString const& input) const;
+        //! The left and right vector bounds.
+        QPair<QString, QString> vectorBounds_;
+
+        //! The left and right array bounds.
+        QPair<QString, QString> arrayBounds_;
+
+        //! The names of the declared ports.
+        QStringList names_;
+
+        //! The description from the comment tailing the declaration.
+        QString description_;
+
+        //! Position of the first character of the declaration in the input.
+        int begin_ = 0;
+
+        //! Position after the last character of the declaration in the input.
+        int end_ = 0;
+    };
 
     /*!
-     *  Finds the section in the input containing all Verilog-2001 style ports.
+     *  Finds all port declarations from the first module in the input.
      *
-     *      @param [in] input   The input to search for.
+     *      @param [in] input   The input to search for port declarations.
+     *      @param [in] tokens  The tokens of the input.
      *
-     *      @return The section of the input containing all Verilog-2001 style ports.
+     *      @return Found port declarations.
      */
-    QString findVerilog2001PortsSection(QString const& input) const;
+    QVector<PortDeclaration> findPortDeclarations(QString const& input,
+        QVector<VerilogTokenizer::Token> const& tokens) const;
 
     /*!
-     *  Removes all ignored lines e.g. comments from a given input.
+     *  Finds the Verilog-1995 style port declarations in the module body.
      *
-     *      @param [in] input   The input to remove lines from.
+     *      @param [in] input       The input to search for port declarations.
+     *      @param [in] tokens      The tokens of the input.
+     *      @param [in] bodyBegin   Index of the first token in the module body.
+     *      @param [in] bodyEnd     Index of the endmodule keyword token.
      *
-     *      @return The input without ignored lines.
+     *      @return Found port declarations.
      */
-    QString removeIgnoredLines(QString const& portSection) const ;
+    QVector<PortDeclaration> findVerilog1995Ports(QString const& input,
+        QVector<VerilogTokenizer::Token> const& tokens, int bodyBegin, int bodyEnd) const;
 
     /*!
-     *  Finds all port declarations from a ports section without comment lines.
+     *  Parses a port declaration beginning with a port direction.
      *
-     *      @param [in] portSectionWithoutCommentLines   The section of the Verilog containing the ports in module
-     *                                                   without comment lines.
+     *      @param [in] input           The input containing the declaration.
+     *      @param [in] tokens          The tokens of the input.
+     *      @param [in/out] position    Index of the direction token. Set to the index after the declaration.
+     *      @param [in] limit           Index of the token ending the port section.
+     *      @param [in] ansiStyle       Flag for declarations in the module header instead of the module body.
+     *      @param [out] declaration    The parsed declaration.
      *
-     *      @return The Verilog port declarations.
+     *      @return True, if the declaration is valid, otherwise false.
      */
-    QStringList portDeclarationsIn(QString const& portSection) const;
+    bool parsePortDeclaration(QString const& input, QVector<VerilogTokenizer::Token> const& tokens,
+        int& position, int limit, bool ansiStyle, PortDeclaration& declaration) const;
 
     /*!
      *  Creates a port from a given Verilog declaration and adds it to the target component.
@@ -144,9 +157,8 @@ private:
      *      @param [in] declaration         The declaration from which to create a port.
      *      @param [in] targetComponent     The component to which add the port.
      */
-    void createPortFromDeclaration(QString const& portDeclaration, 
-        QSharedPointer<Component> targetComponent, 
-        QSharedPointer<ComponentInstantiation> targetComponentInstantiation) const;    
+    void createPortFromDeclaration(PortDeclaration const& declaration,
+        QSharedPointer<Component> targetComponent) const;
 
     /*!
      *  Highlights the given port declaration.
@@ -157,80 +169,23 @@ private:
     void highlight(QString const& portDeclaration, QString const& componentDeclaration);
 
     /*!
-     *  Parses the port direction from a Verilog port declaration.
-     *
-     *      @param [in] declaration   The Verilog port declaration to parse.
-     *
-     *      @return The port direction in the declaration.
-     */
-    DirectionTypes::Direction parseDirection(QString const& portDeclaration) const;
-    
-    /*!
-     *  Parses the port array bounds from a Verilog port declaration.
-     *
-     *      @param [in] portDeclaration     The Verilog port declaration to parse.
-     *      @param [in] ownerComponent      The owner component of the port.
-     *
-     *      @return The port left and right array bound value in the declaration.
-     */
-    QPair<QString, QString> parseArrayBounds(QString const& portDeclaration, 
-        QSharedPointer<Component> targetComponent,
-        QSharedPointer<ComponentInstantiation> targetComponentInstantiation) const;
-
-    /*!
-     *  Parses the left and right bounds of a bounds that is of format [left:right].
-     *  Any name references will be replaced with id references.
-     *
-     *      @param [in] bounds              The expression to parse.
-     *      @param [in] targetComponent     The owner component of the port.
-     *
-     *      @return The left and right bound value in the bounds.
-     */
-    QPair<QString, QString> parseLeftAndRight(QString const& bounds,
-        QSharedPointer<Component> targetComponent, 
-        QSharedPointer<ComponentInstantiation> targetComponentInstantiation) const;
-
-    /*!
-     *  Parses the port vector bounds from a Verilog port declaration.
+     *  Checks the left and right bounds of a port and replaces any name references with id references.
      *
-     *      @param [in] portDeclaration     The Verilog port declaration to parse.
-     *      @param [in] ownerComponent      The owner component of the port.
+     *      @param [in] bounds  The left and right bound to check.
      *
-     *      @return The port left and right vector bound value in the declaration.
+     *      @return The left and right bound value.
      */
-    QPair<QString, QString> parseVectorBounds(QString const& portDeclaration,
-        QSharedPointer<Component> targetComponent,
-        QSharedPointer<ComponentInstantiation> targetComponentInstantiation) const;
+    QPair<QString, QString> parseLeftAndRight(QPair<QString, QString> const& bounds) const;
 
     /*!
      *  Replaces any parameter names with their ids in an expression.
      *
      *      @param [in] expression          The expression to replace the names in.
-     *      @param [in] targetComponent     The containing component of the parameters.
      *
      *      @return The expression where the names have been replaced with corresponding ids.
      */
-    QString replaceNameReferencesWithIds(QString const& expression, 
-        QSharedPointer<Component> targetComponent) const;
+    QString replaceNameReferencesWithIds(QString const& expression) const;
 
-    /*!
-     *  Parses the port names from a Verilog port declaration.
-     *
-     *      @param [in] declaration   The Verilog port declaration to parse.
-     *
-     *      @return The port names in the declaration.
-     */
-    QStringList parsePortNames(QString const& portDeclaration) const;
-
-    /*!
-     *  Parses the port description from a comment tailing a Verilog port declaration.
-     *
-     *      @param [in] declaration   The Verilog port declaration to parse.
-     *
-     *      @return The port description.
-     */
-    QString parseDescription(QString const& portDeclaration) const;
-    
     //-----------------------------------------------------------------------------
     // Data.
     //-----------------------------------------------------------------------------
@@ -240,6 +195,9 @@ private:
 
     //! The expression parser to use.
     QSharedPointer<ExpressionParser> parser_;
+
+    //! The parameters of the target component by their names. The first parameter of each name is used.
+    QHash<QString, QSharedPointer<Parameter> > parametersByName_;
 };
 
 #endif // VERILOGPORTPARSER_H
@@ -137,6 +137,36 @@ bool VerilogSyntax::selectImplementation(QString const& code, QString& implement
     return true;
 }
 
+//-----------------------------------------------------------------------------
+// Function: VerilogSyntax::selectTaggedImplementation()
+//-----------------------------------------------------------------------------
+bool VerilogSyntax::selectTaggedImplementation(QString const& code, QString& implementation,
+    QString& postModule, QString& error)
+{
+    Q_ASSERT(code.startsWith(VerilogSyntax::TAG_OVERRIDE));
+
+    // The module header is above the tag, so any module header after it is another module.
+    if (code.contains(VerilogSyntax::MODULE_KEY_WORD))
+    {
+        error = QObject::tr("There was more than one module header in the code.");
+        return false;
+    }
+
+    int implementationStart = VerilogSyntax::TAG_OVERRIDE.size() + 1;
+    int implementationEnd = code.indexOf(VerilogSyntax::MODULE_END);
+
+    if (implementationEnd == -1)
+    {
+        error = QObject::tr("Could not find module end from the code.");
+        return false;
+    }
+
+    implementation = code.mid(implementationStart, implementationEnd - implementationStart);
+    postModule = code.mid(implementationEnd + 9).trimmed();
+
+    return true;
+}
+
 //-----------------------------------------------------------------------------
 // Function: VerilogSyntax::findImplementation()
 //-----------------------------------------------------------------------------
@@ -118,6 +118,20 @@ namespace VerilogSyntax
      */
 	bool selectImplementation(QString const& fileContent, QString& implementation,
         QString& postModule, QString& error);
+
+    /*!
+     *  Finds the module implementation in Verilog code beginning with the override tag.
+     *  The module header above the tag is written by Kactus2 and is not inspected.
+     *
+	 *      @param [in] code		            The code from the override tag to the end of the file.
+	 *      @param [out] implementation	        The module implementation.
+     *      @param [out] postModule		        Anything that exists after the module.
+     *      @param [out] error                  If fails, this will contain an error message.
+	 *
+	 *      @return True, if a single implementation could be found, else false.
+     */
+	bool selectTaggedImplementation(QString const& code, QString& implementation,
+        QString& postModule, QString& error);
     
     /*!
      *  Finds position of the module implementation in Verilog code.
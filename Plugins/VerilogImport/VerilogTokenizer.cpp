@@ -0,0 +1,432 @@
+//-----------------------------------------------------------------------------
+// File: VerilogTokenizer.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: Kactus2 team
+// Date: 19.10.2026
+//
+// Description:
+// Splits Verilog source text into tokens in one linear pass.
+//-----------------------------------------------------------------------------
+
+#include "VerilogTokenizer.h"
+
+namespace
+{
+    //-----------------------------------------------------------------------------
+    // Function: isIdentifierStart()
+    //-----------------------------------------------------------------------------
+    bool isIdentifierStart(QChar character)
+    {
+        return character.isLetter() || character == QLatin1Char('_') || character == QLatin1Char('$');
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: isIdentifierCharacter()
+    //-----------------------------------------------------------------------------
+    bool isIdentifierCharacter(QChar character)
+    {
+        return character.isLetterOrNumber() || character == QLatin1Char('_') || character == QLatin1Char('$');
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: isBase()
+    //-----------------------------------------------------------------------------
+    bool isBase(QChar character)
+    {
+        const char base = character.toLower().toLatin1();
+        return base == 'b' || base == 'o' || base == 'd' || base == 'h';
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: baseEnd()
+    //-----------------------------------------------------------------------------
+    int baseEnd(QString const& input, int apostrophe)
+    {
+        // The base is given as e.g. 'h or as signed 'sh.
+        int position = apostrophe + 1;
+        if (position < input.length() && input.at(position).toLower() == QLatin1Char('s'))
+        {
+            ++position;
+        }
+
+        if (position < input.length() && isBase(input.at(position)))
+        {
+            return position + 1;
+        }
+
+        return -1;
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: skipWhile()
+    //-----------------------------------------------------------------------------
+    template <typename Predicate>
+    int skipWhile(QString const& input, int position, Predicate predicate)
+    {
+        const int length = input.length();
+        while (position < length && predicate(input.at(position)))
+        {
+            ++position;
+        }
+
+        return position;
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: numberEnd()
+    //-----------------------------------------------------------------------------
+    int numberEnd(QString const& input, int position)
+    {
+        auto isDigit = [](QChar character) { return character.isDigit() || character == QLatin1Char('_'); };
+
+        // The size of a based number or a decimal number.
+        position = skipWhile(input, position, isDigit);
+
+        if (position + 1 < input.length() && input.at(position) == QLatin1Char('.') &&
+            input.at(position + 1).isDigit())
+        {
+            position = skipWhile(input, position + 1, isDigit);
+        }
+
+        if (position < input.length() && input.at(position) == QLatin1Char('\''))
+        {
+            int valueStart = baseEnd(input, position);
+            if (valueStart != -1)
+            {
+                position = skipWhile(input, valueStart, [](QChar character)
+                {
+                    return character.isLetterOrNumber() || character == QLatin1Char('_') ||
+                        character == QLatin1Char('?');
+                });
+            }
+        }
+
+        return position;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: VerilogTokenizer::tokenize()
+//-----------------------------------------------------------------------------
+QVector<VerilogTokenizer::Token> VerilogTokenizer::tokenize(QString const& input)
+{
+    QVector<Token> tokens;
+
+    const int length = input.length();
+    int position = 0;
+    while (position < length)
+    {
+        const QChar current = input.at(position);
+        if (current.isSpace())
+        {
+            ++position;
+            continue;
+        }
+
+        const QChar next = position + 1 < length ? input.at(position + 1) : QChar();
+        const int start = position;
+        TokenType type = SYMBOL;
+
+        if (current == QLatin1Char('/') && next == QLatin1Char('/'))
+        {
+            type = COMMENT;
+            position = skipWhile(input, position, [](QChar character) { return character != QLatin1Char('\n'); });
+        }
+        else if (current == QLatin1Char('/') && next == QLatin1Char('*'))
+        {
+            type = COMMENT;
+            int commentEnd = input.indexOf(QLatin1String("*/"), position + 2);
+            position = commentEnd == -1 ? length : commentEnd + 2;
+        }
+        else if (current == QLatin1Char('"'))
+        {
+            type = STRING;
+            ++position;
+            while (position < length && input.at(position) != QLatin1Char('"') &&
+                input.at(position) != QLatin1Char('\n'))
+            {
+                // Escaped characters, e.g. \", are skipped as a pair.
+                position += input.at(position) == QLatin1Char('\\') ? 2 : 1;
+            }
+
+            position = qMin(position + 1, length);
+        }
+        else if (current == QLatin1Char('`') && isIdentifierStart(next))
+        {
+            type = MACRO;
+            position = skipWhile(input, position + 1, isIdentifierCharacter);
+        }
+        else if (isIdentifierStart(current))
+        {
+            type = IDENTIFIER;
+            position = skipWhile(input, position, isIdentifierCharacter);
+        }
+        else if (current == QLatin1Char('\\'))
+        {
+            // Escaped identifiers end in white space.
+            type = IDENTIFIER;
+            position = skipWhile(input, position, [](QChar character) { return !character.isSpace(); });
+        }
+        else if (current.isDigit() || (current == QLatin1Char('\'') && baseEnd(input, position) != -1))
+        {
+            type = NUMBER;
+            position = numberEnd(input, position);
+        }
+        else
+        {
+            ++position;
+        }
+
+        Token token;
+        token.type = type;
+        token.start = start;
+        token.length = position - start;
+        tokens.append(token);
+    }
+
+    return tokens;
+}
+
+//-----------------------------------------------------------------------------
+// Function: VerilogTokenizer::replaceIdentifiers()
+//-----------------------------------------------------------------------------
+QString VerilogTokenizer::replaceIdentifiers(QString const& expression,
+    std::function<bool(QString const& name, QString& replacement)> const& replacementFor)
+{
+    QString result;
+    int copiedLength = 0;
+    bool replaced = false;
+
+    for (Token const& token : tokenize(expression))
+    {
+        if (token.type != IDENTIFIER && token.type != MACRO)
+        {
+            continue;
+        }
+
+        const int nameStart = token.type == MACRO ? token.start + 1 : token.start;
+        const int tokenEnd = token.start + token.length;
+
+        QString replacement;
+        if (replacementFor(expression.mid(nameStart, tokenEnd - nameStart), replacement))
+        {
+            result.append(expression.midRef(copiedLength, token.start - copiedLength));
+            result.append(replacement);
+            copiedLength = tokenEnd;
+            replaced = true;
+        }
+    }
+
+    if (!replaced)
+    {
+        return expression;
+    }
+
+    result.append(expression.midRef(copiedLength));
+    return result;
+}
+
+//-----------------------------------------------------------------------------
+// Function: VerilogTokenizer::tokenText()
+//-----------------------------------------------------------------------------
+QStringRef VerilogTokenizer::tokenText(QString const& input, Token const& token)
+{
+    return input.midRef(token.start, token.length);
+}
+
+//-----------------------------------------------------------------------------
+// Function: VerilogTokenizer::isSymbol()
+//-----------------------------------------------------------------------------
+bool VerilogTokenizer::isSymbol(QString const& input, QVector<Token> const& tokens, int index, char symbol)
+{
+    return index < tokens.size() && tokens.at(index).type == SYMBOL &&
+        input.at(tokens.at(index).start) == QLatin1Char(symbol);
+}
+
+//-----------------------------------------------------------------------------
+// Function: VerilogTokenizer::isKeyword()
+//-----------------------------------------------------------------------------
+bool VerilogTokenizer::isKeyword(QString const& input, QVector<Token> const& tokens, int index,
+    QLatin1String keyword, Qt::CaseSensitivity sensitivity)
+{
+    return index < tokens.size() && tokens.at(index).type == IDENTIFIER &&
+        tokenText(input, tokens.at(index)).compare(keyword, sensitivity) == 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function: VerilogTokenizer::nextCodeToken()
+//-----------------------------------------------------------------------------
+int VerilogTokenizer::nextCodeToken(QVector<Token> const& tokens, int position)
+{
+    while (position < tokens.size() && tokens.at(position).type == COMMENT)
+    {
+        ++position;
+    }
+
+    return position;
+}
+
+//-----------------------------------------------------------------------------
+// Function: VerilogTokenizer::closingBracket()
+//-----------------------------------------------------------------------------
+int VerilogTokenizer::closingBracket(QString const& input, QVector<Token> const& tokens, int position)
+{
+    int depth = 0;
+    for (int i = position; i < tokens.size(); ++i)
+    {
+        if (tokens.at(i).type != SYMBOL)
+        {
+            continue;
+        }
+
+        const QChar symbol = input.at(tokens.at(i).start);
+        if (symbol == QLatin1Char('(') || symbol == QLatin1Char('[') || symbol == QLatin1Char('{'))
+        {
+            ++depth;
+        }
+        else if (symbol == QLatin1Char(')') || symbol == QLatin1Char(']') || symbol == QLatin1Char('}'))
+        {
+            --depth;
+            if (depth == 0)
+            {
+                return i;
+            }
+            else if (depth < 0)
+            {
+                return -1;
+            }
+        }
+    }
+
+    return -1;
+}
+
+//-----------------------------------------------------------------------------
+// Function: VerilogTokenizer::findModule()
+//-----------------------------------------------------------------------------
+int VerilogTokenizer::findModule(QString const& input, QVector<Token> const& tokens)
+{
+    for (int i = 0; i < tokens.size(); ++i)
+    {
+        if (isKeyword(input, tokens, i, QLatin1String("module")) ||
+            isKeyword(input, tokens, i, QLatin1String("macromodule")))
+        {
+            const int nameIndex = nextCodeToken(tokens, i + 1);
+            if (nameIndex < tokens.size() && tokens.at(nameIndex).type == IDENTIFIER)
+            {
+                return i;
+            }
+        }
+    }
+
+    return tokens.size();
+}
+
+//-----------------------------------------------------------------------------
+// Function: VerilogTokenizer::splitRange()
+//-----------------------------------------------------------------------------
+QPair<QString, QString> VerilogTokenizer::splitRange(QString const& input, QVector<Token> const& tokens,
+    int open, int close)
+{
+    int depth = 0;
+    for (int i = open + 1; i < close; ++i)
+    {
+        if (tokens.at(i).type != SYMBOL)
+        {
+            continue;
+        }
+
+        const QChar symbol = input.at(tokens.at(i).start);
+        if (symbol == QLatin1Char('(') || symbol == QLatin1Char('[') || symbol == QLatin1Char('{'))
+        {
+            ++depth;
+        }
+        else if (symbol == QLatin1Char(')') || symbol == QLatin1Char(']') || symbol == QLatin1Char('}'))
+        {
+            --depth;
+        }
+        else if (symbol == QLatin1Char(':') && depth == 0)
+        {
+            if (i == open + 1 || i + 1 == close)
+            {
+                break;
+            }
+
+            return qMakePair(textWithoutComments(input, tokens, open + 1, i - 1).trimmed(),
+                textWithoutComments(input, tokens, i + 1, close - 1).trimmed());
+        }
+    }
+
+    return QPair<QString, QString>();
+}
+
+//-----------------------------------------------------------------------------
+// Function: VerilogTokenizer::isLineComment()
+//-----------------------------------------------------------------------------
+bool VerilogTokenizer::isLineComment(QString const& input, Token const& token)
+{
+    return token.type == COMMENT && input.midRef(token.start, 2) == QLatin1String("//");
+}
+
+//-----------------------------------------------------------------------------
+// Function: VerilogTokenizer::trailingComment()
+//-----------------------------------------------------------------------------
+int VerilogTokenizer::trailingComment(QString const& input, QVector<Token> const& tokens, int index, int limit)
+{
+    const int next = index + 1;
+    if (next >= limit || !isLineComment(input, tokens.at(next)))
+    {
+        return -1;
+    }
+
+    const int tokenEnd = tokens.at(index).start + tokens.at(index).length;
+    if (input.midRef(tokenEnd, tokens.at(next).start - tokenEnd).contains(QLatin1Char('\n')))
+    {
+        return -1;
+    }
+
+    return next;
+}
+
+//-----------------------------------------------------------------------------
+// Function: VerilogTokenizer::commentText()
+//-----------------------------------------------------------------------------
+QString VerilogTokenizer::commentText(QString const& input, Token const& token)
+{
+    if (isLineComment(input, token))
+    {
+        return input.mid(token.start + 2, token.length - 2).trimmed();
+    }
+
+    // A multi-line comment may be unterminated at the end of the input.
+    QStringRef comment = input.midRef(token.start + 2, token.length - 2);
+    if (comment.endsWith(QLatin1String("*/")))
+    {
+        comment.chop(2);
+    }
+
+    return comment.trimmed().toString();
+}
+
+//-----------------------------------------------------------------------------
+// Function: VerilogTokenizer::textWithoutComments()
+//-----------------------------------------------------------------------------
+QString VerilogTokenizer::textWithoutComments(QString const& input, QVector<Token> const& tokens, int first,
+    int last)
+{
+    QString text;
+
+    int copiedFrom = tokens.at(first).start;
+    for (int i = first; i <= last; ++i)
+    {
+        if (tokens.at(i).type == COMMENT)
+        {
+            text.append(input.midRef(copiedFrom, tokens.at(i).start - copiedFrom));
+            copiedFrom = tokens.at(i).start + tokens.at(i).length;
+        }
+    }
+
+    text.append(input.midRef(copiedFrom, tokens.at(last).start + tokens.at(last).length - copiedFrom));
+    return text;
+}
@@ -0,0 +1,192 @@
+//-----------------------------------------------------------------------------
+// File: VerilogTokenizer.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: Kactus2 team
+// Date: 19.10.2026
+//
+// Description:
+// Splits Verilog source text into tokens in one linear pass.
+//-----------------------------------------------------------------------------
+
+#ifndef VERILOGTOKENIZER_H
+#define VERILOGTOKENIZER_H
+
+#include <QPair>
+#include <QString>
+#include <QVector>
+
+#include <functional>
+
+namespace VerilogTokenizer
+{
+    //! The types of the Verilog tokens.
+    enum TokenType
+    {
+        IDENTIFIER,     //!< A simple or escaped identifier, a keyword or a system function e.g. $clog2.
+        MACRO,          //!< A compiler directive or a macro usage e.g. `define or `WIDTH.
+        NUMBER,         //!< A number literal e.g. 8, 8'hFF or 'b1.
+        STRING,         //!< A string literal.
+        COMMENT,        //!< A one-line or a multi-line comment.
+        SYMBOL          //!< An operator or a punctuation character.
+    };
+
+    //! A token in the source text.
+    struct Token
+    {
+        //! The type of the token.
+        TokenType type;
+
+        //! The position of the first character of the token.
+        int start;
+
+        //! The number of characters in the token.
+        int length;
+    };
+
+    /*!
+     *  Splits the given text into tokens. White space is skipped. Each character is inspected once.
+     *
+     *      @param [in] input   The text to split.
+     *
+     *      @return The tokens in the order of the text.
+     */
+    QVector<Token> tokenize(QString const& input);
+
+    /*!
+     *  Replaces the identifiers and macro usages in an expression.
+     *
+     *      @param [in] expression          The expression to replace the identifiers in.
+     *      @param [in] replacementFor      Gets the replacement for a name without the macro back tick. Returns
+     *                                      false, if the name is kept.
+     *
+     *      @return The expression with the replaced identifiers.
+     */
+    QString replaceIdentifiers(QString const& expression,
+        std::function<bool(QString const& name, QString& replacement)> const& replacementFor);
+
+    /*!
+     *  Gets the text of the given token.
+     *
+     *      @param [in] input   The tokenized text.
+     *      @param [in] token   The token whose text to get.
+     *
+     *      @return The text of the token.
+     */
+    QStringRef tokenText(QString const& input, Token const& token);
+
+    /*!
+     *  Checks if the token at the given index is the given symbol.
+     *
+     *      @param [in] input   The tokenized text.
+     *      @param [in] tokens  The tokens of the text.
+     *      @param [in] index   Index of the token to check.
+     *      @param [in] symbol  The symbol to check for.
+     *
+     *      @return True, if the token exists and is the given symbol, otherwise false.
+     */
+    bool isSymbol(QString const& input, QVector<Token> const& tokens, int index, char symbol);
+
+    /*!
+     *  Checks if the token at the given index is the given keyword.
+     *
+     *      @param [in] input       The tokenized text.
+     *      @param [in] tokens      The tokens of the text.
+     *      @param [in] index       Index of the token to check.
+     *      @param [in] keyword     The keyword to check for.
+     *      @param [in] sensitivity Case sensitivity of the comparison.
+     *
+     *      @return True, if the token exists and is the given keyword, otherwise false.
+     */
+    bool isKeyword(QString const& input, QVector<Token> const& tokens, int index, QLatin1String keyword,
+        Qt::CaseSensitivity sensitivity = Qt::CaseSensitive);
+
+    /*!
+     *  Finds the next token that is not a comment.
+     *
+     *      @param [in] tokens      The tokens of the text.
+     *      @param [in] position    The index to start the search from.
+     *
+     *      @return Index of the next token that is not a comment or the number of tokens, if none is found.
+     */
+    int nextCodeToken(QVector<Token> const& tokens, int position);
+
+    /*!
+     *  Finds the bracket closing the bracket at the given token. Parentheses, square brackets and braces nest.
+     *
+     *      @param [in] input       The tokenized text.
+     *      @param [in] tokens      The tokens of the text.
+     *      @param [in] position    Index of the opening bracket token.
+     *
+     *      @return Index of the closing bracket token or -1, if the brackets are not balanced.
+     */
+    int closingBracket(QString const& input, QVector<Token> const& tokens, int position);
+
+    /*!
+     *  Finds the first module or macromodule keyword that is followed by a module name.
+     *
+     *      @param [in] input   The tokenized text.
+     *      @param [in] tokens  The tokens of the text.
+     *
+     *      @return Index of the keyword token or the number of tokens, if no module is found.
+     */
+    int findModule(QString const& input, QVector<Token> const& tokens);
+
+    /*!
+     *  Splits a range e.g. [WIDTH-1:0] into its left and right bounds without comments.
+     *
+     *      @param [in] input   The tokenized text.
+     *      @param [in] tokens  The tokens of the text.
+     *      @param [in] open    Index of the opening square bracket token.
+     *      @param [in] close   Index of the closing square bracket token.
+     *
+     *      @return The left and right bounds or empty bounds, if the range has no colon on its outermost level.
+     */
+    QPair<QString, QString> splitRange(QString const& input, QVector<Token> const& tokens, int open, int close);
+
+    /*!
+     *  Checks if the given token is a one-line comment.
+     *
+     *      @param [in] input   The tokenized text.
+     *      @param [in] token   The token to check.
+     *
+     *      @return True, if the token is a one-line comment, otherwise false.
+     */
+    bool isLineComment(QString const& input, Token const& token);
+
+    /*!
+     *  Finds a one-line comment directly after the given token on the same line.
+     *
+     *      @param [in] input   The tokenized text.
+     *      @param [in] tokens  The tokens of the text.
+     *      @param [in] index   Index of the token to search the comment after.
+     *      @param [in] limit   Index of the first token not to search.
+     *
+     *      @return Index of the comment token or -1, if there is no such comment.
+     */
+    int trailingComment(QString const& input, QVector<Token> const& tokens, int index, int limit);
+
+    /*!
+     *  Gets the text of a comment without the comment marks and the surrounding white space.
+     *
+     *      @param [in] input   The tokenized text.
+     *      @param [in] token   The comment token.
+     *
+     *      @return The comment text.
+     */
+    QString commentText(QString const& input, Token const& token);
+
+    /*!
+     *  Gets the text of the given tokens without the comments in between.
+     *
+     *      @param [in] input   The tokenized text.
+     *      @param [in] tokens  The tokens of the text.
+     *      @param [in] first   Index of the first token to include.
+     *      @param [in] last    Index of the last token to include.
+     *
+     *      @return The text from the first token to the last token with the comments removed.
+     */
+    QString textWithoutComments(QString const& input, QVector<Token> const& tokens, int first, int last);
+}
+
+#endif // VERILOGTOKENIZER_H
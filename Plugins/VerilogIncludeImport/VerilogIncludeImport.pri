@@ -9,10 +9,12 @@ message("You are running qmake on a generated .pro file. This may not work!")
 
 HEADERS += ../PluginSystem/ImportPlugin/ImportColors.h \
     ../VerilogImport/VerilogParameterParser.h \
+    ../VerilogImport/VerilogTokenizer.h \
     ./verilogincludeimport_global.h \
     ./VerilogIncludeImport.h \
     ../../common/expressions/utilities.h
 SOURCES += ../VerilogImport/VerilogParameterParser.cpp \
     ../VerilogImport/VerilogSyntax.cpp \
+    ../VerilogImport/VerilogTokenizer.cpp \
     ./VerilogIncludeImport.cpp \
     ../../common/expressions/utilities.cpp
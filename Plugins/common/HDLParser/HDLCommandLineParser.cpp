@@ -16,7 +16,9 @@
 //-----------------------------------------------------------------------------
 // Function: HDLCommandLineParser::HDLCommandLineParser()
 //-----------------------------------------------------------------------------
-HDLCommandLineParser::HDLCommandLineParser(QString const& command): command_(command)
+HDLCommandLineParser::HDLCommandLineParser(QString const& command, bool incrementalOutput):
+command_(command),
+    incrementalOutput_(incrementalOutput)
 {
     addHelpOption();
 
@@ -33,6 +35,12 @@ HDLCommandLineParser::HDLCommandLineParser(QString const& command): command_(com
     addOption(targetComponent);
     addOption(targetView);
     addOption(outputDirectory);
+
+    if (incrementalOutput)
+    {
+        addOption(QCommandLineOption(QStringList() << QStringLiteral("i") << QStringLiteral("incremental"),
+            QStringLiteral("Write only the changed files and remove the files no longer generated.")));
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -54,6 +62,7 @@ HDLCommandLineParser::ParseResults HDLCommandLineParser::parseArguments(QStringL
     result.vlnv = VLNV(VLNV::COMPONENT, value("c"));
     result.viewName = value("w");
     result.path = value("o");
+    result.incremental = incrementalOutput_ && isSet(QStringLiteral("i"));
     result.cancelRun = !validArguments;
 
     if (isSet(QStringLiteral("help")))
@@ -26,11 +26,10 @@ public:
     /*!
      *  The constructor.
      *
-     *      @param [in] command   The command used to run the generator for the parser.
-     *
-     *      @return <Description>.
+     *      @param [in] command             The command used to run the generator for the parser.
+     *      @param [in] incrementalOutput   If true, the option for incremental output is available.
      */
-    HDLCommandLineParser(QString const& command);
+    HDLCommandLineParser(QString const& command, bool incrementalOutput = false);
 
     //! The destructor.
     virtual ~HDLCommandLineParser();
@@ -41,6 +40,7 @@ public:
         VLNV vlnv;          //<! The parsed VLVN.
         QString viewName;   //<! The parsed view name;
         QString path;       //<! The parsed output path.
+        bool incremental;   //<! Flag for writing only the changed files and removing the outdated ones.
 
         bool cancelRun;     //<! Flag for canceling the generator run e.g. for showing help or illegal options.
         QString message;    //<! The message to show for cancel reason.
@@ -63,6 +63,9 @@ private:
 
     // The command used to run the generator for the parser.
     QString command_;
+
+    // If true, the option for incremental output is available.
+    bool incrementalOutput_;
 };
 
 #endif // HDLCOMMANDLINEPARSER_H
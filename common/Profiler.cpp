@@ -0,0 +1,262 @@
+//-----------------------------------------------------------------------------
+// File: Profiler.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: Kactus2 team
+// Date: 19.10.2026
+//
+// Description:
+// Collects timings and counters of the application phases.
+//-----------------------------------------------------------------------------
+
+#include "Profiler.h"
+
+#include <QCoreApplication>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QMutexLocker>
+#include <QThread>
+
+#include <algorithm>
+
+//-----------------------------------------------------------------------------
+// Function: Profiler::getInstance()
+//-----------------------------------------------------------------------------
+Profiler& Profiler::getInstance()
+{
+    static Profiler instance;
+    return instance;
+}
+
+//-----------------------------------------------------------------------------
+// Function: Profiler::Profiler()
+//-----------------------------------------------------------------------------
+Profiler::Profiler():
+enabled_(0),
+    clock_(),
+    mutex_(),
+    phases_(),
+    counterSamples_(),
+    counters_()
+{
+    clock_.start();
+}
+
+//-----------------------------------------------------------------------------
+// Function: Profiler::setEnabled()
+//-----------------------------------------------------------------------------
+void Profiler::setEnabled(bool enabled)
+{
+    enabled_.store(enabled ? 1 : 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: Profiler::isEnabled()
+//-----------------------------------------------------------------------------
+bool Profiler::isEnabled() const
+{
+    return enabled_.load() != 0;
+}
+
+//-----------------------------------------------------------------------------
+// Function: Profiler::elapsedMicroseconds()
+//-----------------------------------------------------------------------------
+qint64 Profiler::elapsedMicroseconds() const
+{
+    return clock_.nsecsElapsed() / 1000;
+}
+
+//-----------------------------------------------------------------------------
+// Function: Profiler::addDuration()
+//-----------------------------------------------------------------------------
+void Profiler::addDuration(const char* name, qint64 start, qint64 duration)
+{
+    TimedPhase phase;
+    phase.name = name;
+    phase.start = start;
+    phase.duration = duration;
+    phase.thread = reinterpret_cast<quintptr>(QThread::currentThreadId());
+
+    QMutexLocker locker(&mutex_);
+    phases_.append(phase);
+}
+
+//-----------------------------------------------------------------------------
+// Function: Profiler::addCount()
+//-----------------------------------------------------------------------------
+void Profiler::addCount(const char* name, qint64 amount)
+{
+    if (!isEnabled())
+    {
+        return;
+    }
+
+    CounterSample sample;
+    sample.name = name;
+    sample.time = elapsedMicroseconds();
+
+    QMutexLocker locker(&mutex_);
+
+    qint64& value = counters_[QString::fromLatin1(name)];
+    value += amount;
+
+    sample.value = value;
+    counterSamples_.append(sample);
+}
+
+//-----------------------------------------------------------------------------
+// Function: Profiler::clear()
+//-----------------------------------------------------------------------------
+void Profiler::clear()
+{
+    QMutexLocker locker(&mutex_);
+    phases_.clear();
+    counterSamples_.clear();
+    counters_.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: Profiler::createSummary()
+//-----------------------------------------------------------------------------
+QString Profiler::createSummary() const
+{
+    struct PhaseTotal
+    {
+        QString name;
+        int calls = 0;
+        qint64 total = 0;
+        qint64 maximum = 0;
+    };
+
+    QMap<QString, PhaseTotal> totals;
+    QMap<QString, qint64> counters;
+    {
+        QMutexLocker locker(&mutex_);
+        for (TimedPhase const& phase : phases_)
+        {
+            QString name = QString::fromLatin1(phase.name);
+
+            PhaseTotal& total = totals[name];
+            total.name = name;
+            total.calls++;
+            total.total += phase.duration;
+            total.maximum = qMax(total.maximum, phase.duration);
+        }
+
+        counters = counters_;
+    }
+
+    QVector<PhaseTotal> sortedTotals = totals.values().toVector();
+    std::sort(sortedTotals.begin(), sortedTotals.end(), [](PhaseTotal const& first, PhaseTotal const& second)
+    {
+        return first.total > second.total;
+    });
+
+    QString summary(QStringLiteral("Profiling results:"));
+    for (PhaseTotal const& total : sortedTotals)
+    {
+        summary.append(QStringLiteral("\n  %1: %2 ms total, %3 call(s), %4 ms max").arg(total.name,
+            QString::number(total.total / 1000.0, 'f', 1), QString::number(total.calls),
+            QString::number(total.maximum / 1000.0, 'f', 1)));
+    }
+
+    for (QMap<QString, qint64>::const_iterator i = counters.constBegin(); i != counters.constEnd(); ++i)
+    {
+        summary.append(QStringLiteral("\n  %1: %2").arg(i.key(), QString::number(i.value())));
+    }
+
+    if (sortedTotals.isEmpty() && counters.isEmpty())
+    {
+        summary.append(QStringLiteral("\n  No results have been collected."));
+    }
+
+    return summary;
+}
+
+//-----------------------------------------------------------------------------
+// Function: Profiler::writeTrace()
+//-----------------------------------------------------------------------------
+bool Profiler::writeTrace(QString const& filePath) const
+{
+    const qint64 processId = QCoreApplication::applicationPid();
+
+    QJsonArray events;
+    {
+        QMutexLocker locker(&mutex_);
+
+        // Chrome trace viewer shows small thread ids more clearly than the native handles.
+        QMap<quintptr, int> threadIds;
+        for (TimedPhase const& phase : phases_)
+        {
+            if (!threadIds.contains(phase.thread))
+            {
+                threadIds.insert(phase.thread, threadIds.size() + 1);
+            }
+
+            QJsonObject event;
+            event.insert(QStringLiteral("name"), QString::fromLatin1(phase.name));
+            event.insert(QStringLiteral("cat"), QStringLiteral("kactus2"));
+            event.insert(QStringLiteral("ph"), QStringLiteral("X"));
+            event.insert(QStringLiteral("ts"), double(phase.start));
+            event.insert(QStringLiteral("dur"), double(phase.duration));
+            event.insert(QStringLiteral("pid"), double(processId));
+            event.insert(QStringLiteral("tid"), threadIds.value(phase.thread));
+            events.append(event);
+        }
+
+        for (CounterSample const& sample : counterSamples_)
+        {
+            QJsonObject values;
+            values.insert(QStringLiteral("value"), double(sample.value));
+
+            QJsonObject event;
+            event.insert(QStringLiteral("name"), QString::fromLatin1(sample.name));
+            event.insert(QStringLiteral("cat"), QStringLiteral("kactus2"));
+            event.insert(QStringLiteral("ph"), QStringLiteral("C"));
+            event.insert(QStringLiteral("ts"), double(sample.time));
+            event.insert(QStringLiteral("pid"), double(processId));
+            event.insert(QStringLiteral("args"), values);
+            events.append(event);
+        }
+    }
+
+    QJsonObject trace;
+    trace.insert(QStringLiteral("traceEvents"), events);
+    trace.insert(QStringLiteral("displayTimeUnit"), QStringLiteral("ms"));
+
+    QFile outputFile(filePath);
+    if (!outputFile.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        return false;
+    }
+
+    return outputFile.write(QJsonDocument(trace).toJson(QJsonDocument::Compact)) != -1;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ProfilingScope::ProfilingScope()
+//-----------------------------------------------------------------------------
+ProfilingScope::ProfilingScope(const char* name):
+name_(name),
+    start_(-1)
+{
+    Profiler& profiler = Profiler::getInstance();
+    if (profiler.isEnabled())
+    {
+        start_ = profiler.elapsedMicroseconds();
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ProfilingScope::~ProfilingScope()
+//-----------------------------------------------------------------------------
+ProfilingScope::~ProfilingScope()
+{
+    if (start_ >= 0)
+    {
+        Profiler& profiler = Profiler::getInstance();
+        profiler.addDuration(name_, start_, profiler.elapsedMicroseconds() - start_);
+    }
+}
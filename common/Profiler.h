@@ -0,0 +1,189 @@
+//-----------------------------------------------------------------------------
+// File: Profiler.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: Kactus2 team
+// Date: 19.10.2026
+//
+// Description:
+// Collects timings and counters of the application phases.
+//-----------------------------------------------------------------------------
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <QAtomicInt>
+#include <QElapsedTimer>
+#include <QMap>
+#include <QMutex>
+#include <QString>
+#include <QVector>
+
+//-----------------------------------------------------------------------------
+//! Collects timings and counters of the application phases.
+//!
+//! The profiler is disabled by default. While disabled, the timing scopes and counters only check a flag. The
+//! collected results can be summarized as text or exported as Chrome trace event JSON.
+//-----------------------------------------------------------------------------
+class Profiler
+{
+public:
+
+    /*!
+     *  Get the singleton instance of the profiler.
+     *
+     *      @return The profiler instance.
+     */
+    static Profiler& getInstance();
+
+    /*!
+     *  Enable or disable collecting the results.
+     *
+     *      @param [in] enabled     If true, the results are collected.
+     */
+    void setEnabled(bool enabled);
+
+    /*!
+     *  Check if the results are collected.
+     *
+     *      @return True, if the profiler is enabled, otherwise false.
+     */
+    bool isEnabled() const;
+
+    /*!
+     *  Get the time elapsed since the profiler was created.
+     *
+     *      @return The elapsed time in microseconds.
+     */
+    qint64 elapsedMicroseconds() const;
+
+    /*!
+     *  Add a timed phase.
+     *
+     *      @param [in] name        The name of the phase. The name must remain valid for the program lifetime.
+     *      @param [in] start       The start time of the phase in microseconds.
+     *      @param [in] duration    The duration of the phase in microseconds.
+     */
+    void addDuration(const char* name, qint64 start, qint64 duration);
+
+    /*!
+     *  Increase a counter, if the profiler is enabled.
+     *
+     *      @param [in] name        The name of the counter. The name must remain valid for the program lifetime.
+     *      @param [in] amount      The amount to add.
+     */
+    void addCount(const char* name, qint64 amount = 1);
+
+    /*!
+     *  Remove the collected results.
+     */
+    void clear();
+
+    /*!
+     *  Create a summary of the collected results.
+     *
+     *      @return The total and maximum durations of each phase and the values of the counters.
+     */
+    QString createSummary() const;
+
+    /*!
+     *  Write the collected results as Chrome trace event JSON.
+     *
+     *      @param [in] filePath    The path of the written file.
+     *
+     *      @return True, if the file was written, otherwise false.
+     */
+    bool writeTrace(QString const& filePath) const;
+
+    // No copying. No assignments.
+    Profiler(Profiler const& rhs) = delete;
+    Profiler& operator=(Profiler const& rhs) = delete;
+
+private:
+
+    //! The constructor. Private to enforce the use of getInstance() to get access.
+    Profiler();
+
+    //! A completed phase.
+    struct TimedPhase
+    {
+        //! The name of the phase.
+        const char* name;
+
+        //! The start time in microseconds.
+        qint64 start;
+
+        //! The duration in microseconds.
+        qint64 duration;
+
+        //! The thread running the phase.
+        quintptr thread;
+    };
+
+    //! A counter value at a point of time.
+    struct CounterSample
+    {
+        //! The name of the counter.
+        const char* name;
+
+        //! The time of the sample in microseconds.
+        qint64 time;
+
+        //! The counter value after the change.
+        qint64 value;
+    };
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! Flag for indicating that the results are collected.
+    QAtomicInt enabled_;
+
+    //! The clock for the timestamps.
+    QElapsedTimer clock_;
+
+    //! Guards the collected results.
+    mutable QMutex mutex_;
+
+    //! The completed phases.
+    QVector<TimedPhase> phases_;
+
+    //! The changes of the counters.
+    QVector<CounterSample> counterSamples_;
+
+    //! The current counter values.
+    QMap<QString, qint64> counters_;
+};
+
+//-----------------------------------------------------------------------------
+//! Times the enclosing scope as a phase, if the profiler is enabled.
+//-----------------------------------------------------------------------------
+class ProfilingScope
+{
+public:
+
+    /*!
+     *  The constructor.
+     *
+     *      @param [in] name    The name of the phase. The name must remain valid for the program lifetime.
+     */
+    explicit ProfilingScope(const char* name);
+
+    //! The destructor.
+    ~ProfilingScope();
+
+    // No copying. No assignments.
+    ProfilingScope(ProfilingScope const& rhs) = delete;
+    ProfilingScope& operator=(ProfilingScope const& rhs) = delete;
+
+private:
+
+    //! The name of the phase.
+    const char* name_;
+
+    //! The start time of the phase in microseconds, or -1 if the profiler was disabled.
+    qint64 start_;
+};
+
+#endif // PROFILER_H
@@ -86,6 +86,21 @@ bool ExpandableItem::isExpanded() const
 	return expandCollapseItem_->isExpanded();
 }
 
+//-----------------------------------------------------------------------------
+// Function: ExpandableItem::setExpanded()
+//-----------------------------------------------------------------------------
+void ExpandableItem::setExpanded(bool expanded)
+{
+    if (expanded && !isExpanded())
+    {
+        expandCollapseItem_->expand();
+    }
+    else if (!expanded && isExpanded())
+    {
+        expandCollapseItem_->collapse();
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: ExpandableItem::reorganizeChildren()
 //-----------------------------------------------------------------------------
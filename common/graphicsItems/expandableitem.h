@@ -45,6 +45,13 @@ public:
 	*/
 	virtual bool isExpanded() const;
 
+	/*! Expand or collapse the item without user interaction.
+	 *
+	 * \param expanded If true then the child items are shown.
+	 *
+	*/
+	void setExpanded(bool expanded);
+
 signals: 
     //! Emitted when the item is expanded or collapsed.
     void expandStateChanged();
@@ -116,6 +116,7 @@ AddressSpacesEditor::~AddressSpacesEditor()
 //-----------------------------------------------------------------------------
 void AddressSpacesEditor::refresh()
 {
+    model_.invalidateEvaluations();
 	view_.update();
 }
 
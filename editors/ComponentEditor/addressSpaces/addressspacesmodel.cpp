@@ -45,7 +45,7 @@ addressSpaces_(component->getAddressSpaces()),
 expressionFormatter_(expressionFormatter),
 addressSpaceValidator_(addressSpaceValidator)
 {
-
+    invalidateEvaluationsOnChanges(this);
 }
 
 //-----------------------------------------------------------------------------
@@ -163,7 +163,8 @@ QVariant AddressSpacesModel::data(QModelIndex const& index, int role) const
     {
         if (isValidExpressionColumn(index))
         {
-            return expressionFormatter_->formatReferringExpression(expressionOrValueForIndex(index).toString());
+            return cachedFormattedExpression(index, expressionOrValueForIndex(index).toString(),
+                expressionFormatter_);
         }
         else if (index.column() == AddressSpaceColumns::DESCRIPTION)
         {
@@ -210,7 +211,7 @@ QVariant AddressSpacesModel::data(QModelIndex const& index, int role) const
     {
         if (isValidExpressionColumn(index))
         {
-            return formattedValueFor(expressionOrValueForIndex(index).toString());
+            return cachedValueFor(index, expressionOrValueForIndex(index).toString());
         }
 
         return expressionOrValueForIndex(index);        
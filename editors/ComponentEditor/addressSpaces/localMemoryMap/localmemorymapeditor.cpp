@@ -157,6 +157,7 @@ LocalMemoryMapEditor::~LocalMemoryMapEditor()
 //-----------------------------------------------------------------------------
 void LocalMemoryMapEditor::refresh()
 {
+    model_->invalidateEvaluations();
 	nameEditor_->refresh();
 	view_->update();
     
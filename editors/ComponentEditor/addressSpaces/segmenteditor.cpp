@@ -115,6 +115,7 @@ SegmentEditor::~SegmentEditor()
 //-----------------------------------------------------------------------------
 void SegmentEditor::refresh()
 {
+    model_.invalidateEvaluations();
 	view_.update();
 	view_.sortByColumn(1, Qt::AscendingOrder);
 }
@@ -38,6 +38,7 @@ segments_(addrSpace->getSegments()),
 expressionFormatter_(expressionFormatter)
 {
 	Q_ASSERT(addrSpace);
+    invalidateEvaluationsOnChanges(this);
 }
 
 //-----------------------------------------------------------------------------
@@ -129,7 +130,8 @@ QVariant SegmentsModel::data( QModelIndex const& index, int role) const
     {
         if (isValidExpressionColumn(index))
         {
-            return expressionFormatter_->formatReferringExpression(expressionOrValueForIndex(index).toString());
+            return cachedFormattedExpression(index, expressionOrValueForIndex(index).toString(),
+                expressionFormatter_);
         }
 
         return expressionOrValueForIndex(index);
@@ -158,7 +160,7 @@ QVariant SegmentsModel::data( QModelIndex const& index, int role) const
     {
         if (isValidExpressionColumn(index))
         {
-            return formattedValueFor(expressionOrValueForIndex(index).toString());
+            return cachedValueFor(index, expressionOrValueForIndex(index).toString());
         }
 
         return expressionOrValueForIndex(index);
@@ -0,0 +1,542 @@
+//-----------------------------------------------------------------------------
+// File: JaroWinklerMatcher.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 19.10.2026
+//
+// Description:
+// Indexed Jaro-Winkler matching of a name against a fixed set of candidate names.
+//-----------------------------------------------------------------------------
+
+#include "JaroWinklerMatcher.h"
+
+#include <QMap>
+#include <QVarLengthArray>
+#include <QtAlgorithms>
+#include <QtMath>
+
+#include <algorithm>
+
+namespace
+{
+    //! Maximum length of the common prefix used in Winkler distance.
+    const int MAX_PREFIX_LENGTH = 4;
+
+    //! Name length handled without memory allocation.
+    const int PREALLOCATED_NAME_LENGTH = 128;
+};
+
+//-----------------------------------------------------------------------------
+// Function: JaroWinklerMatcher::JaroWinklerMatcher()
+//-----------------------------------------------------------------------------
+JaroWinklerMatcher::JaroWinklerMatcher(QVector<QString> const& candidates, double threshold,
+    double winklerScalingFactor):
+candidates_(candidates.size()),
+lengthGroups_(),
+searchedEntry_(),
+threshold_(threshold),
+winklerScalingFactor_(winklerScalingFactor)
+{
+    QMap<int, LengthGroup> groupsByLength;
+
+    for (int i = 0; i < candidates.size(); ++i)
+    {
+        IndexEntry& entry = candidates_[i];
+        fillEntry(candidates.at(i), entry);
+
+        CandidateKey key;
+        key.signature_ = entry.signature_;
+        key.index_ = i;
+        if (!entry.lowered_.isEmpty())
+        {
+            key.firstCharacter_ = entry.lowered_.at(0);
+        }
+
+        LengthGroup& group = groupsByLength[entry.folded_.length()];
+        group.length_ = entry.folded_.length();
+        group.candidates_.append(key);
+
+        if (!entry.lowered_.isEmpty())
+        {
+            group.candidatesByFirstCharacter_[key.firstCharacter_].append(key);
+        }
+    }
+
+    // Ordering by signature collects the candidates with the same character classes together.
+    auto signatureOrder = [](CandidateKey const& first, CandidateKey const& second)
+    {
+        return first.signature_ < second.signature_ ||
+            (first.signature_ == second.signature_ && first.index_ < second.index_);
+    };
+
+    for (LengthGroup& group : groupsByLength)
+    {
+        std::sort(group.candidates_.begin(), group.candidates_.end(), signatureOrder);
+        for (QVector<CandidateKey>& sharedCandidates : group.candidatesByFirstCharacter_)
+        {
+            std::sort(sharedCandidates.begin(), sharedCandidates.end(), signatureOrder);
+        }
+
+        lengthGroups_.append(group);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: JaroWinklerMatcher::candidateCount()
+//-----------------------------------------------------------------------------
+int JaroWinklerMatcher::candidateCount() const
+{
+    return candidates_.size();
+}
+
+//-----------------------------------------------------------------------------
+// Function: JaroWinklerMatcher::candidate()
+//-----------------------------------------------------------------------------
+QString const& JaroWinklerMatcher::candidate(int index) const
+{
+    return candidates_.at(index).name_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: JaroWinklerMatcher::findMatches()
+//-----------------------------------------------------------------------------
+QVector<JaroWinklerMatcher::Match> JaroWinklerMatcher::findMatches(QString const& searched) const
+{
+    QVector<Match> matches;
+
+    fillEntry(searched, searchedEntry_);
+    int searchedLength = searchedEntry_.folded_.length();
+
+    for (LengthGroup const& group : lengthGroups_)
+    {
+        if (jaroWinklerBound(qMin(searchedLength, group.length_), searchedLength, group.length_,
+            prefixLengthBound(group.length_)) < threshold_)
+        {
+            continue;
+        }
+
+        // Without the prefix bonus only the candidates sharing the first character may reach the threshold.
+        if (jaroWinklerBound(qMin(searchedLength, group.length_), searchedLength, group.length_, 0) >= threshold_)
+        {
+            findMatchesInGroup(group.candidates_, group.length_, matches);
+        }
+        else if (searchedLength > 0)
+        {
+            auto sharedCandidates = group.candidatesByFirstCharacter_.constFind(searchedEntry_.lowered_.at(0));
+            if (sharedCandidates != group.candidatesByFirstCharacter_.constEnd())
+            {
+                findMatchesInGroup(sharedCandidates.value(), group.length_, matches);
+            }
+        }
+    }
+
+    std::sort(matches.begin(), matches.end(), [](Match const& first, Match const& second)
+    {
+        return first.first < second.first;
+    });
+
+    return matches;
+}
+
+//-----------------------------------------------------------------------------
+// Function: JaroWinklerMatcher::findBestMatch()
+//-----------------------------------------------------------------------------
+int JaroWinklerMatcher::findBestMatch(QString const& searched) const
+{
+    fillEntry(searched, searchedEntry_);
+
+    int bestIndex = -1;
+    double bestDistance = threshold_;
+
+    // Candidates sharing the first character get the prefix bonus, so they are compared first to raise the
+    // bar for the rest of the candidates.
+    if (!searchedEntry_.lowered_.isEmpty())
+    {
+        findBestInGroups(true, bestIndex, bestDistance);
+    }
+
+    findBestInGroups(false, bestIndex, bestDistance);
+
+    return bestIndex;
+}
+
+//-----------------------------------------------------------------------------
+// Function: JaroWinklerMatcher::fillEntry()
+//-----------------------------------------------------------------------------
+void JaroWinklerMatcher::fillEntry(QString const& name, IndexEntry& entry)
+{
+    entry.name_ = name;
+
+    // Resizing keeps the allocated buffers for the next name.
+    entry.folded_.resize(0);
+    entry.folded_.reserve(name.length());
+    entry.lowered_.resize(0);
+    entry.lowered_.reserve(name.length());
+    entry.signature_ = 0;
+    std::fill(entry.classCounts_, entry.classCounts_ + CHARACTER_CLASSES, 0);
+
+    // Characters are converted one at a time to keep the positions aligned with the original name.
+    for (QChar const& character : name)
+    {
+        QChar foldedCharacter = character.toCaseFolded();
+        entry.folded_.append(foldedCharacter);
+        entry.lowered_.append(character.toLower());
+
+        int characterIndex = characterClass(foldedCharacter);
+        entry.signature_ |= (Q_UINT64_C(1) << characterIndex);
+        entry.classCounts_[characterIndex]++;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: JaroWinklerMatcher::findBestInGroups()
+//-----------------------------------------------------------------------------
+void JaroWinklerMatcher::findBestInGroups(bool sharedFirstCharacter, int& bestIndex, double& bestDistance) const
+{
+    int searchedLength = searchedEntry_.folded_.length();
+
+    auto groupBound = [&](int groupIndex)
+    {
+        int referenceLength = lengthGroups_.at(groupIndex).length_;
+        int prefixLength = 0;
+        if (sharedFirstCharacter)
+        {
+            prefixLength = prefixLengthBound(referenceLength);
+        }
+
+        return jaroWinklerBound(qMin(searchedLength, referenceLength), searchedLength, referenceLength,
+            prefixLength);
+    };
+
+    // The length bound decreases in both directions from the searched length, so the groups are visited
+    // outwards in the order of their bounds until neither side can reach the best distance.
+    int upper = std::lower_bound(lengthGroups_.constBegin(), lengthGroups_.constEnd(), searchedLength,
+        [](LengthGroup const& group, int length) { return group.length_ < length; }) - lengthGroups_.constBegin();
+    int lower = upper - 1;
+
+    while (lower >= 0 || upper < lengthGroups_.size())
+    {
+        double lowerBound = -1;
+        if (lower >= 0)
+        {
+            lowerBound = groupBound(lower);
+        }
+
+        double upperBound = -1;
+        if (upper < lengthGroups_.size())
+        {
+            upperBound = groupBound(upper);
+        }
+
+        bool selectUpper = upperBound >= lowerBound;
+        if (qMax(lowerBound, upperBound) < bestDistance)
+        {
+            return;
+        }
+
+        LengthGroup const& group = lengthGroups_.at(selectUpper ? upper++ : lower--);
+        if (sharedFirstCharacter)
+        {
+            auto sharedCandidates = group.candidatesByFirstCharacter_.constFind(searchedEntry_.lowered_.at(0));
+            if (sharedCandidates != group.candidatesByFirstCharacter_.constEnd())
+            {
+                findBestInGroup(sharedCandidates.value(), group.length_, true, bestIndex, bestDistance);
+            }
+        }
+        else
+        {
+            findBestInGroup(group.candidates_, group.length_, false, bestIndex, bestDistance);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: JaroWinklerMatcher::findBestInGroup()
+//-----------------------------------------------------------------------------
+void JaroWinklerMatcher::findBestInGroup(QVector<CandidateKey> const& keys, int referenceLength,
+    bool sharedFirstCharacter, int& bestIndex, double& bestDistance) const
+{
+    int searchedLength = searchedEntry_.folded_.length();
+    int prefixLength = sharedFirstCharacter ? prefixLengthBound(referenceLength) : 0;
+
+    double requiredDistance = bestDistance;
+    int requiredMatches = requiredMatchingCharacters(searchedLength, referenceLength, prefixLength, bestDistance);
+
+    auto first = keys.constBegin();
+    auto last = keys.constEnd();
+
+    // When every character must match, only the candidates with the same character classes can be the best.
+    if (searchedLength == referenceLength && requiredMatches == searchedLength)
+    {
+        quint64 signature = searchedEntry_.signature_;
+        first = std::lower_bound(first, last, signature,
+            [](CandidateKey const& key, quint64 value) { return key.signature_ < value; });
+        last = std::upper_bound(first, last, signature,
+            [](quint64 value, CandidateKey const& key) { return value < key.signature_; });
+    }
+
+    for (auto key = first; key != last; ++key)
+    {
+        if (!sharedFirstCharacter && searchedLength > 0 && key->firstCharacter_ == searchedEntry_.lowered_.at(0))
+        {
+            continue;
+        }
+
+        if (requiredDistance != bestDistance)
+        {
+            requiredDistance = bestDistance;
+            requiredMatches =
+                requiredMatchingCharacters(searchedLength, referenceLength, prefixLength, bestDistance);
+        }
+
+        if (signatureMatchingBound(*key, referenceLength) < requiredMatches)
+        {
+            continue;
+        }
+
+        int candidateIndex = key->index_;
+        IndexEntry const& candidateEntry = candidates_.at(candidateIndex);
+
+        double bound = distanceBound(searchedEntry_, candidateEntry);
+        if (bound < bestDistance || (bestIndex != -1 && bound == bestDistance && candidateIndex > bestIndex))
+        {
+            continue;
+        }
+
+        double jaroWinklerDistance = distance(searchedEntry_, candidateEntry);
+        if (bestIndex == -1 ? jaroWinklerDistance >= bestDistance : (jaroWinklerDistance > bestDistance ||
+            (jaroWinklerDistance == bestDistance && candidateIndex < bestIndex)))
+        {
+            bestIndex = candidateIndex;
+            bestDistance = jaroWinklerDistance;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: JaroWinklerMatcher::findMatchesInGroup()
+//-----------------------------------------------------------------------------
+void JaroWinklerMatcher::findMatchesInGroup(QVector<CandidateKey> const& keys, int referenceLength,
+    QVector<Match>& matches) const
+{
+    int requiredMatches = requiredMatchingCharacters(searchedEntry_.folded_.length(), referenceLength,
+        prefixLengthBound(referenceLength), threshold_);
+
+    for (CandidateKey const& key : keys)
+    {
+        if (signatureMatchingBound(key, referenceLength) < requiredMatches)
+        {
+            continue;
+        }
+
+        IndexEntry const& candidateEntry = candidates_.at(key.index_);
+        if (distanceBound(searchedEntry_, candidateEntry) >= threshold_)
+        {
+            double jaroWinklerDistance = distance(searchedEntry_, candidateEntry);
+            if (jaroWinklerDistance >= threshold_)
+            {
+                matches.append(Match(key.index_, jaroWinklerDistance));
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: JaroWinklerMatcher::jaroWinklerBound()
+//-----------------------------------------------------------------------------
+double JaroWinklerMatcher::jaroWinklerBound(int matchingCharacters, int searchedLength, int referenceLength,
+    int prefixLength) const
+{
+    double jaroBound = 0;
+    if (matchingCharacters != 0)
+    {
+        double firstPart = double(matchingCharacters) / searchedLength;
+        double secondPart = double(matchingCharacters) / referenceLength;
+
+        jaroBound = (firstPart + secondPart + 1) / 3;
+    }
+
+    return jaroBound + prefixLength*winklerScalingFactor_*(1 - jaroBound);
+}
+
+//-----------------------------------------------------------------------------
+// Function: JaroWinklerMatcher::requiredMatchingCharacters()
+//-----------------------------------------------------------------------------
+int JaroWinklerMatcher::requiredMatchingCharacters(int searchedLength, int referenceLength, int prefixLength,
+    double minimumDistance) const
+{
+    int maximumMatches = qMin(searchedLength, referenceLength);
+
+    int requiredMatches = 0;
+    while (requiredMatches <= maximumMatches &&
+        jaroWinklerBound(requiredMatches, searchedLength, referenceLength, prefixLength) < minimumDistance)
+    {
+        requiredMatches++;
+    }
+
+    return requiredMatches;
+}
+
+//-----------------------------------------------------------------------------
+// Function: JaroWinklerMatcher::signatureMatchingBound()
+//-----------------------------------------------------------------------------
+int JaroWinklerMatcher::signatureMatchingBound(CandidateKey const& key, int referenceLength) const
+{
+    // Every character class missing from the other name has at least one character that cannot match.
+    int searchedBound = searchedEntry_.folded_.length() -
+        int(qPopulationCount(searchedEntry_.signature_ & ~key.signature_));
+    int referenceBound = referenceLength - int(qPopulationCount(key.signature_ & ~searchedEntry_.signature_));
+
+    return qMin(searchedBound, referenceBound);
+}
+
+//-----------------------------------------------------------------------------
+// Function: JaroWinklerMatcher::prefixLengthBound()
+//-----------------------------------------------------------------------------
+int JaroWinklerMatcher::prefixLengthBound(int referenceLength) const
+{
+    return qMin(MAX_PREFIX_LENGTH, qMin(searchedEntry_.folded_.length(), referenceLength));
+}
+
+//-----------------------------------------------------------------------------
+// Function: JaroWinklerMatcher::characterClass()
+//-----------------------------------------------------------------------------
+int JaroWinklerMatcher::characterClass(QChar const& character)
+{
+    ushort code = character.unicode();
+    if (code >= 'a' && code <= 'z')
+    {
+        return code - 'a';
+    }
+    else if (code >= '0' && code <= '9')
+    {
+        return 26 + code - '0';
+    }
+    else if (code == '_')
+    {
+        return 36;
+    }
+
+    return 37 + code % (CHARACTER_CLASSES - 37);
+}
+
+//-----------------------------------------------------------------------------
+// Function: JaroWinklerMatcher::matchingCharactersBound()
+//-----------------------------------------------------------------------------
+int JaroWinklerMatcher::matchingCharactersBound(IndexEntry const& first, IndexEntry const& second)
+{
+    quint64 commonClasses = first.signature_ & second.signature_;
+
+    int firstCount = 0;
+    int secondCount = 0;
+    for (int i = 0; commonClasses != 0; ++i, commonClasses >>= 1)
+    {
+        if (commonClasses & 1)
+        {
+            firstCount += first.classCounts_[i];
+            secondCount += second.classCounts_[i];
+        }
+    }
+
+    return qMin(firstCount, secondCount);
+}
+
+//-----------------------------------------------------------------------------
+// Function: JaroWinklerMatcher::distanceBound()
+//-----------------------------------------------------------------------------
+double JaroWinklerMatcher::distanceBound(IndexEntry const& searched, IndexEntry const& reference) const
+{
+    return jaroWinklerBound(matchingCharactersBound(searched, reference), searched.folded_.length(),
+        reference.folded_.length(), commonPrefixLength(searched, reference));
+}
+
+//-----------------------------------------------------------------------------
+// Function: JaroWinklerMatcher::distance()
+//-----------------------------------------------------------------------------
+double JaroWinklerMatcher::distance(IndexEntry const& searched, IndexEntry const& reference) const
+{
+    int searchedLength = searched.folded_.length();
+    int referenceLength = reference.folded_.length();
+    int matchingDistance = qMax(1, qMax(searchedLength, referenceLength)/2 - 1);
+
+    QVarLengthArray<QChar, PREALLOCATED_NAME_LENGTH> firstMatch(searchedLength);
+    QVarLengthArray<QChar, PREALLOCATED_NAME_LENGTH> secondMatch(referenceLength);
+
+    int firstMatchLength = findMatchingCharacters(searched, reference, matchingDistance, firstMatch.data());
+    int secondMatchLength = findMatchingCharacters(reference, searched, matchingDistance, secondMatch.data());
+
+    double matchingCharacters = qMin(firstMatchLength, secondMatchLength);
+
+    double jaroDistance = 0;
+    if (matchingCharacters != 0)
+    {
+        int minLength = qMin(firstMatchLength, secondMatchLength);
+        int transpositions = qMax(firstMatchLength, secondMatchLength) - minLength;
+        for (int i = 0; i < minLength; ++i)
+        {
+            if (firstMatch[i] != secondMatch[i])
+            {
+                transpositions++;
+            }
+        }
+
+        double firstPart = matchingCharacters / searchedLength;
+        double secondPart = matchingCharacters / referenceLength;
+        double transpositionPart = (matchingCharacters - transpositions) / matchingCharacters;
+
+        jaroDistance = (firstPart + secondPart + transpositionPart) / 3;
+    }
+
+    int prefixLength = commonPrefixLength(searched, reference);
+
+    return jaroDistance + prefixLength*winklerScalingFactor_*(1 - jaroDistance);
+}
+
+//-----------------------------------------------------------------------------
+// Function: JaroWinklerMatcher::commonPrefixLength()
+//-----------------------------------------------------------------------------
+int JaroWinklerMatcher::commonPrefixLength(IndexEntry const& first, IndexEntry const& second)
+{
+    const int MAX_STEPS = qMin(MAX_PREFIX_LENGTH, qMin(first.lowered_.length(), second.lowered_.length()));
+
+    int prefixLength = 0;
+    while (prefixLength < MAX_STEPS && first.lowered_.at(prefixLength) == second.lowered_.at(prefixLength))
+    {
+        prefixLength++;
+    }
+
+    return prefixLength;
+}
+
+//-----------------------------------------------------------------------------
+// Function: JaroWinklerMatcher::findMatchingCharacters()
+//-----------------------------------------------------------------------------
+int JaroWinklerMatcher::findMatchingCharacters(IndexEntry const& searched, IndexEntry const& reference,
+    int matchingDistance, QChar* matches)
+{
+    QChar const* searchedData = searched.folded_.constData();
+    QChar const* referenceData = reference.folded_.constData();
+
+    int searchedLength = searched.folded_.length();
+    int referenceLength = reference.folded_.length();
+
+    int matchCount = 0;
+    for (int i = 0; i < searchedLength; ++i)
+    {
+        int startPosition = qMax(0, i - matchingDistance);
+        int endPosition = qMin(i + matchingDistance, referenceLength - 1);
+
+        for (int j = startPosition; j <= endPosition; ++j)
+        {
+            if (referenceData[j] == searchedData[i])
+            {
+                matches[matchCount] = searched.lowered_.at(i);
+                matchCount++;
+                break;
+            }
+        }
+    }
+
+    return matchCount;
+}
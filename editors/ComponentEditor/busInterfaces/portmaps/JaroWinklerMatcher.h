@@ -0,0 +1,310 @@
+//-----------------------------------------------------------------------------
+// File: JaroWinklerMatcher.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 19.10.2026
+//
+// Description:
+// Indexed Jaro-Winkler matching of a name against a fixed set of candidate names.
+//-----------------------------------------------------------------------------
+
+#ifndef JAROWINKLERMATCHER_H
+#define JAROWINKLERMATCHER_H
+
+#include <QHash>
+#include <QPair>
+#include <QString>
+#include <QVector>
+
+//-----------------------------------------------------------------------------
+//! Indexed Jaro-Winkler matching of a name against a fixed set of candidate names.
+//!
+//! The candidates are indexed once by their length, first character and case-insensitive character content.
+//! Name lengths alone limit the distance, so the searches skip every length group that cannot reach the
+//! threshold or the best distance found so far. Within the groups the character class signatures and counts
+//! give upper bounds for the distance, and only the candidates whose bound is high enough are scored. Scoring
+//! gives exactly the same values as JaroWinklerAlgorithm::calculateJaroWinklerDistance().
+//!
+//! The searched name is indexed into a reused buffer, so the searches do not allocate memory for typical names
+//! and a matcher must not be searched from several threads at the same time.
+//-----------------------------------------------------------------------------
+class JaroWinklerMatcher
+{
+public:
+
+    //! A matched candidate and its Jaro-Winkler distance.
+    using Match = QPair<int, double>;
+
+    /*!
+     *  The constructor.
+     *
+     *      @param [in] candidates              The candidate names in their preferred order.
+     *      @param [in] threshold               The minimum accepted Jaro-Winkler distance.
+     *      @param [in] winklerScalingFactor    The scaling factor for prefix. Should not exceed 0.25.
+     */
+    JaroWinklerMatcher(QVector<QString> const& candidates, double threshold, double winklerScalingFactor = 0.1);
+
+    /*!
+     *  The destructor.
+     */
+    ~JaroWinklerMatcher() = default;
+
+    /*!
+     *  Get the number of candidates.
+     *
+     *      @return The number of candidate names.
+     */
+    int candidateCount() const;
+
+    /*!
+     *  Get the candidate name in the given index.
+     *
+     *      @param [in] index   The index of the candidate.
+     *
+     *      @return The candidate name.
+     */
+    QString const& candidate(int index) const;
+
+    /*!
+     *  Find all the candidates whose distance to the searched name reaches the threshold.
+     *
+     *      @param [in] searched    The searched name.
+     *
+     *      @return The matching candidate indexes and distances in the candidate order.
+     */
+    QVector<Match> findMatches(QString const& searched) const;
+
+    /*!
+     *  Find the candidate with the greatest distance to the searched name. Of equally good candidates the first
+     *  one in candidate order is selected.
+     *
+     *      @param [in] searched    The searched name.
+     *
+     *      @return The index of the best candidate or -1 if no candidate reaches the threshold.
+     */
+    int findBestMatch(QString const& searched) const;
+
+    // No copying. No assignments.
+    JaroWinklerMatcher(JaroWinklerMatcher const& rhs) = delete;
+    JaroWinklerMatcher& operator=(JaroWinklerMatcher const& rhs) = delete;
+
+private:
+
+    //! Number of character classes used in the index.
+    static const int CHARACTER_CLASSES = 64;
+
+    //! Precomputed data of one indexed name.
+    struct IndexEntry
+    {
+        //! The original name.
+        QString name_;
+
+        //! The case-folded name used in character comparisons.
+        QString folded_;
+
+        //! The lower case name used in transposition comparisons.
+        QString lowered_;
+
+        //! Bit mask of the character classes present in the name.
+        quint64 signature_ = 0;
+
+        //! Number of characters in each character class of the name.
+        quint16 classCounts_[CHARACTER_CLASSES];
+    };
+
+    //! Index data of a candidate stored in the length groups.
+    struct CandidateKey
+    {
+        //! Bit mask of the character classes present in the candidate.
+        quint64 signature_;
+
+        //! Index of the candidate.
+        int index_;
+
+        //! The first lower case character of the candidate.
+        QChar firstCharacter_;
+    };
+
+    //! Candidates of the same name length. The keys are ordered by signature and index.
+    struct LengthGroup
+    {
+        //! The length of the candidate names.
+        int length_ = 0;
+
+        //! All the candidates of the group.
+        QVector<CandidateKey> candidates_;
+
+        //! The candidates of the group grouped by the first lower case character.
+        QHash<QChar, QVector<CandidateKey> > candidatesByFirstCharacter_;
+    };
+
+    /*!
+     *  Fill the index entry of a name. The buffers of the entry are reused.
+     *
+     *      @param [in] name    The name to index.
+     *      @param [out] entry  The index entry to fill.
+     */
+    static void fillEntry(QString const& name, IndexEntry& entry);
+
+    /*!
+     *  Find the candidate with the greatest distance in the length groups around the searched name length.
+     *
+     *      @param [in] sharedFirstCharacter    If true, only the candidates with the same first character as the
+     *                                          searched name are compared, otherwise only the other candidates.
+     *      @param [in/out] bestIndex           The index of the best candidate found so far.
+     *      @param [in/out] bestDistance        The distance of the best candidate found so far.
+     */
+    void findBestInGroups(bool sharedFirstCharacter, int& bestIndex, double& bestDistance) const;
+
+    /*!
+     *  Compare the candidates of a length group to the searched name and update the best candidate.
+     *
+     *      @param [in] keys                    The compared candidates.
+     *      @param [in] referenceLength         The name length of the compared candidates.
+     *      @param [in] sharedFirstCharacter    If true, the candidates share the first character with the
+     *                                          searched name, otherwise the candidates sharing it are skipped.
+     *      @param [in/out] bestIndex           The index of the best candidate found so far.
+     *      @param [in/out] bestDistance        The distance of the best candidate found so far.
+     */
+    void findBestInGroup(QVector<CandidateKey> const& keys, int referenceLength, bool sharedFirstCharacter,
+        int& bestIndex, double& bestDistance) const;
+
+    /*!
+     *  Find the candidates of a length group reaching the threshold.
+     *
+     *      @param [in] keys                The compared candidates.
+     *      @param [in] referenceLength     The name length of the compared candidates.
+     *      @param [in/out] matches         The found matches.
+     */
+    void findMatchesInGroup(QVector<CandidateKey> const& keys, int referenceLength, QVector<Match>& matches) const;
+
+    /*!
+     *  Calculate the Jaro-Winkler distance of two names having the given number of matching characters without
+     *  transpositions.
+     *
+     *      @param [in] matchingCharacters  The number of matching characters.
+     *      @param [in] searchedLength      The length of the searched name.
+     *      @param [in] referenceLength     The length of the candidate name.
+     *      @param [in] prefixLength        The length of the common prefix.
+     *
+     *      @return The upper bound for the Jaro-Winkler distance.
+     */
+    double jaroWinklerBound(int matchingCharacters, int searchedLength, int referenceLength,
+        int prefixLength) const;
+
+    /*!
+     *  Find the smallest number of matching characters needed to reach the given distance.
+     *
+     *      @param [in] searchedLength      The length of the searched name.
+     *      @param [in] referenceLength     The length of the candidate name.
+     *      @param [in] prefixLength        The greatest possible length of the common prefix.
+     *      @param [in] minimumDistance     The distance to reach.
+     *
+     *      @return The number of matching characters needed. Greater than the shorter length, if unreachable.
+     */
+    int requiredMatchingCharacters(int searchedLength, int referenceLength, int prefixLength,
+        double minimumDistance) const;
+
+    /*!
+     *  Calculate an upper bound for the number of matching characters from the character class signatures.
+     *
+     *      @param [in] key                 The candidate key.
+     *      @param [in] referenceLength     The length of the candidate name.
+     *
+     *      @return The upper bound for the matching characters.
+     */
+    int signatureMatchingBound(CandidateKey const& key, int referenceLength) const;
+
+    /*!
+     *  Get the greatest possible prefix length of the searched name with candidates of the given length.
+     *
+     *      @param [in] referenceLength     The length of the candidate names.
+     *
+     *      @return The greatest possible prefix length.
+     */
+    int prefixLengthBound(int referenceLength) const;
+
+    /*!
+     *  Get the character class of a case-folded character.
+     *
+     *      @param [in] character   The selected character.
+     *
+     *      @return The character class.
+     */
+    static int characterClass(QChar const& character);
+
+    /*!
+     *  Calculate an upper bound for the number of matching characters between two names.
+     *
+     *      @param [in] first   The first name.
+     *      @param [in] second  The second name.
+     *
+     *      @return The upper bound for the matching characters.
+     */
+    static int matchingCharactersBound(IndexEntry const& first, IndexEntry const& second);
+
+    /*!
+     *  Calculate an upper bound for the Jaro-Winkler distance of two names.
+     *
+     *      @param [in] searched    The searched name.
+     *      @param [in] reference   The candidate name.
+     *
+     *      @return The upper bound for the Jaro-Winkler distance.
+     */
+    double distanceBound(IndexEntry const& searched, IndexEntry const& reference) const;
+
+    /*!
+     *  Calculate the Jaro-Winkler distance of two names.
+     *
+     *      @param [in] searched    The searched name.
+     *      @param [in] reference   The candidate name.
+     *
+     *      @return The Jaro-Winkler distance.
+     */
+    double distance(IndexEntry const& searched, IndexEntry const& reference) const;
+
+    /*!
+     *  Find the number of characters in a common prefix for two names.
+     *
+     *      @param [in] first   The first name.
+     *      @param [in] second  The second name.
+     *
+     *      @return The number of common characters in the beginning of the names.
+     */
+    static int commonPrefixLength(IndexEntry const& first, IndexEntry const& second);
+
+    /*!
+     *  Count the characters of a name found within the matching distance in another name.
+     *
+     *      @param [in] searched            The name whose characters are searched.
+     *      @param [in] reference           The name whose characters are matched.
+     *      @param [in] matchingDistance    The allowed distance between matching characters.
+     *      @param [out] matches            The matching lower case characters.
+     *
+     *      @return The number of matching characters.
+     */
+    static int findMatchingCharacters(IndexEntry const& searched, IndexEntry const& reference,
+        int matchingDistance, QChar* matches);
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The indexed candidates in candidate order.
+    QVector<IndexEntry> candidates_;
+
+    //! The candidates grouped by their name length in ascending length order.
+    QVector<LengthGroup> lengthGroups_;
+
+    //! The index entry of the current searched name, reused between the searches.
+    mutable IndexEntry searchedEntry_;
+
+    //! The minimum accepted distance.
+    double threshold_;
+
+    //! The scaling factor for prefix.
+    double winklerScalingFactor_;
+};
+
+#endif // JAROWINKLERMATCHER_H
@@ -11,7 +11,7 @@
 
 #include "PortMapAutoConnector.h"
 
-#include "JaroWinklerAlgorithm.h"
+#include "JaroWinklerMatcher.h"
 
 #include <editors/ComponentEditor/common/ExpressionParser.h>
 
@@ -27,6 +27,8 @@
 
 #include <QtMath>
 
+#include <algorithm>
+
 //-----------------------------------------------------------------------------
 // Function: PortMapAutoConnector::PortMapAutoConnector()
 //-----------------------------------------------------------------------------
@@ -116,12 +118,14 @@ void PortMapAutoConnector::connectSelectedLogicalPorts(QList<QSharedPointer<Port
 {
     QList<PossiblePortMaps> possiblePairings;
 
+    PhysicalPortIndex physicalIndex = createPhysicalPortIndex();
+
     foreach (QSharedPointer<PortAbstraction> logicalPort, logicalPorts)
     {
         if (!logicalPortHasReferencingPortMap(logicalPort->name()) &&
             logicalPort->getPresence(interfaceMode_, systemGroup_) != PresenceTypes::ILLEGAL)
         {
-            QMap<double, QString> physicalPorts = getWeightedPhysicalPorts(logicalPort);
+            QMap<double, QString> physicalPorts = getWeightedPhysicalPorts(logicalPort, physicalIndex);
 
             PossiblePortMaps newPairing;
             newPairing.logicalPort_ = logicalPort;
@@ -161,45 +165,119 @@ bool PortMapAutoConnector::logicalPortHasReferencingPortMap(QString const& logic
     return false;
 }
 
+//-----------------------------------------------------------------------------
+// Function: PortMapAutoConnector::createPhysicalPortIndex()
+//-----------------------------------------------------------------------------
+PortMapAutoConnector::PhysicalPortIndex PortMapAutoConnector::createPhysicalPortIndex() const
+{
+    const double JARO_WINKLER_THRESHOLD = 0.75;
+
+    PhysicalPortIndex physicalIndex;
+
+    QMap<DirectionTypes::Direction, QVector<QString> > portNamesByDirection;
+    foreach (QSharedPointer<Port> physicalPort, *component_->getPorts())
+    {
+        int calculatedLeftBound = parser_->parseExpression(physicalPort->getLeftBound()).toInt();
+        int calculatedRightBound = parser_->parseExpression(physicalPort->getRightBound()).toInt();
+
+        DirectionTypes::Direction direction = physicalPort->getDirection();
+        physicalIndex.directionBuckets_[direction].portPositions_.append(physicalIndex.ports_.size());
+        portNamesByDirection[direction].append(physicalPort->name());
+
+        physicalIndex.ports_.append(physicalPort);
+        physicalIndex.widths_.append(abs(calculatedLeftBound - calculatedRightBound) + 1);
+    }
+
+    for (auto bucket = physicalIndex.directionBuckets_.begin(); bucket != physicalIndex.directionBuckets_.end();
+        ++bucket)
+    {
+        bucket->nameMatcher_ = QSharedPointer<JaroWinklerMatcher>(
+            new JaroWinklerMatcher(portNamesByDirection.value(bucket.key()), JARO_WINKLER_THRESHOLD));
+    }
+
+    return physicalIndex;
+}
+
 //-----------------------------------------------------------------------------
 // Function: PortMapAutoConnector::getWeightedPhysicalPorts()
 //-----------------------------------------------------------------------------
-QMap<double, QString> PortMapAutoConnector::getWeightedPhysicalPorts(QSharedPointer<PortAbstraction> logicalPort)
-    const
+QMap<double, QString> PortMapAutoConnector::getWeightedPhysicalPorts(QSharedPointer<PortAbstraction> logicalPort,
+    PhysicalPortIndex const& physicalIndex) const
 {
+    const double WIDTH_WEIGHT = 0.2;
+
     QMap<double, QString> weightedPhysicalPorts;
 
     DirectionTypes::Direction logicalDirection = absDef_->getPortDirection(logicalPort->name(), interfaceMode_, systemGroup_);
 
-    QMap<QSharedPointer<Port>, double> availablePorts = getPortsByDirection(logicalDirection);
-    if (!availablePorts.isEmpty())
+    // Only the physical ports with a compatible direction are given a weight, so the names are matched only
+    // against the ports of those directions.
+    QVector<DirectionTypes::Direction> compatibleDirections({ logicalDirection });
+    if (logicalDirection == DirectionTypes::IN || logicalDirection == DirectionTypes::OUT)
     {
-        QMap<QString, double> availableWeightedPorts;
+        compatibleDirections.append(DirectionTypes::INOUT);
+    }
 
-        bool isValidWidth = false;
-        QString logicalWidth = parser_->parseExpression(getLogicalPortWidth(logicalPort), &isValidWidth);
-        if (isValidWidth)
-        {
-            int logicalWidthInt = parser_->parseExpression(logicalWidth).toInt();
-            availableWeightedPorts = getPortsByLogicalWidth(logicalWidthInt, availablePorts);
-        }
-        else
+    QString searchedName = physicalPrefix_ + logicalPort->name();
+
+    QVector<JaroWinklerMatcher::Match> nameMatches;
+    for (DirectionTypes::Direction direction : compatibleDirections)
+    {
+        auto bucket = physicalIndex.directionBuckets_.constFind(direction);
+        if (bucket != physicalIndex.directionBuckets_.constEnd())
         {
-            availableWeightedPorts = getPortNames(availablePorts);
+            for (JaroWinklerMatcher::Match const& bucketMatch : bucket->nameMatcher_->findMatches(searchedName))
+            {
+                nameMatches.append(JaroWinklerMatcher::Match(
+                    bucket->portPositions_.at(bucketMatch.first), bucketMatch.second));
+            }
         }
+    }
+
+    if (nameMatches.isEmpty())
+    {
+        return weightedPhysicalPorts;
+    }
+
+    bool isValidWidth = false;
+    double logicalWidth = 0;
+    QString logicalWidthValue = parser_->parseExpression(getLogicalPortWidth(logicalPort), &isValidWidth);
+    if (isValidWidth)
+    {
+        logicalWidth = parser_->parseExpression(logicalWidthValue).toInt();
+    }
+
+    // Keep the component order of the ports for equally named ports.
+    std::sort(nameMatches.begin(), nameMatches.end());
+
+    QMap<QString, double> availableWeightedPorts;
+    for (JaroWinklerMatcher::Match const& nameMatch : nameMatches)
+    {
+        QSharedPointer<Port> physicalPort = physicalIndex.ports_.at(nameMatch.first);
 
-        if (!availableWeightedPorts.isEmpty())
+        double portWeight = getDirectionWeight(logicalDirection, physicalPort->getDirection());
+        if (portWeight < 0)
         {
-            availableWeightedPorts = weightPortsByLogicalName(logicalPort->name(), availableWeightedPorts);
+            continue;
         }
 
-        QMapIterator<QString, double> weightIterator(availableWeightedPorts);
-        while (weightIterator.hasNext())
+        if (isValidWidth)
         {
-            weightIterator.next();
+            double portWidth = physicalIndex.widths_.at(nameMatch.first);
+            double widthSimilarity = WIDTH_WEIGHT * (qMin(logicalWidth, portWidth)/(qMax(logicalWidth, portWidth)));
 
-            weightedPhysicalPorts.insertMulti(weightIterator.value(), weightIterator.key());
+            portWeight = widthSimilarity + portWeight;
         }
+
+        availableWeightedPorts.insert(physicalPort->name(), nameMatch.second + portWeight);
+    }
+
+    QMapIterator<QString, double> weightIterator(availableWeightedPorts);
+    while (weightIterator.hasNext())
+    {
+        weightIterator.next();
+
+        weightedPhysicalPorts.insertMulti(weightIterator.value(), weightIterator.key());
     }
 
     return weightedPhysicalPorts;
@@ -243,27 +321,22 @@ QString PortMapAutoConnector::getBestMatchingPhysicalPort(int logicalIndex,
 
 
 //-----------------------------------------------------------------------------
-// Function: PortMapAutoConnector::getPortsByDirection()
+// Function: PortMapAutoConnector::getDirectionWeight()
 //-----------------------------------------------------------------------------
-QMap<QSharedPointer<Port>, double> PortMapAutoConnector::getPortsByDirection(
-    DirectionTypes::Direction logicalDirection) const
+double PortMapAutoConnector::getDirectionWeight(DirectionTypes::Direction logicalDirection,
+    DirectionTypes::Direction physicalDirection) const
 {
-    QMap<QSharedPointer<Port>, double> availablePorts;
-
-    foreach (QSharedPointer<Port> physicalPort, *component_->getPorts())
+    if (physicalDirection == logicalDirection)
     {
-        if (physicalPort->getDirection() == logicalDirection)
-        {
-            availablePorts.insert(physicalPort, 2);
-        }
-        else if ((logicalDirection == DirectionTypes::IN || logicalDirection == DirectionTypes::OUT) &&
-            physicalPort->getDirection() == DirectionTypes::INOUT)
-        {
-            availablePorts.insert(physicalPort, 0);
-        }
+        return 2;
+    }
+    else if ((logicalDirection == DirectionTypes::IN || logicalDirection == DirectionTypes::OUT) &&
+        physicalDirection == DirectionTypes::INOUT)
+    {
+        return 0;
     }
 
-    return availablePorts;
+    return -1;
 }
 
 //-----------------------------------------------------------------------------
@@ -280,82 +353,6 @@ QString PortMapAutoConnector::getLogicalPortWidth(QSharedPointer<PortAbstraction
     return QString();
 }
 
-//-----------------------------------------------------------------------------
-// Function: PortMapAutoConnector::getPortsByLogicalWidth()
-//-----------------------------------------------------------------------------
-QMap<QString, double> PortMapAutoConnector::getPortsByLogicalWidth(double logicalWidth, 
-    QMap<QSharedPointer<Port>, double> portList) const
-{
-    const double WIDTH_WEIGHT = 0.2;
-
-    QMap<QString, double> widthMatchingPorts;
-
-    QMapIterator<QSharedPointer<Port>, double> portIterator(portList);
-    while (portIterator.hasNext())
-    {
-        portIterator.next();
-
-        QSharedPointer<Port> physicalPort = portIterator.key();
-
-        int calculatedLeftBound = parser_->parseExpression(physicalPort->getLeftBound()).toInt();
-        int calculatedRightBound = parser_->parseExpression(physicalPort->getRightBound()).toInt();
-        double portWidth = abs(calculatedLeftBound - calculatedRightBound) + 1;
-
-        double widthSimilarity = WIDTH_WEIGHT * (qMin(logicalWidth, portWidth)/(qMax(logicalWidth, portWidth)));
-
-        widthMatchingPorts.insert(physicalPort->name(), widthSimilarity + portIterator.value());
-    }
-
-    return widthMatchingPorts;
-}
-
-//-----------------------------------------------------------------------------
-// Function: PortMapAutoConnector::getPortsByLogicalName()
-//-----------------------------------------------------------------------------
-QMap<QString, double> PortMapAutoConnector::weightPortsByLogicalName(QString const& logicalName,
-    QMap<QString, double> portList) const
-{
-    const double JARO_WINKLER_THRESHOLD = 0.75;
-
-    QMap<QString, double> jaroDistancedPorts;
-
-    QMapIterator<QString, double> portIterator(portList);
-    while (portIterator.hasNext())
-    {
-        portIterator.next();        
-        QString physicalName = portIterator.key();
-
-        double jaroDistance = JaroWinklerAlgorithm::calculateJaroWinklerDistance(physicalName, physicalPrefix_ + logicalName);
-
-        if (jaroDistance >= JARO_WINKLER_THRESHOLD)
-        {
-            jaroDistancedPorts.insert(portIterator.key(), jaroDistance + portIterator.value());
-        }
-    }
-
-    return jaroDistancedPorts;
-}
-
-//-----------------------------------------------------------------------------
-// Function: PortMapAutoConnector::getPortNames()
-//-----------------------------------------------------------------------------
-QMap<QString, double> PortMapAutoConnector::getPortNames(QMap<QSharedPointer<Port>, double> portList) const
-{
-    QMap<QString, double> portNameList;
-
-    QMapIterator<QSharedPointer<Port>, double> portIterator(portList);
-    while (portIterator.hasNext())
-    {
-        portIterator.next();
-
-        QSharedPointer<Port> physicalPort = portIterator.key();
-
-        portNameList.insert(physicalPort->name(), portIterator.value());
-    }
-
-    return portNameList;
-}
-
 //-----------------------------------------------------------------------------
 // Function: PortMapAutoConnector::reorderPortsToWeight()
 //-----------------------------------------------------------------------------
@@ -19,6 +19,7 @@
 #include <QObject>
 #include <QSharedPointer>
 #include <QMap>
+#include <QVector>
 
 class Component;
 class AbstractionDefinition;
@@ -29,6 +30,7 @@ class PortAbstraction;
 class ExpressionParser;
 class PortMap;
 class AbstractionType;
+class JaroWinklerMatcher;
 
 //-----------------------------------------------------------------------------
 //! Automatically forms port maps between logical and physical ports.
@@ -112,6 +114,29 @@ private:
         QMap<double, QString> possiblePhysicals_;
     };
 
+    //! Physical ports of the same direction.
+    struct DirectionBucket
+    {
+        //! Positions of the ports in the component port order.
+        QVector<int> portPositions_;
+
+        //! Matcher for the names of the ports.
+        QSharedPointer<JaroWinklerMatcher> nameMatcher_;
+    };
+
+    //! Physical ports of the component prepared for matching against logical ports.
+    struct PhysicalPortIndex
+    {
+        //! The physical ports in component order.
+        QVector<QSharedPointer<Port> > ports_;
+
+        //! The calculated widths of the physical ports.
+        QVector<double> widths_;
+
+        //! The physical ports grouped by their direction.
+        QMap<DirectionTypes::Direction, DirectionBucket> directionBuckets_;
+    };
+
     /*!
      *  Connect the selected logical signals.
      *
@@ -128,14 +153,23 @@ private:
      */
     bool logicalPortHasReferencingPortMap(QString const& logicalName) const;
 
+    /*!
+     *  Create the index of physical ports used in matching the logical ports.
+     *
+     *      @return The physical port index.
+     */
+    PhysicalPortIndex createPhysicalPortIndex() const;
+
     /*!
      *  Get the possible physical ports for the selected logical port.
      *
      *      @param [in] logicalPort     The selected logical port.
+     *      @param [in] physicalIndex   The index of the available physical ports.
      *
      *      @return The possible physical ports combined with weights.
      */
-    QMap<double, QString> getWeightedPhysicalPorts(QSharedPointer<PortAbstraction> logicalPort) const;
+    QMap<double, QString> getWeightedPhysicalPorts(QSharedPointer<PortAbstraction> logicalPort,
+        PhysicalPortIndex const& physicalIndex) const;
 
     /*!
      *  Get the best matching physical port. If another logical signal has the same port with a better value, it
@@ -151,13 +185,15 @@ private:
         QList<PossiblePortMaps> const& possiblePairings) const;
 
     /*!
-     *  Get a list of possible weighted ports by the direction of the given logical direction.
+     *  Get the weight of a physical port direction for the given logical direction.
      *
-     *      @param [in] direction     The selected logical port.
+     *      @param [in] logicalDirection    The direction of the logical port.
+     *      @param [in] physicalDirection   The direction of the physical port.
      *
-     *      @return A list of weighted physical ports with a suitable direction to the logical port.
+     *      @return The direction weight, or a negative value if the directions are not connectable.
      */
-    QMap<QSharedPointer<Port>, double> getPortsByDirection(DirectionTypes::Direction logicalDirection) const;
+    double getDirectionWeight(DirectionTypes::Direction logicalDirection,
+        DirectionTypes::Direction physicalDirection) const;
 
     /*!
      *  Get the width of the selected logical port.
@@ -168,35 +204,6 @@ private:
      */
     QString getLogicalPortWidth(QSharedPointer<PortAbstraction> logicalPort) const;
 
-    /*!
-     *  Get a list of physical ports weighted by the width of the logical port.
-     *
-     *      @param [in] logicalWidth    The width of the selected logical port.
-     *      @param [in] portList        The available weighted physical ports.
-     *
-     *      @return A list of physical ports weighted by suitability to logical width.
-     */
-    QMap<QString, double> getPortsByLogicalWidth(double logicalWidth, QMap<QSharedPointer<Port>, double> portList) const;
-
-    /*!
-     *  Get a list of physical ports weighted by the name of the logical port.
-     *
-     *      @param [in] logicalName     The name of the logical port.
-     *      @param [in] portList        A list of available weighted physical ports.
-     *
-     *      @return A list of physical ports weighted by the name of the logical port.
-     */
-    QMap<QString, double> weightPortsByLogicalName(QString const& logicalName, QMap<QString, double> portList) const;
-
-    /*!
-     *  Get the port names.
-     *
-     *      @param [in] portList    A list of weighted ports.
-     *
-     *      @return A list of weighted port names.
-     */
-    QMap<QString, double> getPortNames(QMap<QSharedPointer<Port>, double> portList) const;
-
     /*!
      *  Reorder the ports according to their weights.
      *
@@ -60,6 +60,7 @@ portMappings_(),
 portMapValidator_(portMapValidator)
 {
     setExpressionParser(expressionParser);
+    invalidateEvaluationsOnChanges(this);
 }
 
 //-----------------------------------------------------------------------------
@@ -359,7 +360,8 @@ QVariant PortMapTreeModel::data(QModelIndex const& index, int role) const
 
         else
         {
-            return formatter_->formatReferringExpression(valueForIndex(index, abstractPort, portMap).toString());
+            return cachedFormattedExpression(index, valueForIndex(index, abstractPort, portMap).toString(),
+                formatter_);
         }
     }
 
@@ -385,7 +387,7 @@ QVariant PortMapTreeModel::data(QModelIndex const& index, int role) const
     {
         if (isValidExpressionColumn(index))
         {
-            return formattedValueFor(valueForIndex(index, abstractPort, portMap).toString());
+            return cachedValueFor(index, valueForIndex(index, abstractPort, portMap).toString());
         }
         else
         {
@@ -41,6 +41,7 @@ expressionFormatter_(expressionFormatter)
 {
     setExpressionParser(expressionParser);
     parameterFinder->registerParameterModel(this);
+    invalidateEvaluationsOnChanges(this);
 }
 
 //-----------------------------------------------------------------------------
@@ -67,7 +68,7 @@ QVariant AbstractParameterModel::data( QModelIndex const& index, int role /*= Qt
             index.column() == bitWidthLeftColumn() || index.column() == bitWidthRightColumn() ||
             index.column() == arrayLeftColumn() || index.column() == arrayRightColumn())
         {
-            return expressionFormatter_->formatReferringExpression(valueForIndex(index).toString());
+            return cachedFormattedExpression(index, valueForIndex(index).toString(), expressionFormatter_);
         }
         else if (index.column() == descriptionColumn())
         {
@@ -98,7 +99,7 @@ QVariant AbstractParameterModel::data( QModelIndex const& index, int role /*= Qt
             index.column() == bitWidthLeftColumn() || index.column() == bitWidthRightColumn() ||
             index.column() == arrayLeftColumn() || index.column() == arrayRightColumn())
         {
-            return formattedValueFor(valueForIndex(index).toString());
+            return cachedValueFor(index, valueForIndex(index).toString());
         }
         else
         {
@@ -670,10 +671,14 @@ QVariant AbstractParameterModel::expressionOrValueForIndex(QModelIndex const& in
 //-----------------------------------------------------------------------------
 // Function: AbstractParameterModel::canRemoveRow()
 //-----------------------------------------------------------------------------
-bool AbstractParameterModel::canRemoveRow(int const& row) const
+bool AbstractParameterModel::canRemoveRow(int const& row)
 {
     QSharedPointer<Parameter> parameter = getParameterOnRow(row);
 
+    QVector<QSharedPointer<Parameter> > removedParameters;
+    removedParameters.append(parameter);
+    emit recalculateReferencesToParameters(removedParameters);
+
     if (parameter->getUsageCount() > 0)
     {
         QMessageBox removeWarning;
@@ -324,13 +324,13 @@ protected:
     virtual int getAllReferencesToIdInItemOnRow(const int& row, QString const& valueID) const;
 
     /*!
-     *  Check if a parameter at row can be removed.
+     *  Check if a parameter at row can be removed. The references to the parameter are recalculated first.
      *
      *      @param [in] row     The row of the parameter.
      *
      *      @return True if the parameter can be removed, false otherwise.
      */
-    bool canRemoveRow(int const& row) const;
+    bool canRemoveRow(int const& row);
 
 private:
 
@@ -23,7 +23,8 @@
 //-----------------------------------------------------------------------------
 ParameterizableTable::ParameterizableTable(QSharedPointer<ParameterFinder> parameterFinder):
 expressionParser_(),
-parameterFinder_(parameterFinder)
+parameterFinder_(parameterFinder),
+rowEvaluations_()
 {
 
 }
@@ -43,6 +44,30 @@ QString ParameterizableTable::getExpressionSymbol() const
 void ParameterizableTable::setExpressionParser(QSharedPointer <ExpressionParser> expressionParser)
 {
     expressionParser_ = expressionParser;
+    invalidateEvaluations();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterizableTable::invalidateEvaluations()
+//-----------------------------------------------------------------------------
+void ParameterizableTable::invalidateEvaluations()
+{
+    rowEvaluations_.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterizableTable::invalidateEvaluationsOnChanges()
+//-----------------------------------------------------------------------------
+void ParameterizableTable::invalidateEvaluationsOnChanges(QAbstractItemModel* model)
+{
+    auto invalidate = [this]() { invalidateEvaluations(); };
+
+    QObject::connect(model, &QAbstractItemModel::dataChanged, model, invalidate);
+    QObject::connect(model, &QAbstractItemModel::rowsInserted, model, invalidate);
+    QObject::connect(model, &QAbstractItemModel::rowsRemoved, model, invalidate);
+    QObject::connect(model, &QAbstractItemModel::rowsMoved, model, invalidate);
+    QObject::connect(model, &QAbstractItemModel::layoutChanged, model, invalidate);
+    QObject::connect(model, &QAbstractItemModel::modelReset, model, invalidate);
 }
 
 //-----------------------------------------------------------------------------
@@ -77,7 +102,7 @@ QVariant ParameterizableTable::italicForEvaluatedValue(QModelIndex const& index)
 //-----------------------------------------------------------------------------
 QVariant ParameterizableTable::blackForValidOrRedForInvalidIndex(QModelIndex const& index) const
 {
-    if (validateIndex(index))
+    if (cachedValidity(index))
     {
         return KactusColors::REGULAR_TEXT;
     }
@@ -112,3 +137,110 @@ QSharedPointer<ParameterFinder> ParameterizableTable::getParameterFinder() const
 {
     return parameterFinder_;
 }
+
+//-----------------------------------------------------------------------------
+// Function: ParameterizableTable::cachedFormattedExpression()
+//-----------------------------------------------------------------------------
+QString ParameterizableTable::cachedFormattedExpression(QModelIndex const& index, QString const& expression,
+    QSharedPointer<ExpressionFormatter> formatter) const
+{
+    if (index.parent().isValid())
+    {
+        return formatter->formatReferringExpression(expression);
+    }
+
+    return cachedResult(evaluationForRow(index.row()).formattedExpressions, index.column(), expression,
+        [&formatter, &expression]() { return formatter->formatReferringExpression(expression); });
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterizableTable::cachedValueFor()
+//-----------------------------------------------------------------------------
+QString ParameterizableTable::cachedValueFor(QModelIndex const& index, QString const& expression) const
+{
+    if (index.parent().isValid())
+    {
+        return formattedValueFor(expression);
+    }
+
+    return cachedResult(evaluationForRow(index.row()).values, index.column(), expression,
+        [this, &expression]() { return formattedValueFor(expression); });
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterizableTable::cachedValidity()
+//-----------------------------------------------------------------------------
+bool ParameterizableTable::cachedValidity(QModelIndex const& index) const
+{
+    // The evaluations are stored by row, so the rows below the top level are not cached.
+    if (index.parent().isValid())
+    {
+        return validateIndex(index);
+    }
+
+    QHash<int, bool>& validity = evaluationForRow(index.row()).validity;
+
+    auto cached = validity.constFind(index.column());
+    if (cached != validity.constEnd())
+    {
+        return cached.value();
+    }
+
+    bool valid = validateIndex(index);
+    validity.insert(index.column(), valid);
+    return valid;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterizableTable::cachedPresence()
+//-----------------------------------------------------------------------------
+bool ParameterizableTable::cachedPresence(int row, QString const& isPresentExpression) const
+{
+    if (isPresentExpression.isEmpty())
+    {
+        return true;
+    }
+
+    RowEvaluation& evaluation = evaluationForRow(row);
+    if (!evaluation.presenceEvaluated || evaluation.presence.expression != isPresentExpression)
+    {
+        evaluation.presence.expression = isPresentExpression;
+        evaluation.presence.result = parseExpressionToDecimal(isPresentExpression);
+        evaluation.presenceEvaluated = true;
+    }
+
+    return evaluation.presence.result.toInt() == 1;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterizableTable::evaluationForRow()
+//-----------------------------------------------------------------------------
+ParameterizableTable::RowEvaluation& ParameterizableTable::evaluationForRow(int row) const
+{
+    if (row >= rowEvaluations_.size())
+    {
+        rowEvaluations_.resize(row + 1);
+    }
+
+    return rowEvaluations_[row];
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterizableTable::cachedResult()
+//-----------------------------------------------------------------------------
+QString ParameterizableTable::cachedResult(QHash<int, CachedExpression>& cache, int column,
+    QString const& expression, std::function<QString()> const& evaluate)
+{
+    auto cached = cache.find(column);
+    if (cached != cache.end() && cached->expression == expression)
+    {
+        return cached->result;
+    }
+
+    CachedExpression evaluated;
+    evaluated.expression = expression;
+    evaluated.result = evaluate();
+
+    cache.insert(column, evaluated);
+    return evaluated.result;
+}
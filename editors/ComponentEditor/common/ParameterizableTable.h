@@ -17,7 +17,12 @@
 #include <editors/ComponentEditor/common/ParameterFinder.h>
 
 #include <QAbstractTableModel>
+#include <QHash>
+#include <QVector>
 
+#include <functional>
+
+class ExpressionFormatter;
 class ExpressionParser;
 //-----------------------------------------------------------------------------
 //! Base class for models editing parameters and model parameters.
@@ -50,8 +55,21 @@ public:
      */
     void setExpressionParser(QSharedPointer<ExpressionParser> expressionParser);
 
+    /*!
+     *  Discards the cached evaluations of all the rows. Called when the rows or the referenced parameters change.
+     */
+    void invalidateEvaluations();
+
 protected:
 
+    /*!
+     *  Discards the cached evaluations whenever the data or the rows of the given model change. Called by the
+     *  models in their constructor, before any view is connected to the model.
+     *
+     *      @param [in] model   The model using the table.
+     */
+    void invalidateEvaluationsOnChanges(QAbstractItemModel* model);
+
     /*!
      *  Gets the symbol for functions.
      */
@@ -103,7 +121,7 @@ protected:
     virtual bool validateIndex(QModelIndex const& index) const = 0;
 
     /*!
-     *  Gets a black color for valid index and red color for invalid index.
+     *  Gets a black color for valid index and red color for invalid index. The validity is cached.
      *
      *      @param [in] index   The index for which to get the color.
      *
@@ -137,13 +155,113 @@ protected:
      */
     QSharedPointer<ParameterFinder> getParameterFinder() const;
 
+    /*!
+     *  Gets an expression formatted with the names of the referenced parameters. The text is kept for the index
+     *  until the expression changes or the evaluations are invalidated. Only the top level rows are cached.
+     *
+     *      @param [in] index       The index of the expression.
+     *      @param [in] expression  The expression to format.
+     *      @param [in] formatter   The formatter for the referenced parameters.
+     *
+     *      @return The formatted expression.
+     */
+    QString cachedFormattedExpression(QModelIndex const& index, QString const& expression,
+        QSharedPointer<ExpressionFormatter> formatter) const;
+
+    /*!
+     *  Gets the formatted value of an expression. The value is kept for the index until the expression changes
+     *  or the evaluations are invalidated. Only the top level rows are cached.
+     *
+     *      @param [in] index       The index of the expression.
+     *      @param [in] expression  The expression whose value to format.
+     *
+     *      @return The formatted value of the expression.
+     */
+    QString cachedValueFor(QModelIndex const& index, QString const& expression) const;
+
+    /*!
+     *  Validates the data in an index. The result is kept until the evaluations are invalidated. Only the top
+     *  level rows are cached.
+     *
+     *      @param [in] index   The index whose data to validate.
+     *
+     *      @return True, if the data in the index is valid, otherwise false.
+     */
+    bool cachedValidity(QModelIndex const& index) const;
+
+    /*!
+     *  Checks if the item on a row is present. The result is kept until the presence expression changes or the
+     *  evaluations are invalidated.
+     *
+     *      @param [in] row                     The row of the item.
+     *      @param [in] isPresentExpression     The presence expression of the item.
+     *
+     *      @return True, if the presence is not given or it evaluates to 1, otherwise false.
+     */
+    bool cachedPresence(int row, QString const& isPresentExpression) const;
+
 private:
 
+    //! An evaluation result of an expression.
+    struct CachedExpression
+    {
+        //! The expression the result was evaluated from.
+        QString expression;
+
+        //! The formatted or evaluated result.
+        QString result;
+    };
+
+    //! The evaluation results of the expressions on a single row.
+    struct RowEvaluation
+    {
+        //! The formatted expressions by column.
+        QHash<int, CachedExpression> formattedExpressions;
+
+        //! The formatted values by column.
+        QHash<int, CachedExpression> values;
+
+        //! The validity of the data by column.
+        QHash<int, bool> validity;
+
+        //! Flag for indicating that the presence of the row has been evaluated.
+        bool presenceEvaluated = false;
+
+        //! The evaluated presence of the row.
+        CachedExpression presence;
+    };
+
+    /*!
+     *  Gets the evaluation results of a row.
+     *
+     *      @param [in] row     The selected row.
+     *
+     *      @return The evaluation results of the row.
+     */
+    RowEvaluation& evaluationForRow(int row) const;
+
+    /*!
+     *  Gets a cached result for an expression or evaluates and caches a new one.
+     *
+     *      @param [in] cache       The cached results of a row by column.
+     *      @param [in] column      The column of the expression.
+     *      @param [in] expression  The expression to evaluate.
+     *      @param [in] evaluate    The evaluation for an expression not found in the cache.
+     *
+     *      @return The result for the expression.
+     */
+    static QString cachedResult(QHash<int, CachedExpression>& cache, int column, QString const& expression,
+        std::function<QString()> const& evaluate);
+
+
     //! Expression parser for configurable elements.
     QSharedPointer<ExpressionParser> expressionParser_;
 
     //! The parameter finder.
     QSharedPointer<ParameterFinder> parameterFinder_;
+
+    //! The evaluation results by row.
+    mutable QVector<RowEvaluation> rowEvaluations_;
 };
 
 #endif // PARAMETERIZABLETABLE_H
@@ -122,6 +122,7 @@ parameterReferenceWindow_(new ParameterReferenceTreeWindow(parameterReferenceTre
     setupLayout();
 
 	// set the component to be displayed in the navigation model
+    navigationModel_.setParameterFinder(parameterFinder_);
     navigationModel_.setRootItem(createNavigationRootForComponent(component_));
 
 	QSettings settings;
@@ -147,6 +148,8 @@ parameterReferenceWindow_(new ParameterReferenceTreeWindow(parameterReferenceTre
 	connect(&navigationModel_, SIGNAL(dataChanged(const QModelIndex&, const QModelIndex&)),
 		    this, SIGNAL(contentChanged()), Qt::UniqueConnection);
     connect(&navigationModel_, SIGNAL(contentChanged()), this, SIGNAL(contentChanged()), Qt::UniqueConnection);
+    connect(this, SIGNAL(contentChanged()), referenceCounter_.data(), SLOT(invalidateSectionIndex()),
+        Qt::UniqueConnection);
     connect(&navigationModel_, SIGNAL(helpUrlRequested(QString const&)),
             this, SIGNAL(helpUrlRequested(QString const&)), Qt::UniqueConnection);
 	connect(&navigationModel_, SIGNAL(errorMessage(const QString&)),
@@ -558,16 +561,25 @@ QSharedPointer<ComponentEditorRootItem> ComponentEditor::createNavigationRootFor
 
     connect(genEditor, SIGNAL(hierarchyChanged(QSettings&)), this, SLOT(setRowVisibility(QSettings&)));
 
-    root->addChildItem(QSharedPointer<ComponentEditorFileSetsItem>( new ComponentEditorFileSetsItem(
+    QSharedPointer<ComponentEditorFileSetsItem> fileSetsItem(new ComponentEditorFileSetsItem(
         &navigationModel_, libHandler_, component, referenceCounter_, parameterFinder_,
-        expressionParser_, expressionFormatter_, root)));
+        expressionParser_, expressionFormatter_, root));
+
+    root->addChildItem(fileSetsItem);
+
+    QSharedPointer<ComponentEditorChoicesItem> choicesItem;
+    QSharedPointer<ComponentEditorParametersItem> parametersItem;
+    QSharedPointer<ComponentEditorMemMapsItem> memoryMapsItem;
+    QSharedPointer<ComponentEditorAddrSpacesItem> addressSpacesItem;
 
     if (component->getImplementation() == KactusAttribute::HW)
     {
-        root->addChildItem(QSharedPointer<ComponentEditorChoicesItem>(
-            new ComponentEditorChoicesItem(&navigationModel_, libHandler_, component, expressionParser_, root)));
+        choicesItem = QSharedPointer<ComponentEditorChoicesItem>(
+            new ComponentEditorChoicesItem(&navigationModel_, libHandler_, component, expressionParser_, root));
+
+        root->addChildItem(choicesItem);
 
-        QSharedPointer<ComponentEditorParametersItem> parametersItem(new ComponentEditorParametersItem(
+        parametersItem = QSharedPointer<ComponentEditorParametersItem>(new ComponentEditorParametersItem(
             &navigationModel_, libHandler_, component, referenceCounter_, parameterFinder_, expressionParser_, 
             expressionFormatter_, root));
 
@@ -577,13 +589,17 @@ QSharedPointer<ComponentEditorRootItem> ComponentEditor::createNavigationRootFor
             parameterReferenceWindow_, SLOT(openReferenceTree(QString const&, QString const)),
             Qt::UniqueConnection);
 
-        root->addChildItem(QSharedPointer<ComponentEditorMemMapsItem>(new ComponentEditorMemMapsItem(
+        memoryMapsItem = QSharedPointer<ComponentEditorMemMapsItem>(new ComponentEditorMemMapsItem(
             &navigationModel_, libHandler_, component, referenceCounter_, parameterFinder_, expressionFormatter_,
-            expressionParser_, root)));
+            expressionParser_, root));
 
-        root->addChildItem(QSharedPointer<ComponentEditorAddrSpacesItem>(new ComponentEditorAddrSpacesItem(
+        root->addChildItem(memoryMapsItem);
+
+        addressSpacesItem = QSharedPointer<ComponentEditorAddrSpacesItem>(new ComponentEditorAddrSpacesItem(
             &navigationModel_, libHandler_, component, referenceCounter_, parameterFinder_, expressionFormatter_,
-            expressionParser_, root)));
+            expressionParser_, root));
+
+        root->addChildItem(addressSpacesItem);
     }
 
     QSharedPointer<InstantiationsItem> instantiationsItem (
@@ -603,6 +619,10 @@ QSharedPointer<ComponentEditorRootItem> ComponentEditor::createNavigationRootFor
     connect(viewsItem.data(), SIGNAL(openReferenceTree(QString const&, QString const&)),
         parameterReferenceWindow_, SLOT(openReferenceTree(QString const&, QString const&)), Qt::UniqueConnection);
 
+    navigationModel_.addValidityDependency(fileSetsItem.data(), instantiationsItem.data());
+    navigationModel_.addValidityDependency(fileSetsItem.data(), viewsItem.data());
+    navigationModel_.addValidityDependency(instantiationsItem.data(), viewsItem.data());
+
     if (component->getImplementation() != KactusAttribute::SW)
     {
         root->addChildItem(QSharedPointer<ComponentEditorSystemViewsItem>(
@@ -641,21 +661,48 @@ QSharedPointer<ComponentEditorRootItem> ComponentEditor::createNavigationRootFor
             parameterReferenceWindow_, SLOT(openReferenceTree(QString const&, QString const&)),
             Qt::UniqueConnection);
 
-        root->addChildItem(QSharedPointer<ComponentEditorChannelsItem>(
-            new ComponentEditorChannelsItem(&navigationModel_, libHandler_, component, expressionParser_, root)));
+        QSharedPointer<ComponentEditorChannelsItem> channelsItem(
+            new ComponentEditorChannelsItem(&navigationModel_, libHandler_, component, expressionParser_, root));
+
+        root->addChildItem(channelsItem);
 
-        root->addChildItem(QSharedPointer<RemapStatesItem>(
+        QSharedPointer<RemapStatesItem> remapStatesItem(
             new RemapStatesItem(&navigationModel_, libHandler_, component, referenceCounter_, parameterFinder_,
-            expressionFormatter_, expressionParser_, root)));
+            expressionFormatter_, expressionParser_, root));
+
+        root->addChildItem(remapStatesItem);
+
+        QSharedPointer<ComponentEditorCpusItem> cpusItem(
+            new ComponentEditorCpusItem(&navigationModel_, libHandler_, component, expressionParser_, root));
 
-        root->addChildItem(QSharedPointer<ComponentEditorCpusItem>(
-            new ComponentEditorCpusItem(&navigationModel_, libHandler_, component, expressionParser_, root)));
+        root->addChildItem(cpusItem);
 
         root->addChildItem(QSharedPointer<ComponentEditorOtherClocksItem>(
             new ComponentEditorOtherClocksItem(&navigationModel_, libHandler_, component, expressionParser_, root)));
 
-        root->addChildItem(QSharedPointer<ResetTypesItem>(
-            new ResetTypesItem(&navigationModel_, libHandler_, component, validator_, root)));
+        QSharedPointer<ResetTypesItem> resetTypesItem(
+            new ResetTypesItem(&navigationModel_, libHandler_, component, validator_, root));
+
+        root->addChildItem(resetTypesItem);
+
+        // Items are validated again only when an item they refer to changes.
+        navigationModel_.addValidityDependency(choicesItem.data(), parametersItem.data());
+        navigationModel_.addValidityDependency(choicesItem.data(), memoryMapsItem.data());
+        navigationModel_.addValidityDependency(choicesItem.data(), addressSpacesItem.data());
+        navigationModel_.addValidityDependency(choicesItem.data(), instantiationsItem.data());
+        navigationModel_.addValidityDependency(choicesItem.data(), busInterfaceItem.data());
+        navigationModel_.addValidityDependency(memoryMapsItem.data(), busInterfaceItem.data());
+        navigationModel_.addValidityDependency(memoryMapsItem.data(), indirectInterfacesItem.data());
+        navigationModel_.addValidityDependency(addressSpacesItem.data(), busInterfaceItem.data());
+        navigationModel_.addValidityDependency(addressSpacesItem.data(), cpusItem.data());
+        navigationModel_.addValidityDependency(viewsItem.data(), busInterfaceItem.data());
+        navigationModel_.addValidityDependency(viewsItem.data(), portsItem.data());
+        navigationModel_.addValidityDependency(portsItem.data(), busInterfaceItem.data());
+        navigationModel_.addValidityDependency(portsItem.data(), remapStatesItem.data());
+        navigationModel_.addValidityDependency(busInterfaceItem.data(), indirectInterfacesItem.data());
+        navigationModel_.addValidityDependency(busInterfaceItem.data(), channelsItem.data());
+        navigationModel_.addValidityDependency(remapStatesItem.data(), memoryMapsItem.data());
+        navigationModel_.addValidityDependency(resetTypesItem.data(), memoryMapsItem.data());
     }
     else if (component->getImplementation() == KactusAttribute::SW)
     {
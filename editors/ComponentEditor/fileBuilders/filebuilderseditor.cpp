@@ -102,5 +102,6 @@ bool FileBuildersEditor::isValid() const
 //-----------------------------------------------------------------------------
 void FileBuildersEditor::refresh()
 {
+    model_->invalidateEvaluations();
 	view_.update();
 }
@@ -34,6 +34,7 @@ fileBuilders_(fileBuilders),
 expressionFormatter_(expressionFormatter)
 {
     setExpressionParser(expressionParser);
+    invalidateEvaluationsOnChanges(this);
 }
 
 //-----------------------------------------------------------------------------
@@ -89,7 +90,8 @@ QVariant FileBuildersModel::data( const QModelIndex& index, int role /*= Qt::Dis
     {
         if (isValidExpressionColumn(index))
         {
-            return expressionFormatter_->formatReferringExpression(expressionOrValueForIndex(index).toString());
+            return cachedFormattedExpression(index, expressionOrValueForIndex(index).toString(),
+                expressionFormatter_);
         }
         else
         {
@@ -104,7 +106,7 @@ QVariant FileBuildersModel::data( const QModelIndex& index, int role /*= Qt::Dis
     {
         if (isValidExpressionColumn(index))
         {
-            return formattedValueFor(expressionOrValueForIndex(index).toString());
+            return cachedValueFor(index, expressionOrValueForIndex(index).toString());
         }
         else
         {
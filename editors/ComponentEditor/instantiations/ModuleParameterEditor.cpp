@@ -121,6 +121,7 @@ ModuleParameterEditor::~ModuleParameterEditor()
 //-----------------------------------------------------------------------------
 void ModuleParameterEditor::refresh()
 {
+    model_->invalidateEvaluations();
     proxy_->invalidate();
 }
 
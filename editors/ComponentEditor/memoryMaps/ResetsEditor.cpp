@@ -79,5 +79,6 @@ ResetsEditor::~ResetsEditor()
 //-----------------------------------------------------------------------------
 void ResetsEditor::refresh()
 {
+    resetsModel_->invalidateEvaluations();
 	resetsView_->update();
 }
@@ -31,6 +31,7 @@ expressionFormatter_(expressionFormatter),
 fieldValidator_(fieldValidator)
 {
     setExpressionParser(expressionParser);
+    invalidateEvaluationsOnChanges(this);
 }
 
 //-----------------------------------------------------------------------------
@@ -123,7 +124,7 @@ QVariant ResetsModel::data(const QModelIndex& index, int role) const
     {
         if (isValidExpressionColumn(index))
         {
-            return expressionFormatter_->formatReferringExpression(valueForIndex(index).toString());
+            return cachedFormattedExpression(index, valueForIndex(index).toString(), expressionFormatter_);
         }
         else
         {
@@ -145,7 +146,7 @@ QVariant ResetsModel::data(const QModelIndex& index, int role) const
     {
         if (isValidExpressionColumn(index))
         {
-            return formattedValueFor(valueForIndex(index).toString());
+            return cachedValueFor(index, valueForIndex(index).toString());
         }
         else
         {
@@ -154,7 +155,7 @@ QVariant ResetsModel::data(const QModelIndex& index, int role) const
     }
     else if (Qt::ForegroundRole == role)
     {
-        if (validateIndex(index))
+        if (cachedValidity(index))
         {
             return KactusColors::REGULAR_TEXT;
         }
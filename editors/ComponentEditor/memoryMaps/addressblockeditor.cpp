@@ -122,5 +122,7 @@ QGroupBox(tr("Registers summary"), parent),
 //-----------------------------------------------------------------------------
 void AddressBlockEditor::refresh()
 {
+    // The referenced parameters may have changed while the editor was hidden.
+    model_->invalidateEvaluations();
 	view_->update();
 }
@@ -60,6 +60,7 @@ AddressBlockModel::AddressBlockModel(QSharedPointer<QList<QSharedPointer<Registe
     }
 
     setExpressionParser(expressionParser);
+    invalidateEvaluationsOnChanges(this);
 }
 
 //-----------------------------------------------------------------------------
@@ -168,7 +169,7 @@ QVariant AddressBlockModel::data(QModelIndex const& index, int role) const
     {
         if (isValidExpressionColumn(index))
         {
-            return expressionFormatter_->formatReferringExpression(valueForIndex(index).toString());
+            return cachedFormattedExpression(index, valueForIndex(index).toString(), expressionFormatter_);
         }
         else if (index.column() == AddressBlockColumns::DESCRIPTION)
         {
@@ -195,7 +196,7 @@ QVariant AddressBlockModel::data(QModelIndex const& index, int role) const
     {
         if (isValidExpressionColumn(index))
         {
-            return formattedValueFor(valueForIndex(index).toString());
+            return cachedValueFor(index, valueForIndex(index).toString());
         }
         else
         {
@@ -204,12 +205,12 @@ QVariant AddressBlockModel::data(QModelIndex const& index, int role) const
     }
     else if (role == Qt::ForegroundRole)
     {
-        if (validateIndex(index))
+        if (cachedValidity(index))
         {
             QSharedPointer<Register> reg = items_.at(index.row());
 
             if (index.column() != AddressBlockColumns::IS_PRESENT && reg &&
-                    (!reg->getIsPresent().isEmpty() && parseExpressionToDecimal(reg->getIsPresent()).toInt() != 1))
+                !cachedPresence(index.row(), reg->getIsPresent()))
             {
                 return KactusColors::DISABLED_TEXT;
             }
@@ -643,6 +644,7 @@ void AddressBlockModel::increaseReferencesInPastedRegister(QSharedPointer<Regist
 void AddressBlockModel::addressUnitBitsChanged(int newAddressUnitbits)
 {
     addressUnitBits_ = newAddressUnitbits;
+    invalidateEvaluations();
 }
 
 //-----------------------------------------------------------------------------
@@ -10,13 +10,19 @@
 //-----------------------------------------------------------------------------
 
 #include "addressblockgraphitem.h"
+#include "registeritemprovider.h"
 
 #include <editors/ComponentEditor/common/ExpressionParser.h>
 
 #include <common/KactusColors.h>
 
+#include <IPXACTmodels/Component/Register.h>
+#include <IPXACTmodels/Component/RegisterBase.h>
+
 #include <QStringBuilder>
 #include <QBrush>
+#include <QGraphicsScene>
+#include <QGraphicsView>
 
 //-----------------------------------------------------------------------------
 // Function: AddressBlockGraphItem::AddressBlockGraphItem()
@@ -25,22 +31,71 @@ AddressBlockGraphItem::AddressBlockGraphItem(QSharedPointer<AddressBlock> addrBl
     QSharedPointer<ExpressionParser> expressionParser, QGraphicsItem *parent ):
 MemoryVisualizationItem(expressionParser, parent),
 addrBlock_(addrBlock),
-addrssableUnitBits_(0)
+addrssableUnitBits_(0),
+registerProvider_(),
+visibleArea_()
 {
 	Q_ASSERT(addrBlock_);
 	QBrush brush(KactusColors::ADDR_BLOCK_COLOR);
 	setDefaultBrush(brush);
 
+    // Register files are laid out as child items, so only blocks of plain registers are virtualized.
+    bool onlyRegisters = true;
+    for (QSharedPointer<RegisterBase> registerBase : *addrBlock_->getRegisterData())
+    {
+        if (registerBase.dynamicCast<Register>().isNull())
+        {
+            onlyRegisters = false;
+        }
+    }
+
+    if (onlyRegisters && addrBlock_->getRegisterData()->size() >= VIRTUALIZATION_THRESHOLD)
+    {
+        registerProvider_.reset(new RegisterItemProvider(addrBlock_, expressionParser, this));
+        registerProvider_->setWidth(childWidth_);
+
+        connect(registerProvider_.data(),
+            SIGNAL(selectRegisterEditor(QSharedPointer<Register>, QSharedPointer<Field>)),
+            this, SIGNAL(selectRegisterEditor(QSharedPointer<Register>, QSharedPointer<Field>)),
+            Qt::UniqueConnection);
+        connect(registerProvider_.data(), SIGNAL(heightChanged()),
+            this, SLOT(onRegisterHeightChanged()), Qt::UniqueConnection);
+    }
+
     updateDisplay();
 }
 
+//-----------------------------------------------------------------------------
+// Function: AddressBlockGraphItem::~AddressBlockGraphItem()
+//-----------------------------------------------------------------------------
+AddressBlockGraphItem::~AddressBlockGraphItem()
+{
+
+}
+
 //-----------------------------------------------------------------------------
 // Function: AddressBlockGraphItem::refresh()
 //-----------------------------------------------------------------------------
 void AddressBlockGraphItem::refresh() 
 {
     updateDisplay();
+
+    if (registerProvider_.isNull())
+    {
+        reorganizeChildren();
+        return;
+    }
+
+    qreal previousHeight = itemTotalRect().height();
+
+    registerProvider_->updateIndex();
     reorganizeChildren();
+
+    // The registers are not child items of the parent to notify it of the changed height.
+    if (isExpanded() && itemTotalRect().height() != previousHeight)
+    {
+        emit expandStateChanged();
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -85,6 +140,11 @@ int AddressBlockGraphItem::getBitWidth() const
 void AddressBlockGraphItem::setAddressableUnitBits(int addressableUnitBits)
 {
     addrssableUnitBits_ = addressableUnitBits;
+
+    if (registerProvider_)
+    {
+        registerProvider_->updateIndex();
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -119,3 +179,108 @@ quint64 AddressBlockGraphItem::getLastAddress() const
     }
     return lastAddr -1;
 }
+
+//-----------------------------------------------------------------------------
+// Function: AddressBlockGraphItem::isVirtualized()
+//-----------------------------------------------------------------------------
+bool AddressBlockGraphItem::isVirtualized() const
+{
+    return !registerProvider_.isNull();
+}
+
+//-----------------------------------------------------------------------------
+// Function: AddressBlockGraphItem::reorganizeChildren()
+//-----------------------------------------------------------------------------
+void AddressBlockGraphItem::reorganizeChildren()
+{
+    if (registerProvider_.isNull())
+    {
+        MemoryVisualizationItem::reorganizeChildren();
+        return;
+    }
+
+    setShowExpandableItem(registerProvider_->hasRegisters());
+
+    if (isExpanded())
+    {
+        updateVisibleRegisters();
+    }
+
+    ExpandableItem::reorganizeChildren();
+}
+
+//-----------------------------------------------------------------------------
+// Function: AddressBlockGraphItem::itemTotalRect()
+//-----------------------------------------------------------------------------
+QRectF AddressBlockGraphItem::itemTotalRect() const
+{
+    // Only a part of the register items exist, so the height comes from the index.
+    if (registerProvider_ && isExpanded())
+    {
+        QRectF totalRect = rect();
+        totalRect.setBottom(totalRect.bottom() + registerProvider_->totalHeight());
+        return totalRect;
+    }
+
+    return MemoryVisualizationItem::itemTotalRect();
+}
+
+//-----------------------------------------------------------------------------
+// Function: AddressBlockGraphItem::setWidth()
+//-----------------------------------------------------------------------------
+void AddressBlockGraphItem::setWidth(qreal width)
+{
+    MemoryVisualizationItem::setWidth(width);
+
+    if (registerProvider_)
+    {
+        registerProvider_->setWidth(childWidth_);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: AddressBlockGraphItem::setVisibleArea()
+//-----------------------------------------------------------------------------
+void AddressBlockGraphItem::setVisibleArea(QRectF const& sceneArea)
+{
+    visibleArea_ = sceneArea;
+
+    if (registerProvider_ && isExpanded() && isVisible())
+    {
+        updateVisibleRegisters();
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: AddressBlockGraphItem::onRegisterHeightChanged()
+//-----------------------------------------------------------------------------
+void AddressBlockGraphItem::onRegisterHeightChanged()
+{
+    updateVisibleRegisters();
+    ExpandableItem::reorganizeChildren();
+
+    emit expandStateChanged();
+}
+
+//-----------------------------------------------------------------------------
+// Function: AddressBlockGraphItem::updateVisibleRegisters()
+//-----------------------------------------------------------------------------
+void AddressBlockGraphItem::updateVisibleRegisters()
+{
+    QRectF sceneArea = visibleArea_;
+
+    // The scene has not told the shown area yet, e.g. right after the item was created.
+    if (sceneArea.isNull() && scene() && !scene()->views().isEmpty())
+    {
+        QGraphicsView* view = scene()->views().first();
+        sceneArea = view->mapToScene(view->viewport()->rect()).boundingRect();
+    }
+
+    if (sceneArea.isNull())
+    {
+        sceneArea = mapRectToScene(rect());
+    }
+
+    QRectF itemArea = mapRectFromScene(sceneArea);
+    registerProvider_->updateItems(itemArea.top(), itemArea.bottom());
+}
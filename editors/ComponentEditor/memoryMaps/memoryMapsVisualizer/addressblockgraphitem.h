@@ -17,11 +17,19 @@
 #include <IPXACTmodels/Component/AddressBlock.h>
 
 #include <QGraphicsItem>
+#include <QRectF>
+#include <QScopedPointer>
 #include <QSharedPointer>
 
 class ExpressionParser;
+class Field;
+class Register;
+class RegisterItemProvider;
 //-----------------------------------------------------------------------------
 //! The graphical item that represents one address block.
+//!
+//! The register items of a block with many registers are created by the item itself, only for the registers
+//! in the area shown in the view. Whether the block is virtualized is decided when the item is created.
 //-----------------------------------------------------------------------------
 class AddressBlockGraphItem : public MemoryVisualizationItem
 {
@@ -29,6 +37,9 @@ class AddressBlockGraphItem : public MemoryVisualizationItem
 
 public:
 
+    //! The number of registers from which on the register items are created only for the shown area.
+    static const int VIRTUALIZATION_THRESHOLD = 1000;
+
 	/*!
      *  The constructor
 	 *
@@ -41,7 +52,7 @@ public:
 		QGraphicsItem *parent);
 	
 	//! The destructor
-	virtual ~AddressBlockGraphItem() = default;
+	virtual ~AddressBlockGraphItem();
 
     //! No copying.
     AddressBlockGraphItem(const AddressBlockGraphItem& other) = delete;
@@ -97,13 +108,68 @@ public:
      */
     virtual bool isPresent() const override final;
 
+    /*!
+     *  Checks if the register items are created only for the shown area.
+     *
+     *      @return True, if the items are created for the shown area, otherwise false.
+     */
+    bool isVirtualized() const;
+
+    //! Set new positions for the child items, creating the shown register items in a virtualized block.
+    virtual void reorganizeChildren() override final;
+
+    /*!
+     *  Get the rectangle containing the item and its children.
+     *
+     *      @return The total rectangle of the item.
+     */
+    virtual QRectF itemTotalRect() const override final;
+
+    /*!
+     *  Sets the width of the item and its children.
+     *
+     *      @param [in] width   The width to set.
+     */
+    virtual void setWidth(qreal width) override final;
+
+    /*!
+     *  Sets the area of the scene currently shown in the view.
+     *
+     *      @param [in] sceneArea   The shown area in scene coordinates.
+     */
+    virtual void setVisibleArea(QRectF const& sceneArea) override final;
+
+signals:
+
+    /*!
+     *  Emitted when a register or field item created by a virtualized block is clicked.
+     *
+     *      @param [in] selectedRegister    The clicked register.
+     *      @param [in] selectedField       The clicked field, or null if the register was clicked.
+     */
+    void selectRegisterEditor(QSharedPointer<Register> selectedRegister, QSharedPointer<Field> selectedField);
+
+private slots:
+
+    //! Handles a change in the height of the registers after a register item is expanded or collapsed.
+    void onRegisterHeightChanged();
+
 private:
+
+    //! Creates the register items for the shown area and releases the others.
+    void updateVisibleRegisters();
 		
 	//! Pointer to the address block being displayed.
 	QSharedPointer<AddressBlock> addrBlock_;
 
     //! The number of bits in an address unit.
     int addrssableUnitBits_;
+
+    //! Creates the register items of a virtualized block, null if the block is not virtualized.
+    QScopedPointer<RegisterItemProvider> registerProvider_;
+
+    //! The area of the scene shown in the view.
+    QRectF visibleArea_;
 };
 
 #endif // ADDRESSBLOCKGRAPHITEM_H
@@ -156,3 +156,11 @@ bool FieldGraphItem::isPresent() const
 {
     return field_->getIsPresent().isEmpty() || parseExpression(field_->getIsPresent()) == 1;
 }
+
+//-----------------------------------------------------------------------------
+// Function: FieldGraphItem::getField()
+//-----------------------------------------------------------------------------
+QSharedPointer<Field> FieldGraphItem::getField() const
+{
+    return field_;
+}
@@ -108,6 +108,13 @@ public:
      */
     virtual bool isPresent() const override final;
 
+    /*!
+     *  Get the visualized field.
+     *
+     *      @return The field being visualized.
+     */
+    QSharedPointer<Field> getField() const;
+
 protected:
      
     //! Set the item into conflicted (overlapping memory) state.
@@ -155,6 +155,17 @@ bool MemoryMapGraphItem::isPresent() const
     return memoryMap_->getIsPresent().isEmpty() || parseExpression(memoryMap_->getIsPresent()) == 1;
 }
 
+//-----------------------------------------------------------------------------
+// Function: MemoryMapGraphItem::setVisibleArea()
+//-----------------------------------------------------------------------------
+void MemoryMapGraphItem::setVisibleArea(QRectF const& sceneArea)
+{
+    for (MemoryVisualizationItem* child : childItems_)
+    {
+        child->setVisibleArea(sceneArea);
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: memorymapgraphitem::getMemoryMap()
 //-----------------------------------------------------------------------------
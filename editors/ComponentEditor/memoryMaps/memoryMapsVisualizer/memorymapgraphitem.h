@@ -102,6 +102,13 @@ public:
      */
     virtual bool isPresent() const override final;
 
+    /*!
+     *  Sets the area of the scene currently shown in the view for the address blocks.
+     *
+     *      @param [in] sceneArea   The shown area in scene coordinates.
+     */
+    virtual void setVisibleArea(QRectF const& sceneArea) override final;
+
 protected:
 
     /*!
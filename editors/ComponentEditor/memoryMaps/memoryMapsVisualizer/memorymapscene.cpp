@@ -24,7 +24,8 @@
 MemoryMapScene::MemoryMapScene(QObject *parent):
 QGraphicsScene(parent),
 memGraphItems_(),
-width_(VisualizerItem::DEFAULT_WIDTH)
+width_(VisualizerItem::DEFAULT_WIDTH),
+visibleArea_()
 {
 
 }
@@ -73,6 +74,8 @@ void MemoryMapScene::addMemGraphItem( VisualizerItem* memGraphItem )
 
     setSceneRect(rect);
     invalidate();
+
+    updateVisibleArea();
 }
 
 //-----------------------------------------------------------------------------
@@ -122,6 +125,9 @@ void MemoryMapScene::rePosition()
 
     setSceneRect(rect);
 	invalidate();
+
+    // The items may have moved in or out of the shown area.
+    updateVisibleArea();
 }
 
 //-----------------------------------------------------------------------------
@@ -146,6 +152,18 @@ void MemoryMapScene::setWidth(int width)
     }
 }
 
+//-----------------------------------------------------------------------------
+// Function: MemoryMapScene::setVisibleArea()
+//-----------------------------------------------------------------------------
+void MemoryMapScene::setVisibleArea(QRectF const& visibleArea)
+{
+    if (visibleArea_ != visibleArea)
+    {
+        visibleArea_ = visibleArea;
+        updateVisibleArea();
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: MemoryMapScene::wheelEvent()
 //-----------------------------------------------------------------------------
@@ -162,3 +180,23 @@ void MemoryMapScene::wheelEvent(QGraphicsSceneWheelEvent * wheelEvent)
         QGraphicsScene::wheelEvent(wheelEvent);
     }
 }
+
+//-----------------------------------------------------------------------------
+// Function: MemoryMapScene::updateVisibleArea()
+//-----------------------------------------------------------------------------
+void MemoryMapScene::updateVisibleArea()
+{
+    if (visibleArea_.isNull())
+    {
+        return;
+    }
+
+    for (VisualizerItem* memMap : memGraphItems_)
+    {
+        MemoryVisualizationItem* memoryItem = dynamic_cast<MemoryVisualizationItem*>(memMap);
+        if (memoryItem && memoryItem->isVisible())
+        {
+            memoryItem->setVisibleArea(visibleArea_);
+        }
+    }
+}
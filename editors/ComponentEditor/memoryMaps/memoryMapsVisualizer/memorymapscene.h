@@ -63,6 +63,15 @@ public:
 	 */
     void setWidth(int width);
 
+    /*!
+     *  Set the area of the scene shown in the view.
+     *
+     *  Address blocks with a large number of registers create the register items only for this area.
+     *
+     *      @param [in] visibleArea     The shown area in scene coordinates.
+     */
+    void setVisibleArea(QRectF const& visibleArea);
+
     public slots:
 
     /*!
@@ -83,11 +92,17 @@ private:
 	//! No assignment.
 	MemoryMapScene& operator=(const MemoryMapScene& other);
 
+    //! Informs the memory map items of the shown area.
+    void updateVisibleArea();
+
 	//! Contains the graph items for memory maps.
 	QList<VisualizerItem*> memGraphItems_;
 
     //! Width of top (memory map) items.
     int width_;
+
+    //! The area of the scene shown in the view.
+    QRectF visibleArea_;
 };
 
 #endif // MEMORYMAPSCENE_H
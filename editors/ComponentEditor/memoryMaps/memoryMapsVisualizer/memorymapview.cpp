@@ -49,6 +49,18 @@ void MemoryMapView::resizeEvent(QResizeEvent *event)
         memoryscene->setWidth(event->size().width());
         event->accept();
     }
+
+    updateVisibleArea();
+}
+
+//-----------------------------------------------------------------------------
+// Function: scrollContentsBy()
+//-----------------------------------------------------------------------------
+void MemoryMapView::scrollContentsBy(int dx, int dy)
+{
+    QGraphicsView::scrollContentsBy(dx, dy);
+
+    updateVisibleArea();
 }
 
 //-----------------------------------------------------------------------------
@@ -83,4 +95,16 @@ void MemoryMapView::mousePressEvent(QMouseEvent* mouseEvent)
     {
         QGraphicsView::mousePressEvent(mouseEvent);
     }
-}
\ No newline at end of file
+}
+
+//-----------------------------------------------------------------------------
+// Function: updateVisibleArea()
+//-----------------------------------------------------------------------------
+void MemoryMapView::updateVisibleArea()
+{
+    MemoryMapScene* memoryscene = dynamic_cast<MemoryMapScene*>(scene());
+    if (memoryscene)
+    {
+        memoryscene->setVisibleArea(mapToScene(viewport()->rect()).boundingRect());
+    }
+}
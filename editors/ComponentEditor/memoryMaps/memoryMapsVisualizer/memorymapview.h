@@ -41,7 +41,13 @@ protected:
     //! Handler for mouse press events.
     void mousePressEvent(QMouseEvent* mouseEvent);
 
+    //! Informs the scene of the shown area after scrolling.
+    virtual void scrollContentsBy(int dx, int dy);
+
 private:
+
+    //! Informs the scene of the area shown in the view.
+    void updateVisibleArea();
 	
 	//! No copying.
 	MemoryMapView(const MemoryMapView& other);
@@ -30,7 +30,9 @@
 RegisterGraphItem::RegisterGraphItem(QSharedPointer<Register> reg,
     QSharedPointer<ExpressionParser> expressionParser, QGraphicsItem* parent):
 MemoryVisualizationItem(expressionParser, parent),
-register_(reg)
+register_(reg),
+lastRegister_(reg),
+registerCount_(1)
 {
 	Q_ASSERT(register_);
 
@@ -62,6 +64,13 @@ void RegisterGraphItem::updateDisplay()
         name.append("[" % QString::number(dimension - 1) % ":0]");
     }
 
+    QString toolTipName = register_->name();
+    if (registerCount_ > 1)
+    {
+        name.append(QStringLiteral(" .. ") % lastRegister_->name() % " (" % QString::number(registerCount_) % ")");
+        toolTipName.append(QStringLiteral(" .. ") % lastRegister_->name());
+    }
+
     quint64 offset = getOffset();
     quint64 lastAddress = getLastAddress();
 
@@ -69,11 +78,17 @@ void RegisterGraphItem::updateDisplay()
     setDisplayOffset(offset);
     setDisplayLastAddress(lastAddress);
 
+    QString registerCount;
+    if (registerCount_ > 1)
+    {
+        registerCount = "<br><b>Registers: </b>" % QString::number(registerCount_);
+    }
+
     // Set tooltip to show addresses in hexadecimals.
-    setToolTip("<b>Name: </b>" % register_->name() % "<br>" %
+    setToolTip("<b>Name: </b>" % toolTipName % "<br>" %
         "<b>First address: </b>" % toHexString(offset) % "<br>" %
         "<b>Last address: </b>" % toHexString(lastAddress) % "<br>" %
-        "<b>Size [bits]: </b>" % QString::number(getBitWidth()));
+        "<b>Size [bits]: </b>" % QString::number(getBitWidth()) % registerCount);
 }
 
 //-----------------------------------------------------------------------------
@@ -86,7 +101,7 @@ void RegisterGraphItem::removeChild( MemoryVisualizationItem* childItem )
     Q_ASSERT(childItems_.contains(offset));
     childItems_.remove(offset, childItem);
 
-    disconnect(childItem, SIGNAL(destroyed(QObject*)), this, SLOT(reorganizeChildren()));
+    disconnect(childItem, SIGNAL(destroyed(QObject*)), this, SLOT(scheduleReorganize()));
 }
 
 //-----------------------------------------------------------------------------
@@ -94,16 +109,7 @@ void RegisterGraphItem::removeChild( MemoryVisualizationItem* childItem )
 //-----------------------------------------------------------------------------
 quint64 RegisterGraphItem::getOffset() const
 {	
-	// the address block's offset
-	MemoryVisualizationItem* blockItem = static_cast<MemoryVisualizationItem*>(parentItem());
-	Q_ASSERT(blockItem);
-	quint64 blockOffset = blockItem->getOffset();
-
-    // the register offset from the address block
-    quint64 regOffset = parseExpression(register_->getAddressOffset());
-
-	// the total offset is the address block's offset added with register's offset
-	return blockOffset + regOffset;
+    return getRegisterOffset(register_);
 }
 
 //-----------------------------------------------------------------------------
@@ -118,8 +124,8 @@ quint64 RegisterGraphItem::getLastAddress() const
         return 0;
     }
 
-    // the last address contained in the register    
-    return getOffset() + size - 1;
+    // the last address contained in the register, or in the last register of a collapsed run
+    return getRegisterOffset(lastRegister_) + size - 1;
 }
 
 //-----------------------------------------------------------------------------
@@ -162,26 +168,122 @@ bool RegisterGraphItem::isPresent() const
 }
 
 //-----------------------------------------------------------------------------
-// Function: RegisterGraphItem::updateChildMap()
+// Function: RegisterGraphItem::getRegister()
 //-----------------------------------------------------------------------------
-void RegisterGraphItem::updateChildMap()
+QSharedPointer<Register> RegisterGraphItem::getRegister() const
 {
-    QMap<quint64, MemoryVisualizationItem*> newMap;
-    
-    for (auto item = childItems_.begin(); item != childItems_.end(); /* iterator incremented in the loop*/)
+    return register_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterGraphItem::setRegister()
+//-----------------------------------------------------------------------------
+void RegisterGraphItem::setRegister(QSharedPointer<Register> reg)
+{
+    Q_ASSERT(reg);
+
+    QList<FieldGraphItem*> fieldItems;
+    for (MemoryVisualizationItem* child : childItems_)
     {
-        MemoryGapItem* gap = dynamic_cast<MemoryGapItem*>(*item);
-        if (gap)
+        FieldGraphItem* fieldItem = dynamic_cast<FieldGraphItem*>(child);
+        if (fieldItem)
         {
-            delete gap;
-            item = childItems_.erase(item);
+            fieldItems.append(fieldItem);
         }
-        else
+    }
+
+    // The field items are kept if they already show the fields of the new register.
+    int fieldCount = reg->getFields()->size() - reg->getFields()->count(QSharedPointer<Field>());
+    bool fieldsChanged = fieldItems.size() != fieldCount;
+    for (FieldGraphItem* fieldItem : fieldItems)
+    {
+        fieldsChanged = fieldsChanged || !reg->getFields()->contains(fieldItem->getField());
+    }
+
+    register_ = reg;
+    lastRegister_ = reg;
+    registerCount_ = 1;
+
+    if (fieldsChanged)
+    {
+        for (FieldGraphItem* fieldItem : fieldItems)
         {
-            ++item;
+            removeChild(fieldItem);
+            delete fieldItem;
         }
+
+        createFieldItems();
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterGraphItem::createFieldItems()
+//-----------------------------------------------------------------------------
+void RegisterGraphItem::createFieldItems()
+{
+    for (QSharedPointer<Field> field : *register_->getFields())
+    {
+        if (field)
+        {
+            FieldGraphItem* fieldItem = new FieldGraphItem(field, getExpressionParser(), this);
+            addChild(fieldItem);
+
+            connect(fieldItem, SIGNAL(selectEditor()), this, SLOT(onFieldSelected()), Qt::UniqueConnection);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterGraphItem::setCollapsedRun()
+//-----------------------------------------------------------------------------
+void RegisterGraphItem::setCollapsedRun(QSharedPointer<Register> lastRegister, int registerCount)
+{
+    lastRegister_ = lastRegister;
+    registerCount_ = registerCount;
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterGraphItem::sizeInAddressUnits()
+//-----------------------------------------------------------------------------
+quint64 RegisterGraphItem::sizeInAddressUnits(unsigned int bitWidth, unsigned int addressUnitBits, int dimension)
+{
+    // prevent division by zero
+    if (addressUnitBits == 0)
+    {
+        addressUnitBits = 1;
     }
 
+    // how many address unit are contained in the register
+    unsigned int size = bitWidth / addressUnitBits;
+    if (size*addressUnitBits < bitWidth) 
+    {
+        size++; //Round truncated number upwards
+    }
+
+    return qMax(1, dimension) * size;
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterGraphItem::onFieldSelected()
+//-----------------------------------------------------------------------------
+void RegisterGraphItem::onFieldSelected()
+{
+    FieldGraphItem* fieldItem = qobject_cast<FieldGraphItem*>(sender());
+    if (fieldItem)
+    {
+        emit selectFieldEditor(fieldItem->getField());
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterGraphItem::updateChildMap()
+//-----------------------------------------------------------------------------
+void RegisterGraphItem::updateChildMap()
+{
+    QMap<quint64, MemoryVisualizationItem*> newMap;
+    
+    releaseGapItems();
+
     unsigned int registerMSB = getRegisterMSB(getBitWidth());
 
     for (auto& item : childItems_)
@@ -274,26 +376,25 @@ void RegisterGraphItem::repositionChildren()
 //-----------------------------------------------------------------------------
 quint64 RegisterGraphItem::getSizeInAUB() const
 {
-    // how many bits one address unit takes
-    unsigned int addrUnit = getAddressUnitSize();
-
-    // prevent division by zero
-    if (addrUnit == 0)
-    {
-        addrUnit = 1;
-    }
+    return sizeInAddressUnits(parseExpression(register_->getSize()), getAddressUnitSize(),
+        parseExpression(register_->getDimension()));
+}
 
-    // how many address unit are contained in the register
-    unsigned int bitSize = parseExpression(register_->getSize());
-    unsigned int size = bitSize / addrUnit;
-    if (size*addrUnit < bitSize) 
-    {
-        size++; //Round truncated number upwards
-    }
+//-----------------------------------------------------------------------------
+// Function: RegisterGraphItem::getRegisterOffset()
+//-----------------------------------------------------------------------------
+quint64 RegisterGraphItem::getRegisterOffset(QSharedPointer<Register> reg) const
+{
+	// the address block's offset
+	MemoryVisualizationItem* blockItem = static_cast<MemoryVisualizationItem*>(parentItem());
+	Q_ASSERT(blockItem);
+	quint64 blockOffset = blockItem->getOffset();
 
-    int dimension = qMax(1, parseExpression(register_->getDimension()));
+    // the register offset from the address block
+    quint64 regOffset = parseExpression(reg->getAddressOffset());
 
-    return dimension * size;
+	// the total offset is the address block's offset added with register's offset
+	return blockOffset + regOffset;
 }
 
 //-----------------------------------------------------------------------------
@@ -371,8 +472,13 @@ bool RegisterGraphItem::emptySpaceBeforeChild(MemoryVisualizationItem* current,
 //-----------------------------------------------------------------------------
 void RegisterGraphItem::createMemoryGap(quint64 startAddress, quint64 endAddress)
 {
-    // create the gap item
-    FieldGapItem* gap = new FieldGapItem(tr("Reserved"), getExpressionParser(), this);
+    // Reuse a gap item of the previous layout, if any. Registers only contain field gaps.
+    FieldGapItem* gap = static_cast<FieldGapItem*>(takeReleasedGapItem());
+    if (gap == 0)
+    {
+        gap = new FieldGapItem(tr("Reserved"), getExpressionParser(), this);
+    }
+
     gap->setStartAddress(startAddress);
     gap->setEndAddress(qMin(endAddress, quint64(getRegisterMSB(getBitWidth()))));
     gap->setPos(findPositionFor(gap));
@@ -19,6 +19,7 @@
 #include <QSharedPointer>
 
 class ExpressionParser;
+class Field;
 
 //-----------------------------------------------------------------------------
 //! The graphical item that represents one register.
@@ -97,6 +98,58 @@ public:
      */
     virtual bool isPresent() const override final;
 
+    /*!
+     *  Get the visualized register.
+     *
+     *      @return The register being visualized.
+     */
+    QSharedPointer<Register> getRegister() const;
+
+    /*!
+     *  Sets the register to visualize and recreates the field items for it.
+     *
+     *  Used when an item created with createFieldItems() is reused for another register.
+     *
+     *      @param [in] reg     The register to visualize.
+     */
+    void setRegister(QSharedPointer<Register> reg);
+
+    /*!
+     *  Creates the field items of the register.
+     *
+     *  Used when the register item is not created by the component editor, which otherwise creates the field
+     *  items. A click on a created field item is reported with selectFieldEditor().
+     */
+    void createFieldItems();
+
+    /*!
+     *  Sets the item to represent a run of consecutive identical registers starting from the visualized one.
+     *
+     *      @param [in] lastRegister    The last register of the run.
+     *      @param [in] registerCount   The number of registers in the run.
+     */
+    void setCollapsedRun(QSharedPointer<Register> lastRegister, int registerCount);
+
+    /*!
+     *  Calculates the size of a register in address units.
+     *
+     *      @param [in] bitWidth            The width of the register in bits.
+     *      @param [in] addressUnitBits     The number of bits in an address unit.
+     *      @param [in] dimension           The dimension of the register.
+     *
+     *      @return The size of the register in address units.
+     */
+    static quint64 sizeInAddressUnits(unsigned int bitWidth, unsigned int addressUnitBits, int dimension);
+
+signals:
+
+    /*!
+     *  Emitted when a field item created with createFieldItems() is clicked.
+     *
+     *      @param [in] field   The field of the clicked item.
+     */
+    void selectFieldEditor(QSharedPointer<Field> field);
+
 protected:
 
     //! Update the child items in the map. Field items are organized according to last address.
@@ -107,8 +160,22 @@ protected:
      */
     virtual void repositionChildren() override final;
 
+private slots:
+
+    //! Reports a click on a field item created with createFieldItems().
+    void onFieldSelected();
+
 private:
-		
+
+    /*!
+     *  Gets the offset of the given register within the address block.
+     *
+     *      @param [in] reg     The register whose offset to get.
+     *
+     *      @return The offset of the register.
+     */
+    quint64 getRegisterOffset(QSharedPointer<Register> reg) const;
+
     /*!
      *  Gets the register size in AUB units.
      *
@@ -196,6 +263,12 @@ private:
     //! Pointer to the register being visualized.
 	QSharedPointer<Register> register_;
 
+    //! The last register of the run of identical registers represented by the item.
+    QSharedPointer<Register> lastRegister_;
+
+    //! The number of registers represented by the item.
+    int registerCount_;
+
 };
 
 #endif // REGISTERGRAPHITEM_H
@@ -0,0 +1,530 @@
+//-----------------------------------------------------------------------------
+// File: registeritemprovider.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 19.10.2026
+//
+// Description:
+// Creates the register items of an address block only for the shown part of the block.
+//-----------------------------------------------------------------------------
+
+#include "registeritemprovider.h"
+#include "registergraphitem.h"
+
+#include <editors/ComponentEditor/common/ExpressionParser.h>
+#include <editors/ComponentEditor/visualization/memorygapitem.h>
+#include <editors/ComponentEditor/visualization/memoryvisualizationitem.h>
+
+#include <QSignalBlocker>
+
+#include <algorithm>
+
+//-----------------------------------------------------------------------------
+// Function: RegisterItemProvider::RegisterItemProvider()
+//-----------------------------------------------------------------------------
+RegisterItemProvider::RegisterItemProvider(QSharedPointer<AddressBlock> addressBlock,
+    QSharedPointer<ExpressionParser> expressionParser, MemoryVisualizationItem* blockItem):
+QObject(),
+addressBlock_(addressBlock),
+expressionParser_(expressionParser),
+blockItem_(blockItem),
+rows_(),
+totalHeight_(0),
+width_(VisualizerItem::DEFAULT_WIDTH),
+activeItems_(),
+releasedRegisters_(),
+releasedGaps_(),
+expandedRegisters_()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterItemProvider::updateIndex()
+//-----------------------------------------------------------------------------
+void RegisterItemProvider::updateIndex()
+{
+    // The contents of the rows may have changed, so all the rows get their items again.
+    releaseItems();
+    rows_.clear();
+
+    QVector<RegisterEntry> registers = readRegisters();
+
+    quint64 blockLastAddress = blockItem_->getLastAddress();
+    quint64 nextFreeAddress = blockItem_->getOffset();
+
+    for (int i = 0; i < registers.size(); ++i)
+    {
+        RegisterEntry const& current = registers.at(i);
+
+        bool conflicted = current.lastAddress_ > blockLastAddress;
+        if (current.offset_ > nextFreeAddress)
+        {
+            addGapRow(nextFreeAddress, current.offset_ - 1);
+        }
+        else if (!rows_.isEmpty() && current.offset_ < nextFreeAddress)
+        {
+            conflicted = true;
+            rows_.last().conflicted_ = true;
+        }
+
+        int runEnd = i + 1;
+        if (!conflicted)
+        {
+            runEnd = findRunEnd(registers, i, blockLastAddress);
+            if (runEnd - i < MINIMUM_COLLAPSED_RUN)
+            {
+                runEnd = i + 1;
+            }
+        }
+
+        RegisterEntry const& last = registers.at(runEnd - 1);
+
+        IndexRow row;
+        row.offset_ = current.offset_;
+        row.lastAddress_ = last.lastAddress_;
+        row.firstRegister_ = current.register_;
+        row.lastRegister_ = last.register_;
+        row.registerCount_ = runEnd - i;
+        row.conflicted_ = conflicted;
+        row.top_ = 0;
+        row.height_ = 0;
+        rows_.append(row);
+
+        nextFreeAddress = qMax(nextFreeAddress, last.lastAddress_ + 1);
+        i = runEnd - 1;
+    }
+
+    // Fill in any addresses left between the registers and the end of the block.
+    if (!rows_.isEmpty() && blockLastAddress >= nextFreeAddress)
+    {
+        addGapRow(nextFreeAddress, blockLastAddress);
+    }
+
+    updateRowPositions();
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterItemProvider::hasRegisters()
+//-----------------------------------------------------------------------------
+bool RegisterItemProvider::hasRegisters() const
+{
+    // Gaps are only added around registers.
+    return !rows_.isEmpty();
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterItemProvider::rowCount()
+//-----------------------------------------------------------------------------
+int RegisterItemProvider::rowCount() const
+{
+    return rows_.size();
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterItemProvider::totalHeight()
+//-----------------------------------------------------------------------------
+qreal RegisterItemProvider::totalHeight() const
+{
+    return totalHeight_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterItemProvider::setWidth()
+//-----------------------------------------------------------------------------
+void RegisterItemProvider::setWidth(qreal width)
+{
+    width_ = width;
+
+    // The released items get the width when they are reused.
+    for (MemoryVisualizationItem* item : activeItems_)
+    {
+        item->setWidth(width_);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterItemProvider::updateItems()
+//-----------------------------------------------------------------------------
+void RegisterItemProvider::updateItems(qreal top, qreal bottom)
+{
+    qreal rowsTop = blockItem_->rect().bottom();
+    qreal areaTop = top - rowsTop - VISIBLE_MARGIN;
+    qreal areaBottom = bottom - rowsTop + VISIBLE_MARGIN;
+
+    int firstRow = std::lower_bound(rows_.constBegin(), rows_.constEnd(), areaTop,
+        [](IndexRow const& row, qreal position) { return row.top_ + row.height_ <= position; }) -
+        rows_.constBegin();
+    int lastRow = std::lower_bound(rows_.constBegin() + firstRow, rows_.constEnd(), areaBottom,
+        [](IndexRow const& row, qreal position) { return row.top_ < position; }) - rows_.constBegin();
+
+    for (auto item = activeItems_.begin(); item != activeItems_.end(); /* iterator incremented in the loop*/)
+    {
+        if (item.key() < firstRow || item.key() >= lastRow)
+        {
+            releaseItem(item.value());
+            item = activeItems_.erase(item);
+        }
+        else
+        {
+            ++item;
+        }
+    }
+
+    for (int i = firstRow; i < lastRow; ++i)
+    {
+        MemoryVisualizationItem* item = activeItems_.value(i, nullptr);
+        if (item == nullptr)
+        {
+            item = createItem(i);
+            activeItems_.insert(i, item);
+        }
+
+        item->setPos(MemoryVisualizationItem::CHILD_INDENTATION, rowsTop + rows_.at(i).top_);
+        item->setVisible(true);
+    }
+
+    // Expanding the block item shows all its children, also the released ones.
+    for (RegisterGraphItem* item : releasedRegisters_)
+    {
+        item->setVisible(false);
+    }
+
+    for (MemoryGapItem* item : releasedGaps_)
+    {
+        item->setVisible(false);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterItemProvider::releaseItems()
+//-----------------------------------------------------------------------------
+void RegisterItemProvider::releaseItems()
+{
+    for (MemoryVisualizationItem* item : activeItems_)
+    {
+        releaseItem(item);
+    }
+
+    activeItems_.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterItemProvider::onRegisterSelected()
+//-----------------------------------------------------------------------------
+void RegisterItemProvider::onRegisterSelected()
+{
+    RegisterGraphItem* registerItem = qobject_cast<RegisterGraphItem*>(sender());
+    if (registerItem)
+    {
+        emit selectRegisterEditor(registerItem->getRegister(), QSharedPointer<Field>());
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterItemProvider::onFieldSelected()
+//-----------------------------------------------------------------------------
+void RegisterItemProvider::onFieldSelected(QSharedPointer<Field> field)
+{
+    RegisterGraphItem* registerItem = qobject_cast<RegisterGraphItem*>(sender());
+    if (registerItem)
+    {
+        emit selectRegisterEditor(registerItem->getRegister(), field);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterItemProvider::onExpandStateChanged()
+//-----------------------------------------------------------------------------
+void RegisterItemProvider::onExpandStateChanged()
+{
+    RegisterGraphItem* registerItem = qobject_cast<RegisterGraphItem*>(sender());
+    if (registerItem == nullptr)
+    {
+        return;
+    }
+
+    // The signal is also emitted when the fields of the item are laid out.
+    Register const* expandedRegister = registerItem->getRegister().data();
+    if (registerItem->isExpanded() == expandedRegisters_.contains(expandedRegister))
+    {
+        return;
+    }
+
+    if (registerItem->isExpanded())
+    {
+        expandedRegisters_.insert(expandedRegister);
+    }
+    else
+    {
+        expandedRegisters_.remove(expandedRegister);
+    }
+
+    updateRowPositions();
+    emit heightChanged();
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterItemProvider::readRegisters()
+//-----------------------------------------------------------------------------
+QVector<RegisterItemProvider::RegisterEntry> RegisterItemProvider::readRegisters() const
+{
+    QVector<RegisterEntry> registers;
+    registers.reserve(addressBlock_->getRegisterData()->size());
+
+    quint64 blockOffset = blockItem_->getOffset();
+    unsigned int addressUnitBits = blockItem_->getAddressUnitSize();
+
+    for (QSharedPointer<RegisterBase> registerBase : *addressBlock_->getRegisterData())
+    {
+        QSharedPointer<Register> reg = registerBase.dynamicCast<Register>();
+        if (reg && (reg->getIsPresent().isEmpty() || parseExpression(reg->getIsPresent()) == 1))
+        {
+            RegisterEntry entry;
+            entry.register_ = reg;
+            entry.offset_ = blockOffset + parseExpression(reg->getAddressOffset());
+            entry.bitWidth_ = parseExpression(reg->getSize());
+            entry.dimension_ = parseExpression(reg->getDimension());
+
+            // Same as the last address of the register item.
+            quint64 size = RegisterGraphItem::sizeInAddressUnits(entry.bitWidth_, addressUnitBits,
+                entry.dimension_);
+            entry.lastAddress_ = 0;
+            if (size != 0)
+            {
+                entry.lastAddress_ = entry.offset_ + size - 1;
+            }
+
+            registers.append(entry);
+        }
+    }
+
+    // Registers with the same offset are ordered by descending last address, as in the other memory items.
+    std::stable_sort(registers.begin(), registers.end(), [](RegisterEntry const& first, RegisterEntry const& second)
+    {
+        return first.offset_ < second.offset_ ||
+            (first.offset_ == second.offset_ && first.lastAddress_ > second.lastAddress_);
+    });
+
+    return registers;
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterItemProvider::findRunEnd()
+//-----------------------------------------------------------------------------
+int RegisterItemProvider::findRunEnd(QVector<RegisterEntry> const& registers, int first,
+    quint64 blockLastAddress) const
+{
+    int end = first + 1;
+    while (end < registers.size() &&
+        registers.at(end).offset_ == registers.at(end - 1).lastAddress_ + 1 &&
+        registers.at(end).lastAddress_ <= blockLastAddress &&
+        isIdentical(registers.at(first), registers.at(end)))
+    {
+        end++;
+    }
+
+    return end;
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterItemProvider::isIdentical()
+//-----------------------------------------------------------------------------
+bool RegisterItemProvider::isIdentical(RegisterEntry const& first, RegisterEntry const& second) const
+{
+    if (first.bitWidth_ != second.bitWidth_ || first.dimension_ != second.dimension_)
+    {
+        return false;
+    }
+
+    QSharedPointer<QList<QSharedPointer<Field> > > firstFields = first.register_->getFields();
+    QSharedPointer<QList<QSharedPointer<Field> > > secondFields = second.register_->getFields();
+    if (firstFields->size() != secondFields->size())
+    {
+        return false;
+    }
+
+    for (int i = 0; i < firstFields->size(); ++i)
+    {
+        QSharedPointer<Field> firstField = firstFields->at(i);
+        QSharedPointer<Field> secondField = secondFields->at(i);
+
+        if (!firstField || !secondField || firstField->name() != secondField->name() ||
+            firstField->getBitOffset() != secondField->getBitOffset() ||
+            firstField->getBitWidth() != secondField->getBitWidth() ||
+            firstField->getIsPresent() != secondField->getIsPresent())
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterItemProvider::addGapRow()
+//-----------------------------------------------------------------------------
+void RegisterItemProvider::addGapRow(quint64 offset, quint64 lastAddress)
+{
+    IndexRow row;
+    row.offset_ = offset;
+    row.lastAddress_ = lastAddress;
+    row.registerCount_ = 0;
+    row.conflicted_ = false;
+    row.top_ = 0;
+    row.height_ = 0;
+
+    rows_.append(row);
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterItemProvider::parseExpression()
+//-----------------------------------------------------------------------------
+int RegisterItemProvider::parseExpression(QString const& expression) const
+{
+    return expressionParser_->parseExpression(expression).toUInt();
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterItemProvider::updateRowPositions()
+//-----------------------------------------------------------------------------
+void RegisterItemProvider::updateRowPositions()
+{
+    qreal top = 0;
+    for (IndexRow& row : rows_)
+    {
+        row.top_ = top;
+        row.height_ = findRowHeight(row);
+
+        top += row.height_;
+    }
+
+    totalHeight_ = top;
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterItemProvider::findRowHeight()
+//-----------------------------------------------------------------------------
+qreal RegisterItemProvider::findRowHeight(IndexRow const& row) const
+{
+    // An expanded register shows its fields on a second line.
+    if (row.firstRegister_ && expandedRegisters_.contains(row.firstRegister_.data()))
+    {
+        for (QSharedPointer<Field> field : *row.firstRegister_->getFields())
+        {
+            if (field && (field->getIsPresent().isEmpty() || parseExpression(field->getIsPresent()) == 1))
+            {
+                return 2 * VisualizerItem::DEFAULT_HEIGHT;
+            }
+        }
+    }
+
+    return VisualizerItem::DEFAULT_HEIGHT;
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterItemProvider::createItem()
+//-----------------------------------------------------------------------------
+MemoryVisualizationItem* RegisterItemProvider::createItem(int rowIndex)
+{
+    IndexRow const& row = rows_.at(rowIndex);
+    if (row.firstRegister_)
+    {
+        return createRegisterItem(row);
+    }
+
+    return createGapItem(row);
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterItemProvider::createRegisterItem()
+//-----------------------------------------------------------------------------
+RegisterGraphItem* RegisterItemProvider::createRegisterItem(IndexRow const& row)
+{
+    RegisterGraphItem* registerItem = nullptr;
+
+    // An item released with the same register keeps its field items.
+    for (int i = releasedRegisters_.size() - 1; i >= 0 && registerItem == nullptr; --i)
+    {
+        if (releasedRegisters_.at(i)->getRegister() == row.firstRegister_)
+        {
+            registerItem = releasedRegisters_.takeAt(i);
+        }
+    }
+
+    if (registerItem == nullptr && !releasedRegisters_.isEmpty())
+    {
+        registerItem = releasedRegisters_.takeLast();
+    }
+
+    if (registerItem)
+    {
+        registerItem->setRegister(row.firstRegister_);
+    }
+    else
+    {
+        registerItem = new RegisterGraphItem(row.firstRegister_, expressionParser_, blockItem_);
+        registerItem->createFieldItems();
+
+        connect(registerItem, SIGNAL(selectEditor()), this, SLOT(onRegisterSelected()), Qt::UniqueConnection);
+        connect(registerItem, SIGNAL(selectFieldEditor(QSharedPointer<Field>)),
+            this, SLOT(onFieldSelected(QSharedPointer<Field>)), Qt::UniqueConnection);
+        connect(registerItem, SIGNAL(expandStateChanged()),
+            this, SLOT(onExpandStateChanged()), Qt::UniqueConnection);
+    }
+
+    registerItem->setCollapsedRun(row.lastRegister_, row.registerCount_);
+    registerItem->setWidth(width_);
+
+    // The expansion is restored from the index, so it is not reported as a change by the user.
+    {
+        QSignalBlocker blocker(registerItem);
+        registerItem->setExpanded(expandedRegisters_.contains(row.firstRegister_.data()));
+    }
+
+    registerItem->recursiveRefresh();
+    registerItem->setConflicted(row.conflicted_);
+
+    return registerItem;
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterItemProvider::createGapItem()
+//-----------------------------------------------------------------------------
+MemoryGapItem* RegisterItemProvider::createGapItem(IndexRow const& row)
+{
+    MemoryGapItem* gap = nullptr;
+    if (releasedGaps_.isEmpty())
+    {
+        gap = new MemoryGapItem(expressionParser_, blockItem_);
+    }
+    else
+    {
+        gap = releasedGaps_.takeLast();
+    }
+
+    gap->setWidth(width_);
+    gap->setStartAddress(row.offset_);
+    gap->setEndAddress(row.lastAddress_);
+
+    return gap;
+}
+
+//-----------------------------------------------------------------------------
+// Function: RegisterItemProvider::releaseItem()
+//-----------------------------------------------------------------------------
+void RegisterItemProvider::releaseItem(MemoryVisualizationItem* item)
+{
+    item->setVisible(false);
+
+    RegisterGraphItem* registerItem = dynamic_cast<RegisterGraphItem*>(item);
+    if (registerItem)
+    {
+        releasedRegisters_.append(registerItem);
+    }
+    else
+    {
+        releasedGaps_.append(static_cast<MemoryGapItem*>(item));
+    }
+}
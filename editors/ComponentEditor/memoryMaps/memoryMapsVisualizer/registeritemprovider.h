@@ -0,0 +1,319 @@
+//-----------------------------------------------------------------------------
+// File: registeritemprovider.h
+//-----------------------------------------------------------------------------
+// Project: Kactus2
+// Author: Kactus2 team
+// Date: 19.10.2026
+//
+// Description:
+// Creates the register items of an address block only for the shown part of the block.
+//-----------------------------------------------------------------------------
+
+#ifndef REGISTERITEMPROVIDER_H
+#define REGISTERITEMPROVIDER_H
+
+#include <common/graphicsItems/visualizeritem.h>
+
+#include <IPXACTmodels/Component/AddressBlock.h>
+#include <IPXACTmodels/Component/Field.h>
+#include <IPXACTmodels/Component/Register.h>
+
+#include <QHash>
+#include <QObject>
+#include <QSet>
+#include <QSharedPointer>
+#include <QVector>
+
+class ExpressionParser;
+class MemoryGapItem;
+class MemoryVisualizationItem;
+class RegisterGraphItem;
+
+//-----------------------------------------------------------------------------
+//! Creates the register items of an address block only for the shown part of the block.
+//!
+//! The registers are kept in an index of rows sorted by offset. Each row is a register, a run of consecutive
+//! identical registers or a gap between them, and its position is known without creating an item for it.
+//! Items are created for the rows in the shown area and a margin around it. The items of the rows scrolled
+//! out of the area are hidden and reused for the next rows scrolled in.
+//!
+//! The provider owns the register and field items it creates. They are graphics children of the address
+//! block item and are deleted with it.
+//-----------------------------------------------------------------------------
+class RegisterItemProvider : public QObject
+{
+    Q_OBJECT
+
+public:
+
+    //! The distance above and below the shown area within which the rows have items.
+    static const int VISIBLE_MARGIN = 10 * VisualizerItem::DEFAULT_HEIGHT;
+
+    //! The minimum number of consecutive identical registers shown as one row.
+    static const int MINIMUM_COLLAPSED_RUN = 3;
+
+    /*!
+     *  The constructor.
+     *
+     *      @param [in] addressBlock        The address block whose registers to visualize.
+     *      @param [in] expressionParser    The used expression parser.
+     *      @param [in] blockItem           The item of the address block, parent of the created items.
+     */
+    RegisterItemProvider(QSharedPointer<AddressBlock> addressBlock,
+        QSharedPointer<ExpressionParser> expressionParser, MemoryVisualizationItem* blockItem);
+
+    //! The destructor.
+    virtual ~RegisterItemProvider() = default;
+
+    //! No copying.
+    RegisterItemProvider(const RegisterItemProvider& other) = delete;
+
+    //! No assignment.
+    RegisterItemProvider& operator=(const RegisterItemProvider& other) = delete;
+
+    //! Rebuilds the row index from the registers of the address block.
+    void updateIndex();
+
+    /*!
+     *  Checks if the address block has any registers to show.
+     *
+     *      @return True, if there are registers, otherwise false.
+     */
+    bool hasRegisters() const;
+
+    /*!
+     *  Get the number of rows in the index.
+     *
+     *      @return The number of rows.
+     */
+    int rowCount() const;
+
+    /*!
+     *  Get the total height of the rows.
+     *
+     *      @return The height of the rows.
+     */
+    qreal totalHeight() const;
+
+    /*!
+     *  Sets the width of the register items.
+     *
+     *      @param [in] width   The width to set.
+     */
+    void setWidth(qreal width);
+
+    /*!
+     *  Creates the items for the rows in the given area and releases the items of the other rows.
+     *
+     *      @param [in] top     The top of the shown area in the block item coordinates.
+     *      @param [in] bottom  The bottom of the shown area in the block item coordinates.
+     */
+    void updateItems(qreal top, qreal bottom);
+
+    //! Hides all the items to be reused for the next shown rows.
+    void releaseItems();
+
+signals:
+
+    /*!
+     *  Emitted when the item of a register or one of its fields is clicked.
+     *
+     *      @param [in] selectedRegister    The register of the clicked item.
+     *      @param [in] selectedField       The field of the clicked item, or null if the register was clicked.
+     */
+    void selectRegisterEditor(QSharedPointer<Register> selectedRegister, QSharedPointer<Field> selectedField);
+
+    //! Emitted when the height of the rows changes after the user expands or collapses a register.
+    void heightChanged();
+
+private slots:
+
+    //! Handles a click on a register item.
+    void onRegisterSelected();
+
+    /*!
+     *  Handles a click on a field item.
+     *
+     *      @param [in] field   The field of the clicked item.
+     */
+    void onFieldSelected(QSharedPointer<Field> field);
+
+    //! Handles the user expanding or collapsing a register item.
+    void onExpandStateChanged();
+
+private:
+
+    //! A register read for the index.
+    struct RegisterEntry
+    {
+        //! The register.
+        QSharedPointer<Register> register_;
+
+        //! The first address of the register.
+        quint64 offset_;
+
+        //! The last address of the register.
+        quint64 lastAddress_;
+
+        //! The width of the register in bits.
+        int bitWidth_;
+
+        //! The dimension of the register.
+        int dimension_;
+    };
+
+    //! A row in the index.
+    struct IndexRow
+    {
+        //! The first address of the row.
+        quint64 offset_;
+
+        //! The last address of the row.
+        quint64 lastAddress_;
+
+        //! The first register of the row, or null for a gap.
+        QSharedPointer<Register> firstRegister_;
+
+        //! The last register of the row.
+        QSharedPointer<Register> lastRegister_;
+
+        //! The number of registers in the row.
+        int registerCount_;
+
+        //! Tells if the row overlaps other rows or the end of the address block.
+        bool conflicted_;
+
+        //! The position of the row below the block item.
+        qreal top_;
+
+        //! The height of the row.
+        qreal height_;
+    };
+
+    /*!
+     *  Reads the registers of the address block sorted by offset.
+     *
+     *      @return The present registers.
+     */
+    QVector<RegisterEntry> readRegisters() const;
+
+    /*!
+     *  Finds the end of the run of identical consecutive registers starting at the given register.
+     *
+     *      @param [in] registers           The registers sorted by offset.
+     *      @param [in] first               The index of the first register of the run.
+     *      @param [in] blockLastAddress    The last address of the address block.
+     *
+     *      @return The index after the last register of the run.
+     */
+    int findRunEnd(QVector<RegisterEntry> const& registers, int first, quint64 blockLastAddress) const;
+
+    /*!
+     *  Checks if the two registers are identical apart from their names and offsets.
+     *
+     *      @param [in] first   The first register to compare.
+     *      @param [in] second  The second register to compare.
+     *
+     *      @return True, if the registers are identical, otherwise false.
+     */
+    bool isIdentical(RegisterEntry const& first, RegisterEntry const& second) const;
+
+    /*!
+     *  Adds a gap row to the index.
+     *
+     *      @param [in] offset          The first address of the gap.
+     *      @param [in] lastAddress     The last address of the gap.
+     */
+    void addGapRow(quint64 offset, quint64 lastAddress);
+
+    /*!
+     *  Parse a given expression.
+     *
+     *      @param [in] expression  The expression to parse.
+     *
+     *      @return The value of the expression.
+     */
+    int parseExpression(QString const& expression) const;
+
+    //! Calculates the positions of the rows.
+    void updateRowPositions();
+
+    /*!
+     *  Finds the height of the given row.
+     *
+     *      @param [in] row     The row whose height to find.
+     *
+     *      @return The height of the row.
+     */
+    qreal findRowHeight(IndexRow const& row) const;
+
+    /*!
+     *  Gets an item for the given row.
+     *
+     *      @param [in] rowIndex    The index of the row.
+     *
+     *      @return The item for the row.
+     */
+    MemoryVisualizationItem* createItem(int rowIndex);
+
+    /*!
+     *  Gets a register item for the given row, reusing a released one if possible.
+     *
+     *      @param [in] row     The row to show.
+     *
+     *      @return The register item.
+     */
+    RegisterGraphItem* createRegisterItem(IndexRow const& row);
+
+    /*!
+     *  Gets a gap item for the given row, reusing a released one if possible.
+     *
+     *      @param [in] row     The row to show.
+     *
+     *      @return The gap item.
+     */
+    MemoryGapItem* createGapItem(IndexRow const& row);
+
+    /*!
+     *  Hides the given item to be reused for the next shown rows.
+     *
+     *      @param [in] item    The item to release.
+     */
+    void releaseItem(MemoryVisualizationItem* item);
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The address block whose registers are visualized.
+    QSharedPointer<AddressBlock> addressBlock_;
+
+    //! The used expression parser.
+    QSharedPointer<ExpressionParser> expressionParser_;
+
+    //! The item of the address block.
+    MemoryVisualizationItem* blockItem_;
+
+    //! The rows sorted by offset.
+    QVector<IndexRow> rows_;
+
+    //! The total height of the rows.
+    qreal totalHeight_;
+
+    //! The width of the register items.
+    qreal width_;
+
+    //! The items of the rows in the shown area by the row index.
+    QHash<int, MemoryVisualizationItem*> activeItems_;
+
+    //! The hidden register items to reuse.
+    QVector<RegisterGraphItem*> releasedRegisters_;
+
+    //! The hidden gap items to reuse.
+    QVector<MemoryGapItem*> releasedGaps_;
+
+    //! The first registers of the rows expanded by the user.
+    QSet<Register const*> expandedRegisters_;
+};
+
+#endif // REGISTERITEMPROVIDER_H
@@ -116,5 +116,6 @@ MemoryMapEditor::~MemoryMapEditor()
 //-----------------------------------------------------------------------------
 void MemoryMapEditor::refresh()
 {
+    model_->invalidateEvaluations();
 	view_->update();
 }
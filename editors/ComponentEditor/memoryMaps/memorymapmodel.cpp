@@ -48,6 +48,7 @@ addressUnitBits_(addressUnitBits)
     setExpressionParser(expressionParser);
 
     Q_ASSERT(memoryRemap_);
+    invalidateEvaluationsOnChanges(this);
 }
 
 //-----------------------------------------------------------------------------
@@ -173,11 +174,11 @@ QVariant MemoryMapModel::data(QModelIndex const& index, int role) const
         {
             if (role == Qt::DisplayRole)
             {
-                return expressionFormatter_->formatReferringExpression(valueForIndex(index).toString());
+                return cachedFormattedExpression(index, valueForIndex(index).toString(), expressionFormatter_);
             }
             else if (role == Qt::ToolTipRole)
             {
-                return formattedValueFor(valueForIndex(index).toString());
+                return cachedValueFor(index, valueForIndex(index).toString());
             }
         }
         else if (role == Qt::DisplayRole && index.column() == MemoryMapColumns::DESCRIPTION_COLUMN)
@@ -204,8 +205,7 @@ QVariant MemoryMapModel::data(QModelIndex const& index, int role) const
         QSharedPointer<MemoryBlockBase> memoryBlock = memoryBlocks_->at(index.row());
 
         if (index.column() != MemoryMapColumns::IS_PRESENT &&
-            (!memoryBlock->getIsPresent().isEmpty() &&
-             parseExpressionToDecimal(memoryBlock->getIsPresent()).toInt() != 1))
+            !cachedPresence(index.row(), memoryBlock->getIsPresent()))
         {
             return KactusColors::DISABLED_TEXT;
         }
@@ -143,6 +143,7 @@ void MemoryMapsEditor::connectSignals()
 //-----------------------------------------------------------------------------
 void MemoryMapsEditor::refresh()
 {
+    model_->invalidateEvaluations();
     delegate_->updateRemapStateNames(getRemapStateNames());
 	view_->update();
     view_->expandAll();
@@ -50,6 +50,7 @@ QAbstractItemModel(parent),
     memoryMapValidator_(memoryMapValidator)
 {
     setExpressionParser(expressionParser);
+    invalidateEvaluationsOnChanges(this);
 }
 
 //-----------------------------------------------------------------------------
@@ -161,7 +162,7 @@ QVariant MemoryMapsModel::data(QModelIndex const& index, int role) const
     {
         if (isValidExpressionColumn(index))
         {
-            return expressionFormatter_->formatReferringExpression(valueForIndex(index).toString());
+            return cachedFormattedExpression(index, valueForIndex(index).toString(), expressionFormatter_);
         }
         else if (index.column() == MemoryMapsColumns::DESCRIPTION_COLUMN)
         {
@@ -186,7 +187,7 @@ QVariant MemoryMapsModel::data(QModelIndex const& index, int role) const
     {
         if (isValidExpressionColumn(index))
         {
-            return formattedValueFor(valueForIndex(index).toString());
+            return cachedValueFor(index, valueForIndex(index).toString());
         }
         else
         {
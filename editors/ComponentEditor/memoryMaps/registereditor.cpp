@@ -120,5 +120,7 @@ RegisterEditor::~RegisterEditor()
 //-----------------------------------------------------------------------------
 void RegisterEditor::refresh()
 {
+    // The referenced parameters may have changed while the editor was hidden.
+    model_->invalidateEvaluations();
 	view_->update();
 }
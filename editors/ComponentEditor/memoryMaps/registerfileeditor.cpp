@@ -137,5 +137,6 @@ RegisterFileEditor::RegisterFileEditor(QSharedPointer<QList<QSharedPointer<Regis
 //-----------------------------------------------------------------------------
 void RegisterFileEditor::refresh()
 {
+    model_->invalidateEvaluations();
     view_->update();
 }
@@ -60,6 +60,7 @@ registerFileValidator_(registerFileValidator)
     }
 
     setExpressionParser(expressionParser);
+    invalidateEvaluationsOnChanges(this);
 }
 
 //-----------------------------------------------------------------------------
@@ -155,7 +156,7 @@ QVariant RegisterFileModel::data(QModelIndex const& index, int role) const
     {
         if (isValidExpressionColumn(index))
         {
-            return expressionFormatter_->formatReferringExpression(valueForIndex(index).toString());
+            return cachedFormattedExpression(index, valueForIndex(index).toString(), expressionFormatter_);
         }
         else if (index.column() == RegisterFileColumns::DESCRIPTION)
         {
@@ -182,7 +183,7 @@ QVariant RegisterFileModel::data(QModelIndex const& index, int role) const
     {
         if (isValidExpressionColumn(index))
         {
-            return formattedValueFor(valueForIndex(index).toString());
+            return cachedValueFor(index, valueForIndex(index).toString());
         }
         else
         {
@@ -191,13 +192,12 @@ QVariant RegisterFileModel::data(QModelIndex const& index, int role) const
     }
     else if (role == Qt::ForegroundRole)
     {
-        if (validateIndex(index))
+        if (cachedValidity(index))
         {
             QSharedPointer<RegisterFile> regFile = items_.at(index.row());
 
             if (index.column() != RegisterFileColumns::IS_PRESENT &&
-                (!regFile->getIsPresent().isEmpty() && 
-                    parseExpressionToDecimal(regFile->getIsPresent()).toInt() != 1))
+                !cachedPresence(index.row(), regFile->getIsPresent()))
             {
                 return KactusColors::DISABLED_TEXT;
             }
@@ -40,6 +40,7 @@ expressionFormatter_(expressionFormatter),
 fieldValidator_(fieldValidator)
 {
     setExpressionParser(expressionParser);
+    invalidateEvaluationsOnChanges(this);
 }
 
 //-----------------------------------------------------------------------------
@@ -184,7 +185,7 @@ QVariant RegisterTableModel::data( const QModelIndex& index, int role /*= Qt::Di
     {
         if (isValidExpressionColumn(index))
         {
-            return expressionFormatter_->formatReferringExpression(valueForIndex(index).toString());
+            return cachedFormattedExpression(index, valueForIndex(index).toString(), expressionFormatter_);
         }
         else if (index.column() == RegisterColumns::DESCRIPTION_COLUMN)
         {
@@ -215,7 +216,7 @@ QVariant RegisterTableModel::data( const QModelIndex& index, int role /*= Qt::Di
         }
         else if (isValidExpressionColumn(index))
         {
-            return formattedValueFor(valueForIndex(index).toString());
+            return cachedValueFor(index, valueForIndex(index).toString());
         }
         else
         {
@@ -225,11 +226,10 @@ QVariant RegisterTableModel::data( const QModelIndex& index, int role /*= Qt::Di
 
 	else if (Qt::ForegroundRole == role) 
     {
-        if (validateIndex(index))
+        if (cachedValidity(index))
         {
-            QString isPresentValue = fields_->at(index.row())->getIsPresent();
-            if (index.column() != RegisterColumns::IS_PRESENT_COLUMN && 
-                (!isPresentValue.isEmpty() && parseExpressionToDecimal(isPresentValue).toInt() != 1))
+            if (index.column() != RegisterColumns::IS_PRESENT_COLUMN &&
+                !cachedPresence(index.row(), fields_->at(index.row())->getIsPresent()))
             {
                 return KactusColors::DISABLED_TEXT;
             }
@@ -76,43 +76,54 @@ void ComponentParameterReferenceTree::setupTree()
 {
     if (!component_.isNull())
     {
-        if (referenceCounter_->countReferencesInFileSets(getTargetID()) > 0)
+        // Only the sections indexed to reference the parameter are searched.
+        QString targetID = getTargetID();
+
+        if (referenceCounter_->countIndexedReferences(
+            targetID, ComponentParameterReferenceCounter::FILESETS) > 0)
         {
             createReferencesForFileSets();
         }
 
-        if (referenceCounter_->countReferencesInParameters(getTargetID(), component_->getParameters()) > 0)
+        if (referenceCounter_->countIndexedReferences(
+            targetID, ComponentParameterReferenceCounter::PARAMETERS) > 0)
         {
             QTreeWidgetItem* topParametersItem = createTopItem("Parameters");
             createParameterReferences(component_->getParameters(), topParametersItem);
         }
 
-        if (referenceCounter_->countReferencesInMemoryMaps(getTargetID()) > 0)
+        if (referenceCounter_->countIndexedReferences(
+            targetID, ComponentParameterReferenceCounter::MEMORYMAPS) > 0)
         {
             createReferencesForMemoryMaps();
         }
 
-        if (referenceCounter_->countReferencesInAddressSpaces(getTargetID()) > 0)
+        if (referenceCounter_->countIndexedReferences(
+            targetID, ComponentParameterReferenceCounter::ADDRESSSPACES) > 0)
         {
             createReferencesForAddressSpaces();
         }
 
-        if (referenceCounter_->countReferencesInInstantiations(getTargetID()) > 0)
+        if (referenceCounter_->countIndexedReferences(
+            targetID, ComponentParameterReferenceCounter::INSTANTIATIONS) > 0)
         {
             createReferencesForInstantiations();
         }
 
-        if (referenceCounter_->countReferencesInPorts(getTargetID()) > 0)
+        if (referenceCounter_->countIndexedReferences(
+            targetID, ComponentParameterReferenceCounter::PORTS) > 0)
         {
             createReferencesForPorts();
         }
 
-        if (referenceCounter_->countReferencesInBusInterfaces(getTargetID()) > 0)
+        if (referenceCounter_->countIndexedReferences(
+            targetID, ComponentParameterReferenceCounter::BUSINTERFACES) > 0)
         {
             createReferencesForBusInterfaces();
         }
 
-        if (referenceCounter_->countReferencesInRemapStates(getTargetID()) > 0)
+        if (referenceCounter_->countIndexedReferences(
+            targetID, ComponentParameterReferenceCounter::REMAPSTATES) > 0)
         {
             createReferencesForRemapStates();
         }
@@ -45,6 +45,7 @@ arrayStartIndex_(arrayStartIndex)
 
     QString arrayValue;
     setExpressionParser(expressionParser);
+    invalidateEvaluationsOnChanges(this);
 }
 
 //-----------------------------------------------------------------------------
@@ -115,7 +116,7 @@ QVariant ParameterArrayModel::data(const QModelIndex &index, int role) const
     {
         if (index.column() == ArrayColumns::VALUE)
         {
-            return expressionformatter_->formatReferringExpression(valueForIndex(index).toString());
+            return cachedFormattedExpression(index, valueForIndex(index).toString(), expressionformatter_);
         }
         else
         {
@@ -150,7 +151,7 @@ QVariant ParameterArrayModel::data(const QModelIndex &index, int role) const
             }
             else
             {
-                return formattedValueFor(valueForIndex(index).toString());
+                return cachedValueFor(index, valueForIndex(index).toString());
             }
         }
         else
@@ -20,7 +20,7 @@ ComponentParameterModel::ComponentParameterModel(QSharedPointer<ParameterFinder>
     ParameterizableTable(parameterFinder),
     parameterFinder_(parameterFinder)
 {
-
+    invalidateEvaluationsOnChanges(this);
 }
 
 //-----------------------------------------------------------------------------
@@ -92,7 +92,7 @@ QVariant ComponentParameterModel::data(QModelIndex const& index, int role) const
         }
         else if (index.column() == ComponentParameterColumns::VALUE)
         {
-            return formattedValueFor(parameterFinder_->valueForId(parameterIds.at(index.row())));
+            return cachedValueFor(index, parameterFinder_->valueForId(parameterIds.at(index.row())));
         }
         else if (index.column() == ComponentParameterColumns::ID)
         {
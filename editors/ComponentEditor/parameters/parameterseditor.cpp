@@ -142,6 +142,7 @@ ParametersEditor::~ParametersEditor()
 //-----------------------------------------------------------------------------
 void ParametersEditor::refresh()
 {
+    model_->invalidateEvaluations();
     view_->update();
 }
 
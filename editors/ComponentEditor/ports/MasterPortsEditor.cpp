@@ -129,6 +129,7 @@ bool MasterPortsEditor::isValid() const
 //-----------------------------------------------------------------------------
 void MasterPortsEditor::refresh()
 {
+    model_->invalidateEvaluations();
 	view_->update();
 }
 
@@ -38,7 +38,12 @@
 ComponentParameterReferenceCounter::ComponentParameterReferenceCounter(
     QSharedPointer<ParameterFinder> parameterFinder, QSharedPointer<Component> component):
 ParameterReferenceCounter(parameterFinder),
-component_(component)
+component_(component),
+    indexedIds_(),
+    referenceTotals_(),
+    referenceIndex_(SECTION_COUNT),
+    referenceIndexValid_(false),
+    sectionIndexValid_(false)
 {
 
 }
@@ -49,6 +54,403 @@ component_(component)
 void ComponentParameterReferenceCounter::setComponent(QSharedPointer<Component> newComponent)
 {
     component_ = newComponent;
+    invalidateReferenceIndex();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterReferenceCounter::countIndexedReferences()
+//-----------------------------------------------------------------------------
+int ComponentParameterReferenceCounter::countIndexedReferences(QString const& parameterID) const
+{
+    updateReferenceIndex();
+
+    if (!indexedIds_.contains(parameterID))
+    {
+        // Parameters created after the index was built are counted directly.
+        int referenceCount = 0;
+        for (int section = 0; section < SECTION_COUNT; ++section)
+        {
+            referenceCount += countReferencesInSection(parameterID, static_cast<ReferenceSection>(section));
+        }
+
+        return referenceCount;
+    }
+
+    return referenceTotals_.value(parameterID, 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterReferenceCounter::countIndexedReferences()
+//-----------------------------------------------------------------------------
+int ComponentParameterReferenceCounter::countIndexedReferences(QString const& parameterID,
+    ReferenceSection section) const
+{
+    if (!sectionIndexValid_)
+    {
+        referenceIndexValid_ = false;
+    }
+
+    updateReferenceIndex();
+
+    if (!indexedIds_.contains(parameterID))
+    {
+        return countReferencesInSection(parameterID, section);
+    }
+
+    return referenceIndex_.at(section).value(parameterID, 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterReferenceCounter::increaseReferenceCount()
+//-----------------------------------------------------------------------------
+void ComponentParameterReferenceCounter::increaseReferenceCount(QString const& id)
+{
+    ParameterReferenceCounter::increaseReferenceCount(id);
+
+    if (referenceIndexValid_ && indexedIds_.contains(id))
+    {
+        referenceTotals_[id]++;
+    }
+
+    // The section of the new reference is not known.
+    sectionIndexValid_ = false;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterReferenceCounter::decreaseReferenceCount()
+//-----------------------------------------------------------------------------
+void ComponentParameterReferenceCounter::decreaseReferenceCount(QString const& id)
+{
+    ParameterReferenceCounter::decreaseReferenceCount(id);
+
+    if (referenceIndexValid_ && referenceTotals_.value(id, 0) > 0)
+    {
+        referenceTotals_[id]--;
+    }
+
+    sectionIndexValid_ = false;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterReferenceCounter::invalidateReferenceIndex()
+//-----------------------------------------------------------------------------
+void ComponentParameterReferenceCounter::invalidateReferenceIndex()
+{
+    referenceIndexValid_ = false;
+    sectionIndexValid_ = false;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterReferenceCounter::invalidateSectionIndex()
+//-----------------------------------------------------------------------------
+void ComponentParameterReferenceCounter::invalidateSectionIndex()
+{
+    sectionIndexValid_ = false;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterReferenceCounter::updateReferenceIndex()
+//-----------------------------------------------------------------------------
+void ComponentParameterReferenceCounter::updateReferenceIndex() const
+{
+    if (referenceIndexValid_)
+    {
+        return;
+    }
+
+    indexedIds_.clear();
+    referenceTotals_.clear();
+    for (QHash<QString, int>& sectionReferences : referenceIndex_)
+    {
+        sectionReferences.clear();
+    }
+
+    if (component_)
+    {
+        const QStringList parameterIds = getParameterFinder()->getAllParameterIds();
+        for (QString const& parameterId : parameterIds)
+        {
+            indexedIds_.insert(parameterId);
+        }
+
+        for (int section = 0; section < SECTION_COUNT; ++section)
+        {
+            QHash<QString, int>& sectionReferences = referenceIndex_[section];
+            collectReferencesInSection(static_cast<ReferenceSection>(section), sectionReferences);
+
+            for (auto reference = sectionReferences.cbegin(); reference != sectionReferences.cend(); ++reference)
+            {
+                referenceTotals_[reference.key()] += reference.value();
+            }
+        }
+    }
+
+    referenceIndexValid_ = true;
+    sectionIndexValid_ = true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterReferenceCounter::countReferencesInSection()
+//-----------------------------------------------------------------------------
+int ComponentParameterReferenceCounter::countReferencesInSection(QString const& parameterID,
+    ReferenceSection section) const
+{
+    if (!component_)
+    {
+        return 0;
+    }
+
+    switch (section)
+    {
+    case FILESETS:
+        return countReferencesInFileSets(parameterID);
+    case PARAMETERS:
+        return countReferencesInParameters(parameterID, component_->getParameters());
+    case MEMORYMAPS:
+        return countReferencesInMemoryMaps(parameterID);
+    case ADDRESSSPACES:
+        return countReferencesInAddressSpaces(parameterID);
+    case INSTANTIATIONS:
+        return countReferencesInInstantiations(parameterID);
+    case PORTS:
+        return countReferencesInPorts(parameterID);
+    case BUSINTERFACES:
+        return countReferencesInBusInterfaces(parameterID);
+    case REMAPSTATES:
+        return countReferencesInRemapStates(parameterID);
+    default:
+        return 0;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterReferenceCounter::collectReferencesInSection()
+//-----------------------------------------------------------------------------
+void ComponentParameterReferenceCounter::collectReferencesInSection(ReferenceSection section,
+    QHash<QString, int>& references) const
+{
+    if (section == FILESETS)
+    {
+        for (QSharedPointer<FileSet> fileSet : *component_->getFileSets())
+        {
+            collectReferencesInFileBuilders(fileSet->getDefaultFileBuilders(), references);
+
+            for (QSharedPointer<File> singleFile : *fileSet->getFiles())
+            {
+                if (singleFile->getBuildCommand())
+                {
+                    collectReferences(singleFile->getBuildCommand()->getReplaceDefaultFlags(), references);
+                }
+            }
+        }
+    }
+    else if (section == PARAMETERS)
+    {
+        collectReferencesInParameters(component_->getParameters(), indexedIds_, references);
+    }
+    else if (section == MEMORYMAPS)
+    {
+        for (QSharedPointer<MemoryMap> memoryMap : *component_->getMemoryMaps())
+        {
+            collectReferencesInBaseMemoryMap(memoryMap, references);
+
+            for (QSharedPointer<MemoryRemap> remap : *memoryMap->getMemoryRemaps())
+            {
+                collectReferencesInBaseMemoryMap(remap, references);
+            }
+        }
+    }
+    else if (section == ADDRESSSPACES)
+    {
+        for (QSharedPointer<AddressSpace> space : *component_->getAddressSpaces())
+        {
+            collectReferences(space->getWidth(), references);
+            collectReferences(space->getRange(), references);
+
+            if (space->getLocalMemoryMap())
+            {
+                collectReferencesInBaseMemoryMap(space->getLocalMemoryMap(), references);
+            }
+
+            for (QSharedPointer<Segment> segment : *space->getSegments())
+            {
+                collectReferences(segment->getAddressOffset(), references);
+                collectReferences(segment->getRange(), references);
+            }
+        }
+    }
+    else if (section == INSTANTIATIONS)
+    {
+        for (QSharedPointer<ComponentInstantiation> instantiation : *component_->getComponentInstantiations())
+        {
+            for (QSharedPointer<ModuleParameter> parameter : *instantiation->getModuleParameters())
+            {
+                collectReferencesInSingleParameter(parameter, indexedIds_, references);
+            }
+
+            collectReferencesInParameters(instantiation->getParameters(), indexedIds_, references);
+            collectReferencesInFileBuilders(instantiation->getDefaultFileBuilders(), references);
+        }
+
+        for (QSharedPointer<DesignConfigurationInstantiation> instantiation :
+            *component_->getDesignConfigurationInstantiations())
+        {
+            collectReferencesInParameters(instantiation->getParameters(), indexedIds_, references);
+
+            QSharedPointer<ConfigurableVLNVReference> configurationReference =
+                instantiation->getDesignConfigurationReference();
+            if (configurationReference && configurationReference->isValid())
+            {
+                collectReferencesInConfigurableElementValues(
+                    configurationReference->getConfigurableElementValues(), indexedIds_, references);
+            }
+        }
+
+        for (QSharedPointer<DesignInstantiation> instantiation : *component_->getDesignInstantiations())
+        {
+            QSharedPointer<ConfigurableVLNVReference> designReference = instantiation->getDesignReference();
+            if (designReference && designReference->isValid())
+            {
+                collectReferencesInConfigurableElementValues(
+                    designReference->getConfigurableElementValues(), indexedIds_, references);
+            }
+        }
+    }
+    else if (section == PORTS)
+    {
+        for (QSharedPointer<Port> port : *component_->getPorts())
+        {
+            collectReferences(port->getLeftBound(), references);
+            collectReferences(port->getRightBound(), references);
+            collectReferences(port->getArrayLeft(), references);
+            collectReferences(port->getArrayRight(), references);
+            collectReferences(port->getDefaultValue(), references);
+        }
+    }
+    else if (section == BUSINTERFACES)
+    {
+        for (QSharedPointer<BusInterface> busInterface : *component_->getBusInterfaces())
+        {
+            collectReferencesInBusInterface(busInterface, references);
+        }
+    }
+    else if (section == REMAPSTATES)
+    {
+        for (QSharedPointer<RemapState> remapState : *component_->getRemapStates())
+        {
+            for (QSharedPointer<RemapPort> port : *remapState->getRemapPorts())
+            {
+                collectReferences(port->getValue(), references);
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterReferenceCounter::collectReferencesInFileBuilders()
+//-----------------------------------------------------------------------------
+void ComponentParameterReferenceCounter::collectReferencesInFileBuilders(
+    QSharedPointer<QList<QSharedPointer<FileBuilder> > > builders, QHash<QString, int>& references) const
+{
+    for (QSharedPointer<FileBuilder> fileBuilder : *builders)
+    {
+        collectReferences(fileBuilder->getReplaceDefaultFlags(), references);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterReferenceCounter::collectReferencesInBaseMemoryMap()
+//-----------------------------------------------------------------------------
+void ComponentParameterReferenceCounter::collectReferencesInBaseMemoryMap(QSharedPointer<MemoryMapBase> memoryMap,
+    QHash<QString, int>& references) const
+{
+    for (QSharedPointer<MemoryBlockBase> memoryBlock : *memoryMap->getMemoryBlocks())
+    {
+        QSharedPointer<AddressBlock> addressBlock = memoryBlock.dynamicCast<AddressBlock>();
+        if (addressBlock)
+        {
+            collectReferences(addressBlock->getBaseAddress(), references);
+            collectReferences(addressBlock->getRange(), references);
+            collectReferences(addressBlock->getWidth(), references);
+            collectReferences(addressBlock->getIsPresent(), references);
+
+            for (QSharedPointer<RegisterBase> registerItem : *addressBlock->getRegisterData())
+            {
+                QSharedPointer<Register> targetRegister = registerItem.dynamicCast<Register>();
+                if (targetRegister)
+                {
+                    collectReferencesInRegister(targetRegister, references);
+                }
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterReferenceCounter::collectReferencesInRegister()
+//-----------------------------------------------------------------------------
+void ComponentParameterReferenceCounter::collectReferencesInRegister(QSharedPointer<Register> targetRegister,
+    QHash<QString, int>& references) const
+{
+    collectReferences(targetRegister->getAddressOffset(), references);
+    collectReferences(targetRegister->getDimension(), references);
+    collectReferences(targetRegister->getSize(), references);
+    collectReferences(targetRegister->getIsPresent(), references);
+
+    for (QSharedPointer<Field> registerField : *targetRegister->getFields())
+    {
+        collectReferences(registerField->getBitOffset(), references);
+        collectReferences(registerField->getBitWidth(), references);
+        collectReferences(registerField->getIsPresent(), references);
+
+        for (QSharedPointer<FieldReset> fieldReset : *registerField->getResets())
+        {
+            collectReferences(fieldReset->getResetValue(), references);
+            collectReferences(fieldReset->getResetMask(), references);
+        }
+
+        QSharedPointer<WriteValueConstraint> writeConstraint = registerField->getWriteConstraint();
+        if (writeConstraint)
+        {
+            collectReferences(writeConstraint->getMinimum(), references);
+            collectReferences(writeConstraint->getMaximum(), references);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterReferenceCounter::collectReferencesInBusInterface()
+//-----------------------------------------------------------------------------
+void ComponentParameterReferenceCounter::collectReferencesInBusInterface(QSharedPointer<BusInterface> busInterface,
+    QHash<QString, int>& references) const
+{
+    collectReferencesInParameters(busInterface->getParameters(), indexedIds_, references);
+
+    QSharedPointer<MirroredSlaveInterface> mirroredSlave = busInterface->getMirroredSlave();
+    if (mirroredSlave)
+    {
+        collectReferences(mirroredSlave->getRange(), references);
+
+        for (QSharedPointer<MirroredSlaveInterface::RemapAddress> remapAddress :
+            *mirroredSlave->getRemapAddresses())
+        {
+            collectReferences(remapAddress->remapAddress_, references);
+        }
+    }
+
+    if (busInterface->getMaster())
+    {
+        collectReferences(busInterface->getMaster()->getBaseAddress(), references);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentParameterReferenceCounter::collectReferences()
+//-----------------------------------------------------------------------------
+void ComponentParameterReferenceCounter::collectReferences(QString const& expression,
+    QHash<QString, int>& references) const
+{
+    collectReferencesInExpression(expression, indexedIds_, references);
 }
 
 //-----------------------------------------------------------------------------
@@ -59,19 +461,7 @@ void ComponentParameterReferenceCounter::recalculateReferencesToParameters(
 {
     foreach (QSharedPointer<Parameter> parameter, parameterList)
     {
-        int referenceCount = 0;
-        QString parameterID = parameter->getValueId();
-
-        referenceCount += countReferencesInFileSets(parameterID);
-        referenceCount += countReferencesInParameters(parameterID, component_->getParameters());
-        referenceCount += countReferencesInMemoryMaps(parameterID);
-        referenceCount += countReferencesInAddressSpaces(parameterID);
-        referenceCount += countReferencesInInstantiations(parameterID);
-        referenceCount += countReferencesInPorts(parameterID);
-        referenceCount += countReferencesInBusInterfaces(parameterID);
-        referenceCount += countReferencesInRemapStates(parameterID);
-
-        parameter->setUsageCount(referenceCount);
+        parameter->setUsageCount(countIndexedReferences(parameter->getValueId()));
     }
 }
 
@@ -16,6 +16,10 @@
 
 #include <IPXACTmodels/Component/MirroredSlaveInterface.h>
 
+#include <QHash>
+#include <QSet>
+#include <QVector>
+
 class Component;
 class FileBuilder;
 class FileSet;
@@ -43,6 +47,10 @@ class RemapPort;
 
 //-----------------------------------------------------------------------------
 //! Calculates the amount of references made to component parameters.
+//!
+//! The references to the component parameters are indexed in one pass over the component expressions. After
+//! the index has been built, the reference totals follow the reference count changes. The references of each
+//! section are indexed again only when they are queried after the component has been edited.
 //-----------------------------------------------------------------------------
 class ComponentParameterReferenceCounter : public ParameterReferenceCounter
 {
@@ -50,6 +58,20 @@ class ComponentParameterReferenceCounter : public ParameterReferenceCounter
 
 public:
 
+    //! The top level sections of the component containing references.
+    enum ReferenceSection
+    {
+        FILESETS = 0,
+        PARAMETERS,
+        MEMORYMAPS,
+        ADDRESSSPACES,
+        INSTANTIATIONS,
+        PORTS,
+        BUSINTERFACES,
+        REMAPSTATES,
+        SECTION_COUNT
+    };
+
     /*!
      *  The constructor.
      *
@@ -71,6 +93,26 @@ public:
      */
     void setComponent(QSharedPointer<Component> newComponent);
 
+    /*!
+     *  Get the number of references made to the selected parameter in the component from the reference index.
+     *
+     *      @param [in] parameterID     ID of the selected parameter.
+     *
+     *      @return The amount of references made to the selected parameter.
+     */
+    int countIndexedReferences(QString const& parameterID) const;
+
+    /*!
+     *  Get the number of references made to the selected parameter in a section of the component from the
+     *  reference index.
+     *
+     *      @param [in] parameterID     ID of the selected parameter.
+     *      @param [in] section         The selected section.
+     *
+     *      @return The amount of references made to the selected parameter in the section.
+     */
+    int countIndexedReferences(QString const& parameterID, ReferenceSection section) const;
+
     /*!
      *  Count the references made to the selected parameter in the file sets.
      *
@@ -507,8 +549,99 @@ public slots:
      */
     virtual void recalculateReferencesToParameters(QVector<QSharedPointer<Parameter> > parameterList);
 
+    /*!
+     *  Increase the reference count of the parameter matching the id.
+     *
+     *      @param [in] id      The id of the parameter which is being referenced.
+     */
+    virtual void increaseReferenceCount(QString const& id) override;
+
+    /*!
+     *  Decrease the reference count of the parameter matching the id.
+     *
+     *      @param [in] id      The id of the parameter which was referenced.
+     */
+    virtual void decreaseReferenceCount(QString const& id) override;
+
+    /*!
+     *  Mark the whole reference index outdated.
+     */
+    void invalidateReferenceIndex();
+
+    /*!
+     *  Mark the section references of the index outdated after the component has been edited.
+     */
+    void invalidateSectionIndex();
+
 private:
 
+    /*!
+     *  Build the reference index, if it is outdated.
+     */
+    void updateReferenceIndex() const;
+
+    /*!
+     *  Count the references made to the selected parameter in a section of the component without the index.
+     *
+     *      @param [in] parameterID     ID of the selected parameter.
+     *      @param [in] section         The selected section.
+     *
+     *      @return The amount of references made to the selected parameter in the section.
+     */
+    int countReferencesInSection(QString const& parameterID, ReferenceSection section) const;
+
+    /*!
+     *  Collect the references made to the indexed parameters in a section of the component.
+     *
+     *      @param [in] section         The selected section.
+     *      @param [out] references      The number of references to each parameter is added here.
+     */
+    void collectReferencesInSection(ReferenceSection section, QHash<QString, int>& references) const;
+
+    /*!
+     *  Collect the references made to the indexed parameters in the selected file builders.
+     *
+     *      @param [in] builders        The selected file builders.
+     *      @param [out] references      The number of references to each parameter is added here.
+     */
+    void collectReferencesInFileBuilders(QSharedPointer<QList<QSharedPointer<FileBuilder> > > builders,
+        QHash<QString, int>& references) const;
+
+    /*!
+     *  Collect the references made to the indexed parameters in the selected memory map.
+     *
+     *      @param [in] memoryMap       The selected memory map.
+     *      @param [out] references      The number of references to each parameter is added here.
+     */
+    void collectReferencesInBaseMemoryMap(QSharedPointer<MemoryMapBase> memoryMap,
+        QHash<QString, int>& references) const;
+
+    /*!
+     *  Collect the references made to the indexed parameters in the selected register.
+     *
+     *      @param [in] targetRegister  The selected register.
+     *      @param [out] references      The number of references to each parameter is added here.
+     */
+    void collectReferencesInRegister(QSharedPointer<Register> targetRegister,
+        QHash<QString, int>& references) const;
+
+    /*!
+     *  Collect the references made to the indexed parameters in the selected bus interface.
+     *
+     *      @param [in] busInterface    The selected bus interface.
+     *      @param [out] references      The number of references to each parameter is added here.
+     */
+    void collectReferencesInBusInterface(QSharedPointer<BusInterface> busInterface,
+        QHash<QString, int>& references) const;
+
+    /*!
+     *  Collect the references made to the indexed parameters in the selected expression.
+     *
+     *      @param [in] expression      The selected expression.
+     *      @param [out] references      The number of references to each parameter is added here.
+     */
+    void collectReferences(QString const& expression, QHash<QString, int>& references) const;
+
     /*!
      *  Count the references made to the selected parameter in the selected write constraint.
      *
@@ -530,6 +663,21 @@ private:
 
     //! The containing component.
     QSharedPointer<Component> component_;
+
+    //! The IDs of the parameters in the reference index.
+    mutable QSet<QString> indexedIds_;
+
+    //! The number of references to each indexed parameter in the component.
+    mutable QHash<QString, int> referenceTotals_;
+
+    //! The number of references to each indexed parameter in each section of the component.
+    mutable QVector<QHash<QString, int> > referenceIndex_;
+
+    //! Flag for indicating that the reference totals match the component.
+    mutable bool referenceIndexValid_;
+
+    //! Flag for indicating that the section references match the component.
+    mutable bool sectionIndexValid_;
 };
 
 #endif // COMPONENTPARAMETERREFERENCECOUNTER_H
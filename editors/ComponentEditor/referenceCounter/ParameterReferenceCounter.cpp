@@ -14,6 +14,21 @@
 #include <IPXACTmodels/common/Parameter.h>
 #include <IPXACTmodels/common/ConfigurableElementValue.h>
 
+namespace
+{
+    //! Check if the character continues an identifier, so that a reference cannot end or start next to it.
+    bool isWordCharacter(QChar const& character)
+    {
+        return character.isLetterOrNumber() || character == QLatin1Char('_');
+    }
+
+    //! Check if the character can be a part of a parameter ID. The IDs are XML names, which may contain '-' and '.'.
+    bool isNameCharacter(QChar const& character)
+    {
+        return isWordCharacter(character) || character == QLatin1Char('-') || character == QLatin1Char('.');
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: ParameterReferenceCounter::ParameterReferenceCounter()
 //-----------------------------------------------------------------------------
@@ -49,6 +64,14 @@ void ParameterReferenceCounter::decreaseReferenceCount(QString const& id)
     }
 }
 
+//-----------------------------------------------------------------------------
+// Function: ParameterReferenceCounter::getParameterFinder()
+//-----------------------------------------------------------------------------
+QSharedPointer<ParameterFinder> ParameterReferenceCounter::getParameterFinder() const
+{
+    return parameterFinder_;
+}
+
 //-----------------------------------------------------------------------------
 // Function: ParameterReferenceCounter::countReferencesInParameters()
 //-----------------------------------------------------------------------------
@@ -115,5 +138,105 @@ int ParameterReferenceCounter::countReferencesInSingleConfigurableElementValue(Q
 int ParameterReferenceCounter::countReferencesInExpression(QString const& parameterID,
     QString const& expression) const
 {
-    return expression.count(parameterID);
+    if (parameterID.isEmpty())
+    {
+        return 0;
+    }
+
+    int referenceCount = 0;
+
+    int position = expression.indexOf(parameterID);
+    while (position != -1)
+    {
+        const int referenceEnd = position + parameterID.length();
+        if ((position == 0 || !isWordCharacter(expression.at(position - 1))) &&
+            (referenceEnd == expression.length() || !isWordCharacter(expression.at(referenceEnd))))
+        {
+            referenceCount++;
+        }
+
+        position = expression.indexOf(parameterID, referenceEnd);
+    }
+
+    return referenceCount;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterReferenceCounter::collectReferencesInParameters()
+//-----------------------------------------------------------------------------
+void ParameterReferenceCounter::collectReferencesInParameters(
+    QSharedPointer<QList<QSharedPointer<Parameter> > > parameters, QSet<QString> const& parameterIDs,
+    QHash<QString, int>& references) const
+{
+    for (QSharedPointer<Parameter> singleParameter : *parameters)
+    {
+        collectReferencesInSingleParameter(singleParameter, parameterIDs, references);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterReferenceCounter::collectReferencesInSingleParameter()
+//-----------------------------------------------------------------------------
+void ParameterReferenceCounter::collectReferencesInSingleParameter(QSharedPointer<Parameter> parameter,
+    QSet<QString> const& parameterIDs, QHash<QString, int>& references) const
+{
+    collectReferencesInExpression(parameter->getValue(), parameterIDs, references);
+    collectReferencesInExpression(parameter->getVectorLeft(), parameterIDs, references);
+    collectReferencesInExpression(parameter->getVectorRight(), parameterIDs, references);
+    collectReferencesInExpression(parameter->getAttribute(QLatin1String("kactus2:arrayLeft")), parameterIDs,
+        references);
+    collectReferencesInExpression(parameter->getAttribute(QLatin1String("kactus2:arrayRight")), parameterIDs,
+        references);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterReferenceCounter::collectReferencesInConfigurableElementValues()
+//-----------------------------------------------------------------------------
+void ParameterReferenceCounter::collectReferencesInConfigurableElementValues(
+    QSharedPointer<QList<QSharedPointer<ConfigurableElementValue> > > configurableElements,
+    QSet<QString> const& parameterIDs, QHash<QString, int>& references) const
+{
+    for (QSharedPointer<ConfigurableElementValue> element : *configurableElements)
+    {
+        collectReferencesInExpression(element->getConfigurableValue(), parameterIDs, references);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ParameterReferenceCounter::collectReferencesInExpression()
+//-----------------------------------------------------------------------------
+void ParameterReferenceCounter::collectReferencesInExpression(QString const& expression,
+    QSet<QString> const& parameterIDs, QHash<QString, int>& references) const
+{
+    const int expressionLength = expression.length();
+    for (int start = 0; start < expressionLength; ++start)
+    {
+        QChar const& firstCharacter = expression.at(start);
+        if ((start > 0 && isWordCharacter(expression.at(start - 1))) ||
+            !(firstCharacter.isLetter() || firstCharacter == QLatin1Char('_')))
+        {
+            continue;
+        }
+
+        // Every name ending at a word boundary is a candidate, so both "a" and "a-b" are found in "a-b".
+        int end = start + 1;
+        while (true)
+        {
+            if (end == expressionLength || !isWordCharacter(expression.at(end)))
+            {
+                QString candidate = expression.mid(start, end - start);
+                if (parameterIDs.contains(candidate))
+                {
+                    references[candidate]++;
+                }
+            }
+
+            if (end == expressionLength || !isNameCharacter(expression.at(end)))
+            {
+                break;
+            }
+
+            end++;
+        }
+    }
 }
@@ -17,6 +17,9 @@
 #include <editors/ComponentEditor/common/ComponentParameterFinder.h>
 #include <editors/ComponentEditor/common/ParameterFinder.h>
 
+#include <QHash>
+#include <QSet>
+
 class ConfigurableElementValue;
 
 //-----------------------------------------------------------------------------
@@ -94,6 +97,8 @@ public:
     /*!
      *  Count the references made to the selected parameter in the selected expression.
      *
+     *  Only whole identifiers in the expression are matched, so an ID is not found inside a longer identifier.
+     *
      *      @param [in] parameterID     ID of the selected parameter.
      *      @param [in] expression      The selected expression.
      *
@@ -101,6 +106,50 @@ public:
      */
     int countReferencesInExpression(QString const& parameterID, QString const& expression) const;
 
+    /*!
+     *  Collect the references made to the given parameters in the selected parameters.
+     *
+     *      @param [in] parameters      The selected parameters.
+     *      @param [in] parameterIDs    IDs of the parameters whose references are collected.
+     *      @param [out] references      The number of references to each parameter is added here.
+     */
+    void collectReferencesInParameters(QSharedPointer<QList<QSharedPointer<Parameter> > > parameters,
+        QSet<QString> const& parameterIDs, QHash<QString, int>& references) const;
+
+    /*!
+     *  Collect the references made to the given parameters in the selected parameter.
+     *
+     *      @param [in] parameter       The selected parameter.
+     *      @param [in] parameterIDs    IDs of the parameters whose references are collected.
+     *      @param [out] references      The number of references to each parameter is added here.
+     */
+    void collectReferencesInSingleParameter(QSharedPointer<Parameter> parameter,
+        QSet<QString> const& parameterIDs, QHash<QString, int>& references) const;
+
+    /*!
+     *  Collect the references made to the given parameters in the selected configurable element values.
+     *
+     *      @param [in] configurableElements    The selected configurable element values.
+     *      @param [in] parameterIDs            IDs of the parameters whose references are collected.
+     *      @param [out] references              The number of references to each parameter is added here.
+     */
+    void collectReferencesInConfigurableElementValues(
+        QSharedPointer<QList<QSharedPointer<ConfigurableElementValue> > > configurableElements,
+        QSet<QString> const& parameterIDs, QHash<QString, int>& references) const;
+
+    /*!
+     *  Collect the references made to the given parameters in the selected expression.
+     *
+     *  The expression is scanned once for all the given IDs. The IDs are matched as whole identifiers like in
+     *  countReferencesInExpression(), so IDs containing '-' or '.' are found as well.
+     *
+     *      @param [in] expression      The selected expression.
+     *      @param [in] parameterIDs    IDs of the parameters whose references are collected.
+     *      @param [out] references      The number of references to each parameter is added here.
+     */
+    void collectReferencesInExpression(QString const& expression, QSet<QString> const& parameterIDs,
+        QHash<QString, int>& references) const;
+
 public slots:
 
     /*!
@@ -117,6 +166,15 @@ public slots:
      */
     virtual void decreaseReferenceCount(QString const& id) override;
 
+protected:
+
+    /*!
+     *  Get the parameter finder.
+     *
+     *      @return The finder for the referenced parameters.
+     */
+    QSharedPointer<ParameterFinder> getParameterFinder() const;
+
 private:
 
     //-----------------------------------------------------------------------------
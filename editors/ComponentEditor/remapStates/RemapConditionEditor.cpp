@@ -101,6 +101,7 @@ RemapConditionEditor::~RemapConditionEditor()
 //-----------------------------------------------------------------------------
 void RemapConditionEditor::refresh()
 {
+    model_->invalidateEvaluations();
     delegate_->setComponentPorts(component_->getPortNames());
     model_->updatePorts(component_->getPorts());
     proxy_->invalidate();
@@ -263,6 +263,8 @@ void ComponentEditorAddrBlockItem::setVisualizer( MemoryMapsVisualizer* visualiz
 	}
 
 	connect(graphItem_, SIGNAL(selectEditor()),	this, SLOT(onSelectRequest()), Qt::UniqueConnection);
+    connect(graphItem_, SIGNAL(selectRegisterEditor(QSharedPointer<Register>, QSharedPointer<Field>)),
+        this, SLOT(onSelectRegisterRequest(QSharedPointer<Register>, QSharedPointer<Field>)), Qt::UniqueConnection);
 }
 
 //-----------------------------------------------------------------------------
@@ -302,6 +304,8 @@ void ComponentEditorAddrBlockItem::removeGraphicsItem()
 		graphItem_->setParent(NULL);
 
 		disconnect(graphItem_, SIGNAL(selectEditor()), this, SLOT(onSelectRequest()));
+        disconnect(graphItem_, SIGNAL(selectRegisterEditor(QSharedPointer<Register>, QSharedPointer<Field>)),
+            this, SLOT(onSelectRegisterRequest(QSharedPointer<Register>, QSharedPointer<Field>)));
 
 		// delete the graph item
 		delete graphItem_;
@@ -324,3 +328,29 @@ void ComponentEditorAddrBlockItem::addressUnitBitsChanged(int newAddressUnitBits
 
     emit changeInAddressUnitBits(newAddressUnitBits);
 }
+
+//-----------------------------------------------------------------------------
+// Function: ComponentEditorAddrBlockItem::onSelectRegisterRequest()
+//-----------------------------------------------------------------------------
+void ComponentEditorAddrBlockItem::onSelectRegisterRequest(QSharedPointer<Register> selectedRegister,
+    QSharedPointer<Field> selectedField)
+{
+    QSharedPointer<ComponentEditorItem> selectedItem =
+        child(addrBlock_->getRegisterData()->indexOf(selectedRegister));
+    if (selectedItem.isNull())
+    {
+        return;
+    }
+
+    if (selectedField)
+    {
+        QSharedPointer<ComponentEditorItem> fieldItem =
+            selectedItem->child(selectedRegister->getFields()->indexOf(selectedField));
+        if (fieldItem)
+        {
+            selectedItem = fieldItem;
+        }
+    }
+
+    emit selectItem(selectedItem.data());
+}
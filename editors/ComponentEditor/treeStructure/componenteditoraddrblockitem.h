@@ -23,6 +23,8 @@ class MemoryMapsVisualizer;
 class AddressBlockGraphItem;
 class ExpressionParser;
 class AddressBlockValidator;
+class Field;
+class Register;
 //-----------------------------------------------------------------------------
 //! The item for a single address block in component editor's navigation tree.
 //-----------------------------------------------------------------------------
@@ -145,6 +147,16 @@ protected slots:
      */
     virtual void onGraphicsChanged();
 
+private slots:
+
+    /*!
+     *  Selects the item of a register or field clicked in a virtualized address block item.
+     *
+     *      @param [in] selectedRegister    The clicked register.
+     *      @param [in] selectedField       The clicked field, or null if the register was clicked.
+     */
+    void onSelectRegisterRequest(QSharedPointer<Register> selectedRegister, QSharedPointer<Field> selectedField);
+
 signals:
     
     /*!
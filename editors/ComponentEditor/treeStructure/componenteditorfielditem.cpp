@@ -145,7 +145,12 @@ void ComponentEditorFieldItem::setVisualizer( MemoryMapsVisualizer* visualizer )
 
 	// get the graphics item for the memory map
 	MemoryVisualizationItem* parentItem = static_cast<MemoryVisualizationItem*>(parent()->getGraphicsItem());
-	Q_ASSERT(parentItem);
+
+	// The register items of large address blocks create their own field items.
+	if (parentItem == nullptr)
+	{
+		return;
+	}
 
 	// create the graph item for the address block
 	graphItem_ = new FieldGraphItem(field_, expressionParser_, parentItem);
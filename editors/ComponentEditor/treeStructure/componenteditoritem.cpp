@@ -155,7 +155,7 @@ bool ComponentEditorItem::hasChildren() const
 //-----------------------------------------------------------------------------
 QSharedPointer<ComponentEditorItem> ComponentEditorItem::child( const int index )
 {
-	if (index < 0 || childItems_.count() < index)
+	if (index < 0 || childItems_.count() <= index)
     {
 		return QSharedPointer<ComponentEditorItem>();
 	}
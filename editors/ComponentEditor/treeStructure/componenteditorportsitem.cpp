@@ -18,6 +18,8 @@
 
 #include <IPXACTmodels/Component/validators/PortValidator.h>
 
+#include <QSet>
+
 //-----------------------------------------------------------------------------
 // Function: ComponentEditorPortsItem::ComponentEditorPortsItem()
 //-----------------------------------------------------------------------------
@@ -63,7 +65,7 @@ QString ComponentEditorPortsItem::text() const
 //-----------------------------------------------------------------------------
 bool ComponentEditorPortsItem::isValid() const
 {
-    QStringList portNames;
+    QSet<QString> portNames;
 	foreach (QSharedPointer<Port> port, *component_->getPorts()) 
     {
         if (portNames.contains(port->name()) || !portValidator_->validate(port))
@@ -71,7 +73,7 @@ bool ComponentEditorPortsItem::isValid() const
 			return false;
 		}
 
-        portNames.append(port->name());
+        portNames.insert(port->name());
 	}
 
 	return true;
@@ -13,6 +13,7 @@
 #include "componenteditorfielditem.h"
 
 #include <editors/ComponentEditor/memoryMaps/SingleRegisterEditor.h>
+#include <editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/addressblockgraphitem.h>
 #include <editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/memorymapsvisualizer.h>
 #include <editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/registergraphitem.h>
 #include <editors/ComponentEditor/visualization/memoryvisualizationitem.h>
@@ -170,10 +171,15 @@ void ComponentEditorRegisterItem::setVisualizer(MemoryMapsVisualizer* visualizer
     MemoryVisualizationItem* parentItem = static_cast<MemoryVisualizationItem*>(parent()->getGraphicsItem());
     Q_ASSERT(parentItem);
 
-    registerItem_ = new RegisterGraphItem(reg_, expressionParser_, parentItem);
-    parentItem->addChild(registerItem_);
-    
-    connect(registerItem_, SIGNAL(selectEditor()), this, SLOT(onSelectRequest()), Qt::UniqueConnection);
+    // The items of large address blocks are created by the block item only for the shown registers.
+    AddressBlockGraphItem* blockItem = dynamic_cast<AddressBlockGraphItem*>(parentItem);
+    if (blockItem == nullptr || !blockItem->isVirtualized())
+    {
+        registerItem_ = new RegisterGraphItem(reg_, expressionParser_, parentItem);
+        parentItem->addChild(registerItem_);
+
+        connect(registerItem_, SIGNAL(selectEditor()), this, SLOT(onSelectRequest()), Qt::UniqueConnection);
+    }
 
 	// update the visualizers for field items
 	for (QSharedPointer<ComponentEditorItem> item : childItems_)
@@ -220,6 +226,11 @@ void ComponentEditorRegisterItem::onGraphicsChanged()
 //-----------------------------------------------------------------------------
 void ComponentEditorRegisterItem::removeGraphicsItem()
 {
+    if (registerItem_ == nullptr)
+    {
+        return;
+    }
+
     // get the graphics item for the address block.
     MemoryVisualizationItem* parentItem = static_cast<MemoryVisualizationItem*>(parent()->getGraphicsItem());
     Q_ASSERT(parentItem);
@@ -13,6 +13,8 @@
 
 #include <IPXACTmodels/Component/Component.h>
 
+#include <editors/ComponentEditor/common/ParameterFinder.h>
+
 #include <common/KactusColors.h>
 
 #include <QIcon>
@@ -22,7 +24,11 @@
 //-----------------------------------------------------------------------------
 ComponentEditorTreeModel::ComponentEditorTreeModel(QObject* parent) :
 QAbstractItemModel(parent),
-rootItem_()
+rootItem_(),
+validity_(),
+validityDependents_(),
+parameterFinder_(),
+parameterValues_()
 {
 	setObjectName(tr("ComponentEditorTreeModel"));
 }
@@ -42,9 +48,43 @@ void ComponentEditorTreeModel::setRootItem(QSharedPointer<ComponentEditorRootIte
 {
 	beginResetModel();
     rootItem_ = root;
+    validity_.clear();
+
+    // Only the dependencies between the top level items of the new root are kept.
+    for (auto dependency = validityDependents_.begin(); dependency != validityDependents_.end(); )
+    {
+        if (root.isNull() || root->getIndexOf(dependency.key()) == -1 || root->getIndexOf(dependency.value()) == -1)
+        {
+            dependency = validityDependents_.erase(dependency);
+        }
+        else
+        {
+            ++dependency;
+        }
+    }
 	endResetModel();
 }
 
+//-----------------------------------------------------------------------------
+// Function: componenteditortreemodel::setParameterFinder()
+//-----------------------------------------------------------------------------
+void ComponentEditorTreeModel::setParameterFinder(QSharedPointer<ParameterFinder> parameterFinder)
+{
+    parameterFinder_ = parameterFinder;
+    validity_.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: componenteditortreemodel::addValidityDependency()
+//-----------------------------------------------------------------------------
+void ComponentEditorTreeModel::addValidityDependency(ComponentEditorItem* source, ComponentEditorItem* dependent)
+{
+    Q_ASSERT(source);
+    Q_ASSERT(dependent);
+
+    validityDependents_.insert(source, dependent);
+}
+
 //-----------------------------------------------------------------------------
 // Function: componenteditortreemodel::rowCount()
 //-----------------------------------------------------------------------------
@@ -132,7 +172,7 @@ QVariant ComponentEditorTreeModel::data( const QModelIndex& index, int role /*=
 	}
 	else if (role == Qt::ForegroundRole)
     {
-        if (!item->isValid())
+        if (!isValidItem(item))
         {
             return KactusColors::ERROR;
         }         
@@ -178,6 +218,8 @@ Qt::ItemFlags ComponentEditorTreeModel::flags( const QModelIndex& index ) const
 //-----------------------------------------------------------------------------
 void ComponentEditorTreeModel::onContentChanged(ComponentEditorItem* item )
 {
+    invalidateValidity(item);
+
 	QModelIndex index = ComponentEditorTreeModel::index(item);
 	emit dataChanged(index, index);
 }
@@ -296,6 +338,8 @@ void ComponentEditorTreeModel::addItem( ComponentEditorItem* parentItem, int chi
 	parentItem->createChild(childIndex);
 	endInsertRows();
 
+    invalidateValidity(parentItem);
+
 	emit expandItem(parentIndex);
 }
 
@@ -310,6 +354,9 @@ void ComponentEditorTreeModel::removeItem( ComponentEditorItem* parentItem, int
 	// find the index of the parent item
 	QModelIndex parentIndex = index(parentItem);
 
+    // The removed items must be dropped from the cache before their addresses can be reused.
+    invalidateValidity(parentItem);
+
 	beginRemoveRows(parentIndex, childIndex, childIndex);
 	parentItem->removeChild(childIndex);
 	endRemoveRows();
@@ -347,6 +394,8 @@ void ComponentEditorTreeModel::moveItem( ComponentEditorItem* parentItem, int ch
 	beginMoveRows(parentIndex, childSource, childSource, parentIndex, childtarget);
 	parentItem->moveChild(childSource, targetIndex);
 	endMoveRows();
+
+    invalidateValidity(parentItem);
 }
 
 //-----------------------------------------------------------------------------
@@ -413,3 +462,98 @@ QModelIndex ComponentEditorTreeModel::findIndexByItemIdentifier(QString const& i
 
     return parentIndex;
 }
+
+//-----------------------------------------------------------------------------
+// Function: componenteditortreemodel::isValidItem()
+//-----------------------------------------------------------------------------
+bool ComponentEditorTreeModel::isValidItem(ComponentEditorItem* item) const
+{
+    auto cached = validity_.constFind(item);
+    if (cached != validity_.constEnd())
+    {
+        return cached.value();
+    }
+
+    if (validity_.isEmpty())
+    {
+        parameterValues_ = currentParameterValues();
+    }
+
+    bool valid = item->isValid();
+    validity_.insert(item, valid);
+
+    return valid;
+}
+
+//-----------------------------------------------------------------------------
+// Function: componenteditortreemodel::invalidateValidity()
+//-----------------------------------------------------------------------------
+void ComponentEditorTreeModel::invalidateValidity(ComponentEditorItem* item)
+{
+    if (validity_.isEmpty())
+    {
+        return;
+    }
+
+    // Any expression in the component may refer to a changed parameter.
+    QHash<QString, QString> parameterValues = currentParameterValues();
+    if (parameterValues != parameterValues_)
+    {
+        parameterValues_ = parameterValues;
+        validity_.clear();
+        return;
+    }
+
+    invalidateSubtree(item);
+
+    // The validity of an item depends on the validity of its children.
+    ComponentEditorItem* topLevelItem = item;
+    for (ComponentEditorItem* ancestor = item->parent(); ancestor != 0; ancestor = ancestor->parent())
+    {
+        validity_.remove(ancestor);
+
+        if (ancestor->parent() != 0)
+        {
+            topLevelItem = ancestor;
+        }
+    }
+
+    foreach (ComponentEditorItem* dependent, validityDependents_.values(topLevelItem))
+    {
+        invalidateSubtree(dependent);
+
+        QModelIndex dependentIndex = index(dependent);
+        emit dataChanged(dependentIndex, dependentIndex);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: componenteditortreemodel::invalidateSubtree()
+//-----------------------------------------------------------------------------
+void ComponentEditorTreeModel::invalidateSubtree(ComponentEditorItem* item)
+{
+    validity_.remove(item);
+
+    const int childCount = item->rowCount();
+    for (int i = 0; i < childCount; ++i)
+    {
+        invalidateSubtree(item->child(i).data());
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: componenteditortreemodel::currentParameterValues()
+//-----------------------------------------------------------------------------
+QHash<QString, QString> ComponentEditorTreeModel::currentParameterValues() const
+{
+    QHash<QString, QString> parameterValues;
+    if (parameterFinder_)
+    {
+        foreach (QString const& parameterId, parameterFinder_->getAllParameterIds())
+        {
+            parameterValues.insert(parameterId, parameterFinder_->valueForId(parameterId));
+        }
+    }
+
+    return parameterValues;
+}
@@ -15,10 +15,13 @@
 #include "componenteditorrootitem.h"
 
 #include <QAbstractItemModel>
+#include <QHash>
+#include <QMultiHash>
 #include <QWidget>
 #include <QSharedPointer>
 
 class LibraryInterface;
+class ParameterFinder;
 class PluginManager;
 class Component;
 class VLNV;
@@ -50,6 +53,23 @@ public:
 	 */
     void setRootItem(QSharedPointer<ComponentEditorRootItem> root);
 
+    /*!
+     *  Set the parameter finder for detecting parameter changes affecting the validity of the items.
+     *
+     *      @param [in] parameterFinder     The finder for the component parameters.
+     */
+    void setParameterFinder(QSharedPointer<ParameterFinder> parameterFinder);
+
+    /*!
+     *  Set a top level item to depend on the contents of another top level item. When the contents of the
+     *  source item or its child items change, the validity of the dependent item and its child items is checked
+     *  again. The dependencies may be set before the root item containing the items is set.
+     *
+     *      @param [in] source      The item whose contents are referenced.
+     *      @param [in] dependent   The item referencing the contents of the source item.
+     */
+    void addValidityDependency(ComponentEditorItem* source, ComponentEditorItem* dependent);
+
 	/*!
      *  Get the number of rows an item contains.
 	 *
@@ -248,12 +268,54 @@ private:
     QModelIndex findIndexByItemIdentifier(QString const& identifier, QModelIndex parentIndex = QModelIndex())
         const;
 
+    /*!
+     *  Check the validity of an item using the cached result, if available.
+     *
+     *      @param [in] item    The selected item.
+     *
+     *      @return True, if the item is valid, otherwise false.
+     */
+    bool isValidItem(ComponentEditorItem* item) const;
+
+    /*!
+     *  Discard the cached validity of a changed item and the items affected by the change.
+     *
+     *      @param [in] item    The changed item.
+     */
+    void invalidateValidity(ComponentEditorItem* item);
+
+    /*!
+     *  Discard the cached validity of an item and its child items.
+     *
+     *      @param [in] item    The selected item.
+     */
+    void invalidateSubtree(ComponentEditorItem* item);
+
+    /*!
+     *  Get the current values of the component parameters.
+     *
+     *      @return The parameter values by parameter ID.
+     */
+    QHash<QString, QString> currentParameterValues() const;
+
     //-----------------------------------------------------------------------------
     // Data.
     //-----------------------------------------------------------------------------
 
 	//! Pointer to the root item of the tree.
 	QSharedPointer<ComponentEditorRootItem> rootItem_;
+
+    //! The cached validity of the items. Only the items shown in the tree are validated.
+    mutable QHash<ComponentEditorItem const*, bool> validity_;
+
+    //! The items depending on the contents of a top level item.
+    QMultiHash<ComponentEditorItem const*, ComponentEditorItem*> validityDependents_;
+
+    //! The finder for the component parameters.
+    QSharedPointer<ParameterFinder> parameterFinder_;
+
+    //! The parameter values used in the cached validity.
+    mutable QHash<QString, QString> parameterValues_;
 };
 
 #endif // COMPONENTEDITORTREEMODEL_H
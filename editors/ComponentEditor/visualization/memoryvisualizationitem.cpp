@@ -30,6 +30,8 @@ ExpandableItem(parent),
     lastFreeAddress_(-1),
     childWidth_(VisualizerItem::DEFAULT_WIDTH),
     conflicted_(false),
+    reorganizePending_(false),
+    releasedGaps_(),
     overlapped_(false),
     expressionParser_(expressionParser)
 {
@@ -45,8 +47,7 @@ MemoryVisualizationItem::~MemoryVisualizationItem()
 {
     for (auto const& childItem : childItems_)
     {
-        disconnect(childItem, SIGNAL(destroyed(QObject*)), this, SLOT(reorganizeChildren()));
-        disconnect(childItem, SIGNAL(destroyed(QObject*)), this, SIGNAL(expandStateChanged()));
+        disconnect(childItem, SIGNAL(destroyed(QObject*)), this, SLOT(scheduleReorganize()));
     }
 }
 
@@ -69,14 +70,17 @@ void MemoryVisualizationItem::addChild(MemoryVisualizationItem* childItem)
     childItem->setWidth(childWidth_);
     childItem->setVisible(isExpanded());
 
-    reorganizeChildren();
-    emit expandStateChanged();
+    if (dynamic_cast<MemoryGapItem*>(childItem) == 0)
+    {
+        ExpandableItem::setShowExpandableItem(true);
+    }
+
+    scheduleReorganize();
 
     connect(childItem, SIGNAL(expandStateChanged()), this, SLOT(reorganizeChildren()), Qt::UniqueConnection);
     connect(childItem, SIGNAL(expandStateChanged()), this, SIGNAL(expandStateChanged()), Qt::UniqueConnection);
 
-    connect(childItem, SIGNAL(destroyed(QObject*)), this, SLOT(reorganizeChildren()), Qt::UniqueConnection);
-    connect(childItem, SIGNAL(destroyed(QObject*)), this, SIGNAL(expandStateChanged()), Qt::UniqueConnection);
+    connect(childItem, SIGNAL(destroyed(QObject*)), this, SLOT(scheduleReorganize()), Qt::UniqueConnection);
 }
 
 //-----------------------------------------------------------------------------
@@ -217,6 +221,8 @@ bool MemoryVisualizationItem::isConflicted() const
 //-----------------------------------------------------------------------------
 void MemoryVisualizationItem::reorganizeChildren()
 {
+    reorganizePending_ = false;
+
     showExpandIconIfHasChildren();
 
     if (mustRepositionChildren())
@@ -231,6 +237,10 @@ void MemoryVisualizationItem::reorganizeChildren()
 
         repositionChildren();
 
+        // The gap items that were not reused in the new layout are no longer needed.
+        qDeleteAll(releasedGaps_);
+        releasedGaps_.clear();
+
         if (childCountBeforeUpdate != childCountAfterUpdate)
         {
             emit expandStateChanged();
@@ -248,6 +258,14 @@ bool MemoryVisualizationItem::isPresent() const
     return true;
 }
 
+//-----------------------------------------------------------------------------
+// Function: MemoryVisualizationItem::setVisibleArea()
+//-----------------------------------------------------------------------------
+void MemoryVisualizationItem::setVisibleArea(QRectF const& /*sceneArea*/)
+{
+
+}
+
 //-----------------------------------------------------------------------------
 // Function: memoryvisualizationitem::parseExpression()
 //-----------------------------------------------------------------------------
@@ -289,19 +307,7 @@ void MemoryVisualizationItem::updateChildMap()
 {
     QMap<quint64, MemoryVisualizationItem*> updatedMap;
 
-    for (auto item = childItems_.begin(); item != childItems_.end(); /* iterator incremented in the loop*/)
-    {
-        MemoryGapItem* gap = dynamic_cast<MemoryGapItem*>(*item);
-        if (gap)
-        {                   
-            delete gap;
-            item = childItems_.erase(item);
-        }
-        else
-        {
-            ++item;
-        }
-    }
+    releaseGapItems();
 
     quint64 lastAvailableAddress = getLastAddress();    
     for (MemoryVisualizationItem* item : childItems_)
@@ -397,6 +403,79 @@ void MemoryVisualizationItem::updateChildMap()
     }
 }
 
+//-----------------------------------------------------------------------------
+// Function: MemoryVisualizationItem::releaseGapItems()
+//-----------------------------------------------------------------------------
+void MemoryVisualizationItem::releaseGapItems()
+{
+    for (auto item = childItems_.begin(); item != childItems_.end(); /* iterator incremented in the loop*/)
+    {
+        MemoryGapItem* gap = dynamic_cast<MemoryGapItem*>(*item);
+        if (gap)
+        {
+            releasedGaps_.append(gap);
+            item = childItems_.erase(item);
+        }
+        else
+        {
+            ++item;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryVisualizationItem::takeReleasedGapItem()
+//-----------------------------------------------------------------------------
+MemoryGapItem* MemoryVisualizationItem::takeReleasedGapItem()
+{
+    if (releasedGaps_.isEmpty())
+    {
+        return 0;
+    }
+
+    MemoryGapItem* gap = releasedGaps_.takeLast();
+    gap->setConflicted(false);
+
+    return gap;
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryVisualizationItem::scheduleReorganize()
+//-----------------------------------------------------------------------------
+void MemoryVisualizationItem::scheduleReorganize()
+{
+    if (!reorganizePending_)
+    {
+        reorganizePending_ = true;
+        QMetaObject::invokeMethod(this, "onDeferredReorganize", Qt::QueuedConnection);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: MemoryVisualizationItem::onDeferredReorganize()
+//-----------------------------------------------------------------------------
+void MemoryVisualizationItem::onDeferredReorganize()
+{
+    // The children may have been laid out synchronously after scheduling, e.g. by refresh().
+    if (reorganizePending_)
+    {
+        // Cleared here as well, since items laying out their children lazily override reorganizeChildren().
+        reorganizePending_ = false;
+        reorganizeChildren();
+    }
+
+    // The parent is scheduled after its children, so it is also laid out only once.
+    MemoryVisualizationItem* parentMemoryItem = dynamic_cast<MemoryVisualizationItem*>(parentItem());
+    if (parentMemoryItem)
+    {
+        parentMemoryItem->scheduleReorganize();
+    }
+    else
+    {
+        emit expandStateChanged();
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: MemoryVisualizationItem::mustRepositionChildren()
 //-----------------------------------------------------------------------------
@@ -526,7 +605,12 @@ bool MemoryVisualizationItem::childrenOverlap(MemoryVisualizationItem* current,
 //-----------------------------------------------------------------------------
 MemoryGapItem* MemoryVisualizationItem::createConflictItem(qint64 offset, qint64 lastAddress)
 {
-    MemoryGapItem* gap = new MemoryGapItem(expressionParser_, this);
+    MemoryGapItem* gap = takeReleasedGapItem();
+    if (gap == 0)
+    {
+        gap = new MemoryGapItem(expressionParser_, this);
+    }
+
     gap->setWidth(childWidth_);
     gap->setConflicted(true);
     gap->setName(QStringLiteral("conflicted"));
@@ -543,7 +627,16 @@ MemoryGapItem* MemoryVisualizationItem::createConflictItem(qint64 offset, qint64
 //-----------------------------------------------------------------------------
 MemoryGapItem* MemoryVisualizationItem::createMemoryGap(quint64 offset, quint64 lastAddress)
 {
-    MemoryGapItem* gap = new MemoryGapItem(expressionParser_, this);
+    MemoryGapItem* gap = takeReleasedGapItem();
+    if (gap == 0)
+    {
+        gap = new MemoryGapItem(expressionParser_, this);
+    }
+    else
+    {
+        gap->setName(QStringLiteral("Reserved"));
+    }
+
     gap->setWidth(childWidth_);
     gap->setStartAddress(offset);
     gap->setEndAddress(lastAddress);
@@ -17,6 +17,7 @@
 
 #include <QMultiMap>
 #include <QGraphicsSceneMouseEvent>
+#include <QVector>
 
 class MemoryGapItem;
 class ExpressionParser;
@@ -89,6 +90,11 @@ public:
 
 	/*!
      *  Add a child visualization item for this item.
+	 *
+	 * The children are laid out once after the control returns to the event loop, so adding all the
+	 * registers of a large memory map does not re-layout the map after each register. Callers needing the
+	 * layout before that must call refresh() or reorganizeChildren(). The parent items and the scene are
+	 * notified after the deferred layout in either case.
 	 *
 	 *       @param [in] childItem Pointer to the child to add.
 	 */
@@ -177,6 +183,16 @@ public:
      */
     virtual bool isPresent() const;
 
+    /*!
+     *  Sets the area of the scene currently shown in the view.
+     *
+     *  Items that create their children only for the shown area override this. The default implementation
+     *  does nothing.
+     *
+     *      @param [in] sceneArea   The shown area in scene coordinates.
+     */
+    virtual void setVisibleArea(QRectF const& sceneArea);
+
 public slots:
 
     //! Refresh the item and all the sub items.
@@ -216,6 +232,16 @@ protected:
 
     //! Update the offsets of the child items in the map and fills the empty gaps between them..
     virtual void updateChildMap();
+
+    //! Move the gap items of the previous layout out of the child items to be reused in the next layout.
+    void releaseGapItems();
+
+    /*!
+     *  Take a gap item released from the previous layout.
+     *
+     *      @return The gap item to reuse, or null if there are no released gap items left.
+     */
+    MemoryGapItem* takeReleasedGapItem();
         
     /*!
      *  Checks if the children must be repositioned inside this item.
@@ -286,6 +312,16 @@ private:
 	MemoryVisualizationItem(const MemoryVisualizationItem& other);
 	MemoryVisualizationItem& operator=(const MemoryVisualizationItem& other);
 
+private slots:
+
+    //! Schedules the children to be laid out when the control returns to the event loop.
+    void scheduleReorganize();
+
+    //! Lays out the scheduled children and schedules the parent item to be laid out.
+    void onDeferredReorganize();
+
+private:
+
     /*!
      *  Checks if there is empty memory space between the beginning of the item and its first child.
      *
@@ -354,6 +390,12 @@ private:
 	//! Conflicted state. Item is conflicted if it overlaps with other items.
     bool conflicted_;
 
+    //! Tells if the children are waiting for the scheduled layout.
+    bool reorganizePending_;
+
+    //! The gap items of the previous layout that have not been reused yet.
+    QVector<MemoryGapItem*> releasedGaps_;
+
     //! Tells if the item is completely overlapped by other items.
     bool overlapped_;
 
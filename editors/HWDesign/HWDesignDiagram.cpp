@@ -28,6 +28,7 @@
 #include "columnview/ColumnEditDialog.h"
 
 #include <common/GenericEditProvider.h>
+#include <common/Profiler.h>
 #include <common/graphicsItems/GraphicsColumnUndoCommands.h>
 #include <common/graphicsItems/GraphicsColumnLayout.h>
 #include <common/graphicsItems/CommonGraphicsUndoCommands.h>
@@ -139,6 +140,8 @@ HWDesignDiagram::~HWDesignDiagram()
 //-----------------------------------------------------------------------------
 void HWDesignDiagram::loadDesign(QSharedPointer<Design> design)
 {
+    ProfilingScope profilingScope("HWDesignDiagram::loadDesign");
+
     QList<QSharedPointer<ColumnDesc> > designColumns = design->getColumns();
     if (designColumns.isEmpty())
     {
@@ -362,7 +362,10 @@ bool HWDesignWidget::saveAs()
 		writeSucceeded = false;
 	}
 
-	getLibraryInterface()->endSave();
+	if (!getLibraryInterface()->endSave())
+    {
+        writeSucceeded = false;
+    }
 
 	if (writeSucceeded)
     {
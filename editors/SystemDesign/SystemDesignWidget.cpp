@@ -716,7 +716,10 @@ bool SystemDesignWidget::saveAs()
         writeSucceeded = false;
     }
 
-    getLibraryInterface()->endSave();
+    if (!getLibraryInterface()->endSave())
+    {
+        writeSucceeded = false;
+    }
 
     if (writeSucceeded)
     {
@@ -471,8 +471,8 @@ void SystemDetailsEditor::exportSW()
         instance->setMapping("");
     }
 
-    handler_->writeModelToFile(dialog.getPath(), design);
-    handler_->writeModelToFile(dialog.getPath(), desConf);
+    bool writeSucceeded = handler_->writeModelToFile(dialog.getPath(), design);
+    writeSucceeded = handler_->writeModelToFile(dialog.getPath(), desConf) && writeSucceeded;
 
     // Create a new system view for the system design.
     QSharedPointer<SystemView> newView = QSharedPointer<SystemView>( new SystemView("system") );
@@ -485,7 +485,16 @@ void SystemDetailsEditor::exportSW()
 	QList<QSharedPointer<SystemView> > newSystemViews;
 	newSystemViews.append(newView);
     newComponent->setSystemViews(newSystemViews);
-    handler_->writeModelToFile(dialog.getPath(), newComponent);
+    writeSucceeded = handler_->writeModelToFile(dialog.getPath(), newComponent) && writeSucceeded;
+
+    // The files are written in the background until the save ends.
+    writeSucceeded = handler_->endSave() && writeSucceeded;
 
-    handler_->endSave();
+    if (!writeSucceeded)
+    {
+        QMessageBox msgBox(QMessageBox::Critical, QCoreApplication::applicationName(),
+                           tr("Could not export the SW design to %1.").arg(dialog.getPath()),
+                           QMessageBox::Ok, (QWidget*)parent());
+        msgBox.exec();
+    }
 }
@@ -49,6 +49,7 @@ referableParameters_(new QList<QSharedPointer<Parameter> > ())
     QSharedPointer<QList<QSharedPointer<Choice> > > noChoices(new QList<QSharedPointer<Choice> >());
     validator_ = QSharedPointer<ParameterValidator>(
         new ParameterValidator(configurableElementExpressionParser, noChoices));
+    invalidateEvaluationsOnChanges(this);
 }
 
 //-----------------------------------------------------------------------------
@@ -556,13 +557,14 @@ QString ConfigurableElementsModel::tooltipForIndex(QModelIndex const& index) con
         }
         else
         {
-            return configurableElementExpressionFormatter_->
-                formatReferringExpression(expressionOrValueForIndex(index).toString());
+            return cachedFormattedExpression(index, expressionOrValueForIndex(index).toString(),
+                configurableElementExpressionFormatter_);
         }
     }
     else if (index.column() == ConfigurableElementsColumns::DEFAULT_VALUE)
     {
-        return defaultValueFormatter_->formatReferringExpression(expressionOrValueForIndex(index).toString());
+        return cachedFormattedExpression(index, expressionOrValueForIndex(index).toString(),
+            defaultValueFormatter_);
     }
 
     return QString();    
@@ -16,6 +16,8 @@
 #include <IPXACTmodels/Component/Component.h>
 #include <IPXACTmodels/Component/Port.h>
 
+#include <QMap>
+
 //-----------------------------------------------------------------------------
 // Function: PortTableAutoConnector::findPossibleCombinations()
 //-----------------------------------------------------------------------------
@@ -27,9 +29,18 @@ QVector<QPair<QString, QVector<QString> > > PortTableAutoConnector::findPossible
     QSharedPointer<QList<QSharedPointer<Port> > > firstPorts = firstComponent->getPorts();
     QSharedPointer<QList<QSharedPointer<Port> > > secondPorts = secondComponent->getPorts();
 
+    // Ports of the same direction share the list of connectable ports.
+    QMap<DirectionTypes::Direction, QVector<QString> > connectablePortsByDirection;
+
     for (auto currentPort : *firstPorts)
     {
-        QVector<QString> connectablePorts = getConnectablePortNames(currentPort->getDirection(), secondPorts);
+        DirectionTypes::Direction portDirection = currentPort->getDirection();
+        if (!connectablePortsByDirection.contains(portDirection))
+        {
+            connectablePortsByDirection.insert(portDirection, getConnectablePortNames(portDirection, secondPorts));
+        }
+
+        QVector<QString> connectablePorts = connectablePortsByDirection.value(portDirection);
         if (!connectablePorts.isEmpty())
         {
             QPair<QString, QVector<QString> > combination;
@@ -13,7 +13,7 @@
 
 #include <IPXACTmodels/Component/Component.h>
 
-#include <editors/ComponentEditor/busInterfaces/portmaps/JaroWinklerAlgorithm.h>
+#include <editors/ComponentEditor/busInterfaces/portmaps/JaroWinklerMatcher.h>
 
 //-----------------------------------------------------------------------------
 // Function: TableAutoConnector::initializeTable()
@@ -52,26 +52,37 @@ QVector<QPair<QString, QString> > TableAutoConnector::getCombinations(QSharedPoi
     {
         const double JAROWINKLERTRESHOLD = 0.75;
 
+        // Items usually share the same connectable items, so each distinct list is indexed only once.
+        QVector<QPair<QVector<QString>, QSharedPointer<JaroWinklerMatcher> > > matchers;
+
         for (int i = 0; i < possibleCombinations.size(); ++i)
         {
             QString itemToBeConnected = possibleCombinations.at(i).first;
+            QVector<QString> const& comparisonItems = possibleCombinations.at(i).second;
 
-            QMap<double, QString> possibleConnecedItems;
-            for (auto comparisonItem : possibleCombinations.at(i).second)
+            QSharedPointer<JaroWinklerMatcher> itemMatcher;
+            for (auto const& existingMatcher : matchers)
             {
-                double jaroDistance =
-                    JaroWinklerAlgorithm::calculateJaroWinklerDistance(itemToBeConnected, comparisonItem);
-                if (jaroDistance >= JAROWINKLERTRESHOLD)
+                if (existingMatcher.first == comparisonItems)
                 {
-                    possibleConnecedItems.insertMulti(jaroDistance, comparisonItem);
+                    itemMatcher = existingMatcher.second;
+                    break;
                 }
             }
 
-            if (!possibleConnecedItems.isEmpty())
+            if (itemMatcher.isNull())
+            {
+                itemMatcher = QSharedPointer<JaroWinklerMatcher>(
+                    new JaroWinklerMatcher(comparisonItems, JAROWINKLERTRESHOLD));
+                matchers.append(qMakePair(comparisonItems, itemMatcher));
+            }
+
+            int bestMatch = itemMatcher->findBestMatch(itemToBeConnected);
+            if (bestMatch != -1)
             {
                 QPair<QString, QString> portCombination;
                 portCombination.first = itemToBeConnected;
-                portCombination.second = possibleConnecedItems.last();
+                portCombination.second = itemMatcher->candidate(bestMatch);
 
                 combinations.append(portCombination);
             }
@@ -264,7 +264,10 @@ bool DesignWidget::save()
         writeSucceeded = false;
     }
 
-    library_->endSave();
+    if (!library_->endSave())
+    {
+        writeSucceeded = false;
+    }
 
     if (writeSucceeded)
     {
@@ -43,12 +43,49 @@
 #include <IPXACTmodels/kactusExtensions/ComDefinitionWriter.h>
 #include <IPXACTmodels/kactusExtensions/ApiDefinitionWriter.h>
 
+#include <common/Profiler.h>
 #include <common/ui/MessageMediator.h>
 
 #include <QObject>
 #include <QDomElement>
+#include <QFile>
+#include <QRunnable>
+#include <QSaveFile>
+#include <QThreadPool>
 #include <QXmlStreamWriter>
 
+namespace
+{
+    //-----------------------------------------------------------------------------
+    //! Reads one document in a background thread.
+    //-----------------------------------------------------------------------------
+    class ParseTask : public QRunnable
+    {
+    public:
+
+        ParseTask(QString const& path, QSharedPointer<Document>& result):
+        QRunnable(),
+            path_(path),
+            result_(result)
+        {
+
+        }
+
+        void run() override
+        {
+            result_ = DocumentFileAccess::parseDocument(path_);
+        }
+
+    private:
+
+        //! The path of the file to read.
+        QString path_;
+
+        //! The read document.
+        QSharedPointer<Document>& result_;
+    };
+}
+
 //-----------------------------------------------------------------------------
 // Function: DocumentFileAccess::DocumentFileAccess()
 //-----------------------------------------------------------------------------
@@ -63,6 +100,9 @@ DocumentFileAccess::DocumentFileAccess(MessageMediator* messageChannel) :
 //-----------------------------------------------------------------------------
 QSharedPointer<Document> DocumentFileAccess::readDocument(QString const& path)
 {
+    ProfilingScope profilingScope("DocumentFileAccess::readDocument");
+    Profiler::getInstance().addCount("Documents read");
+
     // Create file handle and use it to read the IP-XACT document into memory.
     QFile file(path);
     file.open(QIODevice::ReadOnly);
@@ -76,6 +116,58 @@ QSharedPointer<Document> DocumentFileAccess::readDocument(QString const& path)
     }
     file.close();
 
+    QSharedPointer<Document> document = createDocument(doc);
+    if (document.isNull())
+    {
+        messageChannel_->showMessage(QObject::tr("File '%1' was not supported type").arg(path));
+    }
+
+    return document;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentFileAccess::parseDocument()
+//-----------------------------------------------------------------------------
+QSharedPointer<Document> DocumentFileAccess::parseDocument(QString const& path)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        return QSharedPointer<Document>();
+    }
+
+    QDomDocument doc;
+    if (!doc.setContent(&file))
+    {
+        return QSharedPointer<Document>();
+    }
+
+    return createDocument(doc);
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentFileAccess::parseDocuments()
+//-----------------------------------------------------------------------------
+QVector<QSharedPointer<Document> > DocumentFileAccess::parseDocuments(QStringList const& paths)
+{
+    QVector<QSharedPointer<Document> > documents(paths.size());
+
+    // The results are written into their own slots, so the tasks need no synchronization.
+    QThreadPool threadPool;
+    for (int i = 0; i < paths.size(); ++i)
+    {
+        threadPool.start(new ParseTask(paths.at(i), documents[i]));
+    }
+    threadPool.waitForDone();
+
+    return documents;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentFileAccess::createDocument()
+//-----------------------------------------------------------------------------
+QSharedPointer<Document> DocumentFileAccess::createDocument(QDomDocument const& doc)
+{
     VLNV::IPXactType toCreate = VLNV::string2Type(doc.documentElement().nodeName());
 
     // Create correct type of object.
@@ -122,7 +214,6 @@ QSharedPointer<Document> DocumentFileAccess::readDocument(QString const& path)
     }
     else
     {
-        messageChannel_->showMessage(QObject::tr("File '%1' was not supported type").arg(path));
         return QSharedPointer<Document>();
     }
 }
@@ -132,15 +223,32 @@ QSharedPointer<Document> DocumentFileAccess::readDocument(QString const& path)
 //-----------------------------------------------------------------------------
 bool DocumentFileAccess::writeDocument(QSharedPointer<Document> model, QString const& path)
 {
-    QFile targetFile(path);
-    if (!targetFile.open(QFile::WriteOnly | QFile::Truncate))
+    QByteArray content;
+    if (!serializeDocument(model, content))
+    {
+        messageChannel_->showError(QObject::tr("Could not write document %1 into XML.").arg(
+            model->getVlnv().toString()));
+        return false;
+    }
+
+    if (!writeFile(content, path))
     {
         messageChannel_->showError(QObject::tr("Could not open file %1 for writing.").arg(path));
         return false;
     }
 
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentFileAccess::serializeDocument()
+//-----------------------------------------------------------------------------
+bool DocumentFileAccess::serializeDocument(QSharedPointer<Document> model, QByteArray& content)
+{
+    content.clear();
+
     // write the parsed model
-    QXmlStreamWriter xmlWriter(&targetFile);
+    QXmlStreamWriter xmlWriter(&content);
     xmlWriter.setAutoFormatting(true);
     xmlWriter.setAutoFormattingIndent(-1);
 
@@ -199,11 +307,30 @@ bool DocumentFileAccess::writeDocument(QSharedPointer<Document> model, QString c
     }
     else
     {
-        Q_ASSERT_X(false, "DocumentFileAccess::writeDocument().", "Trying to write unknown document type to file.");
-        targetFile.close();
+        Q_ASSERT_X(false, "DocumentFileAccess::serializeDocument().", "Trying to write unknown document type.");
         return false;
     }
 
-    targetFile.close();
     return true;
 }
+
+//-----------------------------------------------------------------------------
+// Function: DocumentFileAccess::writeFile()
+//-----------------------------------------------------------------------------
+bool DocumentFileAccess::writeFile(QByteArray const& content, QString const& path)
+{
+    // The content is written to a temporary file, which then replaces the target file. An interrupted write
+    // never leaves a partially written document behind.
+    QSaveFile targetFile(path);
+    if (!targetFile.open(QFile::WriteOnly))
+    {
+        return false;
+    }
+
+    if (targetFile.write(content) != content.size())
+    {
+        targetFile.cancelWriting();
+    }
+
+    return targetFile.commit();
+}
@@ -13,10 +13,14 @@
 #define DOCUMENTFILEACCESS_H
 
 
+#include <QByteArray>
 #include <QSharedPointer>
 #include <QString>
+#include <QStringList>
+#include <QVector>
 
 class Document;
+class QDomDocument;
 class MessageMediator;
 
 //-----------------------------------------------------------------------------
@@ -39,11 +43,26 @@ public:
     //! Reads the document from given path.
     QSharedPointer<Document> readDocument(QString const& path);
 
+    //! Reads the document from the given path without reporting errors. Can be called from any thread.
+    static QSharedPointer<Document> parseDocument(QString const& path);
+
+    //! Reads the documents from the given paths concurrently. Unreadable documents are null in the results.
+    static QVector<QSharedPointer<Document> > parseDocuments(QStringList const& paths);
+
     //! Writes to document model to the given path.
     bool writeDocument(QSharedPointer<Document> model, QString const& path);
+
+    //! Serializes the document model into the given buffer. Can be called from any thread.
+    static bool serializeDocument(QSharedPointer<Document> model, QByteArray& content);
+
+    //! Replaces the file in the given path atomically with the given content. Can be called from any thread.
+    static bool writeFile(QByteArray const& content, QString const& path);
     
 private:
 
+    //! Creates the document model of the type given in the XML content, or null for unsupported types.
+    static QSharedPointer<Document> createDocument(QDomDocument const& doc);
+
     //! Channel for messages concerning file access.
     MessageMediator* messageChannel_;
 };
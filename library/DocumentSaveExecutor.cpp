@@ -0,0 +1,121 @@
+//-----------------------------------------------------------------------------
+// File: DocumentSaveExecutor.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: Kactus2 team
+// Date: 19.10.2026
+//
+// Description:
+// Writes IP-XACT documents to files concurrently in background threads.
+//-----------------------------------------------------------------------------
+
+#include "DocumentSaveExecutor.h"
+
+#include "DocumentFileAccess.h"
+
+#include <IPXACTmodels/common/Document.h>
+
+#include <QByteArray>
+#include <QRunnable>
+
+namespace
+{
+    //-----------------------------------------------------------------------------
+    //! Serializes and writes one document in a background thread.
+    //-----------------------------------------------------------------------------
+    class SaveTask : public QRunnable
+    {
+    public:
+
+        SaveTask(QSharedPointer<Document> model, QSharedPointer<DocumentSaveExecutor::SaveResult> result):
+        QRunnable(),
+            model_(model),
+            result_(result)
+        {
+
+        }
+
+        void run() override
+        {
+            QByteArray content;
+            result_->serialized = DocumentFileAccess::serializeDocument(model_, content);
+            result_->saved = result_->serialized && DocumentFileAccess::writeFile(content, result_->path);
+        }
+
+    private:
+
+        //! The document to write.
+        QSharedPointer<Document> model_;
+
+        //! The result of the write.
+        QSharedPointer<DocumentSaveExecutor::SaveResult> result_;
+    };
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentSaveExecutor::DocumentSaveExecutor()
+//-----------------------------------------------------------------------------
+DocumentSaveExecutor::DocumentSaveExecutor():
+threadPool_(),
+    results_(),
+    queuedPaths_()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentSaveExecutor::~DocumentSaveExecutor()
+//-----------------------------------------------------------------------------
+DocumentSaveExecutor::~DocumentSaveExecutor()
+{
+    threadPool_.waitForDone();
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentSaveExecutor::enqueue()
+//-----------------------------------------------------------------------------
+void DocumentSaveExecutor::enqueue(QSharedPointer<Document> model, QString const& path)
+{
+    // The same file written twice must be written in the queued order.
+    if (queuedPaths_.contains(path))
+    {
+        threadPool_.waitForDone();
+    }
+
+    QSharedPointer<SaveResult> result(new SaveResult());
+    result->vlnv = model->getVlnv();
+    result->path = path;
+
+    results_.append(result);
+    queuedPaths_.insert(path);
+
+    threadPool_.start(new SaveTask(model, result));
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentSaveExecutor::isEmpty()
+//-----------------------------------------------------------------------------
+bool DocumentSaveExecutor::isEmpty() const
+{
+    return results_.isEmpty();
+}
+
+//-----------------------------------------------------------------------------
+// Function: DocumentSaveExecutor::waitForResults()
+//-----------------------------------------------------------------------------
+QVector<DocumentSaveExecutor::SaveResult> DocumentSaveExecutor::waitForResults()
+{
+    threadPool_.waitForDone();
+
+    QVector<SaveResult> results;
+    results.reserve(results_.size());
+    for (QSharedPointer<SaveResult> const& result : results_)
+    {
+        results.append(*result);
+    }
+
+    results_.clear();
+    queuedPaths_.clear();
+
+    return results;
+}
@@ -0,0 +1,104 @@
+//-----------------------------------------------------------------------------
+// File: DocumentSaveExecutor.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: Kactus2 team
+// Date: 19.10.2026
+//
+// Description:
+// Writes IP-XACT documents to files concurrently in background threads.
+//-----------------------------------------------------------------------------
+
+#ifndef DOCUMENTSAVEEXECUTOR_H
+#define DOCUMENTSAVEEXECUTOR_H
+
+#include <IPXACTmodels/common/VLNV.h>
+
+#include <QSet>
+#include <QSharedPointer>
+#include <QString>
+#include <QThreadPool>
+#include <QVector>
+
+class Document;
+
+//-----------------------------------------------------------------------------
+//! Writes IP-XACT documents to files concurrently in background threads.
+//!
+//! Each document is serialized into a memory buffer and the buffer is written through a temporary file that
+//! replaces the target file, so the files never contain partially written documents. The queued documents must
+//! not be modified until the results have been collected.
+//-----------------------------------------------------------------------------
+class DocumentSaveExecutor
+{
+public:
+
+    //! The result of writing one document.
+    struct SaveResult
+    {
+        //! The written document.
+        VLNV vlnv;
+
+        //! The path of the written file.
+        QString path;
+
+        //! Flag for the document being serialized into XML successfully.
+        bool serialized = false;
+
+        //! Flag for the document being written successfully.
+        bool saved = false;
+    };
+
+    /*!
+     *  The constructor.
+     */
+    DocumentSaveExecutor();
+
+    /*!
+     *  The destructor. Waits for the queued documents to be written.
+     */
+    ~DocumentSaveExecutor();
+
+    /*!
+     *  Queues a document to be written into the given file.
+     *
+     *      @param [in] model   The document to write.
+     *      @param [in] path    The path of the target file.
+     */
+    void enqueue(QSharedPointer<Document> model, QString const& path);
+
+    /*!
+     *  Checks if there are queued documents whose results have not been collected.
+     *
+     *      @return True, if there are no queued documents, otherwise false.
+     */
+    bool isEmpty() const;
+
+    /*!
+     *  Waits for all the queued documents to be written and collects the results.
+     *
+     *      @return The results of the writes in the order the documents were queued.
+     */
+    QVector<SaveResult> waitForResults();
+
+    // No copying. No assignments.
+    DocumentSaveExecutor(DocumentSaveExecutor const& rhs) = delete;
+    DocumentSaveExecutor& operator=(DocumentSaveExecutor const& rhs) = delete;
+
+private:
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The threads writing the documents.
+    QThreadPool threadPool_;
+
+    //! The results of the queued documents, filled in by the writing threads.
+    QVector<QSharedPointer<SaveResult> > results_;
+
+    //! The paths of the queued files.
+    QSet<QString> queuedPaths_;
+};
+
+#endif // DOCUMENTSAVEEXECUTOR_H
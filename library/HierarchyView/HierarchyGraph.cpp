@@ -0,0 +1,621 @@
+//-----------------------------------------------------------------------------
+// File: HierarchyGraph.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: Kactus2 team
+// Date: 19.10.2026
+//
+// Description:
+// Shared graph of the library documents and their hierarchical references.
+//-----------------------------------------------------------------------------
+
+#include "HierarchyGraph.h"
+
+#include <library/LibraryInterface.h>
+
+#include <IPXACTmodels/Catalog/Catalog.h>
+#include <IPXACTmodels/Catalog/IpxactFile.h>
+#include <IPXACTmodels/Component/Component.h>
+#include <IPXACTmodels/Design/Design.h>
+#include <IPXACTmodels/designConfiguration/DesignConfiguration.h>
+
+#include <QHash>
+#include <QObject>
+
+#include <algorithm>
+
+namespace
+{
+    //! Count the references to a document in the hierarchy of a node, excluding the node itself.
+    int countReferences(HierarchyNode const* node, VLNV const& vlnv, QHash<HierarchyNode const*, int>& counts)
+    {
+        auto counted = counts.constFind(node);
+        if (counted != counts.constEnd())
+        {
+            return counted.value();
+        }
+
+        int count = 0;
+        for (HierarchyNode::Edge const& edge : node->children)
+        {
+            if (edge.child->vlnv == vlnv)
+            {
+                count++;
+            }
+            else
+            {
+                count += countReferences(edge.child, vlnv, counts);
+            }
+        }
+
+        counts.insert(node, count);
+        return count;
+    }
+
+    //! Append the documents in the hierarchy of a node to a list.
+    void appendChildren(HierarchyNode const* node, QList<VLNV>& childList, QSet<HierarchyNode const*>& visited)
+    {
+        for (HierarchyNode::Edge const& edge : node->children)
+        {
+            if (!childList.contains(edge.child->vlnv))
+            {
+                childList.append(edge.child->vlnv);
+            }
+
+            if (!visited.contains(edge.child))
+            {
+                visited.insert(edge.child);
+                appendChildren(edge.child, childList, visited);
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: HierarchyGraph::HierarchyGraph()
+//-----------------------------------------------------------------------------
+HierarchyGraph::HierarchyGraph(LibraryInterface* library):
+library_(library),
+    root_(new HierarchyNode()),
+    nodes_(),
+    nodesInParse_(),
+    errorMessages_()
+{
+    Q_ASSERT_X(library, "HierarchyGraph constructor", "Null LibraryInterface pointer given as parameter");
+}
+
+//-----------------------------------------------------------------------------
+// Function: HierarchyGraph::~HierarchyGraph()
+//-----------------------------------------------------------------------------
+HierarchyGraph::~HierarchyGraph()
+{
+    clear();
+    delete root_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: HierarchyGraph::root()
+//-----------------------------------------------------------------------------
+HierarchyNode* HierarchyGraph::root() const
+{
+    return root_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: HierarchyGraph::clear()
+//-----------------------------------------------------------------------------
+void HierarchyGraph::clear()
+{
+    root_->children.clear();
+
+    qDeleteAll(nodes_);
+    nodes_.clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: HierarchyGraph::findNode()
+//-----------------------------------------------------------------------------
+HierarchyNode* HierarchyGraph::findNode(VLNV const& vlnv) const
+{
+    return nodes_.value(vlnv, nullptr);
+}
+
+//-----------------------------------------------------------------------------
+// Function: HierarchyGraph::getNode()
+//-----------------------------------------------------------------------------
+HierarchyNode* HierarchyGraph::getNode(VLNV const& vlnv)
+{
+    HierarchyNode* node = findNode(vlnv);
+    if (node)
+    {
+        return node;
+    }
+
+    node = new HierarchyNode();
+    node->vlnv = vlnv;
+    nodes_.insert(vlnv, node);
+
+    nodesInParse_.insert(node);
+
+    VLNV::IPXactType documentType = library_->getDocumentType(vlnv);
+    if (documentType == VLNV::COMPONENT)
+    {
+        parseComponent(node);
+    }
+    else if (documentType == VLNV::CATALOG)
+    {
+        parseCatalog(node);
+    }
+    else if (documentType == VLNV::DESIGN)
+    {
+        parseDesign(node);
+    }
+    else if (documentType == VLNV::BUSDEFINITION)
+    {
+        node->type = HierarchyItem::BUSDEFINITION;
+        node->isValid = library_->isValid(vlnv);
+    }
+    else if (documentType == VLNV::ABSTRACTIONDEFINITION)
+    {
+        node->type = HierarchyItem::ABSDEFINITION;
+        node->isValid = library_->isValid(vlnv);
+    }
+    else if (documentType == VLNV::COMDEFINITION)
+    {
+        node->type = HierarchyItem::COMDEFINITION;
+        node->isValid = library_->isValid(vlnv);
+    }
+    else if (documentType == VLNV::APIDEFINITION)
+    {
+        node->type = HierarchyItem::APIDEFINITION;
+        node->isValid = library_->isValid(vlnv);
+    }
+    else
+    {
+        node->isValid = false;
+    }
+
+    nodesInParse_.remove(node);
+
+    return node;
+}
+
+//-----------------------------------------------------------------------------
+// Function: HierarchyGraph::addChild()
+//-----------------------------------------------------------------------------
+bool HierarchyGraph::addChild(HierarchyNode* parent, HierarchyNode* child)
+{
+    for (HierarchyNode::Edge const& edge : parent->children)
+    {
+        if (edge.child == child)
+        {
+            return false;
+        }
+    }
+
+    appendEdge(parent, child, QString(), -1);
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: HierarchyGraph::removeNode()
+//-----------------------------------------------------------------------------
+void HierarchyGraph::removeNode(VLNV const& vlnv)
+{
+    HierarchyNode* removedNode = nodes_.take(vlnv);
+    if (!removedNode)
+    {
+        return;
+    }
+
+    for (HierarchyNode* parent : removedNode->parents)
+    {
+        parent->children.erase(std::remove_if(parent->children.begin(), parent->children.end(),
+            [removedNode](HierarchyNode::Edge const& edge) { return edge.child == removedNode; }),
+            parent->children.end());
+
+        // A component whose design is removed contains references that are not in the library.
+        if (parent->type == HierarchyItem::COMPONENT)
+        {
+            parent->isValid = false;
+        }
+    }
+
+    for (HierarchyNode::Edge const& edge : removedNode->children)
+    {
+        edge.child->parents.removeAll(removedNode);
+    }
+
+    delete removedNode;
+
+    removeUnreachableNodes();
+}
+
+//-----------------------------------------------------------------------------
+// Function: HierarchyGraph::findContainingNodes()
+//-----------------------------------------------------------------------------
+QSet<HierarchyNode const*> HierarchyGraph::findContainingNodes(VLNV const& vlnv) const
+{
+    QSet<HierarchyNode const*> containingNodes;
+
+    HierarchyNode const* target = findNode(vlnv);
+    if (!target)
+    {
+        return containingNodes;
+    }
+
+    QVector<HierarchyNode const*> unvisited({ target });
+    while (!unvisited.isEmpty())
+    {
+        HierarchyNode const* node = unvisited.takeLast();
+        for (HierarchyNode const* parent : node->parents)
+        {
+            if (parent != root_ && !containingNodes.contains(parent))
+            {
+                containingNodes.insert(parent);
+                unvisited.append(parent);
+            }
+        }
+    }
+
+    return containingNodes;
+}
+
+//-----------------------------------------------------------------------------
+// Function: HierarchyGraph::findContainedNodes()
+//-----------------------------------------------------------------------------
+QSet<HierarchyNode const*> HierarchyGraph::findContainedNodes(HierarchyNode const* node) const
+{
+    QSet<HierarchyNode const*> containedNodes;
+
+    QVector<HierarchyNode const*> unvisited({ node });
+    while (!unvisited.isEmpty())
+    {
+        HierarchyNode const* current = unvisited.takeLast();
+        for (HierarchyNode::Edge const& edge : current->children)
+        {
+            if (!containedNodes.contains(edge.child))
+            {
+                containedNodes.insert(edge.child);
+                unvisited.append(edge.child);
+            }
+        }
+    }
+
+    return containedNodes;
+}
+
+//-----------------------------------------------------------------------------
+// Function: HierarchyGraph::findReferencedNodes()
+//-----------------------------------------------------------------------------
+QSet<HierarchyNode const*> HierarchyGraph::findReferencedNodes() const
+{
+    QSet<HierarchyNode const*> referencedNodes;
+    for (HierarchyNode const* node : nodes_)
+    {
+        if (std::any_of(node->parents.cbegin(), node->parents.cend(),
+            [this](HierarchyNode const* parent) { return parent != root_; }))
+        {
+            referencedNodes.insert(node);
+        }
+    }
+
+    return referencedNodes;
+}
+
+//-----------------------------------------------------------------------------
+// Function: HierarchyGraph::referenceCount()
+//-----------------------------------------------------------------------------
+int HierarchyGraph::referenceCount(VLNV const& vlnv) const
+{
+    // The top level documents are not references, but their hierarchies are counted.
+    QHash<HierarchyNode const*, int> counts;
+
+    int count = 0;
+    for (HierarchyNode::Edge const& edge : root_->children)
+    {
+        count += countReferences(edge.child, vlnv, counts);
+    }
+
+    return count;
+}
+
+//-----------------------------------------------------------------------------
+// Function: HierarchyGraph::getOwners()
+//-----------------------------------------------------------------------------
+void HierarchyGraph::getOwners(QList<VLNV>& list, VLNV const& vlnvToSearch) const
+{
+    HierarchyNode const* target = findNode(vlnvToSearch);
+    if (!target)
+    {
+        return;
+    }
+
+    QList<VLNV> owners;
+    for (HierarchyNode const* parent : target->parents)
+    {
+        if (parent != root_ && !list.contains(parent->vlnv))
+        {
+            owners.append(parent->vlnv);
+        }
+    }
+
+    // The owners are listed in the same order regardless of the hashing.
+    std::sort(owners.begin(), owners.end());
+    list.append(owners);
+}
+
+//-----------------------------------------------------------------------------
+// Function: HierarchyGraph::getChildren()
+//-----------------------------------------------------------------------------
+void HierarchyGraph::getChildren(QList<VLNV>& childList, VLNV const& owner) const
+{
+    for (HierarchyNode::Edge const& edge : root_->children)
+    {
+        if (edge.child->vlnv == owner)
+        {
+            QSet<HierarchyNode const*> visited;
+            appendChildren(edge.child, childList, visited);
+            return;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: HierarchyGraph::takeErrorMessages()
+//-----------------------------------------------------------------------------
+QStringList HierarchyGraph::takeErrorMessages()
+{
+    QStringList messages = errorMessages_;
+    errorMessages_.clear();
+
+    return messages;
+}
+
+//-----------------------------------------------------------------------------
+// Function: HierarchyGraph::parseComponent()
+//-----------------------------------------------------------------------------
+void HierarchyGraph::parseComponent(HierarchyNode* node)
+{
+    node->type = HierarchyItem::COMPONENT;
+    node->component = library_->getModelReadOnly<Component>(node->vlnv);
+    Q_ASSERT(node->component);
+
+    node->isValid = library_->isValid(node->vlnv);
+
+    for (QSharedPointer<View> view : *node->component->getViews())
+    {
+        if (view->isHierarchical())
+        {
+            VLNV designVLNV = findDesignReference(node, view);
+            if (!designVLNV.isEmpty())
+            {
+                if (library_->getDocumentType(designVLNV) != VLNV::DESIGN)
+                {
+                    node->isValid = false;
+                }
+                else
+                {
+                    addReference(node, designVLNV, view->name());
+                }
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: HierarchyGraph::parseCatalog()
+//-----------------------------------------------------------------------------
+void HierarchyGraph::parseCatalog(HierarchyNode* node)
+{
+    node->type = HierarchyItem::CATALOG;
+    QSharedPointer<Catalog const> catalog = library_->getModelReadOnly<Catalog>(node->vlnv);
+    Q_ASSERT(catalog);
+
+    node->isValid = library_->isValid(node->vlnv);
+
+    // Cyclic catalog references are left out.
+    for (QSharedPointer<IpxactFile> const& catalogFile : *catalog->getCatalogs())
+    {
+        addReference(node, catalogFile->getVlnv());
+    }
+
+    for (QSharedPointer<IpxactFile> const& busFile : *catalog->getBusDefinitions())
+    {
+        addReference(node, busFile->getVlnv());
+    }
+
+    for (QSharedPointer<IpxactFile> const& abstractionFile : *catalog->getAbstractionDefinitions())
+    {
+        addReference(node, abstractionFile->getVlnv());
+    }
+
+    for (QSharedPointer<IpxactFile> const& componentFile : *catalog->getComponents())
+    {
+        addReference(node, componentFile->getVlnv());
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: HierarchyGraph::parseDesign()
+//-----------------------------------------------------------------------------
+void HierarchyGraph::parseDesign(HierarchyNode* node)
+{
+    QSharedPointer<Design const> design = library_->getModelReadOnly<Design>(node->vlnv);
+    node->isValid = library_->isValid(node->vlnv);
+
+    KactusAttribute::Implementation implementation = design->getImplementation();
+    if (implementation == KactusAttribute::HW)
+    {
+        node->type = HierarchyItem::HW_DESIGN;
+    }
+    else if (implementation == KactusAttribute::SW)
+    {
+        node->type = HierarchyItem::SW_DESIGN;
+    }
+    else if (implementation == KactusAttribute::SYSTEM)
+    {
+        node->type = HierarchyItem::SYS_DESIGN;
+    }
+    else
+    {
+        Q_ASSERT(false);
+    }
+
+    // Take all valid components referenced by the design and count their instances.
+    QVector<VLNV> componentReferences;
+    QHash<VLNV, int> instanceCounts;
+    for (QSharedPointer<ComponentInstance> instance : *design->getComponentInstances())
+    {
+        if (!instance->isDraft())
+        {
+            VLNV componentVLNV = *instance->getComponentRef();
+            if (library_->getDocumentType(componentVLNV) == VLNV::COMPONENT)
+            {
+                componentReferences.append(componentVLNV);
+                instanceCounts[componentVLNV]++;
+            }
+            else
+            {
+                // Mark this object as invalid because not all items were valid.
+                node->isValid = false;
+            }
+        }
+    }
+
+    for (VLNV const& componentVLNV : componentReferences)
+    {
+        if (!addReference(node, componentVLNV, QString(), instanceCounts.value(componentVLNV)))
+        {
+            errorMessages_.append(QObject::tr("Cyclic instantiation for vlnv %1 was found").arg(
+                componentVLNV.toString()));
+            node->isValid = false;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: HierarchyGraph::findDesignReference()
+//-----------------------------------------------------------------------------
+VLNV HierarchyGraph::findDesignReference(HierarchyNode* node, QSharedPointer<View> view) const
+{
+    QSharedPointer<Component const> component = node->component;
+
+    if (!view->getDesignInstantiationRef().isEmpty())
+    {
+        QString viewDesign = view->getDesignInstantiationRef();
+
+        for (QSharedPointer<DesignInstantiation> instantiation : *component->getDesignInstantiations())
+        {
+            if (instantiation->name() == viewDesign)
+            {
+                return *instantiation->getDesignReference();
+            }
+        }
+    }
+    else
+    {
+        QString viewConfiguration = view->getDesignConfigurationInstantiationRef();
+
+        for (QSharedPointer<DesignConfigurationInstantiation> instantiation :
+            *component->getDesignConfigurationInstantiations())
+        {
+            if (instantiation->name() == viewConfiguration)
+            {
+                VLNV configurationVLNV = *instantiation->getDesignConfigurationReference();
+
+                if (!library_->contains(configurationVLNV))
+                {
+                    node->isValid = false;
+                    return configurationVLNV;
+                }
+                else if (library_->getDocumentType(configurationVLNV) != VLNV::DESIGNCONFIGURATION)
+                {
+                    node->isValid = false;
+                    return VLNV();
+                }
+                else
+                {
+                    return library_->getModelReadOnly<DesignConfiguration>(configurationVLNV)->getDesignRef();
+                }
+            }
+        }
+    }
+
+    return VLNV();
+}
+
+//-----------------------------------------------------------------------------
+// Function: HierarchyGraph::addReference()
+//-----------------------------------------------------------------------------
+bool HierarchyGraph::addReference(HierarchyNode* parent, VLNV const& vlnv, QString const& viewName,
+    int instanceCount)
+{
+    for (HierarchyNode::Edge const& edge : parent->children)
+    {
+        if (edge.child->vlnv == vlnv)
+        {
+            return true;
+        }
+    }
+
+    HierarchyNode* child = findNode(vlnv);
+    if (child && nodesInParse_.contains(child))
+    {
+        return false;
+    }
+
+    if (!child)
+    {
+        child = getNode(vlnv);
+    }
+
+    appendEdge(parent, child, viewName, instanceCount);
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: HierarchyGraph::appendEdge()
+//-----------------------------------------------------------------------------
+void HierarchyGraph::appendEdge(HierarchyNode* parent, HierarchyNode* child, QString const& viewName,
+    int instanceCount)
+{
+    parent->children.append(HierarchyNode::Edge{ child, viewName, instanceCount });
+    child->parents.append(parent);
+}
+
+//-----------------------------------------------------------------------------
+// Function: HierarchyGraph::removeUnreachableNodes()
+//-----------------------------------------------------------------------------
+void HierarchyGraph::removeUnreachableNodes()
+{
+    QSet<HierarchyNode const*> reachableNodes = findContainedNodes(root_);
+
+    QVector<HierarchyNode*> unreachableNodes;
+    for (auto node = nodes_.begin(); node != nodes_.end(); )
+    {
+        if (reachableNodes.contains(node.value()))
+        {
+            ++node;
+        }
+        else
+        {
+            unreachableNodes.append(node.value());
+            node = nodes_.erase(node);
+        }
+    }
+
+    // The reachable nodes must not keep back-references to the removed ones.
+    for (HierarchyNode* node : unreachableNodes)
+    {
+        for (HierarchyNode::Edge const& edge : node->children)
+        {
+            if (reachableNodes.contains(edge.child))
+            {
+                edge.child->parents.removeAll(node);
+            }
+        }
+    }
+
+    qDeleteAll(unreachableNodes);
+}
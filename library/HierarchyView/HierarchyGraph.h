@@ -0,0 +1,280 @@
+//-----------------------------------------------------------------------------
+// File: HierarchyGraph.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: Kactus2 team
+// Date: 19.10.2026
+//
+// Description:
+// Shared graph of the library documents and their hierarchical references.
+//-----------------------------------------------------------------------------
+
+#ifndef HIERARCHYGRAPH_H
+#define HIERARCHYGRAPH_H
+
+#include "hierarchyitem.h"
+
+#include <IPXACTmodels/common/VLNV.h>
+#include <IPXACTmodels/kactusExtensions/KactusAttribute.h>
+
+#include <QHash>
+#include <QList>
+#include <QSet>
+#include <QSharedPointer>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+class Component;
+class LibraryInterface;
+class View;
+
+//-----------------------------------------------------------------------------
+//! A document in the library hierarchy. A node is shared by all the hierarchy items showing the document.
+//-----------------------------------------------------------------------------
+struct HierarchyNode
+{
+    //! Reference from a document to a document in its hierarchy.
+    struct Edge
+    {
+        //! The referenced document.
+        HierarchyNode* child;
+
+        //! The name of the view a referenced design belongs to.
+        QString viewName;
+
+        //! The number of instances of a referenced component in a design, or -1 for other references.
+        int instanceCount;
+    };
+
+    //! The VLNV of the document.
+    VLNV vlnv;
+
+    //! The type of the document.
+    HierarchyItem::ObjectType type = HierarchyItem::ROOT;
+
+    //! The document, if it is a component.
+    QSharedPointer<Component const> component;
+
+    //! Specifies the validity of the document and its references.
+    bool isValid = true;
+
+    //! The references to the documents in the hierarchy of this document.
+    QVector<Edge> children;
+
+    //! The nodes referencing this document, including the root for a top level document.
+    QVector<HierarchyNode*> parents;
+};
+
+//-----------------------------------------------------------------------------
+//! Shared graph of the library documents and their hierarchical references.
+//!
+//! Each document is parsed once into a node, no matter how many hierarchies it belongs to. The references of
+//! the documents form a directed acyclic graph: cyclic instantiations are reported and left out.
+//-----------------------------------------------------------------------------
+class HierarchyGraph
+{
+public:
+
+    /*!
+     *  The constructor.
+     *
+     *      @param [in] library     The instance that manages the library.
+     */
+    explicit HierarchyGraph(LibraryInterface* library);
+
+    /*!
+     *  The destructor.
+     */
+    ~HierarchyGraph();
+
+    /*!
+     *  Get the root node referencing the top level documents.
+     *
+     *      @return The root node.
+     */
+    HierarchyNode* root() const;
+
+    /*!
+     *  Remove all the nodes.
+     */
+    void clear();
+
+    /*!
+     *  Find the node of a document.
+     *
+     *      @param [in] vlnv    Identifies the document.
+     *
+     *      @return The node of the document, or null if the document has not been parsed.
+     */
+    HierarchyNode* findNode(VLNV const& vlnv) const;
+
+    /*!
+     *  Get the node of a document, parsing the document and its hierarchy if needed.
+     *
+     *      @param [in] vlnv    Identifies the document.
+     *
+     *      @return The node of the document.
+     */
+    HierarchyNode* getNode(VLNV const& vlnv);
+
+    /*!
+     *  Add a reference between two nodes, unless it already exists.
+     *
+     *      @param [in] parent  The referencing node.
+     *      @param [in] child   The referenced node.
+     *
+     *      @return True, if the reference was added, otherwise false.
+     */
+    bool addChild(HierarchyNode* parent, HierarchyNode* child);
+
+    /*!
+     *  Remove the node of a document and the references to it.
+     *
+     *      @param [in] vlnv    Identifies the removed document.
+     */
+    void removeNode(VLNV const& vlnv);
+
+    /*!
+     *  Find the nodes whose hierarchy contains a document.
+     *
+     *      @param [in] vlnv    Identifies the document.
+     *
+     *      @return The nodes that reference the document directly or indirectly.
+     */
+    QSet<HierarchyNode const*> findContainingNodes(VLNV const& vlnv) const;
+
+    /*!
+     *  Find the nodes contained in the hierarchy of a node.
+     *
+     *      @param [in] node    The selected node.
+     *
+     *      @return The nodes referenced directly or indirectly by the node.
+     */
+    QSet<HierarchyNode const*> findContainedNodes(HierarchyNode const* node) const;
+
+    /*!
+     *  Find the nodes referenced by other nodes than the root.
+     *
+     *      @return The nodes contained in the hierarchy of another node.
+     */
+    QSet<HierarchyNode const*> findReferencedNodes() const;
+
+    /*!
+     *  Count the references to a document in all the hierarchies.
+     *
+     *      @param [in] vlnv    Identifies the document.
+     *
+     *      @return The number of times the document appears in the hierarchies.
+     */
+    int referenceCount(VLNV const& vlnv) const;
+
+    /*!
+     *  Get the documents that reference a document directly.
+     *
+     *      @param [in/out] list        The list where the owners are appended.
+     *      @param [in] vlnvToSearch    Identifies the document.
+     */
+    void getOwners(QList<VLNV>& list, VLNV const& vlnvToSearch) const;
+
+    /*!
+     *  Get the documents in the hierarchy of a top level document.
+     *
+     *      @param [in/out] childList   The list where the documents are appended.
+     *      @param [in] owner           Identifies the top level document.
+     */
+    void getChildren(QList<VLNV>& childList, VLNV const& owner) const;
+
+    /*!
+     *  Take the messages reported while parsing the documents.
+     *
+     *      @return The reported error messages.
+     */
+    QStringList takeErrorMessages();
+
+    // No copying. No assignments.
+    HierarchyGraph(HierarchyGraph const& rhs) = delete;
+    HierarchyGraph& operator=(HierarchyGraph const& rhs) = delete;
+
+private:
+
+    /*!
+     *  Parse the references of a component.
+     *
+     *      @param [in] node    The node of the component.
+     */
+    void parseComponent(HierarchyNode* node);
+
+    /*!
+     *  Parse the references of a catalog.
+     *
+     *      @param [in] node    The node of the catalog.
+     */
+    void parseCatalog(HierarchyNode* node);
+
+    /*!
+     *  Parse the component instances of a design.
+     *
+     *      @param [in] node    The node of the design.
+     */
+    void parseDesign(HierarchyNode* node);
+
+    /*!
+     *  Find the design referenced by a hierarchical view of a component.
+     *
+     *      @param [in] node    The node of the component.
+     *      @param [in] view    The hierarchical view.
+     *
+     *      @return The VLNV of the referenced design.
+     */
+    VLNV findDesignReference(HierarchyNode* node, QSharedPointer<View> view) const;
+
+    /*!
+     *  Add a reference to a document, unless it would create a cycle.
+     *
+     *      @param [in] parent          The referencing node.
+     *      @param [in] vlnv            Identifies the referenced document.
+     *      @param [in] viewName        The name of the view a referenced design belongs to.
+     *      @param [in] instanceCount   The number of instances of a referenced component.
+     *
+     *      @return True, if the reference was added or it already existed, false for a cyclic reference.
+     */
+    bool addReference(HierarchyNode* parent, VLNV const& vlnv, QString const& viewName = QString(),
+        int instanceCount = -1);
+
+    /*!
+     *  Add a reference between two nodes and the back-reference from the child to the parent.
+     *
+     *      @param [in] parent          The referencing node.
+     *      @param [in] child           The referenced node.
+     *      @param [in] viewName        The name of the view a referenced design belongs to.
+     *      @param [in] instanceCount   The number of instances of a referenced component.
+     */
+    void appendEdge(HierarchyNode* parent, HierarchyNode* child, QString const& viewName, int instanceCount);
+
+    /*!
+     *  Remove the nodes that are no longer referenced from the root.
+     */
+    void removeUnreachableNodes();
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The instance that manages the library.
+    LibraryInterface* library_;
+
+    //! The root node referencing the top level documents.
+    HierarchyNode* root_;
+
+    //! The nodes of the parsed documents.
+    QHash<VLNV, HierarchyNode*> nodes_;
+
+    //! The nodes whose references are being parsed, used to detect cyclic references.
+    QSet<HierarchyNode const*> nodesInParse_;
+
+    //! The error messages reported while parsing the documents.
+    QStringList errorMessages_;
+};
+
+#endif // HIERARCHYGRAPH_H
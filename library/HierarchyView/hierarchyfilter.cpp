@@ -43,7 +43,7 @@ bool HierarchyFilter::filterAcceptsRow(int sourceRow, QModelIndex const& sourceP
 
 	HierarchyItem* item = static_cast<HierarchyItem*>(itemIndex.internalPointer());
 
-    QSharedPointer<const Document> document = getLibraryInterface()->getModelReadOnly(item->getVLNV());
+    DocumentMetadata document = getLibraryInterface()->getMetadata(item->getVLNV());
     if (!checkTags(document))
     {
         return false;
@@ -100,11 +100,10 @@ bool HierarchyFilter::filterAcceptsRow(int sourceRow, QModelIndex const& sourceP
         }
     }
 
-    QSharedPointer<Component const> component = item->component();
-    if (component)
+    if (document.type == VLNV::COMPONENT)
     {
         // check the filters
-        if (!checkFirmness(component) || !checkImplementation(component) || !checkHierarchy(component))
+        if (!checkFirmness(document) || !checkImplementation(document) || !checkHierarchy(document))
         {
             return false;
         }
@@ -23,20 +23,21 @@
 
 #include <IPXACTmodels/kactusExtensions/KactusAttribute.h>
 
-#include <QObject>
+#include <QSet>
 #include <QSharedPointer>
-#include <QList>
-#include <QMap>
+#include <QString>
+#include <QVector>
 
-class LibraryInterface;
+struct HierarchyNode;
 
 //-----------------------------------------------------------------------------
 //! Represents a single component in the library in hierarchy view.
+//!
+//! The item shows one occurrence of a document node shared in the hierarchy graph. The child items are created
+//! only when they are first needed, so the hierarchies are expanded only as far as they are viewed.
 //-----------------------------------------------------------------------------
-class HierarchyItem : public QObject
+class HierarchyItem
 {
-	Q_OBJECT
-
 public:
 
 	//! Defines the type of the hierarchy item.
@@ -56,36 +57,43 @@ public:
 
 	/*! The constructor
 	 *
-	 *      @param [in] handler         The instance that manages the library.
-	 *      @param [in] parent          The owner of this object.
-	 *      @param [in] vlnv            The vlnv to construct the item for.
-	 *      @param [in] implementation  The implementation attribute needed by designs.
+	 *      @param [in] parent          The owner of this item.
+	 *      @param [in] node            The document node to show.
+	 *      @param [in] row             The row of this item in the parent.
 	 *      @param [in] viewName        The name of the view the design belongs to.
+	 *      @param [in] instanceCount   The number of instances of the component in the containing design.
 	 */
-	HierarchyItem(LibraryInterface* handler, HierarchyItem* parent, VLNV const& vlnv,
-		KactusAttribute::Implementation implementation = KactusAttribute::KTS_IMPLEMENTATION_COUNT,
-		QString const& viewName = QString());
+	HierarchyItem(HierarchyItem* parent, HierarchyNode* node, int row, QString const& viewName = QString(),
+        int instanceCount = -1);
 
 	/*! The constructor for the root item.
-	 * 
+	 *
 	 * This constructor should only be used to create the root item and no other hierarchy items.
-	 * 
-	 *      @param [in] handler The instance that manages the library.
-	 *      @param [in] parent The owner of this item.
+	 *
+	 *      @param [in] root    The root node of the hierarchy graph.
 	 */
-	HierarchyItem(LibraryInterface* handler, QObject* parent);
+	explicit HierarchyItem(HierarchyNode* root);
 
     //! The destructor
-    virtual ~HierarchyItem() = default;
+    ~HierarchyItem();
+
+    // No copying. No assignments.
+    HierarchyItem(HierarchyItem const& other) = delete;
+    HierarchyItem& operator=(HierarchyItem const& other) = delete;
 
-	/*! Create a child for the HierarchyItem that represents the given VLNV.
-	 * 
-	 * This function should only be called for the root item to create the tree.
-	 * 
-	 *      @param [in] vlnv Identifies the component to represent.
+	/*! Create a child item for a reference added to the node after the children were created.
+	 *
+	 *      @param [in] node            The referenced document node.
+	 *      @param [in] viewName        The name of the view the design belongs to.
+	 *      @param [in] instanceCount   The number of instances of the component in the containing design.
 	 */
-	void createChild(const VLNV& vlnv);
+	void createChild(HierarchyNode* node, QString const& viewName, int instanceCount);
 
+	/*! Remove the child item for a reference removed from the node after the children were created.
+	 *
+	 *      @param [in] row     The row of the removed child item.
+	 */
+	void removeChild(int row);
 
 	/*! Get the parent of this item.
 	 *
@@ -93,6 +101,12 @@ public:
 	*/
 	HierarchyItem* parent() const;
 
+	/*! Get the document node shown by this item.
+	 *
+	 *      @return The node of the document.
+	*/
+	HierarchyNode* node() const;
+
 	/*! Get the vlnv of this item.
 	 *
 	 *      @return VLNV of the component this item represents.
@@ -100,9 +114,9 @@ public:
 	VLNV const& getVLNV() const;
 
 	/*! Get pointer to the child item with given index.
-	 * 
+	 *
 	 * If child with given index does not exist then return null pointer.
-	 * 
+	 *
 	 *      @param [in] index Row number of the child that's pointer is wanted.
 	 *
 	 *      @return HierarchyItem*
@@ -113,27 +127,25 @@ public:
 	 *
 	 *      @return The row number.
 	*/
-	int row();
+	int row() const;
 
-	/*! Get the number of children this item has.
+	/*! Get the number of children this item has. The child items are created, if needed.
 	 *
 	 *      @return The number of child items this item has.
 	*/
 	int getNumberOfChildren() const;
 
-	/*! Get the index of specified item.
+	/*! Check if this item has children or not. The child items are not created.
 	 *
-	 *      @param [in] item The HierarchyItem that's row number is requested.
-	 *
-	 *      @return The row number of given item. Returns -1 if item is not found.
+	 *      @return True if at least one child item exists.
 	*/
-	int getIndexOf(HierarchyItem* item);
+	bool hasChildren() const;
 
-	/*! Check if this item has children or not.
+	/*! Check if the child items of this item have been created.
 	 *
-	 *      @return True if at least one child item exists.
+	 *      @return True if the child items exist.
 	*/
-	bool hasChildren() const;
+	bool childrenCreated() const;
 
 	/*! Check if this item is valid or not.
 	 *
@@ -141,95 +153,32 @@ public:
 	*/
 	bool isValid() const;
 
-	/*! Set the validity of this item.
-	 *
-	 *      @param [in] valid Sets the valid value of the item.
-	 *
-	*/
-	void setValidity(bool valid);
-
-	/*! Checks if the component or one of it's sub-components contains the vlnv.
-	 *
-	 *      @param [in] vlnv The vlnv that is searched in hierarchy.
-	 *
-	 *      @return bool True if the vlnv is found.
-	*/
-	bool contains(const VLNV& vlnv) const;
-
-	/*! Removes the child items that are contained in one or several other components.
-	 * 
-	 * Note: This function should be called only for the root item.
-	 *
-	 *      @return void
-	*/
-	void cleanUp();
-	
 	/*! Get pointer to the component that this item represents
 	 *
 	 *      @return QSharedPointer<Component> The component model.
 	*/
 	QSharedPointer<Component const> component() const;
 
-	/*! Count how many instances of given vlnv is found under this item.
-	 *
-	 * This function does not check if the same owner is counted multiple times
-	 * if same sub-component is instantiated in several components. If count that 
-	 * contains only unique owners then you should use getOwners().
-	 * 
-	 *      @param [in] vlnv Identifies the component that's instances are searched.
-	 *
-	 *      @return Number of found instances.
-	*/
-	int referenceCount(const VLNV& vlnv) const;
-
-	/*! Get list of objects that have instantiated the given vlnv.
-	 *
-	 * This function makes sure each owner is appended to the list only once.
-	 *
-	 *      @param [out] list QList where owner vlnvs is appended.
-	 *      @param [in] vlnvToSearch The vlnv to that's parents are wanted.
-	 * 
-	 *      @return Number of unique owners found.
-	*/
-	int getOwners(QList<VLNV>& list, const VLNV& vlnvToSearch) const;
-
-	/*! Remove the child items with given vlnv.
-	 *
-	 *      @param [in] vlnv Identifies the items to remove.
-	 * 
-	 *      @return Amount of child items removed from this item.
-	*/
-	int removeItems(const VLNV& vlnv);
-
-	/*! Find the hierarchyItems that represent the given vlnv.
+	/*! Find the hierarchyItems that represent the given vlnv, creating the items on the way if needed.
 	 *
-	 *      @param [in] vlnv Identifies the items.
+	 *      @param [in] vlnv                Identifies the items.
+	 *      @param [in] containingNodes     The nodes whose hierarchy contains the vlnv.
 	 *
-	 *      @return QList<HierarchyItem*> contains pointers to the hierarchy items.
+	 *      @return Pointers to the hierarchy items.
 	*/
-	QVector<HierarchyItem*> findItems(const VLNV& vlnv);
+	QVector<HierarchyItem*> findItems(VLNV const& vlnv, QSet<HierarchyNode const*> const& containingNodes);
 
-	/*! Update hierarchy items with given vlnv.
-	 *
-	 *      @param [in] vlnv Identifies the objects to update.
+	/*! Find the already created hierarchyItems that show the given node.
 	 *
-	*/
-	void updateItems(const VLNV& vlnv);
-
-	/*! Checks if the item has parent on some hierarchy-level with given vlnv.
-	 * 
-	 * Function does not just search the direct parent but the whole parent-chain
-	 * up to the root item.
-	 * 
-	 *      @param [in] vlnv Identifies the parent to search.
+	 *      @param [in] node    The node to search.
 	 *
-	 *      @return bool True if parent with given vlnv is found.
+	 *      @return Pointers to the hierarchy items.
 	*/
-	bool hasParent(const VLNV& vlnv);
+	QVector<HierarchyItem*> findCreatedItems(HierarchyNode const* node);
 
 	/*! Check if the parent of this item is the root item.
 	 *
-	 *      @return bool true if the parent item is root item. If this is the root or 
+	 *      @return bool true if the parent item is root item. If this is the root or
 	 * parent is normal item then returns false.
 	*/
 	bool parentIsRoot() const;
@@ -271,7 +220,7 @@ public:
 	bool isHierarchical() const;
 
 	/*! Get the implementation of this item.
-	 * 
+	 *
 	 * Note: This function can only be called for items of type component.
 	 *
 	 *      @return KactusAttribute::Implementation Specifies the implementation.
@@ -284,25 +233,8 @@ public:
 	*/
 	ObjectType type() const;
 
-	/*! Get the child items of given object.
-	 * 
-	 * This function must only be called to the root item.
-	 * 
-	 *      @param [in] childList The list where the vlnvs of the children are appended.
-	 *      @param [in] owner Identifies the object that's children are searched.
-	 *
-	*/
-	void getChildren(QList<VLNV>& childList, const VLNV& owner) const;
-
-	/*! Get the vlnvs of the items that are this item's children.
-	 *
-	 *      @param [in] itemList The list where the vlnvs are appended to.
-	 *
-	*/
-	void getChildItems(QList<VLNV>& itemList) const;
-
 	/*! Count how many times this component has been instantiated in a containing design.
-	 * 
+	 *
 	 * For items that are not components this function returns -1
 	 *
 	 *      @return The instance count in the containing design.
@@ -310,157 +242,45 @@ public:
 	int instanceCount() const;
 
 	/*! Get the name of the view the design belongs to.
-	 * 
+	 *
 	 * If type() is other than design an empty string is returned.
 	 *
 	 *      @return QString containing the view name.
 	*/
 	QString getViewName() const;
 
-signals:
-
-	//! Send a notification to be printed to user.
-	void noticeMessage(QString const& msg);
-
-	//! Send an error message to be printed to user.
-	void errorMessage(QString const& msg);
-
-protected:
-
-	/*! Count the number of instances for the given vlnv.
-	 *
-	 *      @param [in] componentVLNV The vlnv of the component that's instance count is counted.
-	 *
-	 *      @return The number of instantiation times.
-	*/
-	int countInstances(const VLNV& componentVLNV);
-
 private:
-	//! No copying
-	HierarchyItem(const HierarchyItem& other);
 
-	//! No assignment
-	HierarchyItem& operator=(const HierarchyItem& other);
-
-	/*! Checks if this HierarchyItem already has child for given vlnv.
-	 *
-	 *      @param [in] vlnv Identifies the child.
-	 *
-	 *      @return bool True if child with given vlnv is found.
-	*/
-	bool hasChild(const VLNV& vlnv);
-
-	/*! Parse this hierarchy item to match a component
-	 *
-	 *      @param [in] vlnv The vlnv of the component.
-	 *
-	*/
-	void parseComponent(const VLNV& vlnv);
-
-    void parseCatalog(VLNV const& vlnv);
-
-    /*!
-     *  Finds the referenced design in a component view.
-     *
-     *      @param [in] view   The view whose reference to find.
-     *
-     *      @return The design referenced n the view.
-     */
-    VLNV findDesignReference(QSharedPointer<View> view);
-
-    /*!
-     *  Creates a child item for the given design.
-     *
-     *      @param [in] designVLNV          The design to represent with the child.
-     *      @param [in] implementation      The implementation type of the design.
-     *      @param [in] viewName            The name of the view referencing the design.
-     */
-    void createChildItemForDesign(VLNV const& designVLNV,
-        QString const& viewName);
-
-	/*! Parse this hierarchy item to match a bus definition.
-	 *
-	 *      @param [in] vlnv The vlnv of the bus definition.
-	 *
-	*/
-	void parseBusDefinition(const VLNV& vlnv);
-
-	/*! Parse this hierarchy item to match an abstraction definition.
-	 *
-	 *      @param [in] vlnv The vlnv of the abstraction definition.
-	 *
-	*/
-	void parseAbsDefinition(const VLNV& vlnv);
-
-    /*! Parse this hierarchy item to match a COM definition.
-	 *
-	 *      @param [in] vlnv The vlnv of the COM definition.
-	 *
-	*/
-	void parseComDefinition(const VLNV& vlnv);
-
-    /*! Parse this hierarchy item to match an API definition.
-	 *
-	 *      @param [in] vlnv The vlnv of the API definition.
-	 *
-	*/
-	void parseApiDefinition(const VLNV& vlnv);
-
-	/*! Parse this hierarchy item to match a design.
-	 *
-	 *      @param [in] vlnv The vlnv of the design.
-	*/
-	void parseDesign(const VLNV& vlnv, KactusAttribute::Implementation implementation, QString const& viewName);
-
-    /*!
-     *  Finds the valid component references in a design item.
-     *
-     *      @return The valid VLVN references.
-     */
-    QVector<VLNV> getValidComponentsInDesign(QSharedPointer<Design const> design);
-
-    /*!
-     *  Checks if the given VLNV reference to a component is valid.
-     *
-     *      @param [in] componentVLNV   The VLNV to check.
-     *
-     *      @return True, if the VLVN reference is valid, otherwise false.
-     */
-    bool isValidComponentInstanceVLNV(VLNV const& componentVLNV);
+	//! Create the child items for the references of the node.
+	void createChildren() const;
 
     //-----------------------------------------------------------------------------
     // Data.
     //-----------------------------------------------------------------------------
 
-    //! The VLNV this item represents.
-    VLNV vlnv_;
-
-	//! The component that this hierarhcyItem represents.
-	QSharedPointer<Component const> component_;
-
-	//! The object that manages the library.
-	LibraryInterface* library_;
-
-	//! List of children of this item.
-	QVector<HierarchyItem*> childItems_;
+	//! The document node this item shows.
+	HierarchyNode* node_;
 
 	//! The parent of this item.
 	HierarchyItem* parentItem_;
 
-	//! Specifies the validity of this item.
-	bool isValid_;
+	//! The row of this item in the parent.
+	int row_;
 
-	//! Contains info that tell is this item is contained in some item as child.
-	bool isDuplicate_;
+	//! List of children of this item, created on demand.
+	mutable QVector<HierarchyItem*> childItems_;
 
-	//! Defines the type of this hierarchy item.
-	ObjectType type_;
+	//! Tells if the child items have been created.
+	mutable bool childrenCreated_;
 
-	//! Contains the instance count for the sub items.
-	QMap<VLNV, int> instanceCount_;
+	//! Contains info that tell is this item is contained in some item as child.
+	bool isDuplicate_;
 
 	//! The name of the view a design belongs to.
 	QString viewName_;
+
+	//! The number of instances of the component in the containing design.
+	int instanceCount_;
 };
 
 #endif // HIERARCHYITEM_H
@@ -21,18 +21,37 @@
 #include <QStringBuilder>
 #include <QIcon>
 
+#include <algorithm>
+
+namespace
+{
+    //! Checks if a document of the given type can be added to the model without rebuilding the existing items.
+    bool isAddedIncrementally(VLNV::IPXactType documentType)
+    {
+        return documentType == VLNV::ABSTRACTIONDEFINITION || documentType == VLNV::BUSDEFINITION ||
+            documentType == VLNV::CATALOG || documentType == VLNV::COMPONENT ||
+            documentType == VLNV::APIDEFINITION || documentType == VLNV::COMDEFINITION;
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: HierarchyModel::HierarchyModel()
 //-----------------------------------------------------------------------------
 HierarchyModel::HierarchyModel(LibraryInterface* handler, QObject* parent):
 QAbstractItemModel(parent),
-    rootItem_(new HierarchyItem(handler, this)),
+    graph_(handler),
+    rootItem_(nullptr),
     handler_(handler)
 {
-    connect(rootItem_, SIGNAL(errorMessage(const QString&)),
-        this, SIGNAL(errorMessage(const QString&)), Qt::UniqueConnection);
-    connect(rootItem_, SIGNAL(noticeMessage(const QString&)),
-        this, SIGNAL(noticeMessage(const QString&)), Qt::UniqueConnection);
+    createRootItem();
+}
+
+//-----------------------------------------------------------------------------
+// Function: HierarchyModel::~HierarchyModel()
+//-----------------------------------------------------------------------------
+HierarchyModel::~HierarchyModel()
+{
+    delete rootItem_;
 }
 
 //-----------------------------------------------------------------------------
@@ -42,7 +61,7 @@ void HierarchyModel::onResetModel()
 {
     beginResetModel();
 
-    rootItem_->clear();
+    graph_.clear();
 
     QVector<VLNV> absDefs;
 
@@ -56,7 +75,7 @@ void HierarchyModel::onResetModel()
             documentType == VLNV::CATALOG || documentType == VLNV::COMPONENT ||
             documentType == VLNV::APIDEFINITION || documentType == VLNV::COMDEFINITION)
         {
-            rootItem_->createChild(itemVlnv);
+            graph_.addChild(graph_.root(), graph_.getNode(itemVlnv));
 
             if (documentType == VLNV::ABSTRACTIONDEFINITION)
             {
@@ -71,16 +90,139 @@ void HierarchyModel::onResetModel()
     	QSharedPointer<AbstractionDefinition const> absDef = 
             handler_->getModelReadOnly(absDefVlnv).staticCast<AbstractionDefinition const>();
 
-        for (HierarchyItem* busDefItem : rootItem_->findItems(absDef->getBusType()))
+        HierarchyNode* busDefNode = graph_.findNode(absDef->getBusType());
+        if (busDefNode && busDefNode->type == HierarchyItem::BUSDEFINITION)
         {
-    		busDefItem->createChild(absDefVlnv);
+            graph_.addChild(busDefNode, graph_.findNode(absDefVlnv));
         }
     }
 
-    // Remove the duplicates.
-    rootItem_->cleanUp();
+    createRootItem();
 
     endResetModel();
+
+    for (QString const& message : graph_.takeErrorMessages())
+    {
+        emit errorMessage(message);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: HierarchyModel::onAddVLNV()
+//-----------------------------------------------------------------------------
+void HierarchyModel::onAddVLNV(VLNV const& vlnv)
+{
+    VLNV::IPXactType documentType = vlnv.getType();
+
+    // Designs and configurations are shown under their top components, so the hierarchies must be rebuilt.
+    // The same applies to documents already referenced by the existing hierarchies.
+    HierarchyNode* existingNode = graph_.findNode(vlnv);
+    bool isTopLevel = existingNode && std::any_of(graph_.root()->children.cbegin(),
+        graph_.root()->children.cend(),
+        [existingNode](HierarchyNode::Edge const& edge) { return edge.child == existingNode; });
+
+    if (!isAddedIncrementally(documentType) || (existingNode && !isTopLevel))
+    {
+        onResetModel();
+        return;
+    }
+
+    if (existingNode)
+    {
+        return;
+    }
+
+    HierarchyNode* addedNode = graph_.getNode(vlnv);
+    graph_.addChild(graph_.root(), addedNode);
+
+    int row = rootItem_->getNumberOfChildren();
+    beginInsertRows(QModelIndex(), row, row);
+    rootItem_->createChild(addedNode, QString(), -1);
+    endInsertRows();
+
+    HierarchyItem* addedItem = rootItem_->child(row);
+
+    if (documentType == VLNV::ABSTRACTIONDEFINITION)
+    {
+        QSharedPointer<AbstractionDefinition const> absDef =
+            handler_->getModelReadOnly(vlnv).dynamicCast<AbstractionDefinition const>();
+
+        HierarchyNode* busDefNode = absDef.isNull() ? nullptr : graph_.findNode(absDef->getBusType());
+        if (busDefNode && busDefNode->type == HierarchyItem::BUSDEFINITION)
+        {
+            QVector<HierarchyItem*> busDefItems = rootItem_->findCreatedItems(busDefNode);
+
+            // The existing children must be created before the new reference is added to the shared node.
+            for (HierarchyItem* busDefItem : busDefItems)
+            {
+                busDefItem->getNumberOfChildren();
+            }
+
+            if (graph_.addChild(busDefNode, addedNode))
+            {
+                for (HierarchyItem* busDefItem : busDefItems)
+                {
+                    int childRow = busDefItem->getNumberOfChildren();
+                    beginInsertRows(index(busDefItem), childRow, childRow);
+                    busDefItem->createChild(addedNode, QString(), -1);
+                    endInsertRows();
+                }
+            }
+
+            addedItem->setDuplicate(true);
+        }
+    }
+    else
+    {
+        // Only the new item can contain the existing ones, so the other items need not be compared.
+        QSet<HierarchyNode const*> containedNodes = graph_.findContainedNodes(addedNode);
+        for (int i = 0; i < row; ++i)
+        {
+            HierarchyItem* existingItem = rootItem_->child(i);
+            if (existingItem->isDuplicate() == false && containedNodes.contains(existingItem->node()))
+            {
+                existingItem->setDuplicate(true);
+            }
+        }
+    }
+
+    emit invalidateFilter();
+
+    for (QString const& message : graph_.takeErrorMessages())
+    {
+        emit errorMessage(message);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: HierarchyModel::onAddVLNVs()
+//-----------------------------------------------------------------------------
+void HierarchyModel::onAddVLNVs(QVector<VLNV> const& vlnvs)
+{
+    if (std::all_of(vlnvs.cbegin(), vlnvs.cend(),
+        [](VLNV const& vlnv) { return isAddedIncrementally(vlnv.getType()); }))
+    {
+        // Abstraction definitions are added last to find the bus definitions added at the same time.
+        for (VLNV const& vlnv : vlnvs)
+        {
+            if (vlnv.getType() != VLNV::ABSTRACTIONDEFINITION)
+            {
+                onAddVLNV(vlnv);
+            }
+        }
+
+        for (VLNV const& vlnv : vlnvs)
+        {
+            if (vlnv.getType() == VLNV::ABSTRACTIONDEFINITION)
+            {
+                onAddVLNV(vlnv);
+            }
+        }
+    }
+    else
+    {
+        onResetModel();
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -197,7 +339,7 @@ QModelIndexList HierarchyModel::findIndexes(VLNV const& vlnv)
 {
     QModelIndexList list;
 
-    for (HierarchyItem* item : rootItem_->findItems(vlnv))
+    for (HierarchyItem* item : rootItem_->findItems(vlnv, graph_.findContainingNodes(vlnv)))
     {
     	list.append(index(item));
     }
@@ -693,8 +835,70 @@ void HierarchyModel::onRemoveVLNV(VLNV const& vlnv)
     	return;
     }
 
+    HierarchyNode* removedNode = graph_.findNode(vlnv);
+    if (!removedNode)
+    {
+        return;
+    }
+
+    // The nodes only reachable through the removed node are shown only under its items, so removing the
+    // items of the removed node removes all the items of the nodes deleted from the graph.
+    for (HierarchyItem* removedItem : rootItem_->findCreatedItems(removedNode))
+    {
+        HierarchyItem* parentItem = removedItem->parent();
+        int row = removedItem->row();
+
+        beginRemoveRows(index(parentItem), row, row);
+        parentItem->removeChild(row);
+        endRemoveRows();
+    }
+
+    QVector<HierarchyNode*> parentNodes = removedNode->parents;
+    graph_.removeNode(vlnv);
+
+    // The parents lose a reference and may become invalid.
+    for (HierarchyNode* parentNode : parentNodes)
+    {
+        if (parentNode != graph_.root())
+        {
+            for (HierarchyItem* parentItem : rootItem_->findCreatedItems(parentNode))
+            {
+                QModelIndex parentIndex = index(parentItem);
+                emit dataChanged(parentIndex, parentIndex.sibling(parentIndex.row(), HierarchyModel::INSTANCE_COLUMN));
+            }
+        }
+    }
+
+    // The top level documents only referenced by the removed hierarchy are no longer duplicates.
+    QSet<HierarchyNode const*> referencedNodes = graph_.findReferencedNodes();
+    for (int i = 0; i < rootItem_->getNumberOfChildren(); ++i)
+    {
+        HierarchyItem* item = rootItem_->child(i);
+        item->setDuplicate(referencedNodes.contains(item->node()));
+    }
+
+    emit invalidateFilter();
+}
+
+//-----------------------------------------------------------------------------
+// Function: HierarchyModel::onRemoveVLNVs()
+//-----------------------------------------------------------------------------
+void HierarchyModel::onRemoveVLNVs(QVector<VLNV> const& vlnvs)
+{
+    if (vlnvs.isEmpty())
+    {
+        return;
+    }
+
     beginResetModel();
-    rootItem_->removeItems(vlnv);
+    for (VLNV const& vlnv : vlnvs)
+    {
+        if (vlnv.isValid())
+        {
+            graph_.removeNode(vlnv);
+        }
+    }
+    createRootItem();
     endResetModel();
 }
 
@@ -703,7 +907,7 @@ void HierarchyModel::onRemoveVLNV(VLNV const& vlnv)
 //-----------------------------------------------------------------------------
 int HierarchyModel::referenceCount(VLNV const& vlnv) const
 {
-    return rootItem_->referenceCount(vlnv);
+    return graph_.referenceCount(vlnv);
 }
 
 //-----------------------------------------------------------------------------
@@ -711,10 +915,18 @@ int HierarchyModel::referenceCount(VLNV const& vlnv) const
 //-----------------------------------------------------------------------------
 void HierarchyModel::onDocumentUpdated(VLNV const& vlnv)
 {
-    bool isValid = handler_->isValid(vlnv);
-    for (HierarchyItem* updatedItem : rootItem_->findItems(vlnv))
+    HierarchyNode* updatedNode = graph_.findNode(vlnv);
+    if (!updatedNode)
+    {
+        return;
+    }
+
+    // The node is shared, so only the items already shown need to be repainted.
+    updatedNode->isValid = handler_->isValid(vlnv);
+    for (HierarchyItem* updatedItem : rootItem_->findCreatedItems(updatedNode))
     {
-        updatedItem->setValidity(isValid);
+        QModelIndex updatedIndex = index(updatedItem);
+        emit dataChanged(updatedIndex, updatedIndex.sibling(updatedIndex.row(), HierarchyModel::INSTANCE_COLUMN));
     }
 }
 
@@ -723,7 +935,7 @@ void HierarchyModel::onDocumentUpdated(VLNV const& vlnv)
 //-----------------------------------------------------------------------------
 int HierarchyModel::getOwners(QList<VLNV>& list, VLNV const& vlnvToSearch) const
 {
-    rootItem_->getOwners(list, vlnvToSearch);
+    graph_.getOwners(list, vlnvToSearch);
     return list.size();
 }
 
@@ -732,7 +944,24 @@ int HierarchyModel::getOwners(QList<VLNV>& list, VLNV const& vlnvToSearch) const
 //-----------------------------------------------------------------------------
 void HierarchyModel::getChildren(QList<VLNV>& childList, VLNV const& owner)
 {
-    rootItem_->getChildren(childList, owner);
+    graph_.getChildren(childList, owner);
+}
+
+//-----------------------------------------------------------------------------
+// Function: HierarchyModel::createRootItem()
+//-----------------------------------------------------------------------------
+void HierarchyModel::createRootItem()
+{
+    delete rootItem_;
+    rootItem_ = new HierarchyItem(graph_.root());
+
+    // Top level documents contained in other hierarchies are marked as duplicates.
+    QSet<HierarchyNode const*> referencedNodes = graph_.findReferencedNodes();
+    for (int i = 0; i < rootItem_->getNumberOfChildren(); ++i)
+    {
+        HierarchyItem* item = rootItem_->child(i);
+        item->setDuplicate(referencedNodes.contains(item->node()));
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -13,9 +13,11 @@
 #define HIERARCHYMODEL_H
 
 #include "hierarchyitem.h"
+#include "HierarchyGraph.h"
 
 #include <QAbstractItemModel>
 #include <QSharedPointer>
+#include <QVector>
 
 class LibraryInterface;
 class LibraryData;
@@ -45,7 +47,7 @@ public:
     HierarchyModel(LibraryInterface* handler, QObject* parent);
     
     //! The destructor
-    virtual ~HierarchyModel() = default;
+    virtual ~HierarchyModel();
 
     /*! Get the data for the headers of this model.
      *
@@ -170,6 +172,22 @@ public slots:
     //! Reset the model
     void onResetModel();
 
+    /*! Add a new document to the model without rebuilding the existing items.
+     *
+     * Documents that may change the existing hierarchies, e.g. designs, cause a reset of the model.
+     *
+     *      @param [in] vlnv Identifies the added document.
+     */
+    void onAddVLNV(VLNV const& vlnv);
+
+    /*! Add several new documents to the model.
+     *
+     * The model is reset at most once, if any of the documents may change the existing hierarchies.
+     *
+     *      @param [in] vlnvs Identifies the added documents.
+     */
+    void onAddVLNVs(QVector<VLNV> const& vlnvs);
+
     //! Open the selected hierarchical design
     void onOpenDesign(QModelIndex const& index);
 
@@ -214,6 +232,13 @@ public slots:
 
     //! Remove the specified vlnv from the tree.
     void onRemoveVLNV(VLNV const& vlnv);
+
+    /*!
+     *  Removes the given documents from the tree. The tree is rebuilt once for all the documents.
+     *
+     *      @param [in] vlnvs   The documents to remove.
+     */
+    void onRemoveVLNVs(QVector<VLNV> const& vlnvs);
     
     /*! This function should be called when an IP-XACT document has changed.
      * 
@@ -292,6 +317,12 @@ private:
     //! No assignment
     HierarchyModel& operator=(const HierarchyModel& other);
 
+    //! Create the root item for the top level documents in the hierarchy graph.
+    void createRootItem();
+
+    //! The documents and their references shared by the hierarchy items.
+    HierarchyGraph graph_;
+
     //! The root item of the model
     HierarchyItem* rootItem_;
 
@@ -0,0 +1,425 @@
+//-----------------------------------------------------------------------------
+// File: LibraryFileWatcher.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: Kactus2 team
+// Date: 19.10.2026
+//
+// Description:
+// Watches the library files for changes made outside the library.
+//-----------------------------------------------------------------------------
+
+#include "LibraryFileWatcher.h"
+
+#include <QFileInfo>
+#include <QRunnable>
+#include <QStorageInfo>
+
+namespace
+{
+    //! File systems on which the system watches are unreliable.
+    const QSet<QByteArray> NETWORK_FILE_SYSTEMS =
+    {
+        QByteArrayLiteral("nfs"),
+        QByteArrayLiteral("nfs4"),
+        QByteArrayLiteral("cifs"),
+        QByteArrayLiteral("smbfs"),
+        QByteArrayLiteral("smb3"),
+        QByteArrayLiteral("afs"),
+        QByteArrayLiteral("9p"),
+        QByteArrayLiteral("fuse.sshfs")
+    };
+}
+
+//-----------------------------------------------------------------------------
+//! Reads the modification times of the polled files in a background thread.
+//-----------------------------------------------------------------------------
+class LibraryFileWatcher::PollTask : public QRunnable
+{
+public:
+
+    PollTask(LibraryFileWatcher* watcher, QSharedPointer<PollResult> result):
+    watcher_(watcher),
+    result_(result)
+    {
+
+    }
+
+    void run() override
+    {
+        for (auto file = result_->knownTimes.cbegin(); file != result_->knownTimes.cend(); ++file)
+        {
+            result_->currentTimes.insert(file.key(), QFileInfo(file.key()).lastModified());
+        }
+
+        // The watcher waits for the poll before it is destroyed.
+        QMetaObject::invokeMethod(watcher_, "onPollFinished", Qt::QueuedConnection);
+    }
+
+private:
+
+    //! The watcher to report to.
+    LibraryFileWatcher* watcher_;
+
+    //! The polled files.
+    QSharedPointer<PollResult> result_;
+};
+
+//-----------------------------------------------------------------------------
+// Function: LibraryFileWatcher::LibraryFileWatcher()
+//-----------------------------------------------------------------------------
+LibraryFileWatcher::LibraryFileWatcher(QObject* parent):
+QObject(parent),
+systemWatcher_(this),
+mode_(DIRECTORIES),
+watchedFiles_(),
+polledDirectories_(),
+pollTimer_(this),
+runningPoll_(),
+pollThread_()
+{
+    pollThread_.setMaxThreadCount(1);
+
+    pollTimer_.setInterval(5000);
+    pollTimer_.setTimerType(Qt::CoarseTimer);
+
+    connect(&systemWatcher_, SIGNAL(fileChanged(QString const&)),
+        this, SLOT(onFileChanged(QString const&)), Qt::UniqueConnection);
+    connect(&systemWatcher_, SIGNAL(directoryChanged(QString const&)),
+        this, SLOT(onDirectoryChanged(QString const&)), Qt::UniqueConnection);
+    connect(&pollTimer_, SIGNAL(timeout()), this, SLOT(onPollTimeout()), Qt::UniqueConnection);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryFileWatcher::~LibraryFileWatcher()
+//-----------------------------------------------------------------------------
+LibraryFileWatcher::~LibraryFileWatcher()
+{
+    pollThread_.waitForDone();
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryFileWatcher::setWatchMode()
+//-----------------------------------------------------------------------------
+void LibraryFileWatcher::setWatchMode(WatchMode mode)
+{
+    if (mode == mode_)
+    {
+        return;
+    }
+
+    QStringList watchedPaths = files();
+    clear();
+
+    mode_ = mode;
+    addPaths(watchedPaths);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryFileWatcher::setPollingInterval()
+//-----------------------------------------------------------------------------
+void LibraryFileWatcher::setPollingInterval(int interval)
+{
+    pollTimer_.setInterval(qMax(interval, 0));
+    updatePolling();
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryFileWatcher::addPath()
+//-----------------------------------------------------------------------------
+void LibraryFileWatcher::addPath(QString const& path)
+{
+    addPaths(QStringList(path));
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryFileWatcher::addPaths()
+//-----------------------------------------------------------------------------
+void LibraryFileWatcher::addPaths(QStringList const& paths)
+{
+    if (paths.isEmpty())
+    {
+        return;
+    }
+
+    QStringList addedDirectories;
+    for (QString const& path : paths)
+    {
+        QFileInfo fileInfo(path);
+        QString directory = fileInfo.absolutePath();
+
+        QHash<QString, QDateTime>& directoryFiles = watchedFiles_[directory];
+        if (directoryFiles.isEmpty())
+        {
+            addedDirectories.append(directory);
+        }
+
+        directoryFiles.insert(path, fileInfo.lastModified());
+    }
+
+    if (mode_ == FILES)
+    {
+        for (QString const& directory : addedDirectories)
+        {
+            if (isOnNetworkFileSystem(directory))
+            {
+                pollDirectory(directory);
+            }
+        }
+
+        QStringList systemWatchedPaths;
+        for (QString const& path : paths)
+        {
+            if (polledDirectories_.contains(QFileInfo(path).absolutePath()) == false)
+            {
+                systemWatchedPaths.append(path);
+            }
+        }
+
+        // The system watches may run out, e.g. when the inotify watch limit is reached.
+        if (systemWatchedPaths.isEmpty() == false)
+        {
+            for (QString const& failedPath : systemWatcher_.addPaths(systemWatchedPaths))
+            {
+                pollDirectory(QFileInfo(failedPath).absolutePath());
+            }
+        }
+    }
+    else
+    {
+        for (QString const& directory : addedDirectories)
+        {
+            watchDirectory(directory);
+        }
+    }
+
+    updatePolling();
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryFileWatcher::removePath()
+//-----------------------------------------------------------------------------
+void LibraryFileWatcher::removePath(QString const& path)
+{
+    QString directory = QFileInfo(path).absolutePath();
+
+    auto directoryFiles = watchedFiles_.find(directory);
+    if (directoryFiles == watchedFiles_.end() || directoryFiles->remove(path) == 0)
+    {
+        return;
+    }
+
+    if (mode_ == FILES)
+    {
+        systemWatcher_.removePath(path);
+    }
+
+    if (directoryFiles->isEmpty())
+    {
+        watchedFiles_.erase(directoryFiles);
+
+        if (polledDirectories_.remove(directory) == false && mode_ == DIRECTORIES)
+        {
+            systemWatcher_.removePath(directory);
+        }
+    }
+
+    updatePolling();
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryFileWatcher::clear()
+//-----------------------------------------------------------------------------
+void LibraryFileWatcher::clear()
+{
+    QStringList systemWatches = systemWatcher_.files() + systemWatcher_.directories();
+    if (systemWatches.isEmpty() == false)
+    {
+        systemWatcher_.removePaths(systemWatches);
+    }
+
+    watchedFiles_.clear();
+    polledDirectories_.clear();
+    pollTimer_.stop();
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryFileWatcher::files()
+//-----------------------------------------------------------------------------
+QStringList LibraryFileWatcher::files() const
+{
+    QStringList watchedPaths;
+    for (QHash<QString, QDateTime> const& directoryFiles : watchedFiles_)
+    {
+        watchedPaths.append(directoryFiles.keys());
+    }
+
+    return watchedPaths;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryFileWatcher::onFileChanged()
+//-----------------------------------------------------------------------------
+void LibraryFileWatcher::onFileChanged(QString const& path)
+{
+    QString directory = QFileInfo(path).absolutePath();
+
+    auto directoryFiles = watchedFiles_.find(directory);
+    if (directoryFiles == watchedFiles_.end() || directoryFiles->contains(path) == false)
+    {
+        return;
+    }
+
+    // The change is recorded, so polling the directory does not report it again.
+    QFileInfo fileInfo(path);
+    directoryFiles->insert(path, fileInfo.lastModified());
+
+    // The system stops watching a replaced or removed file, so the watch is renewed for the replacing file.
+    if (polledDirectories_.contains(directory) == false)
+    {
+        systemWatcher_.removePath(path);
+        if (fileInfo.exists() == false || systemWatcher_.addPath(path) == false)
+        {
+            pollDirectory(directory);
+            updatePolling();
+        }
+    }
+
+    emit fileChanged(path);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryFileWatcher::onDirectoryChanged()
+//-----------------------------------------------------------------------------
+void LibraryFileWatcher::onDirectoryChanged(QString const& directory)
+{
+    auto directoryFiles = watchedFiles_.find(directory);
+    if (directoryFiles == watchedFiles_.end())
+    {
+        return;
+    }
+
+    QStringList changedFiles;
+    for (auto file = directoryFiles->begin(); file != directoryFiles->end(); ++file)
+    {
+        QDateTime lastModified = QFileInfo(file.key()).lastModified();
+        if (lastModified != file.value())
+        {
+            file.value() = lastModified;
+            changedFiles.append(file.key());
+        }
+    }
+
+    for (QString const& path : changedFiles)
+    {
+        emit fileChanged(path);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryFileWatcher::onPollTimeout()
+//-----------------------------------------------------------------------------
+void LibraryFileWatcher::onPollTimeout()
+{
+    // A slow file system may take longer to read than the polling interval.
+    if (runningPoll_)
+    {
+        return;
+    }
+
+    runningPoll_ = QSharedPointer<PollResult>(new PollResult());
+    for (QString const& directory : polledDirectories_)
+    {
+        runningPoll_->knownTimes.unite(watchedFiles_.value(directory));
+    }
+
+    pollThread_.start(new PollTask(this, runningPoll_));
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryFileWatcher::onPollFinished()
+//-----------------------------------------------------------------------------
+void LibraryFileWatcher::onPollFinished()
+{
+    QSharedPointer<PollResult> finishedPoll = runningPoll_;
+    runningPoll_.clear();
+
+    if (!finishedPoll)
+    {
+        return;
+    }
+
+    QStringList changedFiles;
+    for (auto file = finishedPoll->currentTimes.cbegin(); file != finishedPoll->currentTimes.cend(); ++file)
+    {
+        QDateTime knownTime = finishedPoll->knownTimes.value(file.key());
+        if (file.value() == knownTime)
+        {
+            continue;
+        }
+
+        // The files removed from the watch or changed since the poll started are left out.
+        auto directoryFiles = watchedFiles_.find(QFileInfo(file.key()).absolutePath());
+        if (directoryFiles != watchedFiles_.end() && directoryFiles->contains(file.key()) &&
+            directoryFiles->value(file.key()) == knownTime)
+        {
+            directoryFiles->insert(file.key(), file.value());
+            changedFiles.append(file.key());
+        }
+    }
+
+    for (QString const& path : changedFiles)
+    {
+        emit fileChanged(path);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryFileWatcher::watchDirectory()
+//-----------------------------------------------------------------------------
+void LibraryFileWatcher::watchDirectory(QString const& directory)
+{
+    // The system watches may also run out, e.g. when the inotify watch limit is reached.
+    if (isOnNetworkFileSystem(directory) || systemWatcher_.addPath(directory) == false)
+    {
+        pollDirectory(directory);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryFileWatcher::pollDirectory()
+//-----------------------------------------------------------------------------
+void LibraryFileWatcher::pollDirectory(QString const& directory)
+{
+    polledDirectories_.insert(directory);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryFileWatcher::updatePolling()
+//-----------------------------------------------------------------------------
+void LibraryFileWatcher::updatePolling()
+{
+    if (polledDirectories_.isEmpty() == false && pollTimer_.interval() > 0)
+    {
+        if (pollTimer_.isActive() == false)
+        {
+            pollTimer_.start();
+        }
+    }
+    else
+    {
+        pollTimer_.stop();
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryFileWatcher::isOnNetworkFileSystem()
+//-----------------------------------------------------------------------------
+bool LibraryFileWatcher::isOnNetworkFileSystem(QString const& directory)
+{
+    QStorageInfo storage(directory);
+
+    // Windows network shares are identified by their UNC root path.
+    return NETWORK_FILE_SYSTEMS.contains(storage.fileSystemType()) ||
+        storage.rootPath().startsWith(QLatin1String("//"));
+}
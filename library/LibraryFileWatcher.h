@@ -0,0 +1,210 @@
+//-----------------------------------------------------------------------------
+// File: LibraryFileWatcher.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: Kactus2 team
+// Date: 19.10.2026
+//
+// Description:
+// Watches the library files for changes made outside the library.
+//-----------------------------------------------------------------------------
+
+#ifndef LIBRARYFILEWATCHER_H
+#define LIBRARYFILEWATCHER_H
+
+#include <QDateTime>
+#include <QFileSystemWatcher>
+#include <QHash>
+#include <QObject>
+#include <QSet>
+#include <QSharedPointer>
+#include <QString>
+#include <QStringList>
+#include <QThreadPool>
+#include <QTimer>
+
+//-----------------------------------------------------------------------------
+//! Watches the library files for changes made outside the library.
+//!
+//! In the directory mode, which is the default, the directories of the files are watched instead of each
+//! file, so a large library needs only one system watch per directory. A changed directory is resolved into
+//! the changed files by comparing the modification times of the watched files in it. A directory watch
+//! reports the files created, removed, replaced or renamed in it, but not necessarily the files written in
+//! place, so the file mode is kept for the users that need them reported on every platform.
+//!
+//! In the file mode, each file has its own system watch.
+//!
+//! In both modes, the directories that cannot be watched are polled periodically instead. These are the
+//! directories on a network file system and the directories whose watches failed, e.g. when the inotify watch
+//! limit is reached. The polled files are read in a background thread, so slow file systems do not block the
+//! user interface.
+//-----------------------------------------------------------------------------
+class LibraryFileWatcher : public QObject
+{
+    Q_OBJECT
+
+public:
+
+    //! The ways to watch the files.
+    enum WatchMode
+    {
+        FILES,          //!< Each file is watched separately.
+        DIRECTORIES     //!< The directories containing the files are watched.
+    };
+
+    /*!
+     *  The constructor.
+     *
+     *      @param [in] parent  The owner of the watcher.
+     */
+    explicit LibraryFileWatcher(QObject* parent = nullptr);
+
+    //! The destructor.
+    virtual ~LibraryFileWatcher();
+
+    // No copying. No assignments.
+    LibraryFileWatcher(LibraryFileWatcher const& rhs) = delete;
+    LibraryFileWatcher& operator=(LibraryFileWatcher const& rhs) = delete;
+
+    /*!
+     *  Sets the way to watch the files. The files already watched are watched in the new mode.
+     *
+     *      @param [in] mode    The mode to set.
+     */
+    void setWatchMode(WatchMode mode);
+
+    /*!
+     *  Sets the interval for polling the directories.
+     *
+     *      @param [in] interval    The polling interval in milliseconds. Zero disables the polling.
+     */
+    void setPollingInterval(int interval);
+
+    /*!
+     *  Starts watching the given file.
+     *
+     *      @param [in] path    The path of the file.
+     */
+    void addPath(QString const& path);
+
+    /*!
+     *  Starts watching the given files.
+     *
+     *      @param [in] paths   The paths of the files.
+     */
+    void addPaths(QStringList const& paths);
+
+    /*!
+     *  Stops watching the given file.
+     *
+     *      @param [in] path    The path of the file.
+     */
+    void removePath(QString const& path);
+
+    //! Stops watching all the files.
+    void clear();
+
+    /*!
+     *  Gets the watched files.
+     *
+     *      @return The paths of the watched files.
+     */
+    QStringList files() const;
+
+signals:
+
+    //! Emitted when a watched file has been modified, replaced or removed.
+    void fileChanged(QString const& path);
+
+private slots:
+
+    /*!
+     *  Records the new modification time of a changed file reported by the system.
+     *
+     *      @param [in] path    The path of the changed file.
+     */
+    void onFileChanged(QString const& path);
+
+    /*!
+     *  Finds the changed files in a changed directory.
+     *
+     *      @param [in] directory   The changed directory.
+     */
+    void onDirectoryChanged(QString const& directory);
+
+    //! Starts reading the modification times of the files in the polled directories.
+    void onPollTimeout();
+
+    //! Reports the changed files found by the finished poll.
+    void onPollFinished();
+
+private:
+
+    //! Reads the modification times of the polled files in a background thread.
+    class PollTask;
+
+    //! The modification times of the polled files.
+    struct PollResult
+    {
+        //! The modification times of the files when the poll was started.
+        QHash<QString, QDateTime> knownTimes;
+
+        //! The modification times of the files read by the poll.
+        QHash<QString, QDateTime> currentTimes;
+    };
+
+    /*!
+     *  Starts watching the given directory or polling it, if it cannot be watched.
+     *
+     *      @param [in] directory   The directory to watch.
+     */
+    void watchDirectory(QString const& directory);
+
+    /*!
+     *  Starts polling the given directory.
+     *
+     *      @param [in] directory   The directory to poll.
+     */
+    void pollDirectory(QString const& directory);
+
+    /*!
+     *  Starts or stops the polling depending on if there are directories to poll.
+     */
+    void updatePolling();
+
+    /*!
+     *  Checks if the given directory is on a network file system.
+     *
+     *      @param [in] directory   The directory to check.
+     *
+     *      @return True, if the directory is on a network file system, otherwise false.
+     */
+    static bool isOnNetworkFileSystem(QString const& directory);
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The system watcher for the files or the directories.
+    QFileSystemWatcher systemWatcher_;
+
+    //! The current watch mode.
+    WatchMode mode_;
+
+    //! The modification times of the watched files by directory. A removed file has an invalid time.
+    QHash<QString, QHash<QString, QDateTime> > watchedFiles_;
+
+    //! The directories that are polled, because the system cannot watch them or their files.
+    QSet<QString> polledDirectories_;
+
+    //! Timer for polling the directories.
+    QTimer pollTimer_;
+
+    //! The result of the running poll, or null if no poll is running.
+    QSharedPointer<PollResult> runningPoll_;
+
+    //! The thread reading the polled files.
+    QThreadPool pollThread_;
+};
+
+#endif // LIBRARYFILEWATCHER_H
@@ -198,16 +198,14 @@ bool LibraryFilter::hasEmptyVLNVfilter() const
 //-----------------------------------------------------------------------------
 // Function: LibraryFilter::checkFirmness()
 //-----------------------------------------------------------------------------
-bool LibraryFilter::checkFirmness(QSharedPointer<Component const> component) const
+bool LibraryFilter::checkFirmness(DocumentMetadata const& component) const
 {
-	Q_ASSERT(component);
-
-    if (component->getImplementation() == KactusAttribute::SW)
+    if (component.implementation == KactusAttribute::SW)
     {
         return true;
     }
 
-    KactusAttribute::Firmness componentFirmness = component->getFirmness();
+    KactusAttribute::Firmness componentFirmness = component.firmness;
     if (componentFirmness == KactusAttribute::TEMPLATE)
     {
         return firmness_.templates_;
@@ -229,15 +227,13 @@ bool LibraryFilter::checkFirmness(QSharedPointer<Component const> component) con
 //-----------------------------------------------------------------------------
 // Function: LibraryFilter::checkImplementation()
 //-----------------------------------------------------------------------------
-bool LibraryFilter::checkImplementation(QSharedPointer<Component const> component) const
+bool LibraryFilter::checkImplementation(DocumentMetadata const& component) const
 {
-    Q_ASSERT(component);
-
-    KactusAttribute::Implementation componentImplementation = component->getImplementation();
+    KactusAttribute::Implementation componentImplementation = component.implementation;
     if (componentImplementation == KactusAttribute::HW)
     {
         // if the HW component contains system views then it should be considered also as system
-        if (component->hasSystemViews())
+        if (component.hasSystemViews)
         {
             return implementation_.hw_ || implementation_.system_;
         }
@@ -262,16 +258,14 @@ bool LibraryFilter::checkImplementation(QSharedPointer<Component const> componen
 //-----------------------------------------------------------------------------
 // Function: LibraryFilter::checkHierarchy()
 //-----------------------------------------------------------------------------
-bool LibraryFilter::checkHierarchy(QSharedPointer<Component const> component) const
+bool LibraryFilter::checkHierarchy(DocumentMetadata const& component) const
 {
-	Q_ASSERT(component);
-
-    if (component->getImplementation() == KactusAttribute::SW)
+    if (component.implementation == KactusAttribute::SW)
     {
         return true;
     }
 
-    KactusAttribute::ProductHierarchy componentHierarchy = component->getHierarchy();
+    KactusAttribute::ProductHierarchy componentHierarchy = component.hierarchy;
     if (componentHierarchy == KactusAttribute::FLAT)
     {
         return hierarchy_.flat_;
@@ -305,7 +299,7 @@ bool LibraryFilter::checkHierarchy(QSharedPointer<Component const> component) co
 //-----------------------------------------------------------------------------
 // Function: LibraryFilter::checkTags()
 //-----------------------------------------------------------------------------
-bool LibraryFilter::checkTags(QSharedPointer<Document const> document) const
+bool LibraryFilter::checkTags(DocumentMetadata const& document) const
 {
     int tagCount = tags_.size();
     if (tagCount == 0)
@@ -313,7 +307,7 @@ bool LibraryFilter::checkTags(QSharedPointer<Document const> document) const
         return true;
     }
 
-    QVector<TagData> documentTags = document->getTags();
+    QVector<TagData> const& documentTags = document.tags;
     if (documentTags.size() < tagCount)
     {
         return false;
@@ -338,9 +332,9 @@ bool LibraryFilter::checkTags(QSharedPointer<Document const> document) const
 //-----------------------------------------------------------------------------
 // Function: LibraryFilter::documentContainsTag()
 //-----------------------------------------------------------------------------
-bool LibraryFilter::documentContainsTag(QSharedPointer<Document const> document, TagData const& tag) const
+bool LibraryFilter::documentContainsTag(DocumentMetadata const& document, TagData const& tag) const
 {
-    for (auto documentTag : document->getTags())
+    for (auto const& documentTag : document.tags)
     {
         if (documentTag.name_ == tag.name_ && documentTag.color_ == tag.color_)
         {
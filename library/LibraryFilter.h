@@ -14,6 +14,7 @@
 
 #include <common/utils.h>
 
+#include <IPXACTmodels/common/DocumentMetadata.h>
 #include <IPXACTmodels/common/TagData.h>
 #include <IPXACTmodels/Component/Component.h>
 #include <IPXACTmodels/kactusExtensions/KactusAttribute.h>
@@ -122,23 +123,23 @@ protected:
      */
     bool hasEmptyVLNVfilter() const;
 
-    //! Check the firmness matching.
-	bool checkFirmness(QSharedPointer<Component const> component) const;
+    //! Check the firmness matching of a component.
+	bool checkFirmness(DocumentMetadata const& component) const;
 
-	//! Check the implementation matching.
-	bool checkImplementation(QSharedPointer<Component const> component) const;
+	//! Check the implementation matching of a component.
+	bool checkImplementation(DocumentMetadata const& component) const;
 
-	//! Check the hierarchy matching.
-	bool checkHierarchy(QSharedPointer<Component const> component) const;
+	//! Check the hierarchy matching of a component.
+	bool checkHierarchy(DocumentMetadata const& component) const;
 
     /*!
      *  Check the tag matching of the selected document.
      *
-     *      @param [in] document    The selected document.
+     *      @param [in] document    The metadata of the selected document.
      *
      *      @return True, if the tags match the visible tags, false otherwise.
      */
-    bool checkTags(QSharedPointer<Document const> document) const;
+    bool checkTags(DocumentMetadata const& document) const;
 
 	/*! Check the list of vlnvs if they match the search rules
 	 *
@@ -166,12 +167,12 @@ private:
     /*!
      *  Check if a document contains the selected tag.
      *
-     *      @param [in] document    The selected document.
+     *      @param [in] document    The metadata of the selected document.
      *      @param [in] tag         The selected tag.
      *
      *      @return True, if the selected document contains the selected tag, false otherwise.
      */
-    bool documentContainsTag(QSharedPointer<Document const> document, TagData const& tag) const;
+    bool documentContainsTag(DocumentMetadata const& document, TagData const& tag) const;
 
     //-----------------------------------------------------------------------------
     // Data.
@@ -18,6 +18,7 @@
 
 #include <library/ItemExporter.h>
 
+#include <common/Profiler.h>
 #include <common/ui/MessageMediator.h>
 
 #include <common/dialogs/newObjectDialog/newobjectdialog.h>
@@ -41,16 +42,46 @@
 
 #include <IPXACTmodels/common/VLNV.h>
 
+#include <QCryptographicHash>
 #include <QFile>
 #include <QFileInfo>
 #include <QSharedPointer>
 #include <QList>
 #include <QMap>
 #include <QMessageBox>
+#include <QSettings>
+#include <QSet>
 #include <QString>
 #include <QStringList>
 #include <QTimer>
 
+namespace
+{
+    //-----------------------------------------------------------------------------
+    // Function: metadataCachePath()
+    //-----------------------------------------------------------------------------
+    QString metadataCachePath()
+    {
+        return QFileInfo(QSettings().fileName()).absolutePath() + QStringLiteral("/LibraryMetadata.cache");
+    }
+
+    //-----------------------------------------------------------------------------
+    // Function: fileContentHash()
+    //-----------------------------------------------------------------------------
+    QByteArray fileContentHash(QString const& path)
+    {
+        QFile file(path);
+        if (file.open(QIODevice::ReadOnly) == false)
+        {
+            return QByteArray();
+        }
+
+        QCryptographicHash hash(QCryptographicHash::Sha1);
+        hash.addData(&file);
+        return hash.result();
+    }
+};
+
 //-----------------------------------------------------------------------------
 // Function: LibraryHandler::LibraryHandler()
 //-----------------------------------------------------------------------------
@@ -61,20 +92,55 @@ QObject(parent),
     fileAccess_(messageChannel),
     loader_(messageChannel),
     documentCache_(),
+    sortedVLNVs_(),
+    sortedVLNVsValid_(false),
+    cachedPaths_(),
+    contentHashes_(),
+    metadataCache_(metadataCachePath()),
     urlTester_(Utils::URL_VALIDITY_REG_EXP, this),
     validator_(this),
     treeModel_(new LibraryTreeModel(this, this)),
     hierarchyModel_(new HierarchyModel(this, this)),
     integrityWidget_(0),
-    saveInProgress_(false),
+    saveInProgress_(0),
+    saveExecutor_(),
+    addedInSave_(),
+    replacedInSave_(),
     fileWatch_(this),
     itemExporter_(new ItemExporter(messageChannel, this, fileAccess_, parentWidget, this)),    checkResults_(),
-    updatedPaths_()
+    changedPaths_(),
+    changeTimer_(this),
+    modelsDeferred_(false)
 {
     // create the connections between models and library handler
     syncronizeModels();
     connect(&fileWatch_, SIGNAL(fileChanged(QString const&)),
             this, SLOT(onFileChangedOnDisk(QString const&)), Qt::UniqueConnection);
+
+    // Watching the directories keeps the number of system watches low. Watching each file also reports the
+    // files written in place on every platform.
+    QSettings settings;
+    if (settings.value(QStringLiteral("Library/WatchDirectories"), true).toBool() == false)
+    {
+        fileWatch_.setWatchMode(LibraryFileWatcher::FILES);
+    }
+    fileWatch_.setPollingInterval(settings.value(QStringLiteral("Library/PollingInterval"), 5000).toInt());
+
+    // Wait to skip the time it takes to remove the file and rewrite it on save.
+    changeTimer_.setSingleShot(true);
+    changeTimer_.setInterval(100);
+    changeTimer_.setTimerType(Qt::CoarseTimer);
+    connect(&changeTimer_, SIGNAL(timeout()), this, SLOT(processFileChanges()), Qt::UniqueConnection);
+
+    metadataCache_.load();
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::~LibraryHandler()
+//-----------------------------------------------------------------------------
+LibraryHandler::~LibraryHandler()
+{
+    metadataCache_.save();
 }
 
 //-----------------------------------------------------------------------------
@@ -128,7 +194,15 @@ QSharedPointer<Document const> LibraryHandler::getModelReadOnly(VLNV const& vlnv
 //-----------------------------------------------------------------------------
 QList<VLNV> LibraryHandler::getAllVLNVs() const
 {
-    return documentCache_.keys();
+    // The VLNVs are listed in the same order regardless of the hashing.
+    if (sortedVLNVsValid_ == false)
+    {
+        sortedVLNVs_ = documentCache_.keys();
+        std::sort(sortedVLNVs_.begin(), sortedVLNVs_.end());
+        sortedVLNVsValid_ = true;
+    }
+
+    return sortedVLNVs_;
 }
 
 //-----------------------------------------------------------------------------
@@ -177,9 +251,16 @@ bool LibraryHandler::writeModelToFile(QString const& path, QSharedPointer<Docume
         return false;
     }
 
-    // the hierarchy model must be re-built
-    hierarchyModel_->onResetModel();
-    treeModel_->onAddVLNV(vlnv);
+    // Only the new item is added to the models, unless they are built later on demand.
+    if (saveInProgress_ > 0)
+    {
+        addedInSave_.append(vlnv);
+    }
+    else if (modelsDeferred_ == false)
+    {
+        hierarchyModel_->onAddVLNV(vlnv);
+        treeModel_->onAddVLNV(vlnv);
+    }
     
     return true;
 }
@@ -189,7 +270,19 @@ bool LibraryHandler::writeModelToFile(QString const& path, QSharedPointer<Docume
 //-----------------------------------------------------------------------------
 bool LibraryHandler::writeModelToFile(QSharedPointer<Document> model)
 {
-    return addObject(model, getPath(model->getVlnv()));
+    if (addObject(model, getPath(model->getVlnv())) == false)
+    {
+        return false;
+    }
+
+    if (saveInProgress_ == 0 && modelsDeferred_ == false)
+    {
+        VLNV const& vlnv = model->getVlnv();
+        treeModel_->onDocumentUpdated(vlnv);
+        hierarchyModel_->onDocumentUpdated(vlnv);
+    }
+
+    return true;
 }
 
 //-----------------------------------------------------------------------------
@@ -206,6 +299,19 @@ void LibraryHandler::searchForIPXactFiles()
     resetModels();
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::indexIPXactFiles()
+//-----------------------------------------------------------------------------
+void LibraryHandler::indexIPXactFiles()
+{
+    clearCache();
+
+    // Short runs do not react to file changes, so watching every file in the library is not needed.
+    loadAvailableVLNVs(false);
+
+    modelsDeferred_ = true;
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryHandler::getNeededVLNVs()
 //-----------------------------------------------------------------------------
@@ -262,6 +368,7 @@ void LibraryHandler::getDependencyFiles(VLNV const& vlnv, QStringList& list)
 //-----------------------------------------------------------------------------
 LibraryItem const* LibraryHandler::getTreeRoot() const
 {
+    buildDeferredModels();
     return treeModel_->getRoot();
 }
 
@@ -279,11 +386,43 @@ VLNV::IPXactType LibraryHandler::getDocumentType(VLNV const& vlnv)
     return it.key().getType();
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::getMetadata()
+//-----------------------------------------------------------------------------
+DocumentMetadata LibraryHandler::getMetadata(VLNV const& vlnv)
+{
+    auto info = documentCache_.find(vlnv);
+    if (info == documentCache_.end())
+    {
+        return DocumentMetadata();
+    }
+
+    if (info->hasMetadata == false)
+    {
+        if (info->document.isNull())
+        {
+            info->document = fileAccess_.readDocument(info->path);
+        }
+
+        info->metadata = DocumentMetadata::create(info->document);
+        info->hasMetadata = true;
+
+        if (info->document.isNull() == false)
+        {
+            metadataCache_.insert(info->path, info->metadata);
+        }
+    }
+
+    return info->metadata;
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryHandler::referenceCount()
 //-----------------------------------------------------------------------------
 int LibraryHandler::referenceCount(VLNV const& vlnv) const
 {
+    buildDeferredModels();
+
     QList<VLNV> list;
     return hierarchyModel_->getOwners(list, vlnv);
 }
@@ -293,6 +432,7 @@ int LibraryHandler::referenceCount(VLNV const& vlnv) const
 //-----------------------------------------------------------------------------
 int LibraryHandler::getOwners(QList<VLNV>& list, VLNV const& vlnvToSearch) const
 {
+    buildDeferredModels();
     return hierarchyModel_->getOwners(list, vlnvToSearch);
 }
 
@@ -306,6 +446,7 @@ int LibraryHandler::getChildren(QList<VLNV>& list, VLNV const& vlnvToSearch) con
         return 0;
     }
 
+    buildDeferredModels();
     hierarchyModel_->getChildren(list, vlnvToSearch);
     return list.size();
 }
@@ -366,13 +507,25 @@ QSharedPointer<Design> LibraryHandler::getDesign(VLNV const& hierarchyRef)
 //-----------------------------------------------------------------------------
 bool LibraryHandler::isValid(VLNV const& vlnv)
 {    
-    auto it = documentCache_.constFind(vlnv);
-    if (it != documentCache_.cend())
+    auto it = documentCache_.find(vlnv);
+    if (it == documentCache_.end())
     {
-        return documentCache_.value(vlnv).isValid;
+        return false;
     }
 
-    return false;
+    // Indexed documents are validated on first request.
+    if (it->isValidated == false)
+    {
+        if (it->document.isNull())
+        {
+            it->document = fileAccess_.readDocument(it->path);
+        }
+
+        it->isValid = validateDocument(it->document, it->path);
+        it->isValidated = true;
+    }
+
+    return it->isValid;
 }
 
 //-----------------------------------------------------------------------------
@@ -380,6 +533,7 @@ bool LibraryHandler::isValid(VLNV const& vlnv)
 //-----------------------------------------------------------------------------
 HierarchyModel* LibraryHandler::getHierarchyModel()
 {
+    buildDeferredModels();
     return hierarchyModel_;
 }
 
@@ -388,6 +542,7 @@ HierarchyModel* LibraryHandler::getHierarchyModel()
 //-----------------------------------------------------------------------------
 LibraryTreeModel* LibraryHandler::getTreeModel()
 {
+    buildDeferredModels();
     return treeModel_;
 }
 
@@ -396,14 +551,19 @@ LibraryTreeModel* LibraryHandler::getTreeModel()
 //-----------------------------------------------------------------------------
 void LibraryHandler::onCheckLibraryIntegrity()
 {
+    ProfilingScope profilingScope("LibraryHandler::onCheckLibraryIntegrity");
+
     messageChannel_->showStatusMessage(tr("Validating items. Please wait..."));
 
     checkResults_.documentCount = 0;
     checkResults_.fileCount = 0;
 
+    // The documents are checked in VLNV order to collect the tags in the same order on every run.
     QVector<TagData> documentTags;
-    for (auto it = documentCache_.begin(); it != documentCache_.end(); ++it)
+    for (VLNV const& vlnv : getAllVLNVs())
     {
+        auto it = documentCache_.find(vlnv);
+
         // TODO: Add model to cache only, if it is already previously cached.
         // Current hierarchy model forces all models to be loaded, but this should be changed.
         QSharedPointer<Document> model = it->document;
@@ -416,9 +576,17 @@ void LibraryHandler::onCheckLibraryIntegrity()
         if (model.isNull() == false)
         {
             documentTags += (model->getTags());
+
+            if (it->hasMetadata == false)
+            {
+                it->metadata = DocumentMetadata::create(model);
+                it->hasMetadata = true;
+                metadataCache_.insert(it->path, it->metadata);
+            }
         }
 
         it->isValid = validateDocument(model, it->path);
+        it->isValidated = true;
         if (it->isValid == false)
         {
             checkResults_.documentCount++;
@@ -430,6 +598,8 @@ void LibraryHandler::onCheckLibraryIntegrity()
 
     showIntegrityResults();
 
+    metadataCache_.save();
+
     messageChannel_->showStatusMessage(tr("Ready."));
 }
 
@@ -467,7 +637,7 @@ void LibraryHandler::onEditItem(VLNV const& vlnv)
     else if (documentType == VLNV::BUSDEFINITION)
     {
         QList<VLNV> absDefVLNVs;
-        hierarchyModel_->getChildren(absDefVLNVs, vlnv);
+        getChildren(absDefVLNVs, vlnv);
 
         if (absDefVLNVs.size() == 1)
         {
@@ -498,7 +668,7 @@ void LibraryHandler::onEditItem(VLNV const& vlnv)
         }
 
         QList<VLNV> absDefVLNVs;
-        hierarchyModel_->getChildren(absDefVLNVs, busDefVLNV);
+        getChildren(absDefVLNVs, busDefVLNV);
 
         // If there is exactly one abstraction definition per bus definition, open it.
         if (absDefVLNVs.size() == 1 && absDefVLNVs.first() == vlnv)
@@ -559,12 +729,12 @@ void LibraryHandler::onGenerateIntegrityReport()
 
         LibraryErrorModel* model = new LibraryErrorModel(integrityWidget_);
         
-        auto end = documentCache_.constEnd();
-        for (auto it = documentCache_.constBegin(); it != end; ++it)
+        for (VLNV const& vlnv : getAllVLNVs())
         {
-            if (it->isValid == false)
+            DocumentInfo const& info = documentCache_.constFind(vlnv).value();
+            if (info.isValid == false)
             {
-                model->addErrors(findErrorsInDocument(it->document, it->path), it.key().toString());
+                model->addErrors(findErrorsInDocument(info.document, info.path), vlnv.toString());
             }
         }             
 
@@ -679,7 +849,7 @@ void LibraryHandler::removeObject(VLNV const& vlnv)
 
     QString path = documentCache_.find(vlnv)->path;
     fileWatch_.removePath(path);
-    documentCache_.remove(vlnv);
+    uncacheDocument(vlnv);
 
     treeModel_->onRemoveVLNV(vlnv);
     hierarchyModel_->onRemoveVLNV(vlnv);
@@ -700,15 +870,23 @@ void LibraryHandler::removeObjects(QList<VLNV> const& vlnvList)
 //-----------------------------------------------------------------------------
 void LibraryHandler::beginSave()
 {
-    saveInProgress_ = true;
+    saveInProgress_++;
 }
 
 //-----------------------------------------------------------------------------
 // Function: LibraryHandler::endSave()
 //-----------------------------------------------------------------------------
-void LibraryHandler::endSave()
+bool LibraryHandler::endSave()
 {
-    saveInProgress_ = false;
+    Q_ASSERT(saveInProgress_ > 0);
+
+    saveInProgress_--;
+    if (saveInProgress_ == 0)
+    {
+        return finishBackgroundSaves();
+    }
+
+    return true;
 }
 
 //-----------------------------------------------------------------------------
@@ -804,7 +982,7 @@ void LibraryHandler::onCreateAbsDef(VLNV const& busDefVLNV)
     QString directory = busDefInfo.absolutePath();
 
     QList<VLNV> absDefVLNVs;
-    hierarchyModel_->getChildren(absDefVLNVs, busDefVLNV);
+    getChildren(absDefVLNVs, busDefVLNV);
 
     // if theres no previous abstraction definition for given bus def
     if (absDefVLNVs.isEmpty())
@@ -836,27 +1014,6 @@ void LibraryHandler::onRemoveVLNV(QList<VLNV> const& vlnvs)
     emit noticeMessage(createDeleteMessage(removeStatistics));
 }
 
-//-----------------------------------------------------------------------------
-// Function: LibraryHandler::onItemSaved()
-//-----------------------------------------------------------------------------
-void LibraryHandler::onItemSaved(VLNV const& vlnv) 
-{
-    if (vlnv.isValid() == false)
-    {
-        return;
-    }
-
-    VLNV savedItem = vlnv;
-    savedItem.setType(getDocumentType(vlnv));
-
-    // Replace overwritten item with new and check validity.
-    QSharedPointer<Document> model = getModel(vlnv);
-    documentCache_.insert(vlnv, DocumentInfo(getPath(vlnv), model, validateDocument(model, getPath(vlnv))));
-    
-    treeModel_->onDocumentUpdated(vlnv);
-    hierarchyModel_->onDocumentUpdated(vlnv);
-}
-
 //-----------------------------------------------------------------------------
 // Function: LibraryHandler::closeIntegrityReport()
 //-----------------------------------------------------------------------------
@@ -871,41 +1028,146 @@ void LibraryHandler::onCloseIntegrityReport()
 //-----------------------------------------------------------------------------
 void LibraryHandler::onFileChangedOnDisk(QString const& path)
 {
-    // Add timer to skip the time it takes to remove the file and rewrite it on save.
-    updatedPaths_.append(path);
-    QTimer::singleShot(100, Qt::CoarseTimer, this, SLOT(handleFileChange()));
+    // Skip the notification of a file written by the library itself. The content is compared, since the
+    // modification time does not change on file systems with coarse timestamps.
+    auto writtenFile = writtenFiles_.find(path);
+    if (writtenFile != writtenFiles_.end())
+    {
+        bool unchanged = fileContentHash(path) == writtenFile.value();
+        writtenFiles_.erase(writtenFile);
+
+        if (unchanged)
+        {
+            return;
+        }
+    }
+
+    // A burst of changes, e.g. from a version control checkout, restarts the timer and is processed at once.
+    changedPaths_.insert(path);
+    changeTimer_.start();
 }
 
 //-----------------------------------------------------------------------------
-// Function: LibraryHandler::handleFileChange()
+// Function: LibraryHandler::processFileChanges()
 //-----------------------------------------------------------------------------
-void LibraryHandler::handleFileChange()
+void LibraryHandler::processFileChanges()
 {
-    VLNV vlnv;
-    QString path = updatedPaths_.takeFirst();
-    
-    if (QFile::exists(path))
+    ProfilingScope profilingScope("LibraryHandler::processFileChanges");
+
+    QStringList changedPaths = changedPaths_.toList();
+    changedPaths_.clear();
+
+    QStringList existingPaths;
+    for (QString const& path : changedPaths)
     {
-        // File updated on disk.
-        QSharedPointer<Document> model = fileAccess_.readDocument(path);
-        vlnv = model->getVlnv();
-        documentCache_.insert(vlnv, DocumentInfo(path, model, validateDocument(model, path)));
+        if (QFile::exists(path))
+        {
+            existingPaths.append(path);
+        }
+    }
 
-        emit updatedVLNV(vlnv);
+    QVector<QSharedPointer<Document> > models = DocumentFileAccess::parseDocuments(existingPaths);
+
+    QHash<QString, QSharedPointer<Document> > readDocuments;
+    for (int i = 0; i < existingPaths.size(); ++i)
+    {
+        if (models.at(i).isNull())
+        {
+            messageChannel_->showError(tr("Could not open file %1 for reading.").arg(existingPaths.at(i)));
+        }
+        else
+        {
+            readDocuments.insert(existingPaths.at(i), models.at(i));
+        }
     }
-    else
+
+    // The documents no longer in their files are removed first, so that a document moved between the changed
+    // files is updated instead of removed.
+    QSet<QString> existingFiles = existingPaths.toSet();
+
+    QSet<VLNV> removedDocuments;
+    for (QString const& path : changedPaths)
+    {
+        VLNV previousVlnv = cachedPaths_.value(path);
+        if (previousVlnv.isValid() == false)
+        {
+            continue;
+        }
+
+        auto readDocument = readDocuments.constFind(path);
+        bool removed = existingFiles.contains(path) == false;
+        bool replaced = readDocument != readDocuments.constEnd() &&
+            !(readDocument.value()->getVlnv() == previousVlnv);
+        if (removed || replaced)
+        {
+            uncacheDocument(previousVlnv);
+            removedDocuments.insert(previousVlnv);
+        }
+    }
+
+    QVector<VLNV> addedDocuments;
+    QVector<VLNV> updatedDocuments;
+    for (auto readDocument = readDocuments.constBegin(); readDocument != readDocuments.constEnd(); ++readDocument)
     {
-        // File removed.
-        auto changedDocument = std::find_if(documentCache_.begin(), documentCache_.end(),
-            [path](const DocumentInfo& item) { return item.path.compare(path) == 0; });
+        QString const& path = readDocument.key();
+        QSharedPointer<Document> model = readDocument.value();
+        VLNV vlnv = model->getVlnv();
 
-        if (changedDocument != documentCache_.end() && changedDocument.key().isValid())
+        // Files rewritten with identical content, e.g. when saving, need no update.
+        auto cachedDocument = documentCache_.constFind(vlnv);
+        if (cachedDocument != documentCache_.constEnd() && cachedDocument->path == path &&
+            cachedDocument->document.isNull() == false &&
+            contentHashes_.documentHash(cachedDocument->document) == contentHashes_.documentHash(model))
         {
-            vlnv = changedDocument.key();
-            documentCache_.erase(changedDocument);
+            continue;
+        }
 
-            emit removeVLNV(vlnv);
+        if (removedDocuments.remove(vlnv) || cachedDocument != documentCache_.constEnd())
+        {
+            updatedDocuments.append(vlnv);
+        }
+        else
+        {
+            addedDocuments.append(vlnv);
         }
+
+        DocumentInfo info(path);
+        info.document = model;
+        cacheDocument(vlnv, info);
+    }
+
+    // The documents are validated once all of them are in the cache, since they may refer to each other.
+    for (VLNV const& vlnv : addedDocuments + updatedDocuments)
+    {
+        auto info = documentCache_.find(vlnv);
+        info->isValid = validateDocument(info->document, info->path);
+        info->isValidated = true;
+    }
+
+    if (modelsDeferred_ == false)
+    {
+        for (VLNV const& vlnv : removedDocuments)
+        {
+            treeModel_->onRemoveVLNV(vlnv);
+        }
+        hierarchyModel_->onRemoveVLNVs(removedDocuments.toList().toVector());
+
+        for (VLNV const& vlnv : addedDocuments)
+        {
+            treeModel_->onAddVLNV(vlnv);
+        }
+        hierarchyModel_->onAddVLNVs(addedDocuments);
+
+        for (VLNV const& vlnv : updatedDocuments)
+        {
+            treeModel_->onDocumentUpdated(vlnv);
+            hierarchyModel_->onDocumentUpdated(vlnv);
+        }
+    }
+
+    for (VLNV const& vlnv : updatedDocuments)
+    {
+        emit updatedVLNV(vlnv);
     }
 }
 
@@ -915,22 +1177,10 @@ void LibraryHandler::handleFileChange()
 void LibraryHandler::syncronizeModels()
 {
     // connect the signals from the data model
-    connect(this, SIGNAL(removeVLNV(const VLNV&)),
-        treeModel_, SLOT(onRemoveVLNV(const VLNV&)), Qt::UniqueConnection);
-    connect(this, SIGNAL(removeVLNV(const VLNV&)),
-        hierarchyModel_, SLOT(onRemoveVLNV(const VLNV&)), Qt::UniqueConnection);
-
+    // The documents changed on disk are applied to the models in batches in processFileChanges().
     connect(this, SIGNAL(addVLNV(const VLNV&)),
         treeModel_, SLOT(onAddVLNV(const VLNV&)), Qt::UniqueConnection);
 
-    connect(this, SIGNAL(updatedVLNV(VLNV const&)),
-        this, SLOT(onItemSaved(VLNV const&)), Qt::UniqueConnection);
-
-    connect(this, SIGNAL(updatedVLNV(VLNV const&)),
-            treeModel_, SLOT(onDocumentUpdated(VLNV const&)), Qt::UniqueConnection);
-    connect(this, SIGNAL(updatedVLNV(VLNV const&)),
-            hierarchyModel_, SLOT(onDocumentUpdated(VLNV const&)), Qt::UniqueConnection);
-
     connect(itemExporter_, SIGNAL(noticeMessage(const QString&)),
         this, SIGNAL(noticeMessage(QString const&)), Qt::UniqueConnection);
 
@@ -1048,17 +1298,147 @@ bool LibraryHandler::addObject(QSharedPointer<Document> model, QString const& fi
         targetPath = pathInfo.symLinkTarget();
     }
 
+    QSharedPointer<Document> savedModel = model->clone();
+
     fileWatch_.removePath(targetPath);
-    fileAccess_.writeDocument(model, targetPath);
-    fileWatch_.addPath(targetPath);
+    if (saveInProgress_ > 0)
+    {
+        // The cached copy is written in the background while the document is validated.
+        saveExecutor_.enqueue(savedModel, targetPath);
+    }
+    else
+    {
+        bool written = fileAccess_.writeDocument(savedModel, targetPath);
+        fileWatch_.addPath(targetPath);
+
+        if (written == false)
+        {
+            return false;
+        }
+
+        writtenFiles_.insert(targetPath, fileContentHash(targetPath));
+    }
 
     TagManager::getInstance().addNewTags(model->getTags());
 
-    documentCache_.insert(model->getVlnv(), DocumentInfo(targetPath, model->clone(), validateDocument(model, targetPath)));
+    // Validate once and update all the cached information on the document in the same pass.
+    DocumentInfo info(targetPath, savedModel, validateDocument(model, targetPath));
+    info.metadata = DocumentMetadata::create(info.document);
+    info.hasMetadata = true;
+
+    if (saveInProgress_ == 0)
+    {
+        metadataCache_.insert(targetPath, info.metadata);
+    }
+    else if (replacedInSave_.contains(model->getVlnv()) == false && documentCache_.contains(model->getVlnv()))
+    {
+        // The document is restored, if it cannot be written.
+        replacedInSave_.insert(model->getVlnv(), documentCache_.value(model->getVlnv()));
+    }
+    cacheDocument(model->getVlnv(), info);
 
     return true;
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::finishBackgroundSaves()
+//-----------------------------------------------------------------------------
+bool LibraryHandler::finishBackgroundSaves()
+{
+    if (saveExecutor_.isEmpty())
+    {
+        replacedInSave_.clear();
+        return true;
+    }
+
+    QStringList watchedPaths;
+    QVector<VLNV> updatedDocuments;
+
+    // A document written several times is in the state of its last write.
+    QHash<VLNV, bool> documentSaved;
+
+    for (DocumentSaveExecutor::SaveResult const& result : saveExecutor_.waitForResults())
+    {
+        documentSaved.insert(result.vlnv, result.saved);
+
+        if (result.saved)
+        {
+            writtenFiles_.insert(result.path, fileContentHash(result.path));
+            metadataCache_.insert(result.path, documentCache_.value(result.vlnv).metadata);
+
+            if (addedInSave_.contains(result.vlnv) == false && updatedDocuments.contains(result.vlnv) == false)
+            {
+                updatedDocuments.append(result.vlnv);
+            }
+        }
+        else if (result.serialized == false)
+        {
+            messageChannel_->showError(tr("Could not write document %1 into XML.").arg(result.vlnv.toString()));
+        }
+        else
+        {
+            messageChannel_->showError(tr("Could not open file %1 for writing.").arg(result.path));
+        }
+
+        if (QFileInfo::exists(result.path) && watchedPaths.contains(result.path) == false)
+        {
+            watchedPaths.append(result.path);
+        }
+    }
+
+    bool allSaved = true;
+    for (auto saved = documentSaved.cbegin(); saved != documentSaved.cend(); ++saved)
+    {
+        if (saved.value())
+        {
+            continue;
+        }
+
+        allSaved = false;
+
+        // A new document that was not written is not in the library and an existing one keeps the content
+        // it has on disk.
+        VLNV const& vlnv = saved.key();
+        if (addedInSave_.contains(vlnv))
+        {
+            uncacheDocument(vlnv);
+            addedInSave_.removeAll(vlnv);
+        }
+        else if (replacedInSave_.contains(vlnv))
+        {
+            cacheDocument(vlnv, replacedInSave_.value(vlnv));
+            updatedDocuments.removeAll(vlnv);
+        }
+    }
+
+    replacedInSave_.clear();
+
+    // The watches are restored in one batch for all the written files.
+    if (watchedPaths.isEmpty() == false)
+    {
+        fileWatch_.addPaths(watchedPaths);
+    }
+
+    if (modelsDeferred_ == false)
+    {
+        for (VLNV const& vlnv : addedInSave_)
+        {
+            treeModel_->onAddVLNV(vlnv);
+        }
+        hierarchyModel_->onAddVLNVs(addedInSave_);
+
+        for (VLNV const& vlnv : updatedDocuments)
+        {
+            treeModel_->onDocumentUpdated(vlnv);
+            hierarchyModel_->onDocumentUpdated(vlnv);
+        }
+    }
+
+    addedInSave_.clear();
+
+    return allSaved;
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryHandler::clearCache()
 //-----------------------------------------------------------------------------
@@ -1066,18 +1446,67 @@ void LibraryHandler::clearCache()
 {
     if (!documentCache_.isEmpty())
     {
-        fileWatch_.removePaths(fileWatch_.files());
+        fileWatch_.clear();
+        writtenFiles_.clear();
         documentCache_.clear();
+        sortedVLNVs_.clear();
+        sortedVLNVsValid_ = false;
+        cachedPaths_.clear();
+        contentHashes_.clear();
     }
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::cacheDocument()
+//-----------------------------------------------------------------------------
+void LibraryHandler::cacheDocument(VLNV const& vlnv, DocumentInfo const& info)
+{
+    auto cachedDocument = documentCache_.constFind(vlnv);
+    if (cachedDocument != documentCache_.constEnd() && cachedDocument->path != info.path)
+    {
+        cachedPaths_.remove(cachedDocument->path);
+    }
+    else if (cachedDocument == documentCache_.constEnd())
+    {
+        sortedVLNVsValid_ = false;
+    }
+
+    documentCache_.insert(vlnv, info);
+    cachedPaths_.insert(info.path, vlnv);
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::uncacheDocument()
+//-----------------------------------------------------------------------------
+void LibraryHandler::uncacheDocument(VLNV const& vlnv)
+{
+    auto cachedDocument = documentCache_.find(vlnv);
+    if (cachedDocument == documentCache_.end())
+    {
+        return;
+    }
+
+    // The path may already have been taken by another document.
+    if (cachedPaths_.value(cachedDocument->path) == vlnv)
+    {
+        cachedPaths_.remove(cachedDocument->path);
+    }
+
+    documentCache_.erase(cachedDocument);
+    sortedVLNVsValid_ = false;
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryHandler::loadAvailableVLNVs()
 //-----------------------------------------------------------------------------
-void LibraryHandler::loadAvailableVLNVs()
+void LibraryHandler::loadAvailableVLNVs(bool watchFiles)
 {
+    ProfilingScope profilingScope("LibraryHandler::loadAvailableVLNVs");
+
     messageChannel_->showStatusMessage(tr("Scanning library. Please wait..."));
 
+    QSet<QString> libraryPaths;
+
     // Read all items before validation.
     // Validation will check for VLNVs in the library, so they must be available before validation.    
     for (auto const& target: loader_.parseLibrary())
@@ -1089,10 +1518,20 @@ void LibraryHandler::loadAvailableVLNVs()
         }
         else
         {
-            documentCache_.insert(target.vlnv, DocumentInfo(target.path));
-            fileWatch_.addPath(target.path);
+            DocumentInfo info(target.path);
+            info.hasMetadata = metadataCache_.find(target.path, info.metadata);
+
+            cacheDocument(target.vlnv, info);
+            libraryPaths.insert(target.path);
         }
     }
+
+    if (watchFiles)
+    {
+        fileWatch_.addPaths(libraryPaths.toList());
+    }
+
+    metadataCache_.retain(libraryPaths);
     messageChannel_->showStatusMessage(tr("Ready."));
 }
 
@@ -1101,12 +1540,28 @@ void LibraryHandler::loadAvailableVLNVs()
 //-----------------------------------------------------------------------------
 void LibraryHandler::resetModels()
 {
+    ProfilingScope profilingScope("LibraryHandler::resetModels");
+
     messageChannel_->showStatusMessage(tr("Updating library view. Please wait..."));
     hierarchyModel_->onResetModel();
     treeModel_->onResetModel();
+    modelsDeferred_ = false;
     messageChannel_->showStatusMessage(tr("Ready."));
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryHandler::buildDeferredModels()
+//-----------------------------------------------------------------------------
+void LibraryHandler::buildDeferredModels() const
+{
+    if (modelsDeferred_)
+    {
+        modelsDeferred_ = false;
+        hierarchyModel_->onResetModel();
+        treeModel_->onResetModel();
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryHandler::showIntegrityResults()
 //-----------------------------------------------------------------------------
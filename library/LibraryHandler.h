@@ -13,11 +13,14 @@
 #define LIBRARYHANDLER_H
 
 #include "LibraryInterface.h"
+#include "LibraryFileWatcher.h"
 #include "LibraryLoader.h"
+#include "LibraryMetadataCache.h"
 #include "LibraryTreeWidget.h"
 #include "LibraryTreeModel.h"
 
 #include "DocumentFileAccess.h"
+#include "DocumentSaveExecutor.h"
 #include "DocumentValidator.h"
 
 #include "HierarchyView/hierarchymodel.h"
@@ -27,15 +30,19 @@
 
 #include <IPXACTmodels/kactusExtensions/KactusAttribute.h>
 
+#include <IPXACTmodels/utilities/StructuralHash.h>
+
 #include <QString>
 #include <QStringList>
 #include <QDir>
 #include <QList>
 #include <QFileInfo>
-#include <QFileSystemWatcher>
 #include <QSharedPointer>
 #include <QHash>
+#include <QByteArray>
 #include <QObject>
+#include <QSet>
+#include <QTimer>
 
 class Document;
 class LibraryItem;
@@ -66,7 +73,7 @@ public:
     LibraryHandler(const LibraryHandler &other) = delete;
 
     //! The destructor
-    virtual ~LibraryHandler() = default;
+    virtual ~LibraryHandler();
 
     //! No assignment
     LibraryHandler &operator=(const LibraryHandler &other) = delete;
@@ -127,8 +134,7 @@ public:
      * that directory. The path must not contain the file name.
      * If file already exists in file system it is written over.
      * 
-     * When model is saved using this function it is not necessary to call 
-     * onItemSaved() because it is called by this function.
+     * The library views are updated to show the saved model by this function.
      *
      *      @param [in] path            Directory path that specifies the directory to save to file into.
      *      @param [in] model           The library component that is written.
@@ -152,6 +158,13 @@ public:
 
     //! Search for IP-Xact files in the file system and add them to library
     virtual void searchForIPXactFiles() override final;
+
+    /*! Search for IP-Xact files in the file system and add them to library without reading the documents.
+     *
+     * Documents are read and validated when they are first requested and the library models are built on first
+     * use. Meant for command-line runs that use only a few documents of the library.
+    */
+    void indexIPXactFiles();
     
     /*! Get list of vlnvs that are needed by given document.
      *
@@ -194,6 +207,16 @@ public:
     */
     virtual VLNV::IPXactType getDocumentType(VLNV const& vlnv) override final;
 
+    /*! Get the metadata of given vlnv for filtering the library.
+     *
+     * The metadata is kept between runs, so the document is read only if it has changed since.
+     *
+     *      @param [in] vlnv Specifies the document that's metadata is wanted.
+     *
+     *      @return The metadata of the document.
+    */
+    virtual DocumentMetadata getMetadata(VLNV const& vlnv) override final;
+
     /*! Count how many times the given component is instantiated in the library.
      *
      *      @param [in] vlnv Identifies the component that's instances are searched.
@@ -348,17 +371,22 @@ public slots:
     *
     * When calling this before saving and then using writeModelToFile() the 
     * library is not update between each save operation thus making the program
-    * faster.
+    * faster. The documents are written concurrently in the background and the 
+    * files are complete when endSave() returns. Until then, writeModelToFile() only
+    * reports if the document was accepted for writing.
     * 
-    * Be sure to call endSave() after all items are saved.
+    * Be sure to call endSave() after all items are saved. The calls may be nested.
     */
     virtual void beginSave();
 
     /*! End the saving operation and update the library.
     *
     * This function must be called always after calling the beginSave().
+    *
+    * @return True, if all the documents saved since beginSave() were written, otherwise false. The writes
+    *         are finished by the outermost call, so the nested calls always return true.
     */
-    virtual void endSave();
+    virtual bool endSave();
 
     /*! Create a new item for given vlnv.
      *
@@ -450,9 +478,6 @@ signals:
     //! Inform tree model that a vlnv is to be added to the tree.
     void addVLNV(VLNV const& vlnv);
 
-    //! Inform tree model that a vlnv is to be removed from the tree.
-    void removeVLNV(VLNV const& vlnv);
-
 
 private slots:
     
@@ -470,17 +495,6 @@ private slots:
     */
     void onRemoveVLNV(QList<VLNV> const& vlnvs);
 
-    /*! This function should be called every time an object is written to disk.
-    * 
-    * This function makes sure that the library object is displayed correctly 
-    * on library views and possible changes made to the object are updated to
-    * views.
-    * 
-    *      @param [in] vlnv Identifies the object that was saved.
-    *
-    */
-    void onItemSaved(VLNV const& vlnv);
-
     //! Closes the integrity report widget.
     void onCloseIntegrityReport();
 
@@ -490,7 +504,12 @@ private slots:
     */
     void onFileChangedOnDisk(QString const& path);
 
-    void handleFileChange();
+    /*! Updates the library for all the files changed on disk since the previous update.
+     *
+     * The changed files are read concurrently and the added, changed and removed documents are applied to the
+     * cache and to the library views in one batch.
+     */
+    void processFileChanges();
 
 private:
 
@@ -500,11 +519,17 @@ private:
         QSharedPointer<Document> document;  //<! The model for the document.
         QString path;                       //<! The path to the file containing the document.
         bool isValid;                       //<! Flag for well-formed content.
+        bool isValidated;                   //<! Flag for validity having been checked.
+        DocumentMetadata metadata;          //<! The metadata of the document for filtering.
+        bool hasMetadata;                   //<! Flag for metadata being available.
 
-        //! Constructor.
-        explicit DocumentInfo(QString const& filePath = QString(), 
-            QSharedPointer<Document> doc = QSharedPointer<Document>(),
-            bool valid = false): document(doc), path(filePath), isValid(valid) {}
+        //! Constructor for a document that has not been validated.
+        explicit DocumentInfo(QString const& filePath = QString()): document(), path(filePath), isValid(false),
+            isValidated(false), metadata(), hasMetadata(false) {}
+
+        //! Constructor for a validated document.
+        DocumentInfo(QString const& filePath, QSharedPointer<Document> doc, bool valid): document(doc),
+            path(filePath), isValid(valid), isValidated(true), metadata(), hasMetadata(false) {}
     };
 
     //! Struct for collecting document statistics e.g. in export.
@@ -534,15 +559,42 @@ private:
     //! Adds a IP-XACT document into the library cache.
     bool addObject(QSharedPointer<Document> model, QString const& filePath);
 
+    /*!
+     *  Waits for the documents written in the background and updates the library for them. The documents that
+     *  could not be written are restored in the cache to their state before the save.
+     *
+     *      @return True, if all the documents were written, otherwise false.
+     */
+    bool finishBackgroundSaves();
+
     //! Clears the library cache of documents.
     void clearCache();
 
-    //! Loads all available VLNVs into the library cache.
-    void loadAvailableVLNVs();
+    /*! Adds a document into the library cache or replaces the cached one.
+     *
+     *      @param [in] vlnv    The VLNV of the document.
+     *      @param [in] info    The information on the document.
+     */
+    void cacheDocument(VLNV const& vlnv, DocumentInfo const& info);
+
+    /*! Removes a document from the library cache.
+     *
+     *      @param [in] vlnv    The VLNV of the document to remove.
+     */
+    void uncacheDocument(VLNV const& vlnv);
+
+    /*! Loads all available VLNVs into the library cache.
+     *
+     *      @param [in] watchFiles  If true, the found files are watched for changes.
+     */
+    void loadAvailableVLNVs(bool watchFiles = true);
 
     //! Resets the tree and hierarchy model.
     void resetModels();
 
+    //! Builds the tree and hierarchy model, if they were left out when indexing the library.
+    void buildDeferredModels() const;
+
     //! Shows the results of the library integrity check.
     void showIntegrityResults() const;
 
@@ -667,7 +719,22 @@ private:
      * Key = VLNV that identifies the library object.
      * Value = Information on the document.
      */
-    QMap<VLNV, DocumentInfo> documentCache_;
+    QHash<VLNV, DocumentInfo> documentCache_;
+
+    //! The VLNVs of the cached documents in sorted order.
+    mutable QList<VLNV> sortedVLNVs_;
+
+    //! Flag for indicating that the sorted VLNVs match the cached documents.
+    mutable bool sortedVLNVsValid_;
+
+    //! The VLNVs of the cached documents by their file paths.
+    QHash<QString, VLNV> cachedPaths_;
+
+    //! Content hashes of the cached documents.
+    StructuralHash contentHashes_;
+
+    //! Metadata of the library documents kept between runs.
+    LibraryMetadataCache metadataCache_;
 
     //! Checks if the given string is a URL (invalids are allowed) or not.
     QRegularExpressionValidator urlTester_;
@@ -684,11 +751,20 @@ private:
     //! Widget for showing integrity report on-demand.
     TableViewDialog* integrityWidget_;
 
-    //! If true then items are being saved and library is not refreshed
-    bool saveInProgress_;
+    //! The number of nested save operations. While positive, items are written in the background.
+    int saveInProgress_;
+
+    //! Writes the documents saved between beginSave() and endSave().
+    DocumentSaveExecutor saveExecutor_;
+
+    //! The documents added to the library between beginSave() and endSave().
+    QVector<VLNV> addedInSave_;
+
+    //! The cached documents replaced between beginSave() and endSave() as they were before the save.
+    QHash<VLNV, DocumentInfo> replacedInSave_;
 
     //! Watch for changes in the IP-XACT files.
-    QFileSystemWatcher fileWatch_;
+    LibraryFileWatcher fileWatch_;
 
     //! Item exporter.
     ItemExporter* itemExporter_;
@@ -696,8 +772,21 @@ private:
     //! Statistics for library integrity check.
     DocumentStatistics checkResults_;
 
-    //! Queue for files updated on disk.
-    QVector<QString> updatedPaths_;
+    //! Files changed on disk that have not yet been processed.
+    QSet<QString> changedPaths_;
+
+    //! Timer for processing a burst of file changes at once after the changes have settled.
+    QTimer changeTimer_;
+
+    /*! Files written by the library and the hashes of their content after the write.
+     *
+     * The first change notification of a written file is ignored, if the file still has the written content,
+     * since the cache is already updated when saving.
+     */
+    QHash<QString, QByteArray> writtenFiles_;
+
+    //! If true, the tree and hierarchy model have not been built for the indexed library.
+    mutable bool modelsDeferred_;
 };
 
 #endif // LIBRARYHANDLER_H
@@ -12,6 +12,7 @@
 #ifndef LIBRARYINTERFACE_H
 #define LIBRARYINTERFACE_H
 
+#include <IPXACTmodels/common/DocumentMetadata.h>
 #include <IPXACTmodels/common/VLNV.h>
 
 #include <QObject>
@@ -110,7 +111,7 @@ public:
      *
      *      @remark The path must not contain the file name.
      *      @remark If file already exists in file system it is overwritten.
-     *      @remark It is not necessary to call onItemSaved() because it is called by this function.
+     *      @remark The library views are updated to show the saved model by this function.
      */
     virtual bool writeModelToFile(QString const& path, QSharedPointer<Document> model) = 0;
 
@@ -166,6 +167,16 @@ public:
     */
     virtual VLNV::IPXactType getDocumentType(VLNV const& vlnv) = 0;
 
+    /*! Get the metadata of given vlnv for filtering the library.
+     *
+     * If vlnv is not found in the library then empty metadata with type VLNV::INVALID is returned.
+     *
+     *      @param [in] vlnv Specifies the document that's metadata is wanted.
+     *
+     *      @return The metadata of the document.
+    */
+    virtual DocumentMetadata getMetadata(VLNV const& vlnv) = 0;
+
     /*! Count how many times the given component is instantiated in the library.
      *
      *      @param [in] vlnv Identifies the component that's instances are searched.
@@ -297,8 +308,10 @@ public slots:
     /*! End the saving operation and update the library.
     *
     * This function must be called always after calling the beginSave().
+    *
+    * @return True, if all the documents saved since beginSave() were written, otherwise false.
     */
-    virtual void endSave() = 0;
+    virtual bool endSave() = 0;
 
 signals:
 
@@ -0,0 +1,166 @@
+//-----------------------------------------------------------------------------
+// File: LibraryMetadataCache.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: Kactus2 team
+// Date: 19.10.2026
+//
+// Description:
+// Persistent store for the metadata of the library documents.
+//-----------------------------------------------------------------------------
+
+#include "LibraryMetadataCache.h"
+
+#include <QDataStream>
+#include <QDateTime>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+
+namespace
+{
+    //! Identifies a metadata cache file.
+    const quint32 CACHE_MAGIC = 0x4b324d44;
+
+    //! Format version of the cache file. Files of other versions are ignored.
+    const quint32 CACHE_VERSION = 1;
+};
+
+//-----------------------------------------------------------------------------
+// Function: LibraryMetadataCache::LibraryMetadataCache()
+//-----------------------------------------------------------------------------
+LibraryMetadataCache::LibraryMetadataCache(QString const& cacheFilePath):
+cacheFilePath_(cacheFilePath),
+    entries_(),
+    changed_(false)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryMetadataCache::load()
+//-----------------------------------------------------------------------------
+void LibraryMetadataCache::load()
+{
+    entries_.clear();
+    changed_ = false;
+
+    QFile cacheFile(cacheFilePath_);
+    if (cacheFile.open(QFile::ReadOnly) == false)
+    {
+        return;
+    }
+
+    QDataStream stream(&cacheFile);
+    stream.setVersion(QDataStream::Qt_5_0);
+
+    quint32 magic = 0;
+    quint32 version = 0;
+    stream >> magic >> version;
+    if (magic != CACHE_MAGIC || version != CACHE_VERSION)
+    {
+        return;
+    }
+
+    qint32 entryCount = 0;
+    stream >> entryCount;
+    entries_.reserve(entryCount);
+
+    for (qint32 i = 0; i < entryCount && stream.status() == QDataStream::Ok; ++i)
+    {
+        QString documentPath;
+        Entry entry;
+        stream >> documentPath >> entry.modified >> entry.metadata;
+
+        if (stream.status() == QDataStream::Ok)
+        {
+            entries_.insert(documentPath, entry);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryMetadataCache::save()
+//-----------------------------------------------------------------------------
+void LibraryMetadataCache::save()
+{
+    if (changed_ == false || cacheFilePath_.isEmpty())
+    {
+        return;
+    }
+
+    QSaveFile cacheFile(cacheFilePath_);
+    if (cacheFile.open(QFile::WriteOnly) == false)
+    {
+        return;
+    }
+
+    QDataStream stream(&cacheFile);
+    stream.setVersion(QDataStream::Qt_5_0);
+
+    stream << CACHE_MAGIC << CACHE_VERSION << static_cast<qint32>(entries_.size());
+    for (auto entry = entries_.cbegin(); entry != entries_.cend(); ++entry)
+    {
+        stream << entry.key() << entry->modified << entry->metadata;
+    }
+
+    if (cacheFile.commit())
+    {
+        changed_ = false;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryMetadataCache::find()
+//-----------------------------------------------------------------------------
+bool LibraryMetadataCache::find(QString const& documentPath, DocumentMetadata& metadata) const
+{
+    auto entry = entries_.constFind(documentPath);
+    if (entry == entries_.cend() || entry->modified != modificationTime(documentPath))
+    {
+        return false;
+    }
+
+    metadata = entry->metadata;
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryMetadataCache::insert()
+//-----------------------------------------------------------------------------
+void LibraryMetadataCache::insert(QString const& documentPath, DocumentMetadata const& metadata)
+{
+    Entry entry;
+    entry.modified = modificationTime(documentPath);
+    entry.metadata = metadata;
+
+    entries_.insert(documentPath, entry);
+    changed_ = true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryMetadataCache::retain()
+//-----------------------------------------------------------------------------
+void LibraryMetadataCache::retain(QSet<QString> const& documentPaths)
+{
+    for (auto entry = entries_.begin(); entry != entries_.end(); )
+    {
+        if (documentPaths.contains(entry.key()))
+        {
+            ++entry;
+        }
+        else
+        {
+            entry = entries_.erase(entry);
+            changed_ = true;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: LibraryMetadataCache::modificationTime()
+//-----------------------------------------------------------------------------
+qint64 LibraryMetadataCache::modificationTime(QString const& filePath)
+{
+    return QFileInfo(filePath).lastModified().toMSecsSinceEpoch();
+}
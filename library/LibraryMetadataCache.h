@@ -0,0 +1,115 @@
+//-----------------------------------------------------------------------------
+// File: LibraryMetadataCache.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: Kactus2 team
+// Date: 19.10.2026
+//
+// Description:
+// Persistent store for the metadata of the library documents.
+//-----------------------------------------------------------------------------
+
+#ifndef LIBRARYMETADATACACHE_H
+#define LIBRARYMETADATACACHE_H
+
+#include <IPXACTmodels/common/DocumentMetadata.h>
+
+#include <QHash>
+#include <QSet>
+#include <QString>
+
+//-----------------------------------------------------------------------------
+//! Persistent store for the metadata of the library documents.
+//!
+//! The metadata is stored by document file path together with the modification time of the file. Metadata of
+//! a file modified after storing is not returned.
+//-----------------------------------------------------------------------------
+class LibraryMetadataCache
+{
+public:
+
+    /*!
+     *  The constructor.
+     *
+     *      @param [in] cacheFilePath   Path to the file for storing the metadata.
+     */
+    explicit LibraryMetadataCache(QString const& cacheFilePath);
+
+    //! The destructor.
+    ~LibraryMetadataCache() = default;
+
+    /*!
+     *  Read the stored metadata from the cache file.
+     */
+    void load();
+
+    /*!
+     *  Write the metadata to the cache file, if it has been changed since reading.
+     */
+    void save();
+
+    /*!
+     *  Find the stored metadata of a document file.
+     *
+     *      @param [in] documentPath    Path to the document file.
+     *      @param [out] metadata       The stored metadata, if found.
+     *
+     *      @return True, if metadata for the current version of the file was found, otherwise false.
+     */
+    bool find(QString const& documentPath, DocumentMetadata& metadata) const;
+
+    /*!
+     *  Store the metadata of a document file.
+     *
+     *      @param [in] documentPath    Path to the document file.
+     *      @param [in] metadata        The metadata of the document.
+     */
+    void insert(QString const& documentPath, DocumentMetadata const& metadata);
+
+    /*!
+     *  Remove the metadata of the files not in the library.
+     *
+     *      @param [in] documentPaths   Paths to the document files in the library.
+     */
+    void retain(QSet<QString> const& documentPaths);
+
+    // No copying. No assignments.
+    LibraryMetadataCache(LibraryMetadataCache const& rhs) = delete;
+    LibraryMetadataCache& operator=(LibraryMetadataCache const& rhs) = delete;
+
+private:
+
+    //! Stored metadata of one document file.
+    struct Entry
+    {
+        //! Modification time of the file when the metadata was stored, in milliseconds since epoch.
+        qint64 modified = 0;
+
+        //! The metadata of the document.
+        DocumentMetadata metadata;
+    };
+
+    /*!
+     *  Get the modification time of a file.
+     *
+     *      @param [in] filePath    Path to the selected file.
+     *
+     *      @return The modification time in milliseconds since epoch.
+     */
+    static qint64 modificationTime(QString const& filePath);
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! Path to the file for storing the metadata.
+    QString cacheFilePath_;
+
+    //! The stored metadata by document file path.
+    QHash<QString, Entry> entries_;
+
+    //! Flag for changes since reading the cache file.
+    bool changed_;
+};
+
+#endif // LIBRARYMETADATACACHE_H
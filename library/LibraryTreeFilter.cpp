@@ -55,15 +55,13 @@ bool LibraryTreeFilter::filterAcceptsRow(int sourceRow, const QModelIndex& sourc
     for (VLNV const& vlnv : list)
     {
         VLNV::IPXactType documentType = libraryAccess->getDocumentType(vlnv);
-        QSharedPointer<Document const> document = libraryAccess->getModelReadOnly(vlnv);
+        DocumentMetadata document = libraryAccess->getMetadata(vlnv);
 
         if (documentType == VLNV::COMPONENT)
         {
             if (type().components_)
             {
-                QSharedPointer<Component const> component = document.staticCast<Component const>();
-
-                if (checkImplementation(component) && checkHierarchy(component) && checkFirmness(component) &&
+                if (checkImplementation(document) && checkHierarchy(document) && checkFirmness(document) &&
                     checkTags(document))
                 {
                     return true;
@@ -96,10 +94,8 @@ bool LibraryTreeFilter::filterAcceptsRow(int sourceRow, const QModelIndex& sourc
 
         else if (documentType == VLNV::DESIGN)
         {
-            QSharedPointer<Design> design = libraryAccess->getDesign(vlnv);
-
             if ((type().advanced_ || (type().components_ && implementation().sw_ &&
-                design->getImplementation() == KactusAttribute::SW)) && checkTags(document))
+                document.implementation == KactusAttribute::SW)) && checkTags(document))
             {
                 return true;
             }
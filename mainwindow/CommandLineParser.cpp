@@ -23,13 +23,20 @@
 
 #include <Plugins/PluginSystem/GeneratorPlugin/IGeneratorPlugin.h>
 
+#include <common/Profiler.h>
+
 //-----------------------------------------------------------------------------
 // Function: CommandLineParser::CommandLineParser()
 //-----------------------------------------------------------------------------
-CommandLineParser::CommandLineParser(): optionParser_(), preReadDone_(false)
+CommandLineParser::CommandLineParser(): optionParser_(), preReadDone_(false), commands_()
 {
     optionParser_.addHelpOption();
     optionParser_.addVersionOption();
+    optionParser_.addOption(QCommandLineOption(QStringLiteral("trace"),
+        QStringLiteral("Writes the profiling results of the run into the given file."), QStringLiteral("file")));
+
+    // The options after the command belong to the command.
+    optionParser_.setOptionsAfterPositionalArgumentsMode(QCommandLineParser::ParseAsPositionalArguments);
 }
 
 //-----------------------------------------------------------------------------
@@ -49,12 +56,34 @@ void CommandLineParser::readArguments(QStringList const& arguments)
     preReadDone_ = true;
 }
 
+//-----------------------------------------------------------------------------
+// Function: CommandLineParser::addCommand()
+//-----------------------------------------------------------------------------
+void CommandLineParser::addCommand(CommandLineSupport* command)
+{
+    commands_.append(command);
+}
+
 //-----------------------------------------------------------------------------
 // Function: CommandLineParser::helpOrVersionOptionSet()
 //-----------------------------------------------------------------------------
 bool CommandLineParser::helpOrVersionOptionSet() const
 {
-    return optionParser_.isSet(QStringLiteral("help")) || optionParser_.isSet(QStringLiteral("version"));
+    if (optionParser_.isSet(QStringLiteral("help")) || optionParser_.isSet(QStringLiteral("version")))
+    {
+        return true;
+    }
+
+    QStringList commandArguments = optionParser_.positionalArguments().mid(1);
+    return commandArguments.contains(QStringLiteral("-h")) || commandArguments.contains(QStringLiteral("--help"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: CommandLineParser::traceFile()
+//-----------------------------------------------------------------------------
+QString CommandLineParser::traceFile() const
+{
+    return optionParser_.value(QStringLiteral("trace"));
 }
 
 //-----------------------------------------------------------------------------
@@ -71,18 +100,16 @@ int CommandLineParser::process(QStringList const& arguments, IPluginUtility* uti
     {
         QString command = optionParser_.positionalArguments().first();       
 
-        PluginManager& pluginManager = PluginManager::getInstance();
-        foreach (IPlugin* plugin, pluginManager.getAllPlugins())
+        CommandLineSupport* support = findCommand(command);
+        if (support)
         {
-            CommandLineSupport* support = dynamic_cast<CommandLineSupport*>(plugin);
-            if (support && support->getCommand().compare(command) == 0)
-            {
-                QStringList pluginArguments = arguments;
-                pluginArguments.pop_front();
+            QStringList pluginArguments = arguments;
+            pluginArguments.pop_front();
+            removeTraceOption(pluginArguments, command);
 
-                support->process(pluginArguments, utility);
-                return 0;
-            }
+            ProfilingScope profilingScope("CommandLineSupport::process");
+            support->process(pluginArguments, utility);
+            return 0;
         }
     }
      
@@ -116,14 +143,14 @@ QString CommandLineParser::helpText()
         "\n"
         "The available commands are:\n");
 
-    PluginManager& pluginManager = PluginManager::getInstance();
-    foreach (IPlugin* plugin, pluginManager.getAllPlugins())
+    foreach (CommandLineSupport* support, commands_)
     {
-        CommandLineSupport* support = dynamic_cast<CommandLineSupport*>(plugin);
-        if (support)
-        {
-            text.append(QString("  %1\n").arg(support->getCommand()));
-        }
+        text.append(QString("  %1\n").arg(support->getCommand()));
+    }
+
+    foreach (QString const& command, PluginManager::getInstance().getCommands())
+    {
+        text.append(QString("  %1\n").arg(command));
     }
 
     text.append(
@@ -133,7 +160,51 @@ QString CommandLineParser::helpText()
         "\n"
         "Options:\n"
         "  -h, --help  Displays this help.\n"
-        "  -v, --version   Displays version information.\n");
+        "  -v, --version   Displays version information.\n"
+        "  --trace <file>  Writes a Chrome trace of the run into the given file.\n");
 
     return text;
 }
+
+//-----------------------------------------------------------------------------
+// Function: CommandLineParser::findCommand()
+//-----------------------------------------------------------------------------
+CommandLineSupport* CommandLineParser::findCommand(QString const& command) const
+{
+    foreach (CommandLineSupport* support, commands_)
+    {
+        if (support->getCommand().compare(command) == 0)
+        {
+            return support;
+        }
+    }
+
+    // Only the plugin running the command is loaded.
+    return PluginManager::getInstance().findCommandLinePlugin(command);
+}
+
+//-----------------------------------------------------------------------------
+// Function: CommandLineParser::removeTraceOption()
+//-----------------------------------------------------------------------------
+void CommandLineParser::removeTraceOption(QStringList& arguments, QString const& command)
+{
+    // Options after the command belong to the command and are passed on as given.
+    for (int i = 0; i < arguments.size() && arguments.at(i) != command; ++i)
+    {
+        if (arguments.at(i) == QLatin1String("--trace"))
+        {
+            arguments.removeAt(i);
+            if (i < arguments.size())
+            {
+                arguments.removeAt(i);
+            }
+
+            return;
+        }
+        else if (arguments.at(i).startsWith(QLatin1String("--trace=")))
+        {
+            arguments.removeAt(i);
+            return;
+        }
+    }
+}
@@ -13,8 +13,10 @@
 #define COMMANDLINEPARSER
 
 #include <QCommandLineParser>
+#include <QList>
 #include <QStringList>
 
+class CommandLineSupport;
 class LibraryInterface;
 class IPluginUtility;
 
@@ -40,14 +42,26 @@ public:
     void readArguments(QStringList const& arguments);
 
     /*!
-     *  Checks if help or version option is set.
+     *  Adds a command that is available without loading any plugins.
      *
-     *      @param [in] arguments   The list of command line arguments to check.
+     *      @param [in] command     The command to add. The ownership is not transferred.
+     */
+    void addCommand(CommandLineSupport* command);
+
+    /*!
+     *  Checks if help or version option is set, or the help option is given to the command.
      *
      *      @return True, if help or verion option is set, otherwise false.
      */
     bool helpOrVersionOptionSet() const;
 
+    /*!
+     *  Gets the file for the profiling results given with the trace option.
+     *
+     *      @return The path of the trace file, or an empty string if the option is not set.
+     */
+    QString traceFile() const;
+
     /*!
      *  Processes the given command line arguments and executes accordingly.
      *
@@ -67,11 +81,31 @@ private:
      */
     QString helpText();
 
+    /*!
+     *  Finds the command to run.
+     *
+     *      @param [in] command     The name of the command.
+     *
+     *      @return The command, or null if no command with the name is available.
+     */
+    CommandLineSupport* findCommand(QString const& command) const;
+
+    /*!
+     *  Removes the trace option and its value given before the command from the arguments passed to a plugin.
+     *
+     *      @param [in/out] arguments   The plugin arguments.
+     *      @param [in]     command     The command run by the plugin.
+     */
+    static void removeTraceOption(QStringList& arguments, QString const& command);
+
     // Parser for command-line options.
     QCommandLineParser optionParser_;   
 
     // Flag to indicate if arguments are read before process();
     bool preReadDone_;
+
+    // The commands available without plugins.
+    QList<CommandLineSupport*> commands_;
 };
 
 #endif 
@@ -12,7 +12,9 @@
 #include "messageconsole.h"
 
 #include <common/KactusColors.h>
+#include <common/Profiler.h>
 
+#include <QFileDialog>
 #include <QMenu>
 
 //-----------------------------------------------------------------------------
@@ -22,7 +24,10 @@ MessageConsole::MessageConsole(QWidget *parent):
 QPlainTextEdit(parent),
     copyAction_(tr("Copy"), this),
     selectAllAction_(tr("Select all"), this),
-    clearAction_(tr("Clear"), this)
+    clearAction_(tr("Clear"), this),
+    profilingAction_(tr("Collect profiling data"), this),
+    showProfilingAction_(tr("Show profiling results"), this),
+    exportProfilingAction_(tr("Export profiling trace..."), this)
 {
 	setReadOnly(true);
     setUndoRedoEnabled(false);
@@ -33,6 +38,13 @@ QPlainTextEdit(parent),
 	connect(&selectAllAction_, SIGNAL(triggered()), this, SLOT(selectAll()), Qt::UniqueConnection);
 	connect(&clearAction_, SIGNAL(triggered()),	this, SLOT(clear()), Qt::UniqueConnection);
 	connect(this, SIGNAL(copyAvailable(bool)), &copyAction_, SLOT(setEnabled(bool)), Qt::UniqueConnection);
+
+    profilingAction_.setCheckable(true);
+    connect(&profilingAction_, SIGNAL(toggled(bool)), this, SLOT(onProfilingToggled(bool)), Qt::UniqueConnection);
+    connect(&showProfilingAction_, SIGNAL(triggered()), this, SLOT(onShowProfilingResults()),
+        Qt::UniqueConnection);
+    connect(&exportProfilingAction_, SIGNAL(triggered()), this, SLOT(onExportProfilingTrace()),
+        Qt::UniqueConnection);
 }
 
 //-----------------------------------------------------------------------------
@@ -86,9 +98,55 @@ void MessageConsole::contextMenuEvent(QContextMenuEvent* event)
 	menu.addAction(&selectAllAction_);
 	menu.addAction(&clearAction_);
 
+    // The profiler may have been enabled at startup.
+    profilingAction_.setChecked(Profiler::getInstance().isEnabled());
+
+    menu.addSeparator();
+    menu.addAction(&profilingAction_);
+    menu.addAction(&showProfilingAction_);
+    menu.addAction(&exportProfilingAction_);
+
 	menu.exec(event->globalPos());
 }
 
+//-----------------------------------------------------------------------------
+// Function: MessageConsole::onProfilingToggled()
+//-----------------------------------------------------------------------------
+void MessageConsole::onProfilingToggled(bool enabled)
+{
+    Profiler::getInstance().setEnabled(enabled);
+}
+
+//-----------------------------------------------------------------------------
+// Function: MessageConsole::onShowProfilingResults()
+//-----------------------------------------------------------------------------
+void MessageConsole::onShowProfilingResults()
+{
+    onNoticeMessage(Profiler::getInstance().createSummary());
+}
+
+//-----------------------------------------------------------------------------
+// Function: MessageConsole::onExportProfilingTrace()
+//-----------------------------------------------------------------------------
+void MessageConsole::onExportProfilingTrace()
+{
+    QString filePath = QFileDialog::getSaveFileName(this, tr("Export profiling trace"), QString(),
+        tr("Chrome trace files (*.json)"));
+    if (filePath.isEmpty())
+    {
+        return;
+    }
+
+    if (Profiler::getInstance().writeTrace(filePath))
+    {
+        onNoticeMessage(tr("Profiling trace written into %1.").arg(filePath));
+    }
+    else
+    {
+        onErrorMessage(tr("Could not write the profiling trace into %1.").arg(filePath));
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Function: MessageConsole::setTextColor()
 //-----------------------------------------------------------------------------
@@ -54,6 +54,17 @@ protected:
 	//! Event handler for context menu requests.
 	virtual void contextMenuEvent(QContextMenuEvent* event);
 
+private slots:
+
+    //! Enables or disables collecting the profiling results.
+    void onProfilingToggled(bool enabled);
+
+    //! Prints the summary of the profiling results.
+    void onShowProfilingResults();
+
+    //! Exports the profiling results as a Chrome trace file selected by the user.
+    void onExportProfilingTrace();
+
 private:
 	
 	//! No copying
@@ -72,6 +83,15 @@ private:
 
 	//! Clear all text from the text edit.
 	QAction clearAction_;
+
+    //! Enable collecting the profiling results.
+    QAction profilingAction_;
+
+    //! Print the summary of the profiling results.
+    QAction showProfilingAction_;
+
+    //! Export the profiling results as a trace file.
+    QAction exportProfilingAction_;
 };
 
 #endif // MESSAGECONSOLE_H
@@ -22,6 +22,7 @@
 #include <QApplication>
 #include <QDialogButtonBox>
 #include <QGroupBox>
+#include <QMessageBox>
 #include <QProgressBar>
 #include <QRadioButton>
 #include <QVBoxLayout>
@@ -84,11 +85,20 @@ void SaveHierarchyDialog::accept()
 
     library_->beginSave();
     documentSelectionBuilder_.saveItem(documentSelectionView_->topLevelItem(0));
-    library_->endSave();
-
-    QDialog::accept();
+    bool saveSucceeded = library_->endSave();
 
     QApplication::restoreOverrideCursor();
+
+    if (!saveSucceeded)
+    {
+        // Keep the dialog open so that the user can retry or choose another location.
+        saveProgressBar_->reset();
+        QMessageBox::critical(this, QCoreApplication::applicationName(),
+            tr("All the selected documents could not be written to disk."));
+        return;
+    }
+
+    QDialog::accept();
 }
 
 //-----------------------------------------------------------------------------
@@ -20,11 +20,15 @@
 
 #include <VersionHelper.h>
 
+#include <common/Profiler.h>
+
 #include <library/LibraryHandler.h>
 
 #include <Plugins/PluginSystem/PluginManager.h>
 #include <Plugins/PluginSystem/PluginUtilityAdapter.h>
 
+#include <wizards/ComponentWizard/ImportCommand.h>
+
 #include <settings/SettingsUpdater.h>
 
 #include <QApplication>
@@ -119,6 +123,21 @@ int main(int argc, char *argv[])
     QSettings settings;
     SettingsUpdater::runUpgrade(settings, mediator.data());
 
+    ImportCommand importCommand;
+
+    CommandLineParser parser;
+    parser.addCommand(&importCommand);
+    if (!startGui(argc))
+    {
+        parser.readArguments(application->arguments());
+    }
+
+    // Profiling is enabled before the plugins and the library are loaded to include the startup.
+    if (qEnvironmentVariableIsSet("KACTUS2_PROFILE") || !parser.traceFile().isEmpty())
+    {
+        Profiler::getInstance().setEnabled(true);
+    }
+
     loadPlugins(settings);
 
     QScopedPointer<LibraryHandler> library(new LibraryHandler(0, mediator.data(), 0));
@@ -157,16 +176,22 @@ int main(int argc, char *argv[])
     else // Run console.
     {        
         QStringList arguments = application->arguments();
-        CommandLineParser parser;
-
-        parser.readArguments(arguments);
 
+        // Command-line runs use only a few documents, so they are read on demand.
         if (!parser.helpOrVersionOptionSet())
         {
-            library->searchForIPXactFiles();
+            library->indexIPXactFiles();
         }
 
         PluginUtilityAdapter utility(library.data(), mediator.data(), VersionHelper::createVersionString(), 0);
-        return parser.process(arguments, &utility);
+        int result = parser.process(arguments, &utility);
+
+        QString traceFile = parser.traceFile();
+        if (!traceFile.isEmpty() && !Profiler::getInstance().writeTrace(traceFile))
+        {
+            mediator->showError(QObject::tr("Could not write the profiling results into %1.").arg(traceFile));
+        }
+
+        return result;
     }   
 }
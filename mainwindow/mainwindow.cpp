@@ -35,6 +35,7 @@
 #include <mainwindow/SaveHierarchy/SaveHierarchyDialog.h>
 
 #include <common/NameGenerationPolicy.h>
+#include <common/Profiler.h>
 #include <common/dialogs/LibrarySettingsDialog/LibrarySettingsDialog.h>
 #include <common/dialogs/NewDesignDialog/NewDesignDialog.h>
 #include <common/dialogs/newObjectDialog/newobjectdialog.h>
@@ -1275,7 +1276,10 @@ void MainWindow::runGeneratorPlugin(QAction* action)
     PluginUtilityAdapter adapter(libraryHandler_, messageChannel_, VersionHelper::createVersionString(), this);
 
     // Run generator.
-    plugin->runGenerator(&adapter, component, design, designConfiguration);
+    {
+        ProfilingScope profilingScope("IGeneratorPlugin::runGenerator");
+        plugin->runGenerator(&adapter, component, design, designConfiguration);
+    }
 
     // Refresh the document.
     doc->refresh();
@@ -1712,7 +1716,10 @@ void MainWindow::createDesign(KactusAttribute::ProductHierarchy prodHier, Kactus
         success = false;
     }
 
-    libraryHandler_->endSave();
+    if (!libraryHandler_->endSave())
+    {
+        success = false;
+    }
 
     if (success)
     {
@@ -1827,7 +1834,10 @@ void MainWindow::createDesignForExistingComponent(VLNV const& vlnv)
         success = false;
     }
 
-    libraryHandler_->endSave();
+    if (!libraryHandler_->endSave())
+    {
+        success = false;
+    }
 
     if (success)
     {
@@ -1952,7 +1962,10 @@ void MainWindow::createSWDesign(VLNV const& vlnv, QString const& directory)
         success = false;
     }
 
-    libraryHandler_->endSave();
+    if (!libraryHandler_->endSave())
+    {
+        success = false;
+    }
 
     if (success)
     {
@@ -2078,7 +2091,10 @@ void MainWindow::createSWDesign(VLNV const& vlnv)
         success = false;
     }
 
-    libraryHandler_->endSave();
+    if (!libraryHandler_->endSave())
+    {
+        success = false;
+    }
 
     if (success)
     {
@@ -2205,7 +2221,10 @@ void MainWindow::createSystem(VLNV const& compVLNV, QString const& viewName, VLN
         }
     }
 
-    libraryHandler_->endSave();
+    if (!libraryHandler_->endSave())
+    {
+        success = false;
+    }
 
     if (success)
     {
@@ -2309,7 +2328,10 @@ void MainWindow::createSystemDesign(VLNV const& vlnv)
         success = false;
     }
 
-    libraryHandler_->endSave();
+    if (!libraryHandler_->endSave())
+    {
+        success = false;
+    }
 
     if (success)
     {
@@ -0,0 +1,270 @@
+//-----------------------------------------------------------------------------
+// File: SyntheticLibraryGenerator.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: Kactus2 team
+// Date: 19.10.2026
+//
+// Description:
+// Creates a deterministic synthetic IP-XACT library for benchmarks.
+//-----------------------------------------------------------------------------
+
+#include "SyntheticLibraryGenerator.h"
+
+#include <IPXACTmodels/common/ConfigurableVLNVReference.h>
+#include <IPXACTmodels/common/Parameter.h>
+
+#include <IPXACTmodels/Component/AddressBlock.h>
+#include <IPXACTmodels/Component/Component.h>
+#include <IPXACTmodels/Component/ComponentInstantiation.h>
+#include <IPXACTmodels/Component/DesignInstantiation.h>
+#include <IPXACTmodels/Component/Field.h>
+#include <IPXACTmodels/Component/MemoryMap.h>
+#include <IPXACTmodels/Component/Port.h>
+#include <IPXACTmodels/Component/Register.h>
+#include <IPXACTmodels/Component/View.h>
+
+#include <IPXACTmodels/Design/AdHocConnection.h>
+#include <IPXACTmodels/Design/ComponentInstance.h>
+#include <IPXACTmodels/Design/Design.h>
+#include <IPXACTmodels/Design/PortReference.h>
+
+#include <IPXACTmodels/designConfiguration/DesignConfiguration.h>
+
+const QString SyntheticLibraryGenerator::FLAT_VIEW = QStringLiteral("rtl");
+
+const QString SyntheticLibraryGenerator::HIERARCHICAL_VIEW = QStringLiteral("structural");
+
+namespace
+{
+    //! The vendor and library of the generated documents.
+    const QString VENDOR = QStringLiteral("tut.fi");
+    const QString LIBRARY = QStringLiteral("benchmark");
+}
+
+//-----------------------------------------------------------------------------
+// Function: SyntheticLibraryGenerator::SyntheticLibraryGenerator()
+//-----------------------------------------------------------------------------
+SyntheticLibraryGenerator::SyntheticLibraryGenerator(int size):
+size_(qMax(size, 2)),
+    topVLNV_(VLNV::COMPONENT, VENDOR, LIBRARY, QStringLiteral("top"), QStringLiteral("1.0")),
+    designVLNV_(VLNV::DESIGN, VENDOR, LIBRARY, QStringLiteral("top.design"), QStringLiteral("1.0")),
+    designConfigurationVLNV_(VLNV::DESIGNCONFIGURATION, VENDOR, LIBRARY, QStringLiteral("top.designcfg"),
+        QStringLiteral("1.0"))
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: SyntheticLibraryGenerator::size()
+//-----------------------------------------------------------------------------
+int SyntheticLibraryGenerator::size() const
+{
+    return size_;
+}
+
+//-----------------------------------------------------------------------------
+// Function: SyntheticLibraryGenerator::createLeafComponent()
+//-----------------------------------------------------------------------------
+QSharedPointer<Component> SyntheticLibraryGenerator::createLeafComponent(int index) const
+{
+    QSharedPointer<Component> component(new Component(leafVLNV(index)));
+
+    const QString widthId = QStringLiteral("uuid_width_%1").arg(index);
+
+    QSharedPointer<Parameter> width(new Parameter());
+    width->setName(QStringLiteral("WIDTH"));
+    width->setValueId(widthId);
+    width->setValue(QString::number(8 * (index % 4 + 1)));
+    width->setValueResolve(QStringLiteral("user"));
+    component->getParameters()->append(width);
+
+    // Even ports are inputs and odd ports are outputs, so the connections can always pair them up.
+    for (int i = 0; i < size_; ++i)
+    {
+        QSharedPointer<Port> port(new Port(QStringLiteral("port_%1").arg(i)));
+        port->setDirection(i % 2 == 0 ? DirectionTypes::IN : DirectionTypes::OUT);
+        port->setLeftBound(widthId + QStringLiteral(" - 1"));
+        port->setRightBound(QStringLiteral("0"));
+        component->getPorts()->append(port);
+    }
+
+    QSharedPointer<AddressBlock> block(new AddressBlock(QStringLiteral("registers"), QStringLiteral("0")));
+    block->setRange(QString::number(size_ * 4));
+    block->setWidth(QStringLiteral("32"));
+
+    for (int i = 0; i < size_; ++i)
+    {
+        QSharedPointer<Register> reg(new Register(QStringLiteral("reg_%1").arg(i),
+            QStringLiteral("'h") + QString::number(i * 4, 16), QStringLiteral("32")));
+
+        QSharedPointer<Field> field(new Field(QStringLiteral("value")));
+        field->setBitOffset(QStringLiteral("0"));
+        field->setBitWidth(QStringLiteral("32"));
+        reg->getFields()->append(field);
+
+        block->getRegisterData()->append(reg);
+    }
+
+    QSharedPointer<MemoryMap> memoryMap(new MemoryMap(QStringLiteral("memoryMap")));
+    memoryMap->setAddressUnitBits(QStringLiteral("8"));
+    memoryMap->getMemoryBlocks()->append(block);
+    component->getMemoryMaps()->append(memoryMap);
+
+    QSharedPointer<ComponentInstantiation> instantiation(
+        new ComponentInstantiation(QStringLiteral("rtl_implementation")));
+    instantiation->setLanguage(QStringLiteral("verilog"));
+    component->getComponentInstantiations()->append(instantiation);
+
+    QSharedPointer<View> view(new View(FLAT_VIEW));
+    view->setComponentInstantiationRef(instantiation->name());
+    component->getViews()->append(view);
+
+    return component;
+}
+
+//-----------------------------------------------------------------------------
+// Function: SyntheticLibraryGenerator::createTopComponent()
+//-----------------------------------------------------------------------------
+QSharedPointer<Component> SyntheticLibraryGenerator::createTopComponent() const
+{
+    QSharedPointer<Component> component(new Component(topVLNV_));
+
+    QSharedPointer<DesignInstantiation> designInstantiation(
+        new DesignInstantiation(QStringLiteral("structural_design")));
+    designInstantiation->setDesignReference(
+        QSharedPointer<ConfigurableVLNVReference>(new ConfigurableVLNVReference(designVLNV_)));
+    component->getDesignInstantiations()->append(designInstantiation);
+
+    QSharedPointer<View> view(new View(HIERARCHICAL_VIEW));
+    view->setDesignInstantiationRef(designInstantiation->name());
+    component->getViews()->append(view);
+
+    return component;
+}
+
+//-----------------------------------------------------------------------------
+// Function: SyntheticLibraryGenerator::createDesign()
+//-----------------------------------------------------------------------------
+QSharedPointer<Design> SyntheticLibraryGenerator::createDesign() const
+{
+    QSharedPointer<Design> design(new Design(designVLNV_));
+
+    for (int i = 0; i < size_; ++i)
+    {
+        QSharedPointer<ConfigurableVLNVReference> componentReference(new ConfigurableVLNVReference(leafVLNV(i)));
+        design->getComponentInstances()->append(QSharedPointer<ComponentInstance>(
+            new ComponentInstance(instanceName(i), componentReference)));
+    }
+
+    // Each instance drives the next one, and the last instance drives the first one.
+    for (int i = 0; i < size_; ++i)
+    {
+        const int inputPort = connectedPortIndex(i);
+
+        QSharedPointer<QList<QSharedPointer<PortReference> > > references(
+            new QList<QSharedPointer<PortReference> >());
+        references->append(QSharedPointer<PortReference>(
+            new PortReference(QStringLiteral("port_%1").arg(inputPort + 1), instanceName(i))));
+        references->append(QSharedPointer<PortReference>(
+            new PortReference(QStringLiteral("port_%1").arg(inputPort), instanceName((i + 1) % size_))));
+
+        QSharedPointer<AdHocConnection> connection(new AdHocConnection(QStringLiteral("connection_%1").arg(i)));
+        connection->setInternalPortReferences(references);
+        design->getAdHocConnections()->append(connection);
+    }
+
+    return design;
+}
+
+//-----------------------------------------------------------------------------
+// Function: SyntheticLibraryGenerator::createDesignConfiguration()
+//-----------------------------------------------------------------------------
+QSharedPointer<DesignConfiguration> SyntheticLibraryGenerator::createDesignConfiguration() const
+{
+    QSharedPointer<DesignConfiguration> configuration(new DesignConfiguration(designConfigurationVLNV_));
+    configuration->setDesignRef(designVLNV_);
+
+    for (int i = 0; i < size_; ++i)
+    {
+        configuration->addViewConfiguration(instanceName(i), FLAT_VIEW);
+    }
+
+    return configuration;
+}
+
+//-----------------------------------------------------------------------------
+// Function: SyntheticLibraryGenerator::createLibrary()
+//-----------------------------------------------------------------------------
+QList<QSharedPointer<Document> > SyntheticLibraryGenerator::createLibrary() const
+{
+    QList<QSharedPointer<Document> > documents;
+    documents.append(createTopComponent());
+    documents.append(createDesign());
+    documents.append(createDesignConfiguration());
+
+    for (int i = 0; i < size_; ++i)
+    {
+        documents.append(createLeafComponent(i));
+    }
+
+    return documents;
+}
+
+//-----------------------------------------------------------------------------
+// Function: SyntheticLibraryGenerator::createExpressions()
+//-----------------------------------------------------------------------------
+QStringList SyntheticLibraryGenerator::createExpressions() const
+{
+    const QStringList templates({
+        QStringLiteral("%1"),
+        QStringLiteral("%1 + %2 * 4 - %3"),
+        QStringLiteral("(%1 + %2) * (%3 - 1) / 2"),
+        QStringLiteral("%1 ** 2 % %2"),
+        QStringLiteral("$clog2(%1 * %2)"),
+        QStringLiteral("8'h%4 << %3"),
+        QStringLiteral("%1 >= %2 * %3"),
+        QStringLiteral("~%2 & 'hFF")});
+
+    QStringList expressions;
+    for (int i = 0; i < size_ * templates.size(); ++i)
+    {
+        expressions.append(templates.at(i % templates.size()).arg(QString::number(i + 1),
+            QString::number(i % 7 + 1), QString::number(i % 5 + 1), QString::number(i % 256, 16)));
+    }
+
+    return expressions;
+}
+
+//-----------------------------------------------------------------------------
+// Function: SyntheticLibraryGenerator::documentPath()
+//-----------------------------------------------------------------------------
+QString SyntheticLibraryGenerator::documentPath(QString const& libraryPath, VLNV const& vlnv)
+{
+    return QStringLiteral("%1/%2/%3/%4/%5/%4.%5.xml").arg(libraryPath, vlnv.getVendor(), vlnv.getLibrary(),
+        vlnv.getName(), vlnv.getVersion());
+}
+
+//-----------------------------------------------------------------------------
+// Function: SyntheticLibraryGenerator::leafVLNV()
+//-----------------------------------------------------------------------------
+VLNV SyntheticLibraryGenerator::leafVLNV(int index) const
+{
+    return VLNV(VLNV::COMPONENT, VENDOR, LIBRARY, QStringLiteral("leaf_%1").arg(index), QStringLiteral("1.0"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: SyntheticLibraryGenerator::instanceName()
+//-----------------------------------------------------------------------------
+QString SyntheticLibraryGenerator::instanceName(int index) const
+{
+    return QStringLiteral("leaf_%1_0").arg(index);
+}
+
+//-----------------------------------------------------------------------------
+// Function: SyntheticLibraryGenerator::connectedPortIndex()
+//-----------------------------------------------------------------------------
+int SyntheticLibraryGenerator::connectedPortIndex(int connectionIndex) const
+{
+    return 2 * (connectionIndex % (size_ / 2));
+}
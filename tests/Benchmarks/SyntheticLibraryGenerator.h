@@ -0,0 +1,165 @@
+//-----------------------------------------------------------------------------
+// File: SyntheticLibraryGenerator.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: Kactus2 team
+// Date: 19.10.2026
+//
+// Description:
+// Creates a deterministic synthetic IP-XACT library for benchmarks.
+//-----------------------------------------------------------------------------
+
+#ifndef SYNTHETICLIBRARYGENERATOR_H
+#define SYNTHETICLIBRARYGENERATOR_H
+
+#include <IPXACTmodels/common/VLNV.h>
+
+#include <QList>
+#include <QSharedPointer>
+#include <QString>
+#include <QStringList>
+
+class Component;
+class Design;
+class DesignConfiguration;
+class Document;
+
+//-----------------------------------------------------------------------------
+//! Creates a deterministic synthetic IP-XACT library for benchmarks.
+//!
+//! The library has one hierarchical top component and a number of leaf components. Each leaf component has the
+//! given number of ports and registers. The design of the top component instantiates every leaf component once
+//! and chains the instances together with ad-hoc connections. The same size always produces the same library.
+//-----------------------------------------------------------------------------
+class SyntheticLibraryGenerator
+{
+public:
+
+    /*!
+     *  The constructor.
+     *
+     *      @param [in] size    The number of leaf components, ports, registers, instances and connections.
+     */
+    explicit SyntheticLibraryGenerator(int size);
+
+    //! The destructor.
+    ~SyntheticLibraryGenerator() = default;
+
+    // No copying. No assignments.
+    SyntheticLibraryGenerator(SyntheticLibraryGenerator const& rhs) = delete;
+    SyntheticLibraryGenerator& operator=(SyntheticLibraryGenerator const& rhs) = delete;
+
+    /*!
+     *  Get the size of the generated library.
+     *
+     *      @return The number of leaf components, ports, registers, instances and connections.
+     */
+    int size() const;
+
+    /*!
+     *  Create a leaf component with ports, registers and a flat view.
+     *
+     *      @param [in] index   The index of the leaf component.
+     *
+     *      @return The created component.
+     */
+    QSharedPointer<Component> createLeafComponent(int index) const;
+
+    /*!
+     *  Create the top component with a hierarchical view referencing the design.
+     *
+     *      @return The created component.
+     */
+    QSharedPointer<Component> createTopComponent() const;
+
+    /*!
+     *  Create the design instantiating and connecting the leaf components.
+     *
+     *      @return The created design.
+     */
+    QSharedPointer<Design> createDesign() const;
+
+    /*!
+     *  Create the design configuration selecting the flat views of the instances.
+     *
+     *      @return The created design configuration.
+     */
+    QSharedPointer<DesignConfiguration> createDesignConfiguration() const;
+
+    /*!
+     *  Create all the documents of the library.
+     *
+     *      @return The top component, the design, the design configuration and the leaf components.
+     */
+    QList<QSharedPointer<Document> > createLibrary() const;
+
+    /*!
+     *  Create SystemVerilog expressions of varying complexity.
+     *
+     *      @return The created expressions.
+     */
+    QStringList createExpressions() const;
+
+    /*!
+     *  Get the path of a document within the library directory.
+     *
+     *      @param [in] libraryPath     The root directory of the library.
+     *      @param [in] vlnv            The VLNV of the document.
+     *
+     *      @return The path of the document file.
+     */
+    static QString documentPath(QString const& libraryPath, VLNV const& vlnv);
+
+    //! The name of the flat view in the leaf components.
+    static const QString FLAT_VIEW;
+
+    //! The name of the hierarchical view in the top component.
+    static const QString HIERARCHICAL_VIEW;
+
+private:
+
+    /*!
+     *  Get the VLNV of a leaf component.
+     *
+     *      @param [in] index   The index of the leaf component.
+     *
+     *      @return The VLNV of the leaf component.
+     */
+    VLNV leafVLNV(int index) const;
+
+    /*!
+     *  Get the name of a leaf component instance.
+     *
+     *      @param [in] index   The index of the instance.
+     *
+     *      @return The name of the instance.
+     */
+    QString instanceName(int index) const;
+
+    /*!
+     *  Get the index of the input port the given connection drives.
+     *
+     *      @param [in] connectionIndex     The index of the connection.
+     *
+     *      @return The index of the input port.
+     */
+    int connectedPortIndex(int connectionIndex) const;
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The number of leaf components, ports, registers, instances and connections.
+    int size_;
+
+    //! The VLNV of the top component.
+    VLNV topVLNV_;
+
+    //! The VLNV of the design.
+    VLNV designVLNV_;
+
+    //! The VLNV of the design configuration.
+    VLNV designConfigurationVLNV_;
+};
+
+#endif // SYNTHETICLIBRARYGENERATOR_H
@@ -0,0 +1,481 @@
+//-----------------------------------------------------------------------------
+// File: tst_PerformanceBenchmarks.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: Kactus2 team
+// Date: 19.10.2026
+//
+// Description:
+// Benchmarks for the library, validation and generation on a synthetic IP-XACT library.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+
+#include "SyntheticLibraryGenerator.h"
+
+#include <editors/ComponentEditor/common/ComponentParameterFinder.h>
+#include <editors/ComponentEditor/common/IPXactSystemVerilogParser.h>
+#include <editors/ComponentEditor/common/ListParameterFinder.h>
+#include <editors/ComponentEditor/common/SystemVerilogExpressionParser.h>
+
+#include <IPXACTmodels/Component/Component.h>
+#include <IPXACTmodels/Component/validators/ComponentValidator.h>
+#include <IPXACTmodels/Design/Design.h>
+#include <IPXACTmodels/Design/validator/DesignValidator.h>
+#include <IPXACTmodels/designConfiguration/DesignConfiguration.h>
+
+#include <library/DocumentFileAccess.h>
+#include <library/LibraryLoader.h>
+
+#include <Plugins/common/HDLParser/HDLParserCommon.h>
+#include <Plugins/common/HDLParser/MetaDesign.h>
+#include <Plugins/PluginSystem/GeneratorPlugin/GenerationControl.h>
+#include <Plugins/PluginSystem/GeneratorPlugin/MessagePasser.h>
+#include <Plugins/VerilogGenerator/VerilogWriterFactory/VerilogWriterFactory.h>
+
+#include <tests/MockObjects/LibraryMock.h>
+
+#include <QElapsedTimer>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include <algorithm>
+
+//-----------------------------------------------------------------------------
+//! Benchmarks for the library, validation and generation on a synthetic IP-XACT library.
+//!
+//! The size of the library, the number of measured rounds and the result file can be set with the environment
+//! variables KACTUS2_BENCHMARK_SIZE, KACTUS2_BENCHMARK_ROUNDS and KACTUS2_BENCHMARK_OUTPUT. The optional
+//! KACTUS2_BENCHMARK_REVISION is stored with the results to track them across commits.
+//!
+//! The benchmarks are not run by make check. Build tests/Benchmarks/tst_PerformanceBenchmarks.pro and run the
+//! executable to measure.
+//-----------------------------------------------------------------------------
+class tst_PerformanceBenchmarks : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_PerformanceBenchmarks();
+
+private slots:
+
+    void initTestCase();
+    void cleanupTestCase();
+
+    void benchmarkLibraryParsing();
+
+    void benchmarkDocumentReading();
+    void benchmarkDocumentWriting();
+
+    void benchmarkExpressionParsing();
+
+    void benchmarkComponentValidation();
+    void benchmarkDesignValidation();
+
+    void benchmarkHierarchyParsing();
+
+    void benchmarkVerilogGeneration();
+
+private:
+
+    /*!
+     *  Run and time an operation for the configured number of rounds and store the result.
+     *
+     *      @param [in] name        The name of the benchmark.
+     *      @param [in] workload    The number of items handled in one round.
+     *      @param [in] operation   The measured operation.
+     */
+    template <typename Operation>
+    void measure(QString const& name, int workload, Operation operation);
+
+    /*!
+     *  Get a positive integer from an environment variable.
+     *
+     *      @param [in] variable        The name of the environment variable.
+     *      @param [in] defaultValue    The value to use, if the variable is not set or is invalid.
+     *
+     *      @return The value of the variable.
+     */
+    static int environmentValue(const char* variable, int defaultValue);
+
+    /*!
+     *  Parse the hierarchy of the synthetic top component.
+     *
+     *      @return The parsed meta designs.
+     */
+    QList<QSharedPointer<MetaDesign> > parseHierarchy();
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! Channel for the messages of the benchmarked operations.
+    MessagePasser messages_;
+
+    //! The library holding the synthetic documents in memory.
+    LibraryMock library_;
+
+    //! The generator of the synthetic documents.
+    QScopedPointer<SyntheticLibraryGenerator> generator_;
+
+    //! The synthetic documents.
+    QList<QSharedPointer<Document> > documents_;
+
+    //! The directory the synthetic documents are written into.
+    QTemporaryDir libraryDirectory_;
+
+    //! The paths of the written documents.
+    QStringList documentPaths_;
+
+    //! The number of measured rounds for each benchmark.
+    int rounds_;
+
+    //! The measured results.
+    QJsonArray results_;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_PerformanceBenchmarks::tst_PerformanceBenchmarks()
+//-----------------------------------------------------------------------------
+tst_PerformanceBenchmarks::tst_PerformanceBenchmarks():
+messages_(),
+    library_(this),
+    generator_(),
+    documents_(),
+    libraryDirectory_(),
+    documentPaths_(),
+    rounds_(environmentValue("KACTUS2_BENCHMARK_ROUNDS", 5)),
+    results_()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PerformanceBenchmarks::measure()
+//-----------------------------------------------------------------------------
+template <typename Operation>
+void tst_PerformanceBenchmarks::measure(QString const& name, int workload, Operation operation)
+{
+    // The first round warms up the caches and is not measured.
+    operation();
+
+    QVector<qint64> durations;
+    durations.reserve(rounds_);
+
+    QElapsedTimer timer;
+    for (int i = 0; i < rounds_; ++i)
+    {
+        timer.start();
+        operation();
+        durations.append(timer.nsecsElapsed());
+    }
+
+    std::sort(durations.begin(), durations.end());
+
+    qint64 total = 0;
+    for (qint64 duration : durations)
+    {
+        total += duration;
+    }
+
+    const double minimum = durations.first() / 1000000.0;
+    const double median = durations.at(durations.size() / 2) / 1000000.0;
+    const double mean = total / 1000000.0 / durations.size();
+
+    QJsonObject result;
+    result.insert(QStringLiteral("name"), name);
+    result.insert(QStringLiteral("workload"), workload);
+    result.insert(QStringLiteral("rounds"), rounds_);
+    result.insert(QStringLiteral("minimumMs"), minimum);
+    result.insert(QStringLiteral("medianMs"), median);
+    result.insert(QStringLiteral("meanMs"), mean);
+    results_.append(result);
+
+    qDebug().noquote() << QStringLiteral("%1: %2 ms median, %3 ms minimum, %4 item(s)").arg(name,
+        QString::number(median, 'f', 3), QString::number(minimum, 'f', 3), QString::number(workload));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PerformanceBenchmarks::environmentValue()
+//-----------------------------------------------------------------------------
+int tst_PerformanceBenchmarks::environmentValue(const char* variable, int defaultValue)
+{
+    bool isNumber = false;
+    int value = qEnvironmentVariableIntValue(variable, &isNumber);
+    if (isNumber && value > 0)
+    {
+        return value;
+    }
+
+    return defaultValue;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PerformanceBenchmarks::initTestCase()
+//-----------------------------------------------------------------------------
+void tst_PerformanceBenchmarks::initTestCase()
+{
+    QVERIFY(libraryDirectory_.isValid());
+
+    generator_.reset(new SyntheticLibraryGenerator(environmentValue("KACTUS2_BENCHMARK_SIZE", 100)));
+    documents_ = generator_->createLibrary();
+
+    DocumentFileAccess fileAccess(&messages_);
+    for (QSharedPointer<Document> const& document : documents_)
+    {
+        library_.addComponent(document);
+
+        QString path = SyntheticLibraryGenerator::documentPath(libraryDirectory_.path(), document->getVlnv());
+        QVERIFY(QDir().mkpath(QFileInfo(path).absolutePath()));
+        QVERIFY(fileAccess.writeDocument(document, path));
+
+        documentPaths_.append(path);
+    }
+
+    // The library locations are read from the settings of a separate application, not from the user settings.
+    QCoreApplication::setOrganizationDomain(QStringLiteral("tut.fi"));
+    QCoreApplication::setOrganizationName(QStringLiteral("TUT"));
+    QCoreApplication::setApplicationName(QStringLiteral("Kactus2_benchmarks"));
+
+    QSettings settings;
+    settings.setValue(QStringLiteral("Library/ActiveLocations"), QStringList(libraryDirectory_.path()));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PerformanceBenchmarks::cleanupTestCase()
+//-----------------------------------------------------------------------------
+void tst_PerformanceBenchmarks::cleanupTestCase()
+{
+    QSettings().remove(QStringLiteral("Library/ActiveLocations"));
+
+    QString outputPath = qEnvironmentVariable("KACTUS2_BENCHMARK_OUTPUT",
+        QStringLiteral("benchmark_results.json"));
+
+    QJsonObject report;
+    report.insert(QStringLiteral("revision"), qEnvironmentVariable("KACTUS2_BENCHMARK_REVISION"));
+    report.insert(QStringLiteral("date"), QDateTime::currentDateTimeUtc().toString(Qt::ISODate));
+    report.insert(QStringLiteral("qtVersion"), QString::fromLatin1(qVersion()));
+    report.insert(QStringLiteral("size"), generator_->size());
+    report.insert(QStringLiteral("results"), results_);
+
+    QFile outputFile(outputPath);
+    QVERIFY(outputFile.open(QIODevice::WriteOnly | QIODevice::Truncate));
+    QVERIFY(outputFile.write(QJsonDocument(report).toJson()) != -1);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PerformanceBenchmarks::benchmarkLibraryParsing()
+//-----------------------------------------------------------------------------
+void tst_PerformanceBenchmarks::benchmarkLibraryParsing()
+{
+    LibraryLoader loader(&messages_);
+
+    int foundDocuments = 0;
+    measure(QStringLiteral("LibraryLoader::parseLibrary"), documentPaths_.size(), [&]()
+    {
+        foundDocuments = loader.parseLibrary().size();
+    });
+
+    QCOMPARE(foundDocuments, documentPaths_.size());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PerformanceBenchmarks::benchmarkDocumentReading()
+//-----------------------------------------------------------------------------
+void tst_PerformanceBenchmarks::benchmarkDocumentReading()
+{
+    DocumentFileAccess fileAccess(&messages_);
+
+    int readDocuments = 0;
+    measure(QStringLiteral("DocumentFileAccess::readDocument"), documentPaths_.size(), [&]()
+    {
+        readDocuments = 0;
+        for (QString const& path : documentPaths_)
+        {
+            if (fileAccess.readDocument(path).isNull() == false)
+            {
+                readDocuments++;
+            }
+        }
+    });
+
+    QCOMPARE(readDocuments, documentPaths_.size());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PerformanceBenchmarks::benchmarkDocumentWriting()
+//-----------------------------------------------------------------------------
+void tst_PerformanceBenchmarks::benchmarkDocumentWriting()
+{
+    QTemporaryDir outputDirectory;
+    QVERIFY(outputDirectory.isValid());
+
+    QStringList outputPaths;
+    for (QSharedPointer<Document> const& document : documents_)
+    {
+        QString path = SyntheticLibraryGenerator::documentPath(outputDirectory.path(), document->getVlnv());
+        QVERIFY(QDir().mkpath(QFileInfo(path).absolutePath()));
+
+        outputPaths.append(path);
+    }
+
+    DocumentFileAccess fileAccess(&messages_);
+
+    bool allWritten = true;
+    measure(QStringLiteral("DocumentFileAccess::writeDocument"), documents_.size(), [&]()
+    {
+        for (int i = 0; i < documents_.size(); ++i)
+        {
+            allWritten &= fileAccess.writeDocument(documents_.at(i), outputPaths.at(i));
+        }
+    });
+
+    QVERIFY(allWritten);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PerformanceBenchmarks::benchmarkExpressionParsing()
+//-----------------------------------------------------------------------------
+void tst_PerformanceBenchmarks::benchmarkExpressionParsing()
+{
+    SystemVerilogExpressionParser parser;
+    QStringList expressions = generator_->createExpressions();
+
+    int validExpressions = 0;
+    measure(QStringLiteral("SystemVerilogExpressionParser::parseExpression"), expressions.size(), [&]()
+    {
+        validExpressions = 0;
+        for (QString const& expression : expressions)
+        {
+            bool isValid = false;
+            parser.parseExpression(expression, &isValid);
+            if (isValid)
+            {
+                validExpressions++;
+            }
+        }
+    });
+
+    QCOMPARE(validExpressions, expressions.size());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PerformanceBenchmarks::benchmarkComponentValidation()
+//-----------------------------------------------------------------------------
+void tst_PerformanceBenchmarks::benchmarkComponentValidation()
+{
+    QList<QSharedPointer<Component> > components;
+    for (QSharedPointer<Document> const& document : documents_)
+    {
+        QSharedPointer<Component> component = document.dynamicCast<Component>();
+        if (component)
+        {
+            components.append(component);
+        }
+    }
+
+    QSharedPointer<ComponentParameterFinder> finder(new ComponentParameterFinder(QSharedPointer<Component>()));
+    ComponentValidator validator(QSharedPointer<ExpressionParser>(new IPXactSystemVerilogParser(finder)),
+        &library_);
+
+    // All the errors are searched, so the whole component is always validated.
+    QVector<QString> errors;
+    measure(QStringLiteral("ComponentValidator::findErrorsIn"), components.size(), [&]()
+    {
+        errors.clear();
+        for (QSharedPointer<Component> const& component : components)
+        {
+            finder->setComponent(component);
+            validator.findErrorsIn(errors, component);
+        }
+    });
+
+    QVERIFY2(errors.isEmpty(), qPrintable(QStringList(errors.toList()).join(QLatin1Char('\n'))));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PerformanceBenchmarks::benchmarkDesignValidation()
+//-----------------------------------------------------------------------------
+void tst_PerformanceBenchmarks::benchmarkDesignValidation()
+{
+    QSharedPointer<Design> design = generator_->createDesign();
+
+    QSharedPointer<ListParameterFinder> finder(new ListParameterFinder());
+    finder->setParameterList(design->getParameters());
+
+    DesignValidator validator(QSharedPointer<ExpressionParser>(new IPXactSystemVerilogParser(finder)), &library_);
+
+    QVector<QString> errors;
+    measure(QStringLiteral("DesignValidator::findErrorsIn"), design->getComponentInstances()->size(), [&]()
+    {
+        errors.clear();
+        validator.findErrorsIn(errors, design);
+    });
+
+    QVERIFY2(errors.isEmpty(), qPrintable(QStringList(errors.toList()).join(QLatin1Char('\n'))));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PerformanceBenchmarks::benchmarkHierarchyParsing()
+//-----------------------------------------------------------------------------
+void tst_PerformanceBenchmarks::benchmarkHierarchyParsing()
+{
+    QList<QSharedPointer<MetaDesign> > designs;
+    measure(QStringLiteral("MetaDesign::parseHierarchy"), generator_->size(), [&]()
+    {
+        designs = parseHierarchy();
+    });
+
+    QCOMPARE(designs.size(), 1);
+    QCOMPARE(designs.first()->getInstances()->size(), generator_->size());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PerformanceBenchmarks::benchmarkVerilogGeneration()
+//-----------------------------------------------------------------------------
+void tst_PerformanceBenchmarks::benchmarkVerilogGeneration()
+{
+    QList<QSharedPointer<MetaDesign> > designs = parseHierarchy();
+    QCOMPARE(designs.size(), 1);
+
+    GenerationSettings settings;
+    settings.generateInterfaces_ = false;
+
+    QString output;
+    measure(QStringLiteral("VerilogWriterFactory::prepareDesign"), generator_->size(), [&]()
+    {
+        VerilogWriterFactory factory(&library_, &messages_, &settings, QStringLiteral("benchmark"),
+            QStringLiteral("benchmark"));
+
+        QList<QSharedPointer<GenerationOutput> > documents = factory.prepareDesign(designs);
+        for (QSharedPointer<GenerationOutput> const& document : documents)
+        {
+            document->write(QString());
+            output = document->fileContent_;
+        }
+    });
+
+    QVERIFY(output.contains(QStringLiteral("module top")));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_PerformanceBenchmarks::parseHierarchy()
+//-----------------------------------------------------------------------------
+QList<QSharedPointer<MetaDesign> > tst_PerformanceBenchmarks::parseHierarchy()
+{
+    QSharedPointer<Component> topComponent = generator_->createTopComponent();
+
+    GenerationTuple input;
+    input.component = topComponent;
+    input.design = generator_->createDesign();
+    input.designConfiguration = generator_->createDesignConfiguration();
+    input.messages = &messages_;
+
+    return MetaDesign::parseHierarchy(&library_, input, topComponent->getViews()->first());
+}
+
+QTEST_GUILESS_MAIN(tst_PerformanceBenchmarks)
+
+#include "tst_PerformanceBenchmarks.moc"
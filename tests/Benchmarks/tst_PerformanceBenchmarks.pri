@@ -0,0 +1,76 @@
+HEADERS += ../../common/Profiler.h \
+    ../../library/DocumentFileAccess.h \
+    ../../library/LibraryLoader.h \
+    ../../common/ui/MessageMediator.h \
+    ../../IPXACTmodels/utilities/ComponentSearch.h \
+    ../../Plugins/VerilogGenerator/CommentWriter/CommentWriter.h \
+    ../../Plugins/VerilogGenerator/ComponentInstanceVerilogWriter/ComponentInstanceVerilogWriter.h \
+    ../../editors/ComponentEditor/common/ComponentParameterFinder.h \
+    ../../Plugins/VerilogGenerator/ComponentVerilogWriter/ComponentVerilogWriter.h \
+    ../../editors/ComponentEditor/common/ExpressionFormatter.h \
+    ../../Plugins/PluginSystem/GeneratorPlugin/GenerationControl.h \
+    ../../Plugins/common/HDLParser/HDLParserCommon.h \
+    ../../editors/ComponentEditor/common/IPXactSystemVerilogParser.h \
+    ../../Plugins/PluginSystem/GeneratorPlugin/IWriterFactory.h \
+    ../../Plugins/common/PortSorter/InterfaceDirectionNameSorter.h \
+    ../../editors/ComponentEditor/common/ListParameterFinder.h \
+    ../../Plugins/common/HDLParser/MetaComponent.h \
+    ../../Plugins/common/HDLParser/MetaDesign.h \
+    ../../Plugins/common/HDLParser/MetaInstance.h \
+    ../../Plugins/VerilogGenerator/ModelParameterVerilogWriter/ModelParameterVerilogWriter.h \
+    ../../editors/ComponentEditor/common/MultipleParameterFinder.h \
+    ../../Plugins/PluginSystem/GeneratorPlugin/OutputControl.h \
+    ../../editors/ComponentEditor/common/ParameterFinder.h \
+    ../../Plugins/common/PortSorter/PortSorter.h \
+    ../../Plugins/VerilogGenerator/VerilogPortWriter/VerilogPortWriter.h \
+    ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
+    ../../Plugins/VerilogGenerator/TextBodyWriter/TextBodyWriter.h \
+    ../../editors/common/TopComponentParameterFinder.h \
+    ../../Plugins/VerilogGenerator/VerilogAssignmentWriter/VerilogAssignmentWriter.h \
+    ../../Plugins/VerilogGenerator/VerilogWriterFactory/VerilogDocument.h \
+    ../../Plugins/VerilogGenerator/VerilogHeaderWriter/VerilogHeaderWriter.h \
+    ../../Plugins/VerilogGenerator/VerilogInterconnectionWriter/VerilogInterconnectionWriter.h \
+    ../../Plugins/VerilogImport/VerilogSyntax.h \
+    ../../Plugins/VerilogGenerator/VerilogWireWriter/VerilogWireWriter.h \
+    ../../Plugins/VerilogGenerator/VerilogWriterFactory/VerilogWriterFactory.h \
+    ../../Plugins/VerilogGenerator/common/Writer.h \
+    ../../Plugins/VerilogGenerator/common/WriterGroup.h \
+    ../../Plugins/PluginSystem/GeneratorPlugin/MessagePasser.h \
+    ../../Plugins/VerilogGenerator/VerilogPortWriter/VerilogTopDefaultWriter.h \
+    ../MockObjects/LibraryMock.h \
+    ./SyntheticLibraryGenerator.h
+SOURCES += ../../common/Profiler.cpp \
+    ../../library/DocumentFileAccess.cpp \
+    ../../library/LibraryLoader.cpp \
+    ../../Plugins/VerilogGenerator/VerilogPortWriter/VerilogTopDefaultWriter.cpp \
+    ../../IPXACTmodels/utilities/ComponentSearch.cpp \
+    ../../Plugins/VerilogGenerator/CommentWriter/CommentWriter.cpp \
+    ../../Plugins/VerilogGenerator/ComponentInstanceVerilogWriter/ComponentInstanceVerilogWriter.cpp \
+    ../../editors/ComponentEditor/common/ComponentParameterFinder.cpp \
+    ../../Plugins/VerilogGenerator/ComponentVerilogWriter/ComponentVerilogWriter.cpp \
+    ../../editors/ComponentEditor/common/ExpressionFormatter.cpp \
+    ../../editors/ComponentEditor/common/IPXactSystemVerilogParser.cpp \
+    ../../Plugins/common/PortSorter/InterfaceDirectionNameSorter.cpp \
+    ../MockObjects/LibraryMock.cpp \
+    ../../editors/ComponentEditor/common/ListParameterFinder.cpp \
+    ../../Plugins/PluginSystem/GeneratorPlugin/MessagePasser.cpp \
+    ../../Plugins/common/HDLParser/MetaComponent.cpp \
+    ../../Plugins/common/HDLParser/MetaDesign.cpp \
+    ../../Plugins/common/HDLParser/MetaInstance.cpp \
+    ../../Plugins/VerilogGenerator/ModelParameterVerilogWriter/ModelParameterVerilogWriter.cpp \
+    ../../editors/ComponentEditor/common/MultipleParameterFinder.cpp \
+    ../../Plugins/PluginSystem/GeneratorPlugin/OutputControl.cpp \
+    ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
+    ../../Plugins/VerilogGenerator/TextBodyWriter/TextBodyWriter.cpp \
+    ../../editors/common/TopComponentParameterFinder.cpp \
+    ../../Plugins/VerilogGenerator/VerilogAssignmentWriter/VerilogAssignmentWriter.cpp \
+    ../../Plugins/VerilogGenerator/VerilogWriterFactory/VerilogDocument.cpp \
+    ../../Plugins/VerilogGenerator/VerilogHeaderWriter/VerilogHeaderWriter.cpp \
+    ../../Plugins/VerilogGenerator/VerilogInterconnectionWriter/VerilogInterconnectionWriter.cpp \
+    ../../Plugins/VerilogImport/VerilogSyntax.cpp \
+    ../../Plugins/VerilogGenerator/VerilogPortWriter/VerilogPortWriter.cpp \
+    ../../Plugins/VerilogGenerator/VerilogWireWriter/VerilogWireWriter.cpp \
+    ../../Plugins/VerilogGenerator/VerilogWriterFactory/VerilogWriterFactory.cpp \
+    ../../Plugins/VerilogGenerator/common/WriterGroup.cpp \
+    ./SyntheticLibraryGenerator.cpp \
+    ./tst_PerformanceBenchmarks.cpp
@@ -0,0 +1,50 @@
+#-----------------------------------------------------------------------------
+# File: tst_PerformanceBenchmarks.pro
+#-----------------------------------------------------------------------------
+# Project: Kactus 2
+# Author: Kactus2 team
+# Date: 19.10.2026
+#
+# Description:
+# Qt project file for running the performance benchmarks.
+# The benchmarks are not part of test_all.pro and are run only when built and run explicitly.
+#-----------------------------------------------------------------------------
+
+TEMPLATE = app
+
+TARGET = tst_PerformanceBenchmarks
+
+QT += core xml gui testlib
+CONFIG += c++11 console
+
+DEFINES += VERILOGGENERATORPLUGIN_LIB
+
+win32:CONFIG(release, debug|release) {
+    LIBS += -L$$PWD/../../executable/ -lIPXACTmodels
+    DESTDIR = ./release
+}
+else:win32:CONFIG(debug, debug|release) {
+    LIBS += -L$$PWD/../../executable/ -lIPXACTmodelsd
+    DESTDIR = ./debug
+}
+else:unix {
+    LIBS += -L$$PWD/../../executable/ -lIPXACTmodels
+    DESTDIR = ./release
+}
+
+INCLUDEPATH += $$PWD/../../
+INCLUDEPATH += $$PWD/../../executable
+INCLUDEPATH += $$PWD/../../executable/Plugins
+INCLUDEPATH += $$DESTDIR
+
+DEPENDPATH += $$PWD/../../
+DEPENDPATH += $$PWD/../../executable
+DEPENDPATH += $$PWD/../../executable/Plugins
+DEPENDPATH += .
+
+OBJECTS_DIR += $$DESTDIR
+
+MOC_DIR += ./generatedFiles
+UI_DIR += ./generatedFiles
+RCC_DIR += ./generatedFiles
+include(tst_PerformanceBenchmarks.pri)
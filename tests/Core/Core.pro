@@ -31,4 +31,6 @@ SUBDIRS += tst_CommandLineParser.pro \
 		   tst_HierarchicalSaveBuildStrategy.pro \
 		   tst_DocumentTreeBuilder.pro \
 		   tst_DocumentGenerator.pro \
-		   tst_MasterSlavePathSearch.pro
+		   tst_MasterSlavePathSearch.pro \
+		   tst_JaroWinklerMatcher.pro \
+		   tst_Profiler.pro
@@ -13,12 +13,14 @@
 
 #include <editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/addressblockgraphitem.h>
 #include <editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/registergraphitem.h>
+#include <editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/registeritemprovider.h>
 #include <editors/ComponentEditor/visualization/memorygapitem.h>
 
 #include <editors/ComponentEditor/common/NullParser.h>
 #include <editors/ComponentEditor/common/SystemVerilogExpressionParser.h>
 
 #include <IPXACTmodels/Component/AddressBlock.h>
+#include <IPXACTmodels/Component/Field.h>
 #include <IPXACTmodels/Component/Register.h>
 #include <IPXACTmodels/Component/RegisterBase.h>
 
@@ -41,10 +43,22 @@ private slots:
 
     void testExpressions();
 
+    void testGapItemsAreReused();
+
+    void testAddingRegistersToExpandedBlock();
+
+    void testRefreshBeforeDeferredLayout();
+
+    void testVirtualizedBlockCreatesItemsForVisibleArea();
+
+    void testIdenticalRegistersAreCollapsed();
+
 private:
     void expandItem(AddressBlockGraphItem* memoryMapItem);
 
     QList<MemoryGapItem*> findMemoryGaps(AddressBlockGraphItem* memoryMapItem);
+
+    QList<RegisterGraphItem*> findRegisterItems(AddressBlockGraphItem* addressBlockItem, bool visibleOnly);
 };
 
 //-----------------------------------------------------------------------------
@@ -247,6 +261,270 @@ void tst_AddressBlockGraphItem::testExpressions()
     delete addressBlockItem;
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_AddressBlockGraphItem::testGapItemsAreReused()
+//-----------------------------------------------------------------------------
+void tst_AddressBlockGraphItem::testGapItemsAreReused()
+{
+    QSharedPointer<AddressBlock> addressBlock(new AddressBlock());
+    addressBlock->setBaseAddress(0);
+    addressBlock->setRange("4");
+
+    QSharedPointer<ExpressionParser> noParser(new NullParser());
+
+    AddressBlockGraphItem* addressBlockItem = new AddressBlockGraphItem(addressBlock, noParser, 0);
+    addressBlockItem->setAddressableUnitBits(8);
+
+    QSharedPointer<Register> reg(new Register());
+    reg->setAddressOffset("1");
+    reg->setSize("8");
+    addressBlock->getRegisterData()->append(reg);
+
+    RegisterGraphItem* registerItem = new RegisterGraphItem(reg, noParser, addressBlockItem);
+    addressBlockItem->addChild(registerItem);
+
+    expandItem(addressBlockItem);
+
+    QList<MemoryGapItem*> initialGaps = findMemoryGaps(addressBlockItem);
+    QCOMPARE(initialGaps.count(), 2);
+
+    addressBlockItem->refresh();
+
+    QList<MemoryGapItem*> refreshedGaps = findMemoryGaps(addressBlockItem);
+    QCOMPARE(refreshedGaps.count(), 2);
+    for (MemoryGapItem* gap : refreshedGaps)
+    {
+        QVERIFY(initialGaps.contains(gap));
+    }
+
+    delete addressBlockItem;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_AddressBlockGraphItem::testAddingRegistersToExpandedBlock()
+//-----------------------------------------------------------------------------
+void tst_AddressBlockGraphItem::testAddingRegistersToExpandedBlock()
+{
+    const int registerCount = 1024;
+
+    QSharedPointer<AddressBlock> addressBlock(new AddressBlock());
+    addressBlock->setBaseAddress(0);
+    addressBlock->setRange(QString::number(registerCount));
+
+    QList<QSharedPointer<Register> > registers;
+    for (int i = 0; i < registerCount; ++i)
+    {
+        QSharedPointer<Register> reg(new Register());
+        reg->setAddressOffset(QString::number(i));
+        reg->setSize("8");
+        registers.append(reg);
+        addressBlock->getRegisterData()->append(reg);
+    }
+
+    QSharedPointer<ExpressionParser> noParser(new NullParser());
+
+    bool lastRegisterVisible = false;
+    qreal lastRegisterPosition = 0;
+
+    QBENCHMARK
+    {
+        AddressBlockGraphItem* addressBlockItem = new AddressBlockGraphItem(addressBlock, noParser, 0);
+        addressBlockItem->setAddressableUnitBits(8);
+        expandItem(addressBlockItem);
+
+        RegisterGraphItem* registerItem = 0;
+        for (QSharedPointer<Register> const& reg : registers)
+        {
+            registerItem = new RegisterGraphItem(reg, noParser, addressBlockItem);
+            addressBlockItem->addChild(registerItem);
+        }
+
+        // The registers are laid out once the control returns to the event loop.
+        QCoreApplication::processEvents();
+
+        lastRegisterVisible = registerItem->isVisible();
+        lastRegisterPosition = registerItem->pos().y();
+
+        delete addressBlockItem;
+    }
+
+    QVERIFY(lastRegisterVisible);
+    QCOMPARE(lastRegisterPosition, qreal(registerCount*VisualizerItem::DEFAULT_HEIGHT));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_AddressBlockGraphItem::testRefreshBeforeDeferredLayout()
+//-----------------------------------------------------------------------------
+void tst_AddressBlockGraphItem::testRefreshBeforeDeferredLayout()
+{
+    const int registerCount = 3;
+
+    QSharedPointer<AddressBlock> addressBlock(new AddressBlock());
+    addressBlock->setBaseAddress(0);
+    addressBlock->setRange(QString::number(registerCount));
+
+    QSharedPointer<ExpressionParser> noParser(new NullParser());
+
+    AddressBlockGraphItem* addressBlockItem = new AddressBlockGraphItem(addressBlock, noParser, 0);
+    addressBlockItem->setAddressableUnitBits(8);
+    expandItem(addressBlockItem);
+
+    QSignalSpy layoutSpy(addressBlockItem, SIGNAL(expandStateChanged()));
+
+    QList<RegisterGraphItem*> registerItems;
+    for (int i = 0; i < registerCount; ++i)
+    {
+        QSharedPointer<Register> reg(new Register());
+        reg->setAddressOffset(QString::number(i));
+        reg->setSize("8");
+        addressBlock->getRegisterData()->append(reg);
+
+        RegisterGraphItem* registerItem = new RegisterGraphItem(reg, noParser, addressBlockItem);
+        addressBlockItem->addChild(registerItem);
+        registerItems.append(registerItem);
+    }
+
+    // A synchronous refresh lays out the children before the deferred layout.
+    addressBlockItem->refresh();
+
+    QCOMPARE(registerItems.last()->pos().y(), qreal(registerCount*VisualizerItem::DEFAULT_HEIGHT));
+
+    layoutSpy.clear();
+    QCoreApplication::processEvents();
+
+    // The deferred layout only notifies the scene once the layout is done.
+    QCOMPARE(layoutSpy.count(), 1);
+    for (int i = 0; i < registerCount; ++i)
+    {
+        QVERIFY(registerItems.at(i)->isVisible());
+        QCOMPARE(registerItems.at(i)->pos().y(), qreal((i + 1)*VisualizerItem::DEFAULT_HEIGHT));
+    }
+
+    delete addressBlockItem;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_AddressBlockGraphItem::testVirtualizedBlockCreatesItemsForVisibleArea()
+//-----------------------------------------------------------------------------
+void tst_AddressBlockGraphItem::testVirtualizedBlockCreatesItemsForVisibleArea()
+{
+    const int registerCount = AddressBlockGraphItem::VIRTUALIZATION_THRESHOLD;
+
+    QSharedPointer<AddressBlock> addressBlock(new AddressBlock());
+    addressBlock->setBaseAddress(0);
+    addressBlock->setRange(QString::number(registerCount));
+
+    QList<QSharedPointer<Register> > registers;
+    for (int i = 0; i < registerCount; ++i)
+    {
+        QSharedPointer<Register> reg(new Register());
+        reg->setName("reg" + QString::number(i));
+        reg->setAddressOffset(QString::number(i));
+        reg->setSize("8");
+
+        // Different fields keep the registers from being collapsed into one item.
+        QSharedPointer<Field> field(new Field("field" + QString::number(i)));
+        field->setBitOffset("0");
+        field->setBitWidth("8");
+        reg->getFields()->append(field);
+
+        addressBlock->getRegisterData()->append(reg);
+        registers.append(reg);
+    }
+
+    QSharedPointer<ExpressionParser> noParser(new NullParser());
+
+    AddressBlockGraphItem* addressBlockItem = new AddressBlockGraphItem(addressBlock, noParser, 0);
+    addressBlockItem->setAddressableUnitBits(8);
+    addressBlockItem->refresh();
+
+    QVERIFY(addressBlockItem->isVirtualized());
+    QVERIFY(findRegisterItems(addressBlockItem, false).isEmpty());
+
+    expandItem(addressBlockItem);
+
+    // Only the rows near the block item get items, but the block is as high as all the registers.
+    int margin = RegisterItemProvider::VISIBLE_MARGIN / VisualizerItem::DEFAULT_HEIGHT;
+    QList<RegisterGraphItem*> visibleItems = findRegisterItems(addressBlockItem, true);
+    QCOMPARE(visibleItems.count(), margin);
+    QCOMPARE(addressBlockItem->itemTotalRect().height(), qreal((registerCount + 1)*VisualizerItem::DEFAULT_HEIGHT));
+
+    const int shownRegister = registerCount / 2;
+    const int shownRows = 10;
+    addressBlockItem->setVisibleArea(QRectF(0, shownRegister*VisualizerItem::DEFAULT_HEIGHT,
+        VisualizerItem::DEFAULT_WIDTH, shownRows*VisualizerItem::DEFAULT_HEIGHT));
+
+    // The items of the rows scrolled out of the area are reused.
+    visibleItems = findRegisterItems(addressBlockItem, true);
+    QCOMPARE(visibleItems.count(), shownRows + 2*margin);
+    QCOMPARE(findRegisterItems(addressBlockItem, false).count(), shownRows + 2*margin);
+
+    RegisterGraphItem* shownItem = 0;
+    for (RegisterGraphItem* registerItem : visibleItems)
+    {
+        if (registerItem->getRegister() == registers.at(shownRegister))
+        {
+            shownItem = registerItem;
+        }
+    }
+
+    QVERIFY(shownItem != 0);
+    QCOMPARE(shownItem->pos().x(), qreal(MemoryVisualizationItem::CHILD_INDENTATION));
+    QCOMPARE(shownItem->pos().y(), qreal((shownRegister + 1)*VisualizerItem::DEFAULT_HEIGHT));
+    QCOMPARE(shownItem->getOffset(), quint64(shownRegister));
+    QCOMPARE(shownItem->name(), QString("reg") + QString::number(shownRegister));
+
+    delete addressBlockItem;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_AddressBlockGraphItem::testIdenticalRegistersAreCollapsed()
+//-----------------------------------------------------------------------------
+void tst_AddressBlockGraphItem::testIdenticalRegistersAreCollapsed()
+{
+    const int registerCount = AddressBlockGraphItem::VIRTUALIZATION_THRESHOLD;
+
+    QSharedPointer<AddressBlock> addressBlock(new AddressBlock());
+    addressBlock->setBaseAddress(0);
+    addressBlock->setRange(QString::number(registerCount + 1));
+
+    for (int i = 0; i < registerCount; ++i)
+    {
+        QSharedPointer<Register> reg(new Register());
+        reg->setName("reg" + QString::number(i));
+        reg->setAddressOffset(QString::number(i));
+        reg->setSize("8");
+        addressBlock->getRegisterData()->append(reg);
+    }
+
+    QSharedPointer<ExpressionParser> noParser(new NullParser());
+
+    AddressBlockGraphItem* addressBlockItem = new AddressBlockGraphItem(addressBlock, noParser, 0);
+    addressBlockItem->setAddressableUnitBits(8);
+    addressBlockItem->refresh();
+    expandItem(addressBlockItem);
+
+    QList<RegisterGraphItem*> visibleItems = findRegisterItems(addressBlockItem, true);
+    QCOMPARE(visibleItems.count(), 1);
+
+    RegisterGraphItem* runItem = visibleItems.first();
+    QVERIFY(runItem->name().startsWith("reg0"));
+    QVERIFY(runItem->name().contains("reg" + QString::number(registerCount - 1)));
+    QCOMPARE(runItem->getOffset(), quint64(0));
+    QCOMPARE(runItem->getLastAddress(), quint64(registerCount - 1));
+    QCOMPARE(runItem->pos().y(), qreal(VisualizerItem::DEFAULT_HEIGHT));
+
+    // The address after the registers is shown as a gap.
+    QList<MemoryGapItem*> gaps = findMemoryGaps(addressBlockItem);
+    QCOMPARE(gaps.count(), 1);
+    QCOMPARE(gaps.first()->getDisplayOffset(), quint64(registerCount));
+    QCOMPARE(gaps.first()->pos().y(), qreal(2*VisualizerItem::DEFAULT_HEIGHT));
+
+    QCOMPARE(addressBlockItem->itemTotalRect().height(), qreal(3*VisualizerItem::DEFAULT_HEIGHT));
+
+    delete addressBlockItem;
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_MemoryMapGraphItem::expandItem()
 //-----------------------------------------------------------------------------
@@ -280,6 +558,25 @@ QList<MemoryGapItem*> tst_AddressBlockGraphItem::findMemoryGaps(AddressBlockGrap
     return gaps;
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_AddressBlockGraphItem::findRegisterItems()
+//-----------------------------------------------------------------------------
+QList<RegisterGraphItem*> tst_AddressBlockGraphItem::findRegisterItems(AddressBlockGraphItem* addressBlockItem,
+    bool visibleOnly)
+{
+    QList<RegisterGraphItem*> registerItems;
+    foreach (QGraphicsItem* child, addressBlockItem->childItems())
+    {
+        RegisterGraphItem* registerItem = dynamic_cast<RegisterGraphItem*>(child);
+        if (registerItem && (!visibleOnly || registerItem->isVisible()))
+        {
+            registerItems.append(registerItem);
+        }
+    }
+
+    return registerItems;
+}
+
 QTEST_MAIN(tst_AddressBlockGraphItem)
 
 #include "tst_AddressBlockGraphItem.moc"
@@ -14,12 +14,35 @@
 #include <tests/MockObjects/LibraryMock.h>
 #include <tests/MockObjects/PluginMock.h>
 
+#include <Plugins/PluginSystem/CommandLineSupport.h>
+#include <Plugins/PluginSystem/IPluginUtility.h>
 #include <Plugins/PluginSystem/PluginManager.h>
 #include <Plugins/PluginSystem/GeneratorPlugin/MessagePasser.h>
 #include <Plugins/PluginSystem/PluginUtilityAdapter.h>
 
 #include <mainwindow/CommandLineParser.h>
 
+namespace
+{
+    //-----------------------------------------------------------------------------
+    //! Command available without a plugin.
+    //-----------------------------------------------------------------------------
+    class CommandMock : public CommandLineSupport
+    {
+    public:
+
+        virtual QString getCommand() const override
+        {
+            return QStringLiteral("added");
+        }
+
+        virtual void process(QStringList const& arguments, IPluginUtility* utility) override
+        {
+            utility->printInfo(QStringLiteral("added: ") + arguments.join(QLatin1Char(' ')));
+        }
+    };
+}
+
 class tst_CommandLineParser : public QObject
 {
     Q_OBJECT
@@ -50,6 +73,13 @@ private slots:
 
     void testRunPluginCommand();
     void testPluginHelp();
+
+    void testTraceOptionIsNotPassedToPlugin();
+    void testTraceOptionAfterCommandIsPassedToPlugin();
+    void testTraceOptionAfterCommandIsNotTraced();
+
+    void testRunAddedCommand();
+    void testAddedCommandIsListedInUsage();
 };
 
 tst_CommandLineParser::tst_CommandLineParser(): QObject(0),
@@ -126,6 +156,7 @@ void tst_CommandLineParser::testShowUsage()
         "Options:\n"
         "  -h, --help  Displays this help.\n"
         "  -v, --version   Displays version information.\n"
+        "  --trace <file>  Writes a Chrome trace of the run into the given file.\n"
         );
 
     QVERIFY(parser.helpOrVersionOptionSet());
@@ -209,10 +240,93 @@ void tst_CommandLineParser::testPluginHelp()
     }
 
     QVERIFY(settingsFile.exists() == false);
+    QVERIFY(parser.helpOrVersionOptionSet());
+    QCOMPARE(log_.count(), 1);
+    QCOMPARE(log_.first(), QStringLiteral("mock -h"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_CommandLineParser::testTraceOptionIsNotPassedToPlugin()
+//-----------------------------------------------------------------------------
+void tst_CommandLineParser::testTraceOptionIsNotPassedToPlugin()
+{
+    QString input("testApp --trace trace.json mock -h");
+
+    CommandLineParser parser;
+    parser.readArguments(input.split(QLatin1Char(' ')));
+    parser.process(input.split(QLatin1Char(' ')), &utility_);
+
+    QCOMPARE(parser.traceFile(), QStringLiteral("trace.json"));
     QCOMPARE(log_.count(), 1);
     QCOMPARE(log_.first(), QStringLiteral("mock -h"));
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_CommandLineParser::testTraceOptionAfterCommandIsPassedToPlugin()
+//-----------------------------------------------------------------------------
+void tst_CommandLineParser::testTraceOptionAfterCommandIsPassedToPlugin()
+{
+    QString input("testApp --trace trace.json mock --trace mock.json");
+
+    CommandLineParser parser;
+    parser.readArguments(input.split(QLatin1Char(' ')));
+    parser.process(input.split(QLatin1Char(' ')), &utility_);
+
+    QCOMPARE(parser.traceFile(), QStringLiteral("trace.json"));
+    QCOMPARE(log_.count(), 1);
+    QCOMPARE(log_.first(), QStringLiteral("mock --trace mock.json"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_CommandLineParser::testTraceOptionAfterCommandIsNotTraced()
+//-----------------------------------------------------------------------------
+void tst_CommandLineParser::testTraceOptionAfterCommandIsNotTraced()
+{
+    QString input("testApp mock --trace mock.json");
+
+    CommandLineParser parser;
+    parser.readArguments(input.split(QLatin1Char(' ')));
+    parser.process(input.split(QLatin1Char(' ')), &utility_);
+
+    QVERIFY(parser.traceFile().isEmpty());
+    QCOMPARE(log_.count(), 1);
+    QCOMPARE(log_.first(), QStringLiteral("mock --trace mock.json"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_CommandLineParser::testRunAddedCommand()
+//-----------------------------------------------------------------------------
+void tst_CommandLineParser::testRunAddedCommand()
+{
+    QString input("testApp added -j 2");
+
+    CommandMock command;
+
+    CommandLineParser parser;
+    parser.addCommand(&command);
+    parser.process(input.split(QLatin1Char(' ')), &utility_);
+
+    QCOMPARE(log_.count(), 1);
+    QCOMPARE(log_.first(), QStringLiteral("added: added -j 2"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_CommandLineParser::testAddedCommandIsListedInUsage()
+//-----------------------------------------------------------------------------
+void tst_CommandLineParser::testAddedCommandIsListedInUsage()
+{
+    QString input("testApp -h");
+
+    CommandMock command;
+
+    CommandLineParser parser;
+    parser.addCommand(&command);
+    parser.process(input.split(QLatin1Char(' ')), &utility_);
+
+    QCOMPARE(log_.count(), 1);
+    QVERIFY(log_.first().contains(QStringLiteral("The available commands are:\n  added\n  mock\n")));
+}
+
 QTEST_MAIN(tst_CommandLineParser)
 
 #include "tst_CommandLineParser.moc"
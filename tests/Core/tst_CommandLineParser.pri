@@ -2,13 +2,15 @@
 # This file is generated by the Qt Visual Studio Add-in.
 # ------------------------------------------------------
 
-HEADERS += ../../Plugins/PluginSystem/PluginManager.h \
+HEADERS += ../../common/Profiler.h \
+    ../../Plugins/PluginSystem/PluginManager.h \
     ../../Plugins/PluginSystem/PluginUtilityAdapter.h \
     ../MockObjects/LibraryMock.h \
     ../../mainwindow/CommandLineParser.h \
     ../../Plugins/PluginSystem/GeneratorPlugin/MessagePasser.h \
     ../MockObjects/PluginMock.h
-SOURCES += ../../Plugins/PluginSystem/PluginManager.cpp \
+SOURCES += ../../common/Profiler.cpp \
+    ../../Plugins/PluginSystem/PluginManager.cpp \
     ../../mainwindow/CommandLineParser.cpp \
     ../../Plugins/PluginSystem/GeneratorPlugin/MessagePasser.cpp \
     ../MockObjects/LibraryMock.cpp \
@@ -15,6 +15,7 @@
 
 #include <IPXACTmodels/Component/Component.h>
 #include <IPXACTmodels/Component/Model.h>
+#include <IPXACTmodels/Component/Port.h>
 #include <IPXACTmodels/common/VLNV.h>
 
 #include <wizards/common/ComponentComparator/ComponentComparator.h>
@@ -57,10 +58,16 @@ private slots:
 
     void testDiffMultipleViewsChanged();
 
+    void testDiffLargePortListsFindsOnlyChangedPorts();
+
+    void benchmarkDiffLargeComponents();
+
 private:
 
     ComponentComparator* makeComparator();
 
+    QSharedPointer<Component> createComponentWithPorts(int portCount) const;
+
     //! The comparator to test.
     ComponentComparator* comparator_;
 };
@@ -329,6 +336,69 @@ void tst_ComponentComparator::testDiffMultipleViewsChanged()
     verifyDiffElementAndType(diff.at(3), "view", "view4", IPXactDiff::ADD);
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentComparator::testDiffLargePortListsFindsOnlyChangedPorts()
+//-----------------------------------------------------------------------------
+void tst_ComponentComparator::testDiffLargePortListsFindsOnlyChangedPorts()
+{
+    QSharedPointer<Component> reference = createComponentWithPorts(1000);
+    QSharedPointer<Component> subject = createComponentWithPorts(1000);
+
+    subject->getPorts()->at(10)->setLeftBound("15");
+    subject->getPorts()->removeAt(500);
+    subject->getPorts()->append(QSharedPointer<Port>(new Port("added_port")));
+
+    QList<QSharedPointer<IPXactDiff> > diff = comparator_->diff(reference, subject);
+
+    QCOMPARE(diff.count(), 3);
+    verifyDiffElementAndType(diff.at(0), "port", "port_10", IPXactDiff::MODIFICATION);
+    verifyDiffElementAndType(diff.at(1), "port", "port_500", IPXactDiff::REMOVE);
+    verifyDiffElementAndType(diff.at(2), "port", "added_port", IPXactDiff::ADD);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentComparator::benchmarkDiffLargeComponents()
+//-----------------------------------------------------------------------------
+void tst_ComponentComparator::benchmarkDiffLargeComponents()
+{
+    const int PORT_COUNT = 20000;
+
+    QSharedPointer<Component> reference = createComponentWithPorts(PORT_COUNT);
+    QSharedPointer<Component> subject = createComponentWithPorts(PORT_COUNT);
+
+    for (int i = 0; i < PORT_COUNT; i += 1000)
+    {
+        subject->getPorts()->at(i)->setDefaultValue("1");
+    }
+
+    QList<QSharedPointer<IPXactDiff> > diff;
+    QBENCHMARK
+    {
+        diff = comparator_->diff(reference, subject);
+    }
+
+    QCOMPARE(diff.count(), PORT_COUNT / 1000);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentComparator::createComponentWithPorts()
+//-----------------------------------------------------------------------------
+QSharedPointer<Component> tst_ComponentComparator::createComponentWithPorts(int portCount) const
+{
+    QSharedPointer<Component> component(new Component());
+
+    for (int i = 0; i < portCount; ++i)
+    {
+        QSharedPointer<Port> port(new Port("port_" + QString::number(i)));
+        port->setDirection(i % 2 == 0 ? DirectionTypes::IN : DirectionTypes::OUT);
+        port->setLeftBound(QString::number(i % 32));
+        port->setRightBound("0");
+
+        component->getPorts()->append(port);
+    }
+
+    return component;
+}
 
 QTEST_APPLESS_MAIN(tst_ComponentComparator)
 
@@ -36,6 +36,7 @@ private slots:
     void testHasRowForEachTopLevelParameter_data();     
     void testHasColumnForNameValueAndId();
     void testFunctionAsValue();
+    void testValueIsReevaluatedAfterInvalidation();
 
 private:
     ComponentParameterModel* make(QSharedPointer<Component> component);
@@ -131,6 +132,40 @@ void tst_ComponentParameterModel::testFunctionAsValue()
     QCOMPARE(model->data(model->index(0, ComponentParameterColumns::VALUE)).toString(), QString("2"));
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentParameterModel::testValueIsReevaluatedAfterInvalidation()
+//-----------------------------------------------------------------------------
+void tst_ComponentParameterModel::testValueIsReevaluatedAfterInvalidation()
+{
+    QSharedPointer<Parameter> referencedParameter(new Parameter());
+    referencedParameter->setName("referenced");
+    referencedParameter->setValueId("referencedId");
+    referencedParameter->setValue("2");
+
+    QSharedPointer<Parameter> referringParameter(new Parameter());
+    referringParameter->setName("referring");
+    referringParameter->setValueId("referringId");
+    referringParameter->setValue("referencedId*2");
+
+    QSharedPointer<Component> component(new Component());
+    component->getParameters()->append(referencedParameter);
+    component->getParameters()->append(referringParameter);
+
+    ComponentParameterModel* model = make(component);
+
+    QModelIndex referringValue = model->index(1, ComponentParameterColumns::VALUE);
+    QCOMPARE(model->data(referringValue).toString(), QString("4"));
+
+    referringParameter->setValue("referencedId+1");
+    QCOMPARE(model->data(referringValue).toString(), QString("3"));
+
+    referencedParameter->setValue("5");
+    QCOMPARE(model->data(referringValue).toString(), QString("3"));
+
+    model->invalidateEvaluations();
+    QCOMPARE(model->data(referringValue).toString(), QString("6"));
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_ComponentParameterModel::make()
 //-----------------------------------------------------------------------------
@@ -2,7 +2,8 @@
 # This file is generated by the Qt Visual Studio Tools.
 # ------------------------------------------------------
 
-HEADERS += ../../editors/HWDesign/undoCommands/AdHocConnectionAddCommand.h \
+HEADERS += ../../common/Profiler.h \
+    ../../editors/HWDesign/undoCommands/AdHocConnectionAddCommand.h \
     ../../editors/HWDesign/undoCommands/AdHocConnectionDeleteCommand.h \
     ../../editors/HWDesign/AdHocEnabled.h \
     ../../editors/HWDesign/undoCommands/AdHocTieOffConnectionDeleteCommand.h \
@@ -34,6 +35,7 @@ HEADERS += ../../editors/HWDesign/undoCommands/AdHocConnectionAddCommand.h \
     ../../editors/ComponentEditor/common/IPXactSystemVerilogParser.h \
     ../../editors/common/ImageExporter.h \
     ../../editors/ComponentEditor/busInterfaces/portmaps/JaroWinklerAlgorithm.h \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/JaroWinklerMatcher.h \
     ../../common/widgets/assistedLineEdit/LineContentAssistWidget.h \
     ../../editors/ComponentEditor/common/ListParameterFinder.h \
     ../../editors/ComponentEditor/common/MultipleParameterFinder.h \
@@ -162,7 +164,8 @@ HEADERS += ../../editors/HWDesign/undoCommands/AdHocConnectionAddCommand.h \
     ../../editors/common/ComponentItemAutoConnector/HierarchicalBusInterfaceTableAutoConnector.h \
     ../../editors/HWDesign/undoCommands/TopAdHocVisibilityChangeCommand.h \
     ../../editors/common/ComponentItemAutoConnector/BusInterfaceItemMatcher.h
-SOURCES += ../../editors/common/ComponentItemAutoConnector/HierarchicalPortItemMatcher.cpp \
+SOURCES += ../../common/Profiler.cpp \
+    ../../editors/common/ComponentItemAutoConnector/HierarchicalPortItemMatcher.cpp \
     ../../editors/HWDesign/undoCommands/AdHocConnectionAddCommand.cpp \
     ../../editors/HWDesign/undoCommands/AdHocConnectionDeleteCommand.cpp \
     ../../editors/HWDesign/AdHocConnectionItem.cpp \
@@ -233,6 +236,7 @@ SOURCES += ../../editors/common/ComponentItemAutoConnector/HierarchicalPortItemM
     ../../editors/ComponentEditor/common/IPXactSystemVerilogParser.cpp \
     ../../editors/common/ImageExporter.cpp \
     ../../editors/ComponentEditor/busInterfaces/portmaps/JaroWinklerAlgorithm.cpp \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/JaroWinklerMatcher.cpp \
     ../../common/widgets/kactusAttributeEditor/KactusAttributeEditor.cpp \
     ../../library/LibraryItem.cpp \
     ../MockObjects/LibraryMock.cpp \
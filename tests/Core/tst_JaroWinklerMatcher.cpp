@@ -0,0 +1,274 @@
+//-----------------------------------------------------------------------------
+// File: tst_JaroWinklerMatcher.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: Kactus2 team
+// Date: 19.10.2026
+//
+// Description:
+// Unit test for class JaroWinklerMatcher.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+#include <QElapsedTimer>
+
+#include <editors/ComponentEditor/busInterfaces/portmaps/JaroWinklerAlgorithm.h>
+#include <editors/ComponentEditor/busInterfaces/portmaps/JaroWinklerMatcher.h>
+
+class tst_JaroWinklerMatcher : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_JaroWinklerMatcher();
+
+private slots:
+    void testMatchesAreEqualToAlgorithm();
+    void testMatchesAreEqualToAlgorithm_data();
+
+    void testBestMatchIsFirstOfEquals();
+    void testNoMatchBelowThreshold();
+
+    void testGeneratedPortNamesMatchAlgorithm();
+
+    void testBestMatchesOfTenThousandPortsWithinSecond();
+
+    void benchmarkBestMatches();
+
+private:
+
+    QVector<QString> createPortNames(int count, int seed) const;
+
+    int findBestWithAlgorithm(QString const& searched, QVector<QString> const& candidates) const;
+};
+
+namespace
+{
+    const double THRESHOLD = 0.75;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_JaroWinklerMatcher::tst_JaroWinklerMatcher()
+//-----------------------------------------------------------------------------
+tst_JaroWinklerMatcher::tst_JaroWinklerMatcher()
+{
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_JaroWinklerMatcher::testMatchesAreEqualToAlgorithm()
+//-----------------------------------------------------------------------------
+void tst_JaroWinklerMatcher::testMatchesAreEqualToAlgorithm()
+{
+    QFETCH(QString, searched);
+    QFETCH(QStringList, candidates);
+
+    JaroWinklerMatcher matcher(candidates.toVector(), THRESHOLD);
+
+    QVector<JaroWinklerMatcher::Match> expectedMatches;
+    for (int i = 0; i < candidates.size(); ++i)
+    {
+        double distance = JaroWinklerAlgorithm::calculateJaroWinklerDistance(searched, candidates.at(i));
+        if (distance >= THRESHOLD)
+        {
+            expectedMatches.append(JaroWinklerMatcher::Match(i, distance));
+        }
+    }
+
+    QVector<JaroWinklerMatcher::Match> matches = matcher.findMatches(searched);
+    QCOMPARE(matches.size(), expectedMatches.size());
+
+    for (int i = 0; i < matches.size(); ++i)
+    {
+        QCOMPARE(matches.at(i).first, expectedMatches.at(i).first);
+        QVERIFY(matches.at(i).second == expectedMatches.at(i).second);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_JaroWinklerMatcher::testMatchesAreEqualToAlgorithm_data()
+//-----------------------------------------------------------------------------
+void tst_JaroWinklerMatcher::testMatchesAreEqualToAlgorithm_data()
+{
+    QTest::addColumn<QString>("searched");
+    QTest::addColumn<QStringList>("candidates");
+
+    QTest::newRow("Exact match") << "clk" << QStringList({"clk", "rst", "data"});
+    QTest::newRow("Case differences") << "CLK_in" << QStringList({"clk_IN", "Clk_out", "rst_n"});
+    QTest::newRow("Common prefix") << "data_in" << QStringList({"data_out", "dat_in", "address", "data"});
+    QTest::newRow("Transpositions") << "MARTHA" << QStringList({"MARHTA", "MATRHA", "ARTHAM"});
+    QTest::newRow("Empty names") << "" << QStringList({"", "a", "clk"});
+    QTest::newRow("Empty searched against names") << "a" << QStringList({"", "a", "ab"});
+    QTest::newRow("Long and short names") << "x" << QStringList({"x_very_long_signal_name_0", "xy", "y"});
+    QTest::newRow("Repeated characters") << "aaaa_bbbb" << QStringList({"bbbb_aaaa", "aaaabbbb", "ab"});
+    QTest::newRow("Non-ASCII characters") << QString::fromUtf8("d\xC3\xA4ta") <<
+        QStringList({QString::fromUtf8("D\xC3\x84TA"), "data", QString::fromUtf8("d\xC3\xB6ta")});
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_JaroWinklerMatcher::testBestMatchIsFirstOfEquals()
+//-----------------------------------------------------------------------------
+void tst_JaroWinklerMatcher::testBestMatchIsFirstOfEquals()
+{
+    QVector<QString> candidates({"rst_n", "clk_a", "clk_b", "clk_c"});
+
+    JaroWinklerMatcher matcher(candidates, THRESHOLD);
+
+    QCOMPARE(matcher.findBestMatch("clk_x"), 1);
+    QCOMPARE(matcher.findBestMatch("clk_c"), 3);
+    QCOMPARE(matcher.candidate(matcher.findBestMatch("rst")), QString("rst_n"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_JaroWinklerMatcher::testNoMatchBelowThreshold()
+//-----------------------------------------------------------------------------
+void tst_JaroWinklerMatcher::testNoMatchBelowThreshold()
+{
+    JaroWinklerMatcher matcher(QVector<QString>({"abc", "def"}), THRESHOLD);
+
+    QCOMPARE(matcher.findBestMatch("xyz"), -1);
+    QVERIFY(matcher.findMatches("xyz").isEmpty());
+
+    JaroWinklerMatcher emptyMatcher(QVector<QString>(), THRESHOLD);
+    QCOMPARE(emptyMatcher.findBestMatch("abc"), -1);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_JaroWinklerMatcher::testGeneratedPortNamesMatchAlgorithm()
+//-----------------------------------------------------------------------------
+void tst_JaroWinklerMatcher::testGeneratedPortNamesMatchAlgorithm()
+{
+    QVector<QString> firstPorts = createPortNames(300, 1);
+    QVector<QString> secondPorts = createPortNames(300, 2);
+
+    JaroWinklerMatcher matcher(secondPorts, THRESHOLD);
+
+    for (QString const& port : firstPorts)
+    {
+        QCOMPARE(matcher.findBestMatch(port), findBestWithAlgorithm(port, secondPorts));
+
+        QVector<JaroWinklerMatcher::Match> expectedMatches;
+        for (int i = 0; i < secondPorts.size(); ++i)
+        {
+            double distance = JaroWinklerAlgorithm::calculateJaroWinklerDistance(port, secondPorts.at(i));
+            if (distance >= THRESHOLD)
+            {
+                expectedMatches.append(JaroWinklerMatcher::Match(i, distance));
+            }
+        }
+
+        QCOMPARE(matcher.findMatches(port), expectedMatches);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_JaroWinklerMatcher::testBestMatchesOfTenThousandPortsWithinSecond()
+//-----------------------------------------------------------------------------
+void tst_JaroWinklerMatcher::testBestMatchesOfTenThousandPortsWithinSecond()
+{
+#ifndef QT_NO_DEBUG
+    QSKIP("The matching time is only measured in release builds.");
+#endif
+
+    QVector<QString> firstPorts = createPortNames(10000, 3);
+    QVector<QString> secondPorts = createPortNames(10000, 4);
+
+    QElapsedTimer timer;
+    timer.start();
+
+    int matchCount = 0;
+
+    JaroWinklerMatcher matcher(secondPorts, THRESHOLD);
+    for (QString const& port : firstPorts)
+    {
+        if (matcher.findBestMatch(port) != -1)
+        {
+            matchCount++;
+        }
+    }
+
+    qint64 elapsedTime = timer.elapsed();
+
+    QCOMPARE(matchCount, firstPorts.size());
+    QVERIFY2(elapsedTime < 1000, qPrintable(QString("Matching took %1 ms.").arg(elapsedTime)));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_JaroWinklerMatcher::benchmarkBestMatches()
+//-----------------------------------------------------------------------------
+void tst_JaroWinklerMatcher::benchmarkBestMatches()
+{
+    QVector<QString> firstPorts = createPortNames(10000, 3);
+    QVector<QString> secondPorts = createPortNames(10000, 4);
+
+    int matchCount = 0;
+
+    QBENCHMARK
+    {
+        matchCount = 0;
+
+        JaroWinklerMatcher matcher(secondPorts, THRESHOLD);
+        for (QString const& port : firstPorts)
+        {
+            if (matcher.findBestMatch(port) != -1)
+            {
+                matchCount++;
+            }
+        }
+    }
+
+    QVERIFY(matchCount > 0);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_JaroWinklerMatcher::createPortNames()
+//-----------------------------------------------------------------------------
+QVector<QString> tst_JaroWinklerMatcher::createPortNames(int count, int seed) const
+{
+    const QStringList prefixes({"axi", "apb", "ahb", "dma", "irq", "gpio", "uart", "spi", "mem", "dbg"});
+    const QStringList bodies({"addr", "data", "valid", "ready", "resp", "len", "burst", "strb", "last", "sel"});
+    const QStringList suffixes({"_i", "_o", "_n", "_in", "_out", ""});
+
+    // Linear congruential generator keeps the names identical between runs.
+    quint32 state = static_cast<quint32>(seed);
+    auto next = [&state](int range)
+    {
+        state = state * 1664525u + 1013904223u;
+        return static_cast<int>((state >> 8) % static_cast<quint32>(range));
+    };
+
+    QVector<QString> names;
+    names.reserve(count);
+    for (int i = 0; i < count; ++i)
+    {
+        names.append(prefixes.at(next(prefixes.size())) + QLatin1Char('_') +
+            bodies.at(next(bodies.size())) + QString::number(next(64)) + suffixes.at(next(suffixes.size())));
+    }
+
+    return names;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_JaroWinklerMatcher::findBestWithAlgorithm()
+//-----------------------------------------------------------------------------
+int tst_JaroWinklerMatcher::findBestWithAlgorithm(QString const& searched, QVector<QString> const& candidates)
+    const
+{
+    int bestIndex = -1;
+    double bestDistance = 0;
+
+    for (int i = 0; i < candidates.size(); ++i)
+    {
+        double distance = JaroWinklerAlgorithm::calculateJaroWinklerDistance(searched, candidates.at(i));
+        if (distance >= THRESHOLD && (bestIndex == -1 || distance > bestDistance))
+        {
+            bestIndex = i;
+            bestDistance = distance;
+        }
+    }
+
+    return bestIndex;
+}
+
+QTEST_APPLESS_MAIN(tst_JaroWinklerMatcher)
+
+#include "tst_JaroWinklerMatcher.moc"
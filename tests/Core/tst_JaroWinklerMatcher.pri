@@ -0,0 +1,9 @@
+# ----------------------------------------------------
+# This file is generated by the Qt Visual Studio Add-in.
+# ------------------------------------------------------
+
+HEADERS += ../../editors/ComponentEditor/busInterfaces/portmaps/JaroWinklerAlgorithm.h \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/JaroWinklerMatcher.h
+SOURCES += ../../editors/ComponentEditor/busInterfaces/portmaps/JaroWinklerAlgorithm.cpp \
+    ../../editors/ComponentEditor/busInterfaces/portmaps/JaroWinklerMatcher.cpp \
+    ./tst_JaroWinklerMatcher.cpp
@@ -0,0 +1,40 @@
+#-----------------------------------------------------------------------------
+# File: tst_JaroWinklerMatcher.pro
+#-----------------------------------------------------------------------------
+# Project: Kactus 2
+# Author: Kactus2 team
+# Date: 19.10.2026
+#
+# Description:
+# Qt project file template for running unit tests for JaroWinklerMatcher.
+#-----------------------------------------------------------------------------
+
+TEMPLATE = app
+
+TARGET = tst_JaroWinklerMatcher
+
+QT += core xml gui testlib
+CONFIG += c++11 testcase console
+
+win32:CONFIG(release, debug|release) {
+    DESTDIR = ./release
+}
+else:win32:CONFIG(debug, debug|release) {
+    DESTDIR = ./debug
+}
+else:unix {
+    DESTDIR = ./release
+}
+
+INCLUDEPATH += $$DESTDIR
+INCLUDEPATH += ../../
+
+DEPENDPATH += .
+DEPENDPATH += ../../
+
+OBJECTS_DIR += $$DESTDIR
+
+MOC_DIR += ./generatedFiles
+UI_DIR += ./generatedFiles
+RCC_DIR += ./generatedFiles
+include(tst_JaroWinklerMatcher.pri)
@@ -4,20 +4,28 @@
 
 HEADERS += ../../editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/addressblockgraphitem.h \
     ../../common/graphicsItems/expandableitem.h \
+    ../../editors/ComponentEditor/visualization/fieldgapitem.h \
+    ../../editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/fieldgraphitem.h \
     ../../common/graphicsItems/graphicsexpandcollapseitem.h \
     ../../editors/ComponentEditor/visualization/memorygapitem.h \
     ../../editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/memorymapgraphitem.h \
     ../../editors/ComponentEditor/visualization/memoryvisualizationitem.h \
+    ../../editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/registergraphitem.h \
+    ../../editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/registeritemprovider.h \
     ../../common/graphicsItems/visualizeritem.h \
     ../../editors/ComponentEditor/common/ExpressionParser.h \
     ../../editors/ComponentEditor/common/NullParser.h \
     ../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h
 SOURCES += ../../editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/addressblockgraphitem.cpp \
     ../../common/graphicsItems/expandableitem.cpp \
+    ../../editors/ComponentEditor/visualization/fieldgapitem.cpp \
+    ../../editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/fieldgraphitem.cpp \
     ../../common/graphicsItems/graphicsexpandcollapseitem.cpp \
     ../../editors/ComponentEditor/visualization/memorygapitem.cpp \
     ../../editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/memorymapgraphitem.cpp \
     ../../editors/ComponentEditor/visualization/memoryvisualizationitem.cpp \
+    ../../editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/registergraphitem.cpp \
+    ../../editors/ComponentEditor/memoryMaps/memoryMapsVisualizer/registeritemprovider.cpp \
     ./tst_MemoryMapGraphItem.cpp \
     ../../common/graphicsItems/visualizeritem.cpp \
     ../../editors/ComponentEditor/common/NullParser.cpp \
@@ -70,6 +70,10 @@ private slots:
 
     void testReferenceAsAnExpressionInParameter();
     void testMultipleReferencesInSameExpression();
+    void testReferenceInsideLongerIdentifierIsNotFound();
+    void testReferencesToIdsWithDashesAndDots();
+
+    void testRecalculateReferencesToParameters();
 
     void testReferenceInViewParameterValueAddsFiveRows();
     void testReferenceInViewModuleParameterValueAddsFiveRows();
@@ -614,6 +618,137 @@ void tst_ParameterReferenceTree::testMultipleReferencesInSameExpression()
     QCOMPARE(tree->topLevelItem(0)->child(0)->child(0)->childCount(), 0);
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_ParameterReferenceTree::testReferenceInsideLongerIdentifierIsNotFound()
+//-----------------------------------------------------------------------------
+void tst_ParameterReferenceTree::testReferenceInsideLongerIdentifierIsNotFound()
+{
+    QSharedPointer<Parameter> searched(new Parameter);
+    searched->setName("searchedParameter");
+    searched->setValueId("searched");
+
+    QSharedPointer<Parameter> longerId(new Parameter);
+    longerId->setName("longerParameter");
+    longerId->setValueId("searched_2");
+
+    QList <QSharedPointer<Parameter> > componentParameters;
+    componentParameters.append(searched);
+    componentParameters.append(longerId);
+
+    // No references, the ID is only a part of other identifiers.
+    QSharedPointer<Parameter> firstRef = createTestParameter("ref", "searched_2 + 1", "", "", "", "");
+    componentParameters.append(firstRef);
+    QSharedPointer<Parameter> secondRef = createTestParameter("ref2", "", "researched", "", "", "");
+    componentParameters.append(secondRef);
+
+    QSharedPointer<Component> component(new Component);
+    component->getParameters()->append(componentParameters);
+
+    QScopedPointer<ComponentParameterReferenceTree> tree(createTestTree(component));
+    tree->openReferenceTree(QStringLiteral("searched"));
+
+    QCOMPARE(tree->topLevelItemCount(), 1);
+    QCOMPARE(tree->topLevelItem(0)->text(ParameterReferenceTree::ITEM_NAME),
+        QStringLiteral("No references found."));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ParameterReferenceTree::testRecalculateReferencesToParameters()
+//-----------------------------------------------------------------------------
+void tst_ParameterReferenceTree::testRecalculateReferencesToParameters()
+{
+    QSharedPointer<Component> component(new Component);
+
+    // Each parameter references the previous one and the first one.
+    QVector<QSharedPointer<Parameter> > parameters;
+    QSharedPointer<Parameter> first = createTestParameter("param0", "1", "", "", "", "");
+    parameters.append(first);
+
+    const int parameterCount = 500;
+    for (int i = 1; i < parameterCount; ++i)
+    {
+        QString value = parameters.last()->getValueId() + QStringLiteral(" + 1");
+        parameters.append(createTestParameter(QStringLiteral("param%1").arg(i), value, first->getValueId(), "0",
+            "", ""));
+    }
+
+    component->getParameters()->append(parameters.toList());
+
+    QSharedPointer<ParameterFinder> finder(new ComponentParameterFinder(component));
+    ComponentParameterReferenceCounter counter(finder, component);
+
+    QBENCHMARK
+    {
+        counter.recalculateReferencesToParameters(parameters);
+    }
+
+    QCOMPARE(first->getUsageCount(), parameterCount);
+    QCOMPARE(parameters.at(1)->getUsageCount(), 1);
+    QCOMPARE(parameters.last()->getUsageCount(), 0);
+
+    // Reference count changes made by the editors update the index.
+    parameters.last()->setValue(first->getValueId());
+    counter.increaseReferenceCount(first->getValueId());
+    QCOMPARE(counter.countIndexedReferences(first->getValueId()), parameterCount + 1);
+    QCOMPARE(counter.countIndexedReferences(first->getValueId(), ComponentParameterReferenceCounter::PARAMETERS),
+        parameterCount + 1);
+    QCOMPARE(counter.countIndexedReferences(first->getValueId(), ComponentParameterReferenceCounter::PORTS), 0);
+
+    counter.recalculateReferencesToParameters(parameters);
+    QCOMPARE(first->getUsageCount(), parameterCount + 1);
+
+    // Edits made without reference count changes are found once the index is invalidated.
+    parameters.at(2)->setValue(QStringLiteral("1"));
+    QCOMPARE(counter.countIndexedReferences(parameters.at(1)->getValueId()), 1);
+
+    counter.invalidateReferenceIndex();
+    QCOMPARE(counter.countIndexedReferences(parameters.at(1)->getValueId()), 0);
+    QCOMPARE(counter.countIndexedReferences(first->getValueId()), parameterCount + 1);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ParameterReferenceTree::testReferencesToIdsWithDashesAndDots()
+//-----------------------------------------------------------------------------
+void tst_ParameterReferenceTree::testReferencesToIdsWithDashesAndDots()
+{
+    QSharedPointer<Parameter> dashed = createTestParameter("dashed", "1", "", "", "", "");
+    dashed->setValueId("first-id");
+
+    QSharedPointer<Parameter> dotted = createTestParameter("dotted", "2", "", "", "", "");
+    dotted->setValueId("second.id");
+
+    QSharedPointer<Parameter> plain = createTestParameter("plain", "3", "", "", "", "");
+    plain->setValueId("third");
+
+    QSharedPointer<Parameter> firstRef = createTestParameter("ref", "first-id + second.id*2", "", "", "", "");
+    QSharedPointer<Parameter> secondRef = createTestParameter("ref2", "third-first-id", "second.idx", "", "", "");
+
+    QVector<QSharedPointer<Parameter> > parameters;
+    parameters << dashed << dotted << plain << firstRef << secondRef;
+
+    QSharedPointer<Component> component(new Component);
+    component->getParameters()->append(parameters.toList());
+
+    QSharedPointer<ParameterFinder> finder(new ComponentParameterFinder(component));
+    ComponentParameterReferenceCounter counter(finder, component);
+    counter.recalculateReferencesToParameters(parameters);
+
+    QCOMPARE(dashed->getUsageCount(), 2);
+    QCOMPARE(dotted->getUsageCount(), 1);
+    QCOMPARE(plain->getUsageCount(), 1);
+
+    // The index agrees with counting a single parameter.
+    QCOMPARE(counter.countReferencesInParameters("first-id", component->getParameters()), 2);
+    QCOMPARE(counter.countReferencesInParameters("second.id", component->getParameters()), 1);
+    QCOMPARE(counter.countReferencesInParameters("third", component->getParameters()), 1);
+
+    QScopedPointer<ComponentParameterReferenceTree> tree(createTestTree(component));
+    tree->openReferenceTree(QStringLiteral("second.id"));
+
+    QCOMPARE(tree->topLevelItemCount(), 1);
+    QCOMPARE(tree->topLevelItem(0)->text(ParameterReferenceTree::ITEM_NAME), QStringLiteral("Parameters"));
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_ParameterReferenceTree::testReferenceInViewParameterValueAddsFiveRows()
 //-----------------------------------------------------------------------------
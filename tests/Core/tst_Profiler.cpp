@@ -0,0 +1,211 @@
+//-----------------------------------------------------------------------------
+// File: tst_Profiler.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: Kactus2 team
+// Date: 19.10.2026
+//
+// Description:
+// Unit test for class Profiler.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+
+#include <common/Profiler.h>
+
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTemporaryDir>
+
+class tst_Profiler : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_Profiler();
+
+private slots:
+    void init();
+    void cleanup();
+
+    //! Test cases:
+    void testDisabledProfilerCollectsNothing();
+    void testNestedScopes();
+    void testTraceOutput();
+
+private:
+
+    QJsonArray writeAndReadTrace();
+
+    QJsonObject findEvent(QJsonArray const& events, QString const& name) const;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_Profiler::tst_Profiler()
+//-----------------------------------------------------------------------------
+tst_Profiler::tst_Profiler()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_Profiler::init()
+//-----------------------------------------------------------------------------
+void tst_Profiler::init()
+{
+    Profiler::getInstance().clear();
+    Profiler::getInstance().setEnabled(true);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_Profiler::cleanup()
+//-----------------------------------------------------------------------------
+void tst_Profiler::cleanup()
+{
+    Profiler::getInstance().setEnabled(false);
+    Profiler::getInstance().clear();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_Profiler::testDisabledProfilerCollectsNothing()
+//-----------------------------------------------------------------------------
+void tst_Profiler::testDisabledProfilerCollectsNothing()
+{
+    Profiler::getInstance().setEnabled(false);
+
+    {
+        ProfilingScope scope("disabled");
+        Profiler::getInstance().addCount("disabledCounter");
+    }
+
+    QVERIFY(writeAndReadTrace().isEmpty());
+    QVERIFY(Profiler::getInstance().createSummary().contains(QStringLiteral("No results have been collected.")));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_Profiler::testNestedScopes()
+//-----------------------------------------------------------------------------
+void tst_Profiler::testNestedScopes()
+{
+    {
+        ProfilingScope outerScope("outer");
+        {
+            ProfilingScope innerScope("inner");
+            QTest::qSleep(2);
+        }
+        {
+            ProfilingScope innerScope("inner");
+            QTest::qSleep(2);
+        }
+    }
+
+    QJsonArray events = writeAndReadTrace();
+    QCOMPARE(events.size(), 3);
+
+    QJsonObject outer = findEvent(events, QStringLiteral("outer"));
+    QVERIFY(!outer.isEmpty());
+
+    double outerStart = outer.value(QStringLiteral("ts")).toDouble();
+    double outerEnd = outerStart + outer.value(QStringLiteral("dur")).toDouble();
+
+    int innerCount = 0;
+    for (QJsonValue const& value : events)
+    {
+        QJsonObject event = value.toObject();
+        if (event.value(QStringLiteral("name")).toString() == QStringLiteral("inner"))
+        {
+            double innerStart = event.value(QStringLiteral("ts")).toDouble();
+            double innerEnd = innerStart + event.value(QStringLiteral("dur")).toDouble();
+
+            QVERIFY(innerStart >= outerStart);
+            QVERIFY(innerEnd <= outerEnd);
+            QCOMPARE(event.value(QStringLiteral("tid")).toInt(), outer.value(QStringLiteral("tid")).toInt());
+            innerCount++;
+        }
+    }
+
+    QCOMPARE(innerCount, 2);
+
+    QString summary = Profiler::getInstance().createSummary();
+    QVERIFY(summary.contains(QStringLiteral("outer: ")));
+    QVERIFY(summary.contains(QStringLiteral("2 call(s)")));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_Profiler::testTraceOutput()
+//-----------------------------------------------------------------------------
+void tst_Profiler::testTraceOutput()
+{
+    {
+        ProfilingScope scope("phase");
+        Profiler::getInstance().addCount("counter", 2);
+        Profiler::getInstance().addCount("counter", 3);
+    }
+
+    QJsonArray events = writeAndReadTrace();
+    QCOMPARE(events.size(), 3);
+
+    QJsonObject phase = findEvent(events, QStringLiteral("phase"));
+    QCOMPARE(phase.value(QStringLiteral("ph")).toString(), QStringLiteral("X"));
+    QCOMPARE(phase.value(QStringLiteral("cat")).toString(), QStringLiteral("kactus2"));
+    QCOMPARE(phase.value(QStringLiteral("tid")).toInt(), 1);
+    QCOMPARE(phase.value(QStringLiteral("pid")).toDouble(), double(QCoreApplication::applicationPid()));
+    QVERIFY(phase.value(QStringLiteral("dur")).toDouble() >= 0);
+
+    QVector<double> counterValues;
+    for (QJsonValue const& value : events)
+    {
+        QJsonObject event = value.toObject();
+        if (event.value(QStringLiteral("ph")).toString() == QStringLiteral("C"))
+        {
+            QCOMPARE(event.value(QStringLiteral("name")).toString(), QStringLiteral("counter"));
+            counterValues.append(event.value(QStringLiteral("args")).toObject().value(
+                QStringLiteral("value")).toDouble());
+        }
+    }
+
+    QCOMPARE(counterValues, QVector<double>({2, 5}));
+    QVERIFY(Profiler::getInstance().createSummary().contains(QStringLiteral("counter: 5")));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_Profiler::writeAndReadTrace()
+//-----------------------------------------------------------------------------
+QJsonArray tst_Profiler::writeAndReadTrace()
+{
+    QTemporaryDir directory;
+    QString tracePath = directory.filePath(QStringLiteral("trace.json"));
+
+    if (!Profiler::getInstance().writeTrace(tracePath))
+    {
+        return QJsonArray();
+    }
+
+    QFile traceFile(tracePath);
+    traceFile.open(QIODevice::ReadOnly);
+
+    QJsonObject trace = QJsonDocument::fromJson(traceFile.readAll()).object();
+    return trace.value(QStringLiteral("traceEvents")).toArray();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_Profiler::findEvent()
+//-----------------------------------------------------------------------------
+QJsonObject tst_Profiler::findEvent(QJsonArray const& events, QString const& name) const
+{
+    for (QJsonValue const& value : events)
+    {
+        QJsonObject event = value.toObject();
+        if (event.value(QStringLiteral("name")).toString() == name)
+        {
+            return event;
+        }
+    }
+
+    return QJsonObject();
+}
+
+QTEST_MAIN(tst_Profiler)
+
+#include "tst_Profiler.moc"
@@ -0,0 +1,7 @@
+# ----------------------------------------------------
+# This file is generated by the Qt Visual Studio Add-in.
+# ------------------------------------------------------
+
+HEADERS += ../../common/Profiler.h
+SOURCES += ../../common/Profiler.cpp \
+    ./tst_Profiler.cpp
@@ -78,4 +78,7 @@ SUBDIRS += tst_AddressSpaceReader.pro \
 		   tst_MemoryMapValidator.pro \  
 		   tst_ComponentWriter.pro \
 		   tst_ComponentReader.pro \
-		   tst_ComponentValidator.pro 
+		   tst_ComponentValidator.pro \
+		   tst_StructuralHash.pro \
+		   tst_ModelPorts.pro \
+		   tst_DocumentMetadata.pro
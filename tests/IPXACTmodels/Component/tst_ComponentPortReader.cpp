@@ -46,6 +46,8 @@ private slots:
     void readTransactionalProtocol();
     void readTransactionalTypeDefinitions();
     void readTransactionalConnectionMinMax();
+
+    void readRepeatedValuesAreShared();
 };
 
 //-----------------------------------------------------------------------------
@@ -749,6 +751,59 @@ void tst_ComponentPortReader::readTransactionalConnectionMinMax()
     QCOMPARE(testPort->getTransactional()->getMinConnections(), QString("8*2"));
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_ComponentPortReader::readRepeatedValuesAreShared()
+//-----------------------------------------------------------------------------
+void tst_ComponentPortReader::readRepeatedValuesAreShared()
+{
+    QString documentContent(
+        "<ipxact:ports>"
+            "<ipxact:port>"
+                "<ipxact:name>first</ipxact:name>"
+                "<ipxact:wire>"
+                    "<ipxact:direction>in</ipxact:direction>"
+                    "<ipxact:vectors>"
+                        "<ipxact:vector>"
+                            "<ipxact:left>DATA_WIDTH-1</ipxact:left>"
+                            "<ipxact:right>0</ipxact:right>"
+                        "</ipxact:vector>"
+                    "</ipxact:vectors>"
+                "</ipxact:wire>"
+            "</ipxact:port>"
+            "<ipxact:port>"
+                "<ipxact:name>second</ipxact:name>"
+                "<ipxact:wire>"
+                    "<ipxact:direction>out</ipxact:direction>"
+                    "<ipxact:vectors>"
+                        "<ipxact:vector>"
+                            "<ipxact:left>DATA_WIDTH-1</ipxact:left>"
+                            "<ipxact:right>0</ipxact:right>"
+                        "</ipxact:vector>"
+                    "</ipxact:vectors>"
+                "</ipxact:wire>"
+            "</ipxact:port>"
+        "</ipxact:ports>"
+        );
+
+    QDomDocument document;
+    document.setContent(documentContent);
+
+    QDomNodeList portNodes = document.elementsByTagName("ipxact:port");
+
+    PortReader portReader;
+    QSharedPointer<Port> firstPort = portReader.createPortFrom(portNodes.at(0));
+    QSharedPointer<Port> secondPort = portReader.createPortFrom(portNodes.at(1));
+
+    QCOMPARE(secondPort->getLeftBound(), QString("DATA_WIDTH-1"));
+    QCOMPARE(secondPort->getRightBound(), QString("0"));
+
+    QVERIFY(firstPort->getLeftBound().constData() == secondPort->getLeftBound().constData());
+    QVERIFY(firstPort->getRightBound().constData() == secondPort->getRightBound().constData());
+
+    secondPort->setLeftBound("7");
+    QCOMPARE(firstPort->getLeftBound(), QString("DATA_WIDTH-1"));
+}
+
 QTEST_APPLESS_MAIN(tst_ComponentPortReader)
 
 #include "tst_ComponentPortReader.moc"
@@ -0,0 +1,145 @@
+//-----------------------------------------------------------------------------
+// File: tst_DocumentMetadata.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: Kactus2 team
+// Date: 19.10.2026
+//
+// Description:
+// Unit test for struct DocumentMetadata.
+//-----------------------------------------------------------------------------
+
+#include <IPXACTmodels/common/DocumentMetadata.h>
+
+#include <IPXACTmodels/Component/Component.h>
+#include <IPXACTmodels/Component/View.h>
+#include <IPXACTmodels/Design/Design.h>
+
+#include <QtTest>
+
+class tst_DocumentMetadata : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_DocumentMetadata();
+
+private slots:
+
+    void testMetadataOfComponent();
+    void testMetadataOfDesign();
+    void testMetadataOfMissingDocument();
+    void testMetadataIsStreamed();
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentMetadata::tst_DocumentMetadata()
+//-----------------------------------------------------------------------------
+tst_DocumentMetadata::tst_DocumentMetadata()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentMetadata::testMetadataOfComponent()
+//-----------------------------------------------------------------------------
+void tst_DocumentMetadata::testMetadataOfComponent()
+{
+    QSharedPointer<Component> component(
+        new Component(VLNV(VLNV::COMPONENT, "tut.fi", "TestLibrary", "TestComponent", "1.0")));
+    component->setImplementation(KactusAttribute::HW);
+    component->setHierarchy(KactusAttribute::SOC);
+    component->setFirmness(KactusAttribute::FIXED);
+
+    TagData tag;
+    tag.name_ = "verified";
+    tag.color_ = "#00ff00";
+    component->setTags(QVector<TagData>({tag}));
+
+    DocumentMetadata metadata = DocumentMetadata::create(component);
+
+    QCOMPARE(metadata.type, VLNV::COMPONENT);
+    QCOMPARE(metadata.implementation, KactusAttribute::HW);
+    QCOMPARE(metadata.hierarchy, KactusAttribute::SOC);
+    QCOMPARE(metadata.firmness, KactusAttribute::FIXED);
+    QCOMPARE(metadata.hasSystemViews, false);
+    QCOMPARE(metadata.hasDesign, false);
+    QCOMPARE(metadata.tags.size(), 1);
+    QVERIFY(metadata.tags.first() == tag);
+
+    QSharedPointer<View> hierarchicalView(new View("structural"));
+    hierarchicalView->setDesignInstantiationRef("design");
+    component->getViews()->append(hierarchicalView);
+
+    QCOMPARE(DocumentMetadata::create(component).hasDesign, true);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentMetadata::testMetadataOfDesign()
+//-----------------------------------------------------------------------------
+void tst_DocumentMetadata::testMetadataOfDesign()
+{
+    QSharedPointer<Design> design(new Design(VLNV(VLNV::DESIGN, "tut.fi", "TestLibrary", "TestDesign", "1.0")));
+    design->setImplementation(KactusAttribute::SW);
+
+    DocumentMetadata metadata = DocumentMetadata::create(design);
+
+    QCOMPARE(metadata.type, VLNV::DESIGN);
+    QCOMPARE(metadata.implementation, KactusAttribute::SW);
+    QCOMPARE(metadata.hasDesign, false);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentMetadata::testMetadataOfMissingDocument()
+//-----------------------------------------------------------------------------
+void tst_DocumentMetadata::testMetadataOfMissingDocument()
+{
+    DocumentMetadata metadata = DocumentMetadata::create(QSharedPointer<Document const>());
+
+    QCOMPARE(metadata.type, VLNV::INVALID);
+    QVERIFY(metadata.tags.isEmpty());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_DocumentMetadata::testMetadataIsStreamed()
+//-----------------------------------------------------------------------------
+void tst_DocumentMetadata::testMetadataIsStreamed()
+{
+    DocumentMetadata original;
+    original.type = VLNV::COMPONENT;
+    original.implementation = KactusAttribute::SYSTEM;
+    original.hierarchy = KactusAttribute::BOARD;
+    original.firmness = KactusAttribute::MUTABLE;
+    original.hasSystemViews = true;
+    original.hasDesign = true;
+
+    TagData firstTag;
+    firstTag.name_ = "first";
+    firstTag.color_ = "#ff0000";
+
+    TagData secondTag;
+    secondTag.name_ = "second";
+    secondTag.color_ = "#0000ff";
+    original.tags = QVector<TagData>({firstTag, secondTag});
+
+    QByteArray data;
+    QDataStream output(&data, QIODevice::WriteOnly);
+    output << original;
+
+    DocumentMetadata copy;
+    QDataStream input(data);
+    input >> copy;
+
+    QCOMPARE(input.status(), QDataStream::Ok);
+    QCOMPARE(copy.type, original.type);
+    QCOMPARE(copy.implementation, original.implementation);
+    QCOMPARE(copy.hierarchy, original.hierarchy);
+    QCOMPARE(copy.firmness, original.firmness);
+    QCOMPARE(copy.hasSystemViews, true);
+    QCOMPARE(copy.hasDesign, true);
+    QVERIFY(copy.tags == original.tags);
+}
+
+QTEST_APPLESS_MAIN(tst_DocumentMetadata)
+
+#include "tst_DocumentMetadata.moc"
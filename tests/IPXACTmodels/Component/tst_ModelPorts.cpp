@@ -0,0 +1,363 @@
+//-----------------------------------------------------------------------------
+// File: tst_ModelPorts.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: Kactus2 team
+// Date: 19.10.2026
+//
+// Description:
+// Unit test and benchmarks for the port storage of class Model.
+//-----------------------------------------------------------------------------
+
+#include <IPXACTmodels/Component/Model.h>
+#include <IPXACTmodels/Component/Port.h>
+#include <IPXACTmodels/Component/PortReader.h>
+
+#include <QtTest>
+#include <QDomDocument>
+
+class tst_ModelPorts : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_ModelPorts();
+
+private slots:
+
+    void testGetPortByName();
+    void testLookupAfterAppendAndRemove();
+    void testLookupAfterRename();
+    void testLookupAfterSetPorts();
+    void testLookupInCopiedModel();
+    void testFirstOfEquallyNamedPortsIsFound();
+
+    void benchmarkIndexedLookup();
+    void benchmarkLinearLookup();
+
+    void benchmarkVectorBoundMemory();
+    void benchmarkVectorBoundMemory_data();
+
+private:
+
+    QSharedPointer<QList<QSharedPointer<Port> > > createPorts(int count) const;
+
+    QDomDocument createPortDocument(int count) const;
+
+    qint64 vectorBoundBytes(QList<QSharedPointer<Port> > const& ports) const;
+};
+
+namespace
+{
+    //! Number of ports in a very wide component.
+    const int WIDE_PORT_COUNT = 20000;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_ModelPorts::tst_ModelPorts()
+//-----------------------------------------------------------------------------
+tst_ModelPorts::tst_ModelPorts()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ModelPorts::testGetPortByName()
+//-----------------------------------------------------------------------------
+void tst_ModelPorts::testGetPortByName()
+{
+    Model model;
+    model.setPorts(createPorts(100));
+
+    QCOMPARE(model.getPort("port_42"), model.getPorts()->at(42));
+    QCOMPARE(model.getPort("port_0"), model.getPorts()->first());
+    QVERIFY(model.hasPort("port_99"));
+
+    QVERIFY(model.getPort("port_100").isNull());
+    QVERIFY(model.hasPort("port_100") == false);
+    QVERIFY(model.hasPort(QString()) == false);
+
+    QCOMPARE(model.getPortNames().size(), 100);
+    QCOMPARE(model.getPortNames().at(7), QString("port_7"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ModelPorts::testLookupAfterAppendAndRemove()
+//-----------------------------------------------------------------------------
+void tst_ModelPorts::testLookupAfterAppendAndRemove()
+{
+    Model model;
+    model.setPorts(createPorts(10));
+
+    QSharedPointer<Port> lastPort = model.getPort("port_9");
+    QVERIFY(lastPort.isNull() == false);
+
+    QSharedPointer<Port> extraPort(new Port("extra"));
+    model.getPorts()->append(extraPort);
+    QCOMPARE(model.getPort("extra"), extraPort);
+
+    model.getPorts()->removeFirst();
+    QVERIFY(model.hasPort("port_0") == false);
+    QCOMPARE(model.getPort("port_9"), lastPort);
+    QCOMPARE(model.getPort("extra"), extraPort);
+
+    model.getPorts()->clear();
+    QVERIFY(model.hasPort("port_9") == false);
+    QVERIFY(model.getPort("extra").isNull());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ModelPorts::testLookupAfterRename()
+//-----------------------------------------------------------------------------
+void tst_ModelPorts::testLookupAfterRename()
+{
+    Model model;
+    model.setPorts(createPorts(10));
+
+    QSharedPointer<Port> renamedPort = model.getPort("port_5");
+    renamedPort->setName("renamed");
+
+    QVERIFY(model.hasPort("port_5") == false);
+    QCOMPARE(model.getPort("renamed"), renamedPort);
+
+    renamedPort->setName("port_5");
+    QVERIFY(model.hasPort("renamed") == false);
+    QCOMPARE(model.getPort("port_5"), renamedPort);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ModelPorts::testLookupAfterSetPorts()
+//-----------------------------------------------------------------------------
+void tst_ModelPorts::testLookupAfterSetPorts()
+{
+    Model model;
+    model.setPorts(createPorts(10));
+    QVERIFY(model.hasPort("port_3"));
+
+    QSharedPointer<QList<QSharedPointer<Port> > > otherPorts(new QList<QSharedPointer<Port> >());
+    otherPorts->append(QSharedPointer<Port>(new Port("port_3_other")));
+    model.setPorts(otherPorts);
+
+    QVERIFY(model.hasPort("port_3") == false);
+    QCOMPARE(model.getPort("port_3_other"), otherPorts->first());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ModelPorts::testLookupInCopiedModel()
+//-----------------------------------------------------------------------------
+void tst_ModelPorts::testLookupInCopiedModel()
+{
+    Model original;
+    original.setPorts(createPorts(10));
+    QVERIFY(original.hasPort("port_1"));
+
+    Model copy(original);
+    QVERIFY(copy.getPort("port_1").isNull() == false);
+    QVERIFY(copy.getPort("port_1") != original.getPort("port_1"));
+
+    Model assigned;
+    assigned.getPorts()->append(QSharedPointer<Port>(new Port("port_1")));
+    QVERIFY(assigned.hasPort("port_1"));
+
+    assigned = original;
+    QCOMPARE(assigned.getPorts()->size(), 10);
+    QCOMPARE(assigned.getPort("port_1"), assigned.getPorts()->at(1));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ModelPorts::testFirstOfEquallyNamedPortsIsFound()
+//-----------------------------------------------------------------------------
+void tst_ModelPorts::testFirstOfEquallyNamedPortsIsFound()
+{
+    Model model;
+
+    QSharedPointer<Port> firstPort(new Port("duplicate"));
+    QSharedPointer<Port> secondPort(new Port("duplicate"));
+    model.getPorts()->append(firstPort);
+    model.getPorts()->append(secondPort);
+
+    QCOMPARE(model.getPort("duplicate"), firstPort);
+
+    model.getPorts()->removeFirst();
+    QCOMPARE(model.getPort("duplicate"), secondPort);
+
+    QSharedPointer<Port> prependedPort(new Port("duplicate"));
+    model.getPorts()->prepend(prependedPort);
+    QCOMPARE(model.getPort("duplicate"), prependedPort);
+
+    QVERIFY(model.getPort("missing").isNull());
+    QVERIFY(!model.hasPort("missing"));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ModelPorts::benchmarkIndexedLookup()
+//-----------------------------------------------------------------------------
+void tst_ModelPorts::benchmarkIndexedLookup()
+{
+    Model model;
+    model.setPorts(createPorts(WIDE_PORT_COUNT));
+
+    QStringList portNames = model.getPortNames();
+    int foundPorts = 0;
+
+    QBENCHMARK
+    {
+        foundPorts = 0;
+        for (QString const& name : portNames)
+        {
+            if (model.getPort(name))
+            {
+                foundPorts++;
+            }
+        }
+    }
+
+    QCOMPARE(foundPorts, WIDE_PORT_COUNT);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ModelPorts::benchmarkLinearLookup()
+//-----------------------------------------------------------------------------
+void tst_ModelPorts::benchmarkLinearLookup()
+{
+    // Reference for benchmarkIndexedLookup(): the search used before the port name index.
+    Model model;
+    model.setPorts(createPorts(WIDE_PORT_COUNT));
+
+    QStringList portNames = model.getPortNames();
+    int foundPorts = 0;
+
+    QBENCHMARK
+    {
+        foundPorts = 0;
+        for (QString const& name : portNames)
+        {
+            foreach (QSharedPointer<Port> port, *model.getPorts())
+            {
+                if (port->name() == name)
+                {
+                    foundPorts++;
+                    break;
+                }
+            }
+        }
+    }
+
+    QCOMPARE(foundPorts, WIDE_PORT_COUNT);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ModelPorts::benchmarkVectorBoundMemory()
+//-----------------------------------------------------------------------------
+void tst_ModelPorts::benchmarkVectorBoundMemory()
+{
+    QFETCH(bool, sharedReader);
+
+    QDomDocument document = createPortDocument(WIDE_PORT_COUNT);
+    QDomNodeList portNodes = document.elementsByTagName("ipxact:port");
+
+    QList<QSharedPointer<Port> > ports;
+    PortReader sharingReader;
+    for (int i = 0; i < portNodes.count(); ++i)
+    {
+        if (sharedReader)
+        {
+            ports.append(sharingReader.createPortFrom(portNodes.at(i)));
+        }
+        else
+        {
+            // A reader per port does not share values between the ports, as in the earlier representation.
+            PortReader singlePortReader;
+            ports.append(singlePortReader.createPortFrom(portNodes.at(i)));
+        }
+    }
+
+    QCOMPARE(ports.size(), WIDE_PORT_COUNT);
+    QTest::setBenchmarkResult(vectorBoundBytes(ports), QTest::BytesAllocated);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ModelPorts::benchmarkVectorBoundMemory_data()
+//-----------------------------------------------------------------------------
+void tst_ModelPorts::benchmarkVectorBoundMemory_data()
+{
+    QTest::addColumn<bool>("sharedReader");
+
+    QTest::newRow("Values shared between ports") << true;
+    QTest::newRow("Values stored per port") << false;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ModelPorts::createPorts()
+//-----------------------------------------------------------------------------
+QSharedPointer<QList<QSharedPointer<Port> > > tst_ModelPorts::createPorts(int count) const
+{
+    QSharedPointer<QList<QSharedPointer<Port> > > ports(new QList<QSharedPointer<Port> >());
+    ports->reserve(count);
+
+    for (int i = 0; i < count; ++i)
+    {
+        ports->append(QSharedPointer<Port>(new Port(QStringLiteral("port_") + QString::number(i))));
+    }
+
+    return ports;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ModelPorts::createPortDocument()
+//-----------------------------------------------------------------------------
+QDomDocument tst_ModelPorts::createPortDocument(int count) const
+{
+    QString documentContent("<ipxact:ports>");
+    for (int i = 0; i < count; ++i)
+    {
+        // Most ports of a wide component are scalars or vectors of a few common widths.
+        QString leftBound = (i % 4 == 0) ? QStringLiteral("0") : QStringLiteral("DATA_WIDTH-1");
+
+        documentContent.append(QStringLiteral(
+            "<ipxact:port>"
+                "<ipxact:name>port_%1</ipxact:name>"
+                "<ipxact:wire>"
+                    "<ipxact:direction>in</ipxact:direction>"
+                    "<ipxact:vectors>"
+                        "<ipxact:vector>"
+                            "<ipxact:left>%2</ipxact:left>"
+                            "<ipxact:right>0</ipxact:right>"
+                        "</ipxact:vector>"
+                    "</ipxact:vectors>"
+                "</ipxact:wire>"
+            "</ipxact:port>").arg(QString::number(i), leftBound));
+    }
+    documentContent.append(QStringLiteral("</ipxact:ports>"));
+
+    QDomDocument document;
+    document.setContent(documentContent);
+    return document;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_ModelPorts::vectorBoundBytes()
+//-----------------------------------------------------------------------------
+qint64 tst_ModelPorts::vectorBoundBytes(QList<QSharedPointer<Port> > const& ports) const
+{
+    QSet<QChar const*> countedBuffers;
+    qint64 bytes = 0;
+
+    for (QSharedPointer<Port> const& port : ports)
+    {
+        for (QString const& bound : {port->getLeftBound(), port->getRightBound()})
+        {
+            if (!countedBuffers.contains(bound.constData()))
+            {
+                countedBuffers.insert(bound.constData());
+                bytes += sizeof(QStringData) + (bound.capacity() + 1) * sizeof(QChar);
+            }
+        }
+    }
+
+    return bytes;
+}
+
+QTEST_APPLESS_MAIN(tst_ModelPorts)
+
+#include "tst_ModelPorts.moc"
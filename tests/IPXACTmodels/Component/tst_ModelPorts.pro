@@ -0,0 +1,42 @@
+#-----------------------------------------------------------------------------
+# File: tst_ModelPorts.pro
+#-----------------------------------------------------------------------------
+# Project: Kactus 2
+# Author: Kactus2 team
+# Date: 19.10.2026
+#
+# Description:
+# Qt project file template for running unit tests for the port storage of Model.
+#-----------------------------------------------------------------------------
+
+TEMPLATE = app
+
+TARGET = tst_ModelPorts
+
+QT += core xml testlib
+QT -= gui
+
+CONFIG += c++11 testcase console
+
+linux-g++ | linux-g++-64 | linux-g++-32 {
+ LIBS += -L../../../executable \
+     -lIPXACTmodels
+
+}
+win64 | win32 {
+ LIBS += -L../../../x64/executable \
+     -lIPXACTmodelsd
+}
+
+INCLUDEPATH += $$DESTDIR
+INCLUDEPATH += ../../../
+
+DEPENDPATH += .
+DEPENDPATH += ../../../
+
+OBJECTS_DIR += $$DESTDIR
+
+MOC_DIR += ./generatedFiles
+UI_DIR += ./generatedFiles
+RCC_DIR += ./generatedFiles
+include(tst_ModelPorts.pri)
@@ -0,0 +1,303 @@
+//-----------------------------------------------------------------------------
+// File: tst_StructuralHash.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: Kactus2 team
+// Date: 19.10.2026
+//
+// Description:
+// Unit test for class StructuralHash.
+//-----------------------------------------------------------------------------
+
+#include <IPXACTmodels/utilities/StructuralHash.h>
+
+#include <IPXACTmodels/Component/BusInterface.h>
+#include <IPXACTmodels/Component/Component.h>
+#include <IPXACTmodels/Component/MemoryMap.h>
+#include <IPXACTmodels/Component/Port.h>
+#include <IPXACTmodels/Component/View.h>
+#include <IPXACTmodels/common/Parameter.h>
+#include <IPXACTmodels/Design/Design.h>
+
+#include <QtTest>
+
+class tst_StructuralHash : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_StructuralHash();
+
+private slots:
+
+    void testEqualComponentsHaveEqualHashes();
+    void testComponentHashChangesWithPort();
+    void testComponentHashChangesWithBusInterface();
+    void testComponentHashChangesWithMemoryMap();
+    void testComponentHashChangesWithDescription();
+    void testModifiedElementIsCachedUntilInvalidated();
+    void testComponentIsCachedUntilInvalidated();
+    void testAddedElementsChangeComponentHash();
+    void testDeletedElementsAreRemovedFromCache();
+    void testPortOrderChangesPortListHash();
+    void testDocumentHashOfComponentAndDesign();
+
+private:
+
+    QSharedPointer<Component> createComponent() const;
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_StructuralHash::tst_StructuralHash()
+//-----------------------------------------------------------------------------
+tst_StructuralHash::tst_StructuralHash()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_StructuralHash::testEqualComponentsHaveEqualHashes()
+//-----------------------------------------------------------------------------
+void tst_StructuralHash::testEqualComponentsHaveEqualHashes()
+{
+    StructuralHash hasher;
+
+    QSharedPointer<Component> first = createComponent();
+    QSharedPointer<Component> second = createComponent();
+
+    QVERIFY(hasher.componentHash(first).isEmpty() == false);
+    QCOMPARE(hasher.componentHash(first), hasher.componentHash(second));
+    QCOMPARE(hasher.componentHash(first), StructuralHash().componentHash(second));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_StructuralHash::testComponentHashChangesWithPort()
+//-----------------------------------------------------------------------------
+void tst_StructuralHash::testComponentHashChangesWithPort()
+{
+    StructuralHash hasher;
+
+    QSharedPointer<Component> component = createComponent();
+    QByteArray originalHash = hasher.componentHash(component);
+
+    QSharedPointer<Port> port = component->getPorts()->last();
+    port->setLeftBound(QStringLiteral("31"));
+    hasher.invalidate(port.data());
+    hasher.invalidate(component.data());
+
+    QByteArray modifiedHash = hasher.componentHash(component);
+    QVERIFY(modifiedHash != originalHash);
+    QCOMPARE(modifiedHash, StructuralHash().componentHash(component));
+
+    component->getPorts()->append(QSharedPointer<Port>(new Port(QStringLiteral("extra"))));
+    hasher.invalidate(component.data());
+    QVERIFY(hasher.componentHash(component) != modifiedHash);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_StructuralHash::testComponentHashChangesWithBusInterface()
+//-----------------------------------------------------------------------------
+void tst_StructuralHash::testComponentHashChangesWithBusInterface()
+{
+    StructuralHash hasher;
+
+    QSharedPointer<Component> component = createComponent();
+    QByteArray originalHash = hasher.componentHash(component);
+
+    QSharedPointer<BusInterface> busInterface = component->getBusInterfaces()->first();
+    busInterface->setName(QStringLiteral("renamed"));
+    hasher.invalidate(busInterface.data());
+    hasher.invalidate(component.data());
+
+    QVERIFY(hasher.componentHash(component) != originalHash);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_StructuralHash::testComponentHashChangesWithMemoryMap()
+//-----------------------------------------------------------------------------
+void tst_StructuralHash::testComponentHashChangesWithMemoryMap()
+{
+    StructuralHash hasher;
+
+    QSharedPointer<Component> component = createComponent();
+    QByteArray originalHash = hasher.componentHash(component);
+
+    component->getMemoryMaps()->append(QSharedPointer<MemoryMap>(new MemoryMap(QStringLiteral("registers"))));
+    hasher.invalidate(component.data());
+
+    QVERIFY(hasher.componentHash(component) != originalHash);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_StructuralHash::testComponentHashChangesWithDescription()
+//-----------------------------------------------------------------------------
+void tst_StructuralHash::testComponentHashChangesWithDescription()
+{
+    StructuralHash hasher;
+
+    QSharedPointer<Component> component = createComponent();
+    QByteArray originalHash = hasher.componentHash(component);
+
+    component->setDescription(QStringLiteral("Modified component."));
+    hasher.invalidate(component.data());
+
+    QVERIFY(hasher.componentHash(component) != originalHash);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_StructuralHash::testModifiedElementIsCachedUntilInvalidated()
+//-----------------------------------------------------------------------------
+void tst_StructuralHash::testModifiedElementIsCachedUntilInvalidated()
+{
+    StructuralHash hasher;
+
+    QSharedPointer<Port> port(new Port(QStringLiteral("clk")));
+    QByteArray originalHash = hasher.portHash(port);
+
+    port->setDirection(DirectionTypes::OUT);
+    QCOMPARE(hasher.portHash(port), originalHash);
+
+    hasher.invalidate(port.data());
+    QVERIFY(hasher.portHash(port) != originalHash);
+
+    hasher.clear();
+    QCOMPARE(hasher.portHash(port), StructuralHash().portHash(port));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_StructuralHash::testComponentIsCachedUntilInvalidated()
+//-----------------------------------------------------------------------------
+void tst_StructuralHash::testComponentIsCachedUntilInvalidated()
+{
+    StructuralHash hasher;
+
+    QSharedPointer<Component> component = createComponent();
+    QByteArray originalHash = hasher.componentHash(component);
+
+    component->getPorts()->last()->setLeftBound(QStringLiteral("15"));
+    QCOMPARE(hasher.componentHash(component), originalHash);
+    QCOMPARE(hasher.documentHash(component), originalHash);
+
+    hasher.invalidate(component.data());
+    QVERIFY(hasher.componentHash(component) != originalHash);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_StructuralHash::testAddedElementsChangeComponentHash()
+//-----------------------------------------------------------------------------
+void tst_StructuralHash::testAddedElementsChangeComponentHash()
+{
+    StructuralHash hasher;
+
+    QSharedPointer<Component> component = createComponent();
+    QByteArray originalHash = hasher.componentHash(component);
+
+    QSharedPointer<View> view(new View(QStringLiteral("rtl")));
+    component->getViews()->append(view);
+    QByteArray viewHash = hasher.componentHash(component);
+    QVERIFY(viewHash != originalHash);
+    QCOMPARE(viewHash, StructuralHash().componentHash(component));
+
+    QSharedPointer<Parameter> parameter(new Parameter());
+    parameter->setName(QStringLiteral("WIDTH"));
+    parameter->setValue(QStringLiteral("8"));
+    component->getParameters()->append(parameter);
+    QByteArray parameterHash = hasher.componentHash(component);
+    QVERIFY(parameterHash != viewHash);
+    QCOMPARE(parameterHash, StructuralHash().componentHash(component));
+
+    component->getPorts()->move(0, 1);
+    QVERIFY(hasher.componentHash(component) != parameterHash);
+
+    component->getPorts()->move(1, 0);
+    component->getViews()->clear();
+    component->getParameters()->clear();
+    QCOMPARE(hasher.componentHash(component), originalHash);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_StructuralHash::testDeletedElementsAreRemovedFromCache()
+//-----------------------------------------------------------------------------
+void tst_StructuralHash::testDeletedElementsAreRemovedFromCache()
+{
+    StructuralHash hasher;
+
+    QSharedPointer<Port> keptPort(new Port(QStringLiteral("kept")));
+    QByteArray keptHash = hasher.portHash(keptPort);
+
+    // Hashing re-read documents leaves the entries of the discarded copies behind.
+    for (int i = 0; i < 10000; ++i)
+    {
+        QSharedPointer<Port> port(new Port(QStringLiteral("port") + QString::number(i)));
+        hasher.portHash(port);
+    }
+
+    QVERIFY(hasher.cacheSize() <= 2048);
+    QCOMPARE(hasher.portHash(keptPort), keptHash);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_StructuralHash::testPortOrderChangesPortListHash()
+//-----------------------------------------------------------------------------
+void tst_StructuralHash::testPortOrderChangesPortListHash()
+{
+    StructuralHash hasher;
+
+    QSharedPointer<Port> first(new Port(QStringLiteral("clk")));
+    QSharedPointer<Port> second(new Port(QStringLiteral("rst_n")));
+
+    QList<QSharedPointer<Port> > ports({first, second});
+    QList<QSharedPointer<Port> > reversedPorts({second, first});
+
+    QVERIFY(hasher.portListHash(ports) != hasher.portListHash(reversedPorts));
+    QVERIFY(hasher.portListHash(ports) != hasher.portListHash(QList<QSharedPointer<Port> >()));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_StructuralHash::testDocumentHashOfComponentAndDesign()
+//-----------------------------------------------------------------------------
+void tst_StructuralHash::testDocumentHashOfComponentAndDesign()
+{
+    StructuralHash hasher;
+
+    QSharedPointer<Component> component = createComponent();
+    QCOMPARE(hasher.documentHash(component), hasher.componentHash(component));
+
+    QSharedPointer<Design> design(new Design(VLNV(VLNV::DESIGN, "tut.fi", "TestLibrary", "TestDesign", "1.0")));
+    QSharedPointer<Design> otherDesign(new Design(VLNV(VLNV::DESIGN, "tut.fi", "TestLibrary", "Other", "1.0")));
+
+    QCOMPARE(hasher.documentHash(design), hasher.designHash(design));
+    QVERIFY(hasher.designHash(design) != hasher.designHash(otherDesign));
+    QVERIFY(hasher.documentHash(design) != hasher.documentHash(component));
+
+    QVERIFY(hasher.documentHash(QSharedPointer<Document const>()).isEmpty());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_StructuralHash::createComponent()
+//-----------------------------------------------------------------------------
+QSharedPointer<Component> tst_StructuralHash::createComponent() const
+{
+    QSharedPointer<Component> component(
+        new Component(VLNV(VLNV::COMPONENT, "tut.fi", "TestLibrary", "TestComponent", "1.0")));
+
+    QSharedPointer<BusInterface> busInterface(new BusInterface());
+    busInterface->setName(QStringLiteral("bus"));
+    component->getBusInterfaces()->append(busInterface);
+
+    QSharedPointer<Port> clock(new Port(QStringLiteral("clk")));
+    clock->setDirection(DirectionTypes::IN);
+    component->getPorts()->append(clock);
+
+    QSharedPointer<Port> data(new Port(QStringLiteral("data")));
+    data->setDirection(DirectionTypes::OUT);
+    data->setLeftBound(QStringLiteral("7"));
+    data->setRightBound(QStringLiteral("0"));
+    component->getPorts()->append(data);
+
+    return component;
+}
+
+QTEST_APPLESS_MAIN(tst_StructuralHash)
+
+#include "tst_StructuralHash.moc"
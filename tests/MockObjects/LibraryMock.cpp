@@ -161,6 +161,14 @@ VLNV::IPXactType LibraryMock::getDocumentType(const VLNV& vlnv)
     }
 }
 
+//-----------------------------------------------------------------------------
+// Function: LibraryMock::getMetadata()
+//-----------------------------------------------------------------------------
+DocumentMetadata LibraryMock::getMetadata(const VLNV& vlnv)
+{
+    return DocumentMetadata::create(components_.value(vlnv));
+}
+
 //-----------------------------------------------------------------------------
 // Function: LibraryMock::referenceCount()
 //-----------------------------------------------------------------------------
@@ -300,7 +308,8 @@ void LibraryMock::beginSave()
 //-----------------------------------------------------------------------------
 // Function: LibraryMock::endSave()
 //-----------------------------------------------------------------------------
-void LibraryMock::endSave()
+bool LibraryMock::endSave()
 {
    Q_ASSERT(false);
+   return false;
 }
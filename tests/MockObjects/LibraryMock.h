@@ -162,6 +162,15 @@ public:
     */
     virtual VLNV::IPXactType getDocumentType(const VLNV& vlnv);
 
+    /*!
+    *  Method description.
+    *
+    *      @param [in]    Description.
+    *
+    *      @return Description.
+    */
+    virtual DocumentMetadata getMetadata(const VLNV& vlnv);
+
     /*!
     *  Method description.
     *
@@ -322,7 +331,7 @@ public slots:
     *
     *      @return Description.
     */
-    virtual void endSave();
+    virtual bool endSave();
 
 private:
 
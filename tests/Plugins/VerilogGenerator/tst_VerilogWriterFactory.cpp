@@ -94,6 +94,16 @@ private slots:
 	void testGenerationWithImplementation();
 	void testGenerationWithImplementationWithTag();
 	void testGenerationWithImplementationWithPostModule();
+    void testGenerationWithNonAsciiImplementation();
+    void testGenerationWithNonAsciiImplementation_data();
+
+    // Output test cases:
+    void testIncrementalOutputSkipsUnchangedFiles();
+    void testIncrementalOutputRemovesStaleFiles();
+    void testStreamingOutputMatchesRenderedOutput();
+
+    // Parallel generation test cases:
+    void testMultipleDesignsKeepTheirOrder();
 
 private slots:
 
@@ -121,6 +131,8 @@ private:
 
     void runGenerator(bool useDesign);
 
+    QSharedPointer<GenerationOutput> createDesignDocument();
+
     void createPortAssignment(QSharedPointer<MetaPort> mPort, QSharedPointer<MetaWire> wire, bool up,
         QString const& logicalLeft, QString const& logicalRight, QString const& physicalLeft, 
         QString const& physicalRight);
@@ -2429,6 +2441,48 @@ void tst_VerilogWriterFactory::testGenerationWithImplementationWithTag()
 	verifyOutputContains(content);
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_VerilogWriterFactory::testGenerationWithNonAsciiImplementation()
+//-----------------------------------------------------------------------------
+void tst_VerilogWriterFactory::testGenerationWithNonAsciiImplementation()
+{
+    QFETCH(QByteArray, byteOrderMark);
+
+    QString content(
+        "module TestComponent(\n"
+        "    // These ports are not in any interface\n"
+        "    input                               clk\n"
+        ");\n"
+        "\n"
+        "// " + VerilogSyntax::TAG_OVERRIDE + "\n" +
+        QString::fromUtf8("// K\xc3\xa4ytt\xc3\xa4j\xc3\xa4n toteutus \xe2\x82\xac\n") +
+        "endmodule\n"
+        );
+
+    QFile existingFile("TestComponent.v");
+
+    existingFile.open(QIODevice::WriteOnly);
+    existingFile.write(byteOrderMark + content.toUtf8());
+    existingFile.close();
+
+    addPort("clk", 1, DirectionTypes::IN, flatComponent_);
+
+    runGenerator(false);
+
+    verifyOutputContains(content);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VerilogWriterFactory::testGenerationWithNonAsciiImplementation_data()
+//-----------------------------------------------------------------------------
+void tst_VerilogWriterFactory::testGenerationWithNonAsciiImplementation_data()
+{
+    QTest::addColumn<QByteArray>("byteOrderMark");
+
+    QTest::newRow("UTF-8 without byte order mark") << QByteArray();
+    QTest::newRow("UTF-8 with byte order mark") << QByteArray("\xef\xbb\xbf");
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_VerilogWriterFactory::testGenerationWithImplementationWithPostModule()
 //-----------------------------------------------------------------------------
@@ -2475,6 +2529,214 @@ void tst_VerilogWriterFactory::testGenerationWithImplementationWithPostModule()
 	verifyOutputContains(content);
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_VerilogWriterFactory::testIncrementalOutputSkipsUnchangedFiles()
+//-----------------------------------------------------------------------------
+void tst_VerilogWriterFactory::testIncrementalOutputSkipsUnchangedFiles()
+{
+    addPort("clk", 1, DirectionTypes::IN, topComponent_);
+
+    QTemporaryDir outputDirectory;
+    QVERIFY(outputDirectory.isValid());
+
+    OutputControl outputControl;
+    outputControl.setOutputPath(outputDirectory.path());
+    outputControl.setIncremental(true);
+
+    QSharedPointer<GenerationOutput> document = createDesignDocument();
+    QCOMPARE(outputControl.writeOutput(document), OutputControl::WRITE_CHANGED);
+
+    // A later run with the same input differs only by the creation time.
+    document->fileContent_.replace(QRegularExpression("// Creation time : [^\n]*"),
+        "// Creation time : 23:59:59");
+    QCOMPARE(outputControl.writeOutput(document), OutputControl::WRITE_UNCHANGED);
+
+    addPort("rst_n", 1, DirectionTypes::IN, topComponent_);
+    document = createDesignDocument();
+    QCOMPARE(outputControl.writeOutput(document), OutputControl::WRITE_CHANGED);
+
+    QFile outputFile(outputDirectory.filePath(document->fileName_));
+    QVERIFY(outputFile.open(QIODevice::ReadOnly));
+    QVERIFY(QString(outputFile.readAll()).contains("rst_n"));
+
+    outputControl.setIncremental(false);
+    QCOMPARE(outputControl.writeOutput(document), OutputControl::WRITE_CHANGED);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VerilogWriterFactory::testIncrementalOutputRemovesStaleFiles()
+//-----------------------------------------------------------------------------
+void tst_VerilogWriterFactory::testIncrementalOutputRemovesStaleFiles()
+{
+    QTemporaryDir outputDirectory;
+    QVERIFY(outputDirectory.isValid());
+
+    OutputControl firstRun;
+    firstRun.setOutputPath(outputDirectory.path());
+    firstRun.setIncremental(true);
+
+    QSharedPointer<GenerationOutput> document = createDesignDocument();
+    QString originalName = document->fileName_;
+    firstRun.getOutputs()->append(document);
+    QCOMPARE(firstRun.writeOutput(document), OutputControl::WRITE_CHANGED);
+
+    QStringList removedFiles;
+    QVERIFY(firstRun.removeStaleOutputs("TestComponent", removedFiles));
+    QVERIFY(removedFiles.isEmpty());
+
+    // A file listed by another generation into the same directory must be kept.
+    OutputControl otherGeneration;
+    otherGeneration.setOutputPath(outputDirectory.path());
+    otherGeneration.setIncremental(true);
+    otherGeneration.getOutputs()->append(document);
+    QVERIFY(otherGeneration.removeStaleOutputs("OtherComponent", removedFiles));
+
+    OutputControl secondRun;
+    secondRun.setOutputPath(outputDirectory.path());
+    secondRun.setIncremental(true);
+
+    QSharedPointer<GenerationOutput> renamedDocument = createDesignDocument();
+    renamedDocument->fileName_ = "Renamed.v";
+    secondRun.getOutputs()->append(renamedDocument);
+    QCOMPARE(secondRun.writeOutput(renamedDocument), OutputControl::WRITE_CHANGED);
+
+    QVERIFY(secondRun.removeStaleOutputs("TestComponent", removedFiles));
+    QVERIFY(removedFiles.isEmpty());
+    QVERIFY(QFile::exists(outputDirectory.filePath(originalName)));
+
+    QVERIFY(otherGeneration.removeStaleOutputs("OtherComponent", removedFiles));
+    QVERIFY(removedFiles.isEmpty());
+
+    // The file is removed, when the last generation listing it no longer generates it.
+    otherGeneration.getOutputs()->clear();
+    QVERIFY(otherGeneration.removeStaleOutputs("OtherComponent", removedFiles));
+    QCOMPARE(removedFiles, QStringList(originalName));
+    QVERIFY(!QFile::exists(outputDirectory.filePath(originalName)));
+    QVERIFY(QFile::exists(outputDirectory.filePath("Renamed.v")));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VerilogWriterFactory::testStreamingOutputMatchesRenderedOutput()
+//-----------------------------------------------------------------------------
+void tst_VerilogWriterFactory::testStreamingOutputMatchesRenderedOutput()
+{
+    addPort("clk", 1, DirectionTypes::IN, topComponent_);
+    addPort("dataOut", 8, DirectionTypes::OUT, topComponent_);
+
+    QTemporaryDir outputDirectory;
+    QVERIFY(outputDirectory.isValid());
+
+    OutputControl outputControl;
+    outputControl.setOutputPath(outputDirectory.path());
+    outputControl.setStreaming(true);
+
+    QSharedPointer<GenerationOutput> document = createDesignDocument();
+    QString renderedContent = document->fileContent_;
+    document->fileContent_.clear();
+
+    QCOMPARE(outputControl.writeOutput(document), OutputControl::WRITE_CHANGED);
+    QVERIFY(document->fileContent_.isEmpty());
+
+    QFile outputFile(outputDirectory.filePath(document->fileName_));
+    QVERIFY(outputFile.open(QIODevice::ReadOnly));
+    QCOMPARE(document->stableContent(QString(outputFile.readAll())), document->stableContent(renderedContent));
+    outputFile.close();
+
+    // Only the streamed file must remain in the directory.
+    QCOMPARE(QDir(outputDirectory.path()).entryList(QDir::Files), QStringList(document->fileName_));
+
+    // The streamed file gets the same permissions as any other file created by the user.
+    QFile referenceFile(outputDirectory.filePath("reference.txt"));
+    QVERIFY(referenceFile.open(QIODevice::WriteOnly));
+    referenceFile.close();
+    QCOMPARE(outputFile.permissions(), referenceFile.permissions());
+    QVERIFY(referenceFile.remove());
+
+    outputControl.setIncremental(true);
+    QCOMPARE(outputControl.writeOutput(document), OutputControl::WRITE_UNCHANGED);
+
+    addPort("rst_n", 1, DirectionTypes::IN, topComponent_);
+    document = createDesignDocument();
+    QCOMPARE(outputControl.writeOutput(document), OutputControl::WRITE_CHANGED);
+
+    QVERIFY(outputFile.open(QIODevice::ReadOnly));
+    QVERIFY(QString(outputFile.readAll()).contains("rst_n"));
+    QCOMPARE(QDir(outputDirectory.path()).entryList(QDir::Files), QStringList(document->fileName_));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VerilogWriterFactory::testMultipleDesignsKeepTheirOrder()
+//-----------------------------------------------------------------------------
+void tst_VerilogWriterFactory::testMultipleDesignsKeepTheirOrder()
+{
+    MessagePasser messages;
+
+    QList<QSharedPointer<MetaDesign> > designs;
+    QStringList expectedFiles;
+    for (int i = 0; i < 20; ++i)
+    {
+        // Every fifth design has no name for the module and cannot be written.
+        QString name = i % 5 == 4 ? QString() : QString("Module_%1").arg(i);
+
+        QSharedPointer<Component> component(new Component(
+            VLNV(VLNV::COMPONENT, "Test", "TestLibrary", name, "1.0")));
+        QSharedPointer<MetaInstance> topInstance(new MetaInstance(QSharedPointer<ComponentInstance>(),
+            &library_, &messages, component, QSharedPointer<View>()));
+        addPort("clk", 1, DirectionTypes::IN, topInstance);
+
+        designs.append(QSharedPointer<MetaDesign>(new MetaDesign(&library_, &messages,
+            QSharedPointer<Design>(), QSharedPointer<DesignInstantiation>(),
+            QSharedPointer<DesignConfiguration>(), topInstance)));
+
+        if (!name.isEmpty())
+        {
+            expectedFiles.append(name + ".v");
+        }
+    }
+
+    connect(&messages, SIGNAL(errorMessage(QString const&)),
+        this, SLOT(gatherErrorMessage(QString const&)), Qt::UniqueConnection);
+
+    GenerationSettings settings;
+    settings.generateInterfaces_ = false;
+
+    VerilogWriterFactory factory(&library_, &messages, &settings, "bogusToolVersion", "bogusGeneratorVersion");
+    QList<QSharedPointer<GenerationOutput> > documents = factory.prepareDesign(designs);
+
+    QStringList generatedFiles;
+    foreach (QSharedPointer<GenerationOutput> document, documents)
+    {
+        generatedFiles.append(document->fileName_);
+
+        document->write(".");
+        QVERIFY(document->fileContent_.contains("module " + QFileInfo(document->fileName_).baseName()));
+    }
+
+    QCOMPARE(generatedFiles, expectedFiles);
+    QCOMPARE(errorMessages_.size(), 4);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VerilogWriterFactory::createDesignDocument()
+//-----------------------------------------------------------------------------
+QSharedPointer<GenerationOutput> tst_VerilogWriterFactory::createDesignDocument()
+{
+    GenerationSettings settings;
+    settings.generateInterfaces_ = false;
+
+    MessagePasser messages;
+
+    VerilogWriterFactory factory(&library_, &messages, &settings, "bogusToolVersion", "bogusGeneratorVersion");
+
+    QList<QSharedPointer<MetaDesign> > designs;
+    designs.append(design_);
+
+    QSharedPointer<GenerationOutput> document = factory.prepareDesign(designs).first();
+    document->write(".");
+
+    return document;
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_VerilogWriterFactory::verifyOutputContains()
 //-----------------------------------------------------------------------------
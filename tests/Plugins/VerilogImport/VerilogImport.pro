@@ -9,4 +9,5 @@ CONFIG += testcase
 SUBDIRS += tst_HDLParser.pro \
            tst_VerilogPortParser.pro \
 		   tst_VerilogParameterParser.pro\
-		   tst_VerilogImporter.pro 
\ No newline at end of file
+		   tst_VerilogImporter.pro \
+		   tst_VerilogTokenizer.pro
\ No newline at end of file
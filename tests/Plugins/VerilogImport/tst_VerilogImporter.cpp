@@ -26,6 +26,10 @@
 #include <editors/ComponentEditor/common/ComponentParameterFinder.h>
 
 #include <wizards/ComponentWizard/ImportEditor/ImportHighlighter.h>
+#include <wizards/ComponentWizard/InstanceData.h>
+
+#include <IPXACTmodels/kactusExtensions/Kactus2Group.h>
+#include <IPXACTmodels/kactusExtensions/Kactus2Value.h>
 
 class tst_VerilogImporter : public QObject
 {
@@ -84,6 +88,8 @@ private slots:
     void testMultipleModelsInOneFile();
     void testMultipleModelsInOneFile_data();
 
+    void testInstancesAreImported();
+
 private:
 
     QString getModuleDeclaration(QString const& input, int const& moduleNumber = 0);
@@ -1349,6 +1355,77 @@ void tst_VerilogImporter::testMultipleModelsInOneFile_data()
         << 2;
 }
 
+//-----------------------------------------------------------------------------
+// Function: tst_VerilogImporter::testInstancesAreImported()
+//-----------------------------------------------------------------------------
+void tst_VerilogImporter::testInstancesAreImported()
+{
+    QString fileContent(
+        "module top(input clk, output [7:0] data);\n"
+        "    // unused u_old(.clk(clk));\n"
+        "    counter #(.WIDTH(8), // Counter width.\n"
+        "        .START(0)) u_counter (\n"
+        "        .clk(clk), /* Shared clock. */\n"
+        "        .value(data)\n"
+        "    );\n"
+        "    assign #1 data = 8'h0;\n"
+        "    xor(sum, bit1, bit2);\n"
+        "    buffer u_buffer(.in(clk));\n"
+        "endmodule\n");
+
+    runParser(fileContent);
+
+    QSharedPointer<Kactus2Group> instancesGroup;
+    for (QSharedPointer<VendorExtension> extension : *importComponent_->getVendorExtensions())
+    {
+        if (extension->type() == InstanceData::VERILOGINSTANCES)
+        {
+            instancesGroup = extension.dynamicCast<Kactus2Group>();
+        }
+    }
+
+    QVERIFY(instancesGroup);
+
+    QList<QSharedPointer<VendorExtension> > instances = instancesGroup->getByType(InstanceData::SINGLEINSTANCE);
+    QCOMPARE(instances.size(), 2);
+
+    QSharedPointer<Kactus2Group> counter = instances.first().dynamicCast<Kactus2Group>();
+    QCOMPARE(counter->getByType(InstanceData::INSTANCENAME).first().dynamicCast<Kactus2Value>()->value(),
+        QString("u_counter"));
+    QCOMPARE(counter->getByType(InstanceData::MODULENAME).first().dynamicCast<Kactus2Value>()->value(),
+        QString("counter"));
+
+    QSharedPointer<Kactus2Group> parameters =
+        counter->getByType(InstanceData::PARAMETERS).first().dynamicCast<Kactus2Group>();
+    QCOMPARE(parameters->getByType(InstanceData::SINGLEPARAMETER).size(), 2);
+
+    QSharedPointer<Kactus2Group> connections =
+        counter->getByType(InstanceData::CONNECTIONS).first().dynamicCast<Kactus2Group>();
+    QList<QSharedPointer<VendorExtension> > counterConnections =
+        connections->getByType(InstanceData::SINGLECONNECTION);
+    QCOMPARE(counterConnections.size(), 2);
+
+    QSharedPointer<Kactus2Group> clockConnection = counterConnections.first().dynamicCast<Kactus2Group>();
+    QCOMPARE(clockConnection->getByType(InstanceData::SUBITEMNAME).first().dynamicCast<Kactus2Value>()->value(),
+        QString("clk"));
+    QCOMPARE(clockConnection->getByType(InstanceData::SUBITEMVALUE).first().dynamicCast<Kactus2Value>()->value(),
+        QString("clk"));
+
+    QSharedPointer<Kactus2Group> buffer = instances.last().dynamicCast<Kactus2Group>();
+    QCOMPARE(buffer->getByType(InstanceData::INSTANCENAME).first().dynamicCast<Kactus2Value>()->value(),
+        QString("u_buffer"));
+    QVERIFY(buffer->getByType(InstanceData::PARAMETERS).isEmpty());
+
+    int moduleBegin = fileContent.indexOf("counter #");
+    verifyNotHighlightedBeforeDeclaration(moduleBegin, ImportColors::INSTANCECOLOR);
+    verifyDeclarationIsHighlighted(moduleBegin, QString("counter").length(), ImportColors::INSTANCECOLOR);
+
+    int instanceBegin = fileContent.indexOf("u_counter");
+    verifyDeclarationIsHighlighted(instanceBegin, QString("u_counter").length(), ImportColors::INSTANCECOLOR);
+    verifyNotHighlightedAfterDeclartion(instanceBegin, QString("u_counter").length(),
+        ImportColors::INSTANCECOLOR);
+}
+
 //-----------------------------------------------------------------------------
 // Function: tst_VerilogImporter::parameterUuid()
 //-----------------------------------------------------------------------------
@@ -18,6 +18,7 @@ HEADERS += ../../../editors/ComponentEditor/common/ComponentParameterFinder.h \
     ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
     ../../../Plugins/VerilogImport/VerilogParameterParser.h \
     ../../../Plugins/VerilogImport/VerilogPortParser.h \
+    ../../../Plugins/VerilogImport/VerilogTokenizer.h \
     ../../../wizards/ComponentWizard/ImportEditor/ImportHighlighter.h \
     ../../../Plugins/VerilogImport/VerilogImporter.h \
     ../../../Plugins/VerilogImport/VerilogInstanceParser.h \
@@ -32,6 +33,7 @@ SOURCES += ../../../editors/ComponentEditor/common/ComponentParameterFinder.cpp
     ../../../Plugins/VerilogImport/VerilogParameterParser.cpp \
     ../../../Plugins/VerilogImport/VerilogPortParser.cpp \
     ../../../Plugins/VerilogImport/VerilogSyntax.cpp \
+    ../../../Plugins/VerilogImport/VerilogTokenizer.cpp \
     ./tst_VerilogImporter.cpp \
     ../../../Plugins/VerilogImport/VerilogInstanceParser.cpp \
     ../../../common/expressions/utilities.cpp
@@ -12,10 +12,12 @@ HEADERS += ../../../editors/ComponentEditor/common/ExpressionParser.h \
     ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
     ../../../Plugins/VerilogImport/VerilogParameterParser.h \
     ../../../Plugins/VerilogImport/VerilogSyntax.h \
+    ../../../Plugins/VerilogImport/VerilogTokenizer.h \
     ../../../common/expressions/utilities.h
 SOURCES += ../../../editors/ComponentEditor/common/IPXactSystemVerilogParser.cpp \
     ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
     ../../../Plugins/VerilogImport/VerilogParameterParser.cpp \
     ../../../Plugins/VerilogImport/VerilogSyntax.cpp \
+    ../../../Plugins/VerilogImport/VerilogTokenizer.cpp \
     ./tst_VerilogParameterParser.cpp \
     ../../../common/expressions/utilities.cpp
@@ -6,12 +6,14 @@ HEADERS += ../../../editors/ComponentEditor/common/NullParser.h \
     ../../../Plugins/common/HDLmath.h \
     ../../../Plugins/VerilogImport/VerilogPortParser.h \
     ../../../Plugins/VerilogImport/VerilogSyntax.h \
+    ../../../Plugins/VerilogImport/VerilogTokenizer.h \
     ../../../editors/ComponentEditor/common/IPXactSystemVerilogParser.h \
     ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.h \
     ../../../editors/ComponentEditor/common/ExpressionParser.h \
     ../../../editors/ComponentEditor/common/ComponentParameterFinder.h
 SOURCES += ../../../editors/ComponentEditor/common/NullParser.cpp \
     ../../../Plugins/VerilogImport/VerilogPortParser.cpp \
+    ../../../Plugins/VerilogImport/VerilogTokenizer.cpp \
     ./tst_VerilogPortParser.cpp \
     ../../../editors/ComponentEditor/common/IPXactSystemVerilogParser.cpp \
     ../../../editors/ComponentEditor/common/SystemVerilogExpressionParser.cpp \
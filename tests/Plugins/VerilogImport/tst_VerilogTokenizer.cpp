@@ -0,0 +1,144 @@
+//-----------------------------------------------------------------------------
+// File: tst_VerilogTokenizer.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: Kactus2 team
+// Date: 19.10.2026
+//
+// Description:
+// Unit test for VerilogTokenizer.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+
+#include <Plugins/VerilogImport/VerilogTokenizer.h>
+
+Q_DECLARE_METATYPE(VerilogTokenizer::TokenType)
+
+class tst_VerilogTokenizer : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_VerilogTokenizer();
+
+private slots:
+
+    // Test cases:
+    void testSingleToken();
+    void testSingleToken_data();
+
+    void testTokensOfDeclaration();
+
+    void testReplaceIdentifiers();
+    void testReplaceIdentifiers_data();
+};
+
+//-----------------------------------------------------------------------------
+// Function: tst_VerilogTokenizer::tst_VerilogTokenizer()
+//-----------------------------------------------------------------------------
+tst_VerilogTokenizer::tst_VerilogTokenizer()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VerilogTokenizer::testSingleToken()
+//-----------------------------------------------------------------------------
+void tst_VerilogTokenizer::testSingleToken()
+{
+    QFETCH(QString, input);
+    QFETCH(VerilogTokenizer::TokenType, expectedType);
+
+    QVector<VerilogTokenizer::Token> tokens = VerilogTokenizer::tokenize(input);
+
+    QCOMPARE(tokens.size(), 1);
+    QCOMPARE(tokens.first().type, expectedType);
+    QCOMPARE(input.mid(tokens.first().start, tokens.first().length), input.trimmed());
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VerilogTokenizer::testSingleToken_data()
+//-----------------------------------------------------------------------------
+void tst_VerilogTokenizer::testSingleToken_data()
+{
+    QTest::addColumn<QString>("input");
+    QTest::addColumn<VerilogTokenizer::TokenType>("expectedType");
+
+    QTest::newRow("identifier") << "data_width" << VerilogTokenizer::IDENTIFIER;
+    QTest::newRow("system function") << "$clog2" << VerilogTokenizer::IDENTIFIER;
+    QTest::newRow("escaped identifier") << "\\bus+index " << VerilogTokenizer::IDENTIFIER;
+    QTest::newRow("macro") << "`WIDTH" << VerilogTokenizer::MACRO;
+    QTest::newRow("decimal") << "1_000" << VerilogTokenizer::NUMBER;
+    QTest::newRow("real") << "1.5" << VerilogTokenizer::NUMBER;
+    QTest::newRow("based number") << "8'hFF" << VerilogTokenizer::NUMBER;
+    QTest::newRow("signed unsized number") << "'sb1x?" << VerilogTokenizer::NUMBER;
+    QTest::newRow("string") << "\"a \\\" b\"" << VerilogTokenizer::STRING;
+    QTest::newRow("one-line comment") << "// comment */\n" << VerilogTokenizer::COMMENT;
+    QTest::newRow("multiline comment") << "/* first\n second */" << VerilogTokenizer::COMMENT;
+    QTest::newRow("unterminated comment") << "/* first" << VerilogTokenizer::COMMENT;
+    QTest::newRow("symbol") << "+" << VerilogTokenizer::SYMBOL;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VerilogTokenizer::testTokensOfDeclaration()
+//-----------------------------------------------------------------------------
+void tst_VerilogTokenizer::testTokensOfDeclaration()
+{
+    QString input("input [`WIDTH-1:0] data; // Data in.");
+
+    QVector<VerilogTokenizer::Token> tokens = VerilogTokenizer::tokenize(input);
+
+    QStringList texts;
+    for (VerilogTokenizer::Token const& token : tokens)
+    {
+        texts.append(input.mid(token.start, token.length));
+    }
+
+    QCOMPARE(texts, QStringList({"input", "[", "`WIDTH", "-", "1", ":", "0", "]", "data", ";",
+        "// Data in."}));
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VerilogTokenizer::testReplaceIdentifiers()
+//-----------------------------------------------------------------------------
+void tst_VerilogTokenizer::testReplaceIdentifiers()
+{
+    QFETCH(QString, expression);
+    QFETCH(QString, expectedResult);
+
+    QString result = VerilogTokenizer::replaceIdentifiers(expression, [](QString const& name, QString& replacement)
+    {
+        if (name == QLatin1String("WIDTH"))
+        {
+            replacement = QStringLiteral("id_width");
+            return true;
+        }
+
+        return false;
+    });
+
+    QCOMPARE(result, expectedResult);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_VerilogTokenizer::testReplaceIdentifiers_data()
+//-----------------------------------------------------------------------------
+void tst_VerilogTokenizer::testReplaceIdentifiers_data()
+{
+    QTest::addColumn<QString>("expression");
+    QTest::addColumn<QString>("expectedResult");
+
+    QTest::newRow("no references") << "8 - 1" << "8 - 1";
+    QTest::newRow("identifier") << "WIDTH - 1" << "id_width - 1";
+    QTest::newRow("macro") << "`WIDTH-1" << "id_width-1";
+    QTest::newRow("multiple references") << "WIDTH*`WIDTH" << "id_width*id_width";
+    QTest::newRow("part of a longer name") << "MAX_WIDTH + WIDTH_MAX" << "MAX_WIDTH + WIDTH_MAX";
+    QTest::newRow("inside a string") << "\"WIDTH\"" << "\"WIDTH\"";
+    QTest::newRow("inside a comment") << "WIDTH // WIDTH" << "id_width // WIDTH";
+    QTest::newRow("base of a number") << "4'hWIDTH" << "4'hWIDTH";
+}
+
+QTEST_APPLESS_MAIN(tst_VerilogTokenizer)
+
+#include "tst_VerilogTokenizer.moc"
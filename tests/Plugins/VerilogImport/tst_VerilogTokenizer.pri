@@ -0,0 +1,7 @@
+# ----------------------------------------------------
+# This file is generated by the Qt Visual Studio Add-in.
+# ------------------------------------------------------
+
+HEADERS += ../../../Plugins/VerilogImport/VerilogTokenizer.h
+SOURCES += ../../../Plugins/VerilogImport/VerilogTokenizer.cpp \
+    ./tst_VerilogTokenizer.cpp
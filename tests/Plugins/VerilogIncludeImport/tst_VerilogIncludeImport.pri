@@ -9,12 +9,14 @@ message("You are running qmake on a generated .pro file. This may not work!")
 
 HEADERS += ../../../IPXACTmodels/utilities/Search.h \
     ../../../Plugins/VerilogImport/VerilogParameterParser.h \
+    ../../../Plugins/VerilogImport/VerilogTokenizer.h \
     ../../../Plugins/VerilogIncludeImport/verilogincludeimport_global.h \
     ../../../wizards/ComponentWizard/ImportEditor/ImportHighlighter.h \
     ../../../Plugins/VerilogIncludeImport/VerilogIncludeImport.h \
     ../../../common/expressions/utilities.h
 SOURCES += ../../../Plugins/VerilogImport/VerilogParameterParser.cpp \
     ../../../Plugins/VerilogImport/VerilogSyntax.cpp \
+    ../../../Plugins/VerilogImport/VerilogTokenizer.cpp \
     ../../../wizards/ComponentWizard/ImportEditor/ImportHighlighter.cpp \
     ../../../Plugins/VerilogIncludeImport/VerilogIncludeImport.cpp \
     ./tst_VerilogIncludeImport.cpp \
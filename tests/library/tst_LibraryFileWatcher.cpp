@@ -0,0 +1,260 @@
+//-----------------------------------------------------------------------------
+// File: tst_LibraryFileWatcher.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: Kactus2 team
+// Date: 19.10.2026
+//
+// Description:
+// Unit test for class LibraryFileWatcher.
+//-----------------------------------------------------------------------------
+
+#include <QtTest>
+
+#include <library/LibraryFileWatcher.h>
+
+#include <QSaveFile>
+#include <QTemporaryDir>
+
+class tst_LibraryFileWatcher : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_LibraryFileWatcher();
+
+private:
+
+    QString createFile(QString const& path, QByteArray const& content);
+
+    void writeInPlace(QString const& path, QByteArray const& content);
+
+private slots:
+
+    void testReplacedFileIsReported();
+    void testReplacedFileIsReported_data();
+
+    void testFileWrittenInPlaceIsReported();
+    void testFileWrittenInPlaceIsReported_data();
+
+    void testRemovedFileIsReported();
+
+    void testOtherFilesInDirectoryAreNotReported();
+
+    void testRemovedPathIsNotReported();
+
+    void testFilesAreListed();
+};
+
+tst_LibraryFileWatcher::tst_LibraryFileWatcher()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryFileWatcher::createFile()
+//-----------------------------------------------------------------------------
+QString tst_LibraryFileWatcher::createFile(QString const& path, QByteArray const& content)
+{
+    // The file is replaced like the library and the editors save files.
+    QSaveFile file(path);
+    file.open(QIODevice::WriteOnly);
+    file.write(content);
+    file.commit();
+
+    // Keep the modification times apart regardless of the file system time resolution.
+    static int fileCount = 0;
+    QFile written(path);
+    written.open(QIODevice::ReadWrite);
+    written.setFileTime(QDateTime::currentDateTime().addSecs(++fileCount), QFileDevice::FileModificationTime);
+    written.close();
+
+    return path;
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryFileWatcher::writeInPlace()
+//-----------------------------------------------------------------------------
+void tst_LibraryFileWatcher::writeInPlace(QString const& path, QByteArray const& content)
+{
+    // The file is overwritten like e.g. cp and some editors do, keeping the same file on disk.
+    QFile file(path);
+    file.open(QIODevice::WriteOnly | QIODevice::Truncate);
+    file.write(content);
+    file.flush();
+
+    static int writeCount = 0;
+    file.setFileTime(QDateTime::currentDateTime().addSecs(3600 + ++writeCount), QFileDevice::FileModificationTime);
+    file.close();
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryFileWatcher::testReplacedFileIsReported()
+//-----------------------------------------------------------------------------
+void tst_LibraryFileWatcher::testReplacedFileIsReported()
+{
+    QFETCH(int, mode);
+
+    QTemporaryDir directory;
+    QString path = createFile(directory.filePath("component.xml"), "<component/>");
+
+    LibraryFileWatcher watcher;
+    watcher.setWatchMode(static_cast<LibraryFileWatcher::WatchMode>(mode));
+    watcher.addPath(path);
+
+    QSignalSpy spy(&watcher, SIGNAL(fileChanged(QString const&)));
+
+    createFile(path, "<component></component>");
+
+    QTRY_VERIFY(spy.count() >= 1);
+    QCOMPARE(spy.first().first().toString(), path);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryFileWatcher::testReplacedFileIsReported_data()
+//-----------------------------------------------------------------------------
+void tst_LibraryFileWatcher::testReplacedFileIsReported_data()
+{
+    QTest::addColumn<int>("mode");
+
+    QTest::newRow("Files watched separately") << int(LibraryFileWatcher::FILES);
+    QTest::newRow("Directories watched") << int(LibraryFileWatcher::DIRECTORIES);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryFileWatcher::testFileWrittenInPlaceIsReported()
+//-----------------------------------------------------------------------------
+void tst_LibraryFileWatcher::testFileWrittenInPlaceIsReported()
+{
+    QFETCH(int, mode);
+
+    QTemporaryDir directory;
+    QString path = createFile(directory.filePath("component.xml"), "<component/>");
+
+    LibraryFileWatcher watcher;
+    watcher.setWatchMode(static_cast<LibraryFileWatcher::WatchMode>(mode));
+    watcher.setPollingInterval(100);
+    watcher.addPath(path);
+
+    QSignalSpy spy(&watcher, SIGNAL(fileChanged(QString const&)));
+
+    writeInPlace(path, "<component></component>");
+
+    QTRY_VERIFY(spy.count() >= 1);
+    QCOMPARE(spy.first().first().toString(), path);
+
+    // The file stays watched after the change.
+    spy.clear();
+    writeInPlace(path, "<component>\n</component>");
+
+    QTRY_VERIFY(spy.count() >= 1);
+    QCOMPARE(spy.first().first().toString(), path);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryFileWatcher::testFileWrittenInPlaceIsReported_data()
+//-----------------------------------------------------------------------------
+void tst_LibraryFileWatcher::testFileWrittenInPlaceIsReported_data()
+{
+    QTest::addColumn<int>("mode");
+
+    // A directory watch does not report the files written in place on every platform.
+    QTest::newRow("Files watched separately") << int(LibraryFileWatcher::FILES);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryFileWatcher::testRemovedFileIsReported()
+//-----------------------------------------------------------------------------
+void tst_LibraryFileWatcher::testRemovedFileIsReported()
+{
+    QTemporaryDir directory;
+    QString path = createFile(directory.filePath("design.xml"), "<design/>");
+
+    LibraryFileWatcher watcher;
+    watcher.addPath(path);
+
+    QSignalSpy spy(&watcher, SIGNAL(fileChanged(QString const&)));
+
+    QVERIFY(QFile::remove(path));
+
+    QTRY_COMPARE(spy.count(), 1);
+    QCOMPARE(spy.first().first().toString(), path);
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryFileWatcher::testOtherFilesInDirectoryAreNotReported()
+//-----------------------------------------------------------------------------
+void tst_LibraryFileWatcher::testOtherFilesInDirectoryAreNotReported()
+{
+    QTemporaryDir directory;
+    QString changedPath = createFile(directory.filePath("changed.xml"), "<component/>");
+    QString unchangedPath = createFile(directory.filePath("unchanged.xml"), "<component/>");
+
+    LibraryFileWatcher watcher;
+    watcher.addPaths(QStringList({ changedPath, unchangedPath }));
+
+    QSignalSpy spy(&watcher, SIGNAL(fileChanged(QString const&)));
+
+    createFile(changedPath, "<component></component>");
+    createFile(directory.filePath("notWatched.xml"), "<component/>");
+
+    QTRY_VERIFY(spy.count() >= 1);
+    for (QList<QVariant> const& arguments : spy)
+    {
+        QCOMPARE(arguments.first().toString(), changedPath);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryFileWatcher::testRemovedPathIsNotReported()
+//-----------------------------------------------------------------------------
+void tst_LibraryFileWatcher::testRemovedPathIsNotReported()
+{
+    QTemporaryDir directory;
+    QString removedPath = createFile(directory.filePath("removed.xml"), "<component/>");
+    QString watchedPath = createFile(directory.filePath("watched.xml"), "<component/>");
+
+    LibraryFileWatcher watcher;
+    watcher.addPaths(QStringList({ removedPath, watchedPath }));
+    watcher.removePath(removedPath);
+
+    QSignalSpy spy(&watcher, SIGNAL(fileChanged(QString const&)));
+
+    createFile(removedPath, "<component></component>");
+    createFile(watchedPath, "<component></component>");
+
+    QTRY_VERIFY(spy.count() >= 1);
+    for (QList<QVariant> const& arguments : spy)
+    {
+        QCOMPARE(arguments.first().toString(), watchedPath);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: tst_LibraryFileWatcher::testFilesAreListed()
+//-----------------------------------------------------------------------------
+void tst_LibraryFileWatcher::testFilesAreListed()
+{
+    QTemporaryDir directory;
+    QVERIFY(QDir(directory.path()).mkdir("sub"));
+
+    QString first = createFile(directory.filePath("first.xml"), "<component/>");
+    QString second = createFile(directory.filePath("sub/second.xml"), "<component/>");
+
+    LibraryFileWatcher watcher;
+    watcher.addPaths(QStringList({ first, second }));
+
+    QStringList files = watcher.files();
+    files.sort();
+    QCOMPARE(files, QStringList({ first, second }));
+
+    watcher.setWatchMode(LibraryFileWatcher::FILES);
+    QCOMPARE(watcher.files().count(), 2);
+
+    watcher.clear();
+    QVERIFY(watcher.files().isEmpty());
+}
+
+QTEST_GUILESS_MAIN(tst_LibraryFileWatcher)
+
+#include "tst_LibraryFileWatcher.moc"
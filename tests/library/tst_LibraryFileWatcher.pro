@@ -0,0 +1,50 @@
+#-----------------------------------------------------------------------------
+# File: unittest.pro
+#-----------------------------------------------------------------------------
+# Project: Kactus 2
+# Author: Esko Pekkarinen
+# Date: 24.7.2014
+#
+# Description:
+# Qt project file template for running unit tests for a single module.
+#-----------------------------------------------------------------------------
+
+TEMPLATE = app
+
+TARGET = tst_LibraryFileWatcher
+
+QT += core testlib
+CONFIG += testcase console c++14
+
+win32:CONFIG(release, debug|release) {
+    LIBS += -L$$PWD/../../x64/executable/ -lIPXACTmodels
+    DESTDIR = ./release
+}
+else:win32:CONFIG(debug, debug|release) {
+    LIBS += -L$$PWD/../../x64/executable/ -lIPXACTmodelsd
+    DESTDIR = ./debug
+}
+else:unix {
+    LIBS += -L$$PWD/../../executable/ -lIPXACTmodels 
+    DESTDIR = ./release
+}
+
+INCLUDEPATH += $$PWD/../../
+INCLUDEPATH += $$PWD/../../executable
+INCLUDEPATH += $$DESTDIR
+
+DEPENDPATH += $$PWD/../../
+DEPENDPATH += $$PWD/../../executable
+DEPENDPATH += .
+
+INCLUDEPATH += $$DESTDIR
+
+DEPENDPATH += .
+
+OBJECTS_DIR += $$DESTDIR
+
+MOC_DIR += ./generatedFiles
+UI_DIR += ./generatedFiles
+RCC_DIR += ./generatedFiles
+
+include(tst_LibraryFileWatcher.pri)
@@ -14,6 +14,7 @@
 
 #include <Plugins/PluginSystem/GeneratorPlugin/MessagePasser.h>
 #include <library/LibraryHandler.h>
+#include <library/HierarchyView/hierarchymodel.h>
 
 void noMessageOutput(QtMsgType type, const QMessageLogContext &context, const QString &msg) {}
 
@@ -44,6 +45,23 @@ private slots:
 
     void testDocumentsInLocationAreRead();
 
+    void testIndexedDocumentsAreReadOnDemand();
+
+    void testCommandLineLoadLatency();
+    void testCommandLineLoadLatency_data();
+
+    void testSaveLatency();
+
+    void testBatchSaveLatency();
+    void testBatchSaveLatency_data();
+
+    void testFailedBatchSaveKeepsPreviousDocument();
+
+    void testExternalEditWithUnchangedTimestampIsRead();
+
+    void testHierarchyModelReset();
+
+    void testHierarchyModelRemovesRowsOfRemovedDocument();
 
 };
 
@@ -142,6 +160,286 @@ void tst_LibraryHandler::testDocumentsInLocationAreRead()
     QVERIFY(library->getAllVLNVs().count() == 1338);
 }
 
+void tst_LibraryHandler::testIndexedDocumentsAreReadOnDemand()
+{
+    QScopedPointer<LibraryHandler> library(createLibraryHandler());
+
+    setupTestLibrary();
+    library->indexIPXactFiles();
+
+    QVERIFY(library->getAllVLNVs().count() == 1338);
+
+    VLNV validItem(VLNV::COMPONENT, QStringLiteral("tut.fi:cpu.logic:alu:1.0"));
+    QVERIFY(library->contains(validItem));
+    QVERIFY(library->getModelReadOnly(validItem).isNull() == false);
+    QVERIFY(library->isValid(validItem));
+
+    QList<VLNV> owners;
+    library->getOwners(owners, validItem);
+    QVERIFY(owners.isEmpty() == false);
+}
+
+void tst_LibraryHandler::testHierarchyModelReset()
+{
+    QScopedPointer<LibraryHandler> library(createLibraryHandler());
+
+    setupTestLibrary();
+    library->searchForIPXactFiles();
+
+    HierarchyModel* model = library->getHierarchyModel();
+
+    QBENCHMARK
+    {
+        model->onResetModel();
+    }
+
+    QVERIFY(model->rowCount() > 0);
+
+    // Instantiated components are found through the hierarchies of their owners.
+    VLNV instantiatedItem(VLNV::COMPONENT, QStringLiteral("tut.fi:cpu.logic:alu:1.0"));
+
+    QList<VLNV> owners;
+    model->getOwners(owners, instantiatedItem);
+    QVERIFY(owners.isEmpty() == false);
+    QVERIFY(model->referenceCount(instantiatedItem) >= owners.count());
+    QVERIFY(model->findIndexes(instantiatedItem).count() > owners.count());
+}
+
+void tst_LibraryHandler::testHierarchyModelRemovesRowsOfRemovedDocument()
+{
+    QScopedPointer<LibraryHandler> library(createLibraryHandler());
+
+    setupTestLibrary();
+    library->searchForIPXactFiles();
+
+    HierarchyModel* model = library->getHierarchyModel();
+    model->onResetModel();
+
+    VLNV instantiatedItem(VLNV::COMPONENT, QStringLiteral("tut.fi:cpu.logic:alu:1.0"));
+
+    QList<VLNV> owners;
+    model->getOwners(owners, instantiatedItem);
+    QVERIFY(owners.isEmpty() == false);
+
+    int itemCount = model->findIndexes(instantiatedItem).count();
+
+    QSignalSpy resetSpy(model, SIGNAL(modelReset()));
+    QSignalSpy removeSpy(model, SIGNAL(rowsRemoved(QModelIndex const&, int, int)));
+
+    model->onRemoveVLNV(owners.first());
+
+    QCOMPARE(resetSpy.count(), 0);
+    QVERIFY(removeSpy.count() > 0);
+    QVERIFY(model->findIndexes(owners.first()).isEmpty());
+    QVERIFY(model->findIndexes(instantiatedItem).count() < itemCount);
+
+    QList<VLNV> remainingOwners;
+    model->getOwners(remainingOwners, instantiatedItem);
+    QVERIFY(remainingOwners.contains(owners.first()) == false);
+}
+
+void tst_LibraryHandler::testCommandLineLoadLatency()
+{
+    QFETCH(bool, indexOnly);
+
+    setupTestLibrary();
+
+    // A command-line generation reads the top component and the documents it depends on.
+    VLNV topItem(VLNV::COMPONENT, QStringLiteral("tut.fi:cpu.logic:alu:1.0"));
+    QList<VLNV> neededItems;
+
+    QBENCHMARK
+    {
+        QScopedPointer<LibraryHandler> library(createLibraryHandler());
+        if (indexOnly)
+        {
+            library->indexIPXactFiles();
+        }
+        else
+        {
+            library->searchForIPXactFiles();
+        }
+
+        neededItems.clear();
+        library->getNeededVLNVs(topItem, neededItems);
+    }
+
+    QVERIFY(neededItems.contains(topItem));
+}
+
+void tst_LibraryHandler::testCommandLineLoadLatency_data()
+{
+    QTest::addColumn<bool>("indexOnly");
+
+    QTest::newRow("Full library search") << false;
+    QTest::newRow("Library index, documents on demand") << true;
+}
+
+void tst_LibraryHandler::testSaveLatency()
+{
+    QScopedPointer<LibraryHandler> library(createLibraryHandler());
+
+    setupTestLibrary();
+    library->searchForIPXactFiles();
+
+    QTemporaryDir saveDirectory;
+    QVERIFY(saveDirectory.isValid());
+
+    // Save a copy of a library component, so the test library itself is not modified.
+    QSharedPointer<Document> component =
+        library->getModel(VLNV(VLNV::COMPONENT, QStringLiteral("tut.fi:cpu.logic:alu:1.0")));
+    QVERIFY(component.isNull() == false);
+
+    VLNV savedItem(VLNV::COMPONENT, QStringLiteral("tut.fi:cpu.logic:alu_saved:1.0"));
+    component->setVlnv(savedItem);
+
+    QVERIFY(library->writeModelToFile(saveDirectory.path(), component));
+    QCOMPARE(library->getHierarchyModel()->findIndexes(savedItem).count(), 1);
+
+    QBENCHMARK
+    {
+        library->writeModelToFile(component);
+    }
+
+    QVERIFY(library->contains(savedItem));
+    QVERIFY(library->isValid(savedItem));
+    QCOMPARE(library->getAllVLNVs().count(), 1339);
+}
+
+void tst_LibraryHandler::testBatchSaveLatency()
+{
+    QFETCH(bool, batched);
+
+    QScopedPointer<LibraryHandler> library(createLibraryHandler());
+
+    setupTestLibrary();
+    library->searchForIPXactFiles();
+
+    QTemporaryDir saveDirectory;
+    QVERIFY(saveDirectory.isValid());
+
+    // Save copies of a library component like a hierarchical save does.
+    QSharedPointer<Document> component =
+        library->getModel(VLNV(VLNV::COMPONENT, QStringLiteral("tut.fi:cpu.logic:alu:1.0")));
+    QVERIFY(component.isNull() == false);
+
+    const int documentCount = 200;
+    QVector<QSharedPointer<Document> > copies;
+    for (int i = 0; i < documentCount; ++i)
+    {
+        QSharedPointer<Document> copy = component->clone();
+        copy->setVlnv(VLNV(VLNV::COMPONENT, QStringLiteral("tut.fi:cpu.logic:alu_copy%1:1.0").arg(i)));
+        QVERIFY(library->writeModelToFile(saveDirectory.path(), copy));
+        copies.append(copy);
+    }
+
+    QBENCHMARK
+    {
+        if (batched)
+        {
+            library->beginSave();
+        }
+
+        for (QSharedPointer<Document> const& copy : copies)
+        {
+            library->writeModelToFile(copy);
+        }
+
+        if (batched)
+        {
+            library->endSave();
+        }
+    }
+
+    QCOMPARE(QDir(saveDirectory.path()).entryList(QStringList("*.xml"), QDir::Files).count(), documentCount);
+    for (QSharedPointer<Document> const& copy : copies)
+    {
+        QVERIFY(library->isValid(copy->getVlnv()));
+        QCOMPARE(library->getHierarchyModel()->findIndexes(copy->getVlnv()).count(), 1);
+    }
+}
+
+void tst_LibraryHandler::testBatchSaveLatency_data()
+{
+    QTest::addColumn<bool>("batched");
+
+    QTest::newRow("Documents written one at a time") << false;
+    QTest::newRow("Documents written in a batch") << true;
+}
+
+void tst_LibraryHandler::testFailedBatchSaveKeepsPreviousDocument()
+{
+    QScopedPointer<LibraryHandler> library(createLibraryHandler());
+
+    setupTestLibrary();
+    library->searchForIPXactFiles();
+
+    QTemporaryDir saveDirectory;
+    QVERIFY(saveDirectory.isValid());
+
+    QSharedPointer<Document> component =
+        library->getModel(VLNV(VLNV::COMPONENT, QStringLiteral("tut.fi:cpu.logic:alu:1.0")));
+    QVERIFY(component.isNull() == false);
+
+    QSharedPointer<Document> copy = component->clone();
+    copy->setVlnv(VLNV(VLNV::COMPONENT, QStringLiteral("tut.fi:cpu.logic:alu_failed:1.0")));
+    copy->setDescription(QStringLiteral("Saved"));
+    QVERIFY(library->writeModelToFile(saveDirectory.path(), copy));
+
+    // A directory in place of the file makes the next write fail.
+    QString filePath = library->getPath(copy->getVlnv());
+    QVERIFY(QFile::remove(filePath));
+    QVERIFY(QDir().mkdir(filePath));
+
+    copy->setDescription(QStringLiteral("Not saved"));
+
+    library->beginSave();
+    QVERIFY(library->writeModelToFile(copy));
+    QVERIFY(library->endSave() == false);
+
+    QCOMPARE(library->getModelReadOnly(copy->getVlnv())->getDescription(), QStringLiteral("Saved"));
+    QCOMPARE(library->getPath(copy->getVlnv()), filePath);
+}
+
+void tst_LibraryHandler::testExternalEditWithUnchangedTimestampIsRead()
+{
+    QScopedPointer<LibraryHandler> library(createLibraryHandler());
+
+    setupTestLibrary();
+    library->searchForIPXactFiles();
+
+    QTemporaryDir saveDirectory;
+    QVERIFY(saveDirectory.isValid());
+
+    QSharedPointer<Document> component =
+        library->getModel(VLNV(VLNV::COMPONENT, QStringLiteral("tut.fi:cpu.logic:alu:1.0")));
+    QVERIFY(component.isNull() == false);
+
+    QSharedPointer<Document> copy = component->clone();
+    copy->setVlnv(VLNV(VLNV::COMPONENT, QStringLiteral("tut.fi:cpu.logic:alu_edited:1.0")));
+    copy->setDescription(QStringLiteral("Saved"));
+    QVERIFY(library->writeModelToFile(saveDirectory.path(), copy));
+
+    // Edit the file in place and keep the modification time, like on a file system with coarse timestamps.
+    QString filePath = library->getPath(copy->getVlnv());
+    QFile file(filePath);
+    QDateTime writtenTime = QFileInfo(filePath).lastModified();
+
+    QVERIFY(file.open(QIODevice::ReadWrite));
+    QByteArray content = file.readAll();
+    content.replace("<ipxact:description>Saved</ipxact:description>",
+        "<ipxact:description>Edited</ipxact:description>");
+    QVERIFY(file.resize(0));
+    QVERIFY(file.write(content) == content.size());
+    QVERIFY(file.setFileTime(writtenTime, QFileDevice::FileModificationTime));
+    file.close();
+
+    QMetaObject::invokeMethod(library.data(), "onFileChangedOnDisk", Q_ARG(QString, filePath));
+    QMetaObject::invokeMethod(library.data(), "processFileChanges");
+
+    QCOMPARE(library->getModelReadOnly(copy->getVlnv())->getDescription(), QStringLiteral("Edited"));
+}
+
 
 QTEST_APPLESS_MAIN(tst_LibraryHandler)
 
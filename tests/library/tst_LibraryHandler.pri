@@ -7,10 +7,13 @@
 message("You are running qmake on a generated .pro file. This may not work!")
 
 
-HEADERS += ../../editors/ComponentEditor/common/ComponentParameterFinder.h \
+HEADERS += ../../common/Profiler.h \
+    ../../editors/ComponentEditor/common/ComponentParameterFinder.h \
     ../../common/ui/ConsoleMediator.h \
     ../../library/DocumentFileAccess.h \
+    ../../library/DocumentSaveExecutor.h \
     ../../library/DocumentValidator.h \
+    ../../library/LibraryFileWatcher.h \
     ../../editors/ComponentEditor/common/ExpressionParser.h \
     ../../editors/ComponentEditor/common/IPXactSystemVerilogParser.h \
     ../../library/LibraryInterface.h \
@@ -30,6 +33,7 @@ HEADERS += ../../editors/ComponentEditor/common/ComponentParameterFinder.h \
     ../../library/LibraryHandler.h \
     ../../library/LibraryItem.h \
     ../../library/LibraryLoader.h \
+    ../../library/LibraryMetadataCache.h \
     ../../common/widgets/LibrarySelectorWidget/LibrarySelectorWidget.h \
     ../../common/dialogs/LibrarySettingsDialog/LibrarySettingsDialog.h \
     ../../library/LibraryTreeModel.h \
@@ -38,6 +42,7 @@ HEADERS += ../../editors/ComponentEditor/common/ComponentParameterFinder.h \
     ../../common/dialogs/ObjectExportDialog/ObjectSelectionDialog.h \
     ../../editors/ComponentEditor/common/ParameterCache.h \
     ../../library/HierarchyView/hierarchyitem.h \
+    ../../library/HierarchyView/HierarchyGraph.h \
     ../../library/HierarchyView/hierarchymodel.h \
     ../../common/widgets/LibrarySelectorWidget/LibraryPathEditor/librarypatheditor.h \
     ../../common/widgets/LibrarySelectorWidget/LibraryPathSelector/librarypathselector.h \
@@ -46,11 +51,14 @@ HEADERS += ../../editors/ComponentEditor/common/ComponentParameterFinder.h \
     ../../common/dialogs/newObjectDialog/newobjectdialog.h \
     ../../common/dialogs/ObjectRemoveDialog/objectremovedialog.h \
     ../../common/widgets/vlnvEditor/vlnveditor.h
-SOURCES += ../../common/widgets/assistedLineEdit/AssistedLineEdit.cpp \
+SOURCES += ../../common/Profiler.cpp \
+    ../../common/widgets/assistedLineEdit/AssistedLineEdit.cpp \
     ../../editors/ComponentEditor/common/ComponentParameterFinder.cpp \
     ../../common/ui/ConsoleMediator.cpp \
     ../../library/DocumentFileAccess.cpp \
+    ../../library/DocumentSaveExecutor.cpp \
     ../../library/DocumentValidator.cpp \
+    ../../library/LibraryFileWatcher.cpp \
     ../../editors/ComponentEditor/common/IPXactSystemVerilogParser.cpp \
     ../../common/widgets/kactusAttributeEditor/KactusAttributeEditor.cpp \
     ../../library/LibraryErrorModel.cpp \
@@ -58,6 +66,7 @@ SOURCES += ../../common/widgets/assistedLineEdit/AssistedLineEdit.cpp \
     ../../library/LibraryItem.cpp \
     ../../library/LibraryItemSelectionFactory.cpp \
     ../../library/LibraryLoader.cpp \
+    ../../library/LibraryMetadataCache.cpp \
     ../../common/widgets/LibrarySelectorWidget/LibrarySelectorWidget.cpp \
     ../../common/dialogs/LibrarySettingsDialog/LibrarySettingsDialog.cpp \
     ../../library/LibraryTreeModel.cpp \
@@ -73,6 +82,7 @@ SOURCES += ../../common/widgets/assistedLineEdit/AssistedLineEdit.cpp \
     ../../common/widgets/vlnvEditor/VLNVContentMatcher.cpp \
     ../../common/widgets/vlnvEditor/VLNVDataTree.cpp \
     ../../library/HierarchyView/hierarchyitem.cpp \
+    ../../library/HierarchyView/HierarchyGraph.cpp \
     ../../library/HierarchyView/hierarchymodel.cpp \
     ../../common/widgets/LibrarySelectorWidget/LibraryPathEditor/librarypatheditor.cpp \
     ../../common/widgets/LibrarySelectorWidget/LibraryPathSelector/librarypathselector.cpp \
@@ -0,0 +1,584 @@
+//-----------------------------------------------------------------------------
+// File: ImportCommand.cpp
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: Kactus2 team
+// Date: 19.10.2026
+//
+// Description:
+// Command for importing HDL source files into components without the user interface.
+//-----------------------------------------------------------------------------
+
+#include "ImportCommand.h"
+
+#include <Plugins/PluginSystem/IPlugin.h>
+#include <Plugins/PluginSystem/IPluginUtility.h>
+#include <Plugins/PluginSystem/PluginManager.h>
+#include <Plugins/PluginSystem/ImportPlugin/ImportPlugin.h>
+#include <Plugins/PluginSystem/ImportPlugin/IncludeImportPlugin.h>
+#include <Plugins/PluginSystem/ImportPlugin/ParallelImportSupport.h>
+
+#include <editors/ComponentEditor/common/ComponentParameterFinder.h>
+#include <editors/ComponentEditor/common/ExpressionParser.h>
+#include <editors/ComponentEditor/common/IPXactSystemVerilogParser.h>
+#include <Plugins/PluginSystem/ImportPlugin/ExpressionSupport.h>
+
+#include <editors/common/FileHandler/FileHandler.h>
+
+#include <library/LibraryInterface.h>
+
+#include <wizards/common/ComponentComparator/ComponentComparator.h>
+
+#include <IPXACTmodels/Component/Component.h>
+
+#include <common/Profiler.h>
+
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFileInfo>
+#include <QRegularExpression>
+#include <QRunnable>
+#include <QSettings>
+#include <QTextStream>
+#include <QThread>
+#include <QThreadPool>
+
+namespace
+{
+    //! Separates the fields of a manifest entry.
+    const QRegularExpression MANIFEST_SEPARATOR(QStringLiteral("\\s+"));
+
+    //-----------------------------------------------------------------------------
+    //! Runs a part of an import in a background thread.
+    //-----------------------------------------------------------------------------
+    class ImportTask : public QRunnable
+    {
+    public:
+
+        explicit ImportTask(std::function<void()> const& task): QRunnable(), task_(task) {}
+
+        void run() override
+        {
+            task_();
+        }
+
+    private:
+
+        //! The task to run.
+        std::function<void()> task_;
+    };
+}
+
+//-----------------------------------------------------------------------------
+// Function: ImportCommand::ImportCommand()
+//-----------------------------------------------------------------------------
+ImportCommand::ImportCommand():
+optionParser_(),
+    importPlugins_(),
+    fileSuffixTable_()
+{
+    optionParser_.addHelpOption();
+    optionParser_.addPositionalArgument(QStringLiteral("files"), QStringLiteral("The source files to import."),
+        QStringLiteral("[files...]"));
+
+    optionParser_.addOption(QCommandLineOption(QStringList() << QStringLiteral("m") << QStringLiteral("manifest"),
+        QStringLiteral("A file listing the source files to import. Each line contains a source file, optionally "
+            "followed by the component VLNV separated by colons (:) and the name of the module to import."),
+        QStringLiteral("file")));
+
+    optionParser_.addOption(QCommandLineOption(QStringLiteral("vendor"),
+        QStringLiteral("The vendor of the components without a VLNV in the manifest."), QStringLiteral("vendor")));
+
+    optionParser_.addOption(QCommandLineOption(QStringLiteral("library"),
+        QStringLiteral("The library of the components without a VLNV in the manifest."), QStringLiteral("library")));
+
+    optionParser_.addOption(QCommandLineOption(QStringLiteral("component-version"),
+        QStringLiteral("The version of the components without a VLNV in the manifest."), QStringLiteral("version"),
+        QStringLiteral("1.0")));
+
+    optionParser_.addOption(QCommandLineOption(QStringList() << QStringLiteral("o") << QStringLiteral("output"),
+        QStringLiteral("The root directory for the created components. The default library location is used, "
+            "if not given."), QStringLiteral("path")));
+
+    optionParser_.addOption(QCommandLineOption(QStringList() << QStringLiteral("j") << QStringLiteral("threads"),
+        QStringLiteral("The number of files imported at the same time."), QStringLiteral("count")));
+
+    optionParser_.addOption(QCommandLineOption(QStringList() << QStringLiteral("n") << QStringLiteral("dry-run"),
+        QStringLiteral("Report the changes without writing the components.")));
+}
+
+//-----------------------------------------------------------------------------
+// Function: ImportCommand::~ImportCommand()
+//-----------------------------------------------------------------------------
+ImportCommand::~ImportCommand()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Function: ImportCommand::getCommand()
+//-----------------------------------------------------------------------------
+QString ImportCommand::getCommand() const
+{
+    return QStringLiteral("import");
+}
+
+//-----------------------------------------------------------------------------
+// Function: ImportCommand::process()
+//-----------------------------------------------------------------------------
+void ImportCommand::process(QStringList const& arguments, IPluginUtility* utility)
+{
+    if (!optionParser_.parse(arguments))
+    {
+        utility->printError(optionParser_.errorText());
+        return;
+    }
+
+    if (optionParser_.isSet(QStringLiteral("help")))
+    {
+        QString help = optionParser_.helpText();
+        help.replace(0, help.indexOf(QLatin1Char('[')), QStringLiteral("Usage: Kactus2 %1 ").arg(getCommand()));
+
+        utility->printInfo(help);
+        return;
+    }
+
+    QElapsedTimer runTimer;
+    runTimer.start();
+
+    fileSuffixTable_ = FileHandler::constructFileSuffixTable();
+
+    importPlugins_.clear();
+    foreach (IPlugin* plugin, PluginManager::getInstance().getActivePlugins())
+    {
+        ImportPlugin* importPlugin = dynamic_cast<ImportPlugin*>(plugin);
+        if (importPlugin && dynamic_cast<IncludeImportPlugin*>(importPlugin) == 0)
+        {
+            importPlugins_.append(importPlugin);
+        }
+    }
+
+    QVector<ImportJob> jobs = createJobs(utility);
+    if (jobs.isEmpty())
+    {
+        utility->printError(QStringLiteral("No source files to import."));
+        return;
+    }
+
+    bool validThreadCount = false;
+    int threadCount = optionParser_.value(QStringLiteral("threads")).toInt(&validThreadCount);
+    if (!validThreadCount || threadCount < 1)
+    {
+        threadCount = QThread::idealThreadCount();
+    }
+
+    {
+        ProfilingScope profilingScope("ImportCommand::readDeclarations");
+        runJobs(jobs, threadCount, readDeclaration);
+    }
+
+    // The library is accessed only from this thread.
+    LibraryInterface* library = utility->getLibraryInterface();
+    QSet<QString> targetVLNVs;
+    for (ImportJob& job : jobs)
+    {
+        findTargetComponent(job, library, targetVLNVs);
+    }
+
+    {
+        ProfilingScope profilingScope("ImportCommand::importDeclarations");
+        runJobs(jobs, threadCount, importDeclaration);
+    }
+
+    if (optionParser_.isSet(QStringLiteral("dry-run")))
+    {
+        utility->printInfo(QStringLiteral("Dry run, no components are written."));
+    }
+    else
+    {
+        ProfilingScope profilingScope("ImportCommand::writeComponents");
+
+        QString newComponentPath = optionParser_.value(QStringLiteral("output"));
+        if (newComponentPath.isEmpty())
+        {
+            newComponentPath = QSettings().value(QStringLiteral("Library/DefaultLocation")).toString();
+        }
+
+        writeComponents(jobs, library, newComponentPath);
+    }
+
+    printReport(jobs, runTimer.elapsed(), utility);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ImportCommand::createJobs()
+//-----------------------------------------------------------------------------
+QVector<ImportCommand::ImportJob> ImportCommand::createJobs(IPluginUtility* utility)
+{
+    VLNV defaultVLNV(VLNV::COMPONENT, optionParser_.value(QStringLiteral("vendor")),
+        optionParser_.value(QStringLiteral("library")), QString(),
+        optionParser_.value(QStringLiteral("component-version")));
+
+    QVector<ImportJob> jobs;
+    for (QString const& filePath : optionParser_.positionalArguments())
+    {
+        ImportJob job;
+        job.filePath = QFileInfo(filePath).absoluteFilePath();
+        job.vlnv = defaultVLNV;
+        jobs.append(job);
+    }
+
+    QString manifestPath = optionParser_.value(QStringLiteral("manifest"));
+    if (!manifestPath.isEmpty() && !readManifest(manifestPath, defaultVLNV, jobs))
+    {
+        utility->printError(QStringLiteral("Could not read the manifest %1.").arg(manifestPath));
+    }
+
+    for (ImportJob& job : jobs)
+    {
+        findImporter(job);
+    }
+
+    return jobs;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ImportCommand::readManifest()
+//-----------------------------------------------------------------------------
+bool ImportCommand::readManifest(QString const& manifestPath, VLNV const& defaultVLNV,
+    QVector<ImportJob>& jobs) const
+{
+    QFile manifest(manifestPath);
+    if (!manifest.open(QIODevice::ReadOnly | QIODevice::Text))
+    {
+        return false;
+    }
+
+    // The source files are relative to the manifest.
+    QDir manifestDirectory = QFileInfo(manifestPath).absoluteDir();
+
+    QTextStream stream(&manifest);
+    while (!stream.atEnd())
+    {
+        QString line = stream.readLine().trimmed();
+        if (line.isEmpty() || line.startsWith(QLatin1Char('#')))
+        {
+            continue;
+        }
+
+        QStringList fields = line.split(MANIFEST_SEPARATOR, QString::SkipEmptyParts);
+
+        ImportJob job;
+        job.filePath = QDir::cleanPath(manifestDirectory.absoluteFilePath(fields.first()));
+        job.vlnv = fields.size() > 1 ? VLNV(VLNV::COMPONENT, fields.at(1)) : defaultVLNV;
+        job.moduleName = fields.value(2);
+        jobs.append(job);
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ImportCommand::findImporter()
+//-----------------------------------------------------------------------------
+void ImportCommand::findImporter(ImportJob& job) const
+{
+    QString fileType = FileHandler::getFileTypeForSuffix(fileSuffixTable_, QFileInfo(job.filePath).suffix());
+
+    for (ImportPlugin* plugin : importPlugins_)
+    {
+        if (plugin->getSupportedFileTypes().contains(fileType))
+        {
+            ParallelImportSupport* parallelSupport = dynamic_cast<ParallelImportSupport*>(plugin);
+            if (parallelSupport)
+            {
+                job.importer = QSharedPointer<ImportPlugin>(parallelSupport->createImporter());
+                job.concurrent = true;
+            }
+            else
+            {
+                // The plugin is owned by the plugin manager.
+                job.importer = QSharedPointer<ImportPlugin>(plugin, [](ImportPlugin*) {});
+            }
+
+            return;
+        }
+    }
+
+    job.result = FAILED;
+    job.message = QStringLiteral("No importer for file type '%1'.").arg(fileType);
+}
+
+//-----------------------------------------------------------------------------
+// Function: ImportCommand::runJobs()
+//-----------------------------------------------------------------------------
+void ImportCommand::runJobs(QVector<ImportJob>& jobs, int threadCount,
+    std::function<void(ImportJob&)> const& task)
+{
+    QThreadPool threadPool;
+    threadPool.setMaxThreadCount(threadCount);
+
+    for (ImportJob& job : jobs)
+    {
+        if (job.concurrent && job.result != FAILED)
+        {
+            threadPool.start(new ImportTask([&job, &task]() { task(job); }));
+        }
+    }
+
+    // A shared importer can run only one import at a time.
+    for (ImportJob& job : jobs)
+    {
+        if (!job.concurrent && job.result != FAILED)
+        {
+            task(job);
+        }
+    }
+
+    threadPool.waitForDone();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ImportCommand::readDeclaration()
+//-----------------------------------------------------------------------------
+void ImportCommand::readDeclaration(ImportJob& job)
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    QFile sourceFile(job.filePath);
+    if (!sourceFile.open(QIODevice::ReadOnly))
+    {
+        job.result = FAILED;
+        job.message = QStringLiteral("Could not read the file.");
+        return;
+    }
+
+    QTextStream stream(&sourceFile);
+    job.fileContent = stream.readAll();
+    job.fileContent.replace(QLatin1String("\r\n"), QLatin1String("\n"));
+
+    // Without a given module, the module named after the component is preferred over the first one in the file.
+    QString wantedName = job.moduleName.isEmpty() ? job.vlnv.getName() : job.moduleName;
+    QString declarationName;
+
+    for (QString const& declaration : job.importer->getFileComponents(job.fileContent))
+    {
+        QString name = job.importer->getComponentName(declaration);
+        if (name == wantedName || (declarationName.isEmpty() && job.moduleName.isEmpty()))
+        {
+            job.declaration = declaration;
+            declarationName = name;
+
+            if (name == wantedName)
+            {
+                break;
+            }
+        }
+    }
+
+    if (job.declaration.isEmpty())
+    {
+        job.result = FAILED;
+        job.message = QStringLiteral("No module or entity %1 found.").arg(wantedName);
+    }
+    else if (job.vlnv.getName().isEmpty())
+    {
+        job.vlnv.setName(declarationName);
+    }
+
+    job.elapsedTime += timer.elapsed();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ImportCommand::findTargetComponent()
+//-----------------------------------------------------------------------------
+void ImportCommand::findTargetComponent(ImportJob& job, LibraryInterface* library, QSet<QString>& targetVLNVs)
+{
+    if (job.result == FAILED)
+    {
+        return;
+    }
+
+    if (!job.vlnv.isValid())
+    {
+        job.result = FAILED;
+        job.message = QStringLiteral("No valid VLNV for the component. Give it in the manifest or with the "
+            "vendor and library options.");
+        return;
+    }
+
+    QString vlnvText = job.vlnv.toString();
+    if (targetVLNVs.contains(vlnvText))
+    {
+        job.result = FAILED;
+        job.message = QStringLiteral("Component %1 is already imported from another file.").arg(vlnvText);
+        return;
+    }
+
+    targetVLNVs.insert(vlnvText);
+
+    if (library->contains(job.vlnv))
+    {
+        job.existingComponent = library->getModelReadOnly(job.vlnv).dynamicCast<Component const>();
+        if (job.existingComponent.isNull())
+        {
+            job.result = FAILED;
+            job.message = QStringLiteral("%1 is not a component.").arg(vlnvText);
+            return;
+        }
+
+        job.importComponent = QSharedPointer<Component>(new Component(*job.existingComponent));
+    }
+    else
+    {
+        job.importComponent = QSharedPointer<Component>(new Component(job.vlnv));
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ImportCommand::importDeclaration()
+//-----------------------------------------------------------------------------
+void ImportCommand::importDeclaration(ImportJob& job)
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    ExpressionSupport* expressionSupport = dynamic_cast<ExpressionSupport*>(job.importer.data());
+    if (expressionSupport)
+    {
+        QSharedPointer<ComponentParameterFinder> parameterFinder(
+            new ComponentParameterFinder(job.importComponent));
+        expressionSupport->setExpressionParser(
+            QSharedPointer<ExpressionParser>(new IPXactSystemVerilogParser(parameterFinder)));
+    }
+
+    job.importer->import(job.fileContent, job.declaration, job.importComponent);
+    job.fileContent.clear();
+
+    compareToLibrary(job);
+
+    job.elapsedTime += timer.elapsed();
+}
+
+//-----------------------------------------------------------------------------
+// Function: ImportCommand::compareToLibrary()
+//-----------------------------------------------------------------------------
+void ImportCommand::compareToLibrary(ImportJob& job)
+{
+    if (job.existingComponent.isNull())
+    {
+        job.result = CREATED;
+        job.message = QStringLiteral("Created %1.").arg(job.vlnv.toString());
+        return;
+    }
+
+    // The fields are diffed directly, since a comparison of the whole components skips the parameters.
+    ComponentComparator comparator;
+    int changeCount = comparator.diffFields(job.existingComponent, job.importComponent).size();
+    if (changeCount == 0)
+    {
+        job.result = UNCHANGED;
+        job.message = QStringLiteral("No changes in %1.").arg(job.vlnv.toString());
+    }
+    else
+    {
+        job.result = CHANGED;
+        job.message = QStringLiteral("%1 changes in %2.").arg(QString::number(changeCount), job.vlnv.toString());
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ImportCommand::writeComponents()
+//-----------------------------------------------------------------------------
+void ImportCommand::writeComponents(QVector<ImportJob>& jobs, LibraryInterface* library,
+    QString const& newComponentPath)
+{
+    library->beginSave();
+
+    for (ImportJob& job : jobs)
+    {
+        bool written = true;
+        if (job.result == CHANGED)
+        {
+            written = library->writeModelToFile(job.importComponent);
+        }
+        else if (job.result == CREATED)
+        {
+            written = !newComponentPath.isEmpty() && library->writeModelToFile(
+                QDir(newComponentPath).filePath(job.vlnv.toString(QStringLiteral("/"))), job.importComponent);
+        }
+
+        if (!written)
+        {
+            job.result = FAILED;
+            job.message = QStringLiteral("Could not write %1.").arg(job.vlnv.toString());
+        }
+    }
+
+    if (library->endSave())
+    {
+        return;
+    }
+
+    // The library keeps the previous state of the components that could not be written.
+    for (ImportJob& job : jobs)
+    {
+        bool written = true;
+        if (job.result == CREATED)
+        {
+            written = library->contains(job.vlnv);
+        }
+        else if (job.result == CHANGED)
+        {
+            QSharedPointer<Component const> libraryComponent =
+                library->getModelReadOnly(job.vlnv).dynamicCast<Component const>();
+
+            ComponentComparator comparator;
+            written = libraryComponent && comparator.diffFields(libraryComponent, job.importComponent).isEmpty();
+        }
+
+        if (!written)
+        {
+            job.result = FAILED;
+            job.message = QStringLiteral("Could not write %1.").arg(job.vlnv.toString());
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Function: ImportCommand::printReport()
+//-----------------------------------------------------------------------------
+void ImportCommand::printReport(QVector<ImportJob> const& jobs, qint64 totalTime, IPluginUtility* utility)
+{
+    const QStringList resultNames({ QStringLiteral("unchanged"), QStringLiteral("changed"),
+        QStringLiteral("created"), QStringLiteral("failed") });
+
+    QVector<int> resultCounts(resultNames.size(), 0);
+    qint64 importTime = 0;
+
+    for (ImportJob const& job : jobs)
+    {
+        resultCounts[job.result]++;
+        importTime += job.elapsedTime;
+
+        QString line = QStringLiteral("%1 %2 ms %3: %4").arg(resultNames.at(job.result), -9).arg(
+            job.elapsedTime, 6).arg(job.filePath, job.message);
+
+        if (job.result == FAILED)
+        {
+            utility->printError(line);
+        }
+        else
+        {
+            utility->printInfo(line);
+        }
+    }
+
+    utility->printInfo(QStringLiteral("Imported %1 files in %2 ms with %3 ms spent in the files: "
+        "%4 created, %5 changed, %6 unchanged and %7 failed.").arg(QString::number(jobs.size()),
+        QString::number(totalTime), QString::number(importTime), QString::number(resultCounts.at(CREATED)),
+        QString::number(resultCounts.at(CHANGED)), QString::number(resultCounts.at(UNCHANGED)),
+        QString::number(resultCounts.at(FAILED))));
+}
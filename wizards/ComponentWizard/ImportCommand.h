@@ -0,0 +1,220 @@
+//-----------------------------------------------------------------------------
+// File: ImportCommand.h
+//-----------------------------------------------------------------------------
+// Project: Kactus 2
+// Author: Kactus2 team
+// Date: 19.10.2026
+//
+// Description:
+// Command for importing HDL source files into components without the user interface.
+//-----------------------------------------------------------------------------
+
+#ifndef IMPORTCOMMAND_H
+#define IMPORTCOMMAND_H
+
+#include <Plugins/PluginSystem/CommandLineSupport.h>
+
+#include <IPXACTmodels/common/VLNV.h>
+
+#include <QCommandLineParser>
+#include <QList>
+#include <QMap>
+#include <QSet>
+#include <QSharedPointer>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+#include <functional>
+
+class Component;
+class ImportPlugin;
+class LibraryInterface;
+
+//-----------------------------------------------------------------------------
+//! Command for importing HDL source files into components without the user interface.
+//!
+//! The files are given as arguments or in a manifest. Each file is imported into a new or an existing component
+//! with the import plugins. The files are imported concurrently without highlighting and only the components
+//! that differ from the library are written.
+//-----------------------------------------------------------------------------
+class ImportCommand : public CommandLineSupport
+{
+public:
+
+    //! The constructor.
+    ImportCommand();
+
+    //! The destructor.
+    virtual ~ImportCommand();
+
+    // No copying. No assignments.
+    ImportCommand(ImportCommand const& rhs) = delete;
+    ImportCommand& operator=(ImportCommand const& rhs) = delete;
+
+    /*!
+     *  Gets the command required to run the import.
+     *
+     *      @return The command to run the import.
+     */
+    virtual QString getCommand() const override;
+
+    /*!
+     *  Imports the source files given in the arguments.
+     *
+     *      @param [in] arguments   The arguments for the import.
+     *      @param [in] utility     Utilities for library access and user notifications.
+     */
+    virtual void process(QStringList const& arguments, IPluginUtility* utility) override;
+
+private:
+
+    //! The outcomes of importing a source file.
+    enum ImportResult
+    {
+        UNCHANGED,  //!< The component did not change.
+        CHANGED,    //!< The existing component changed.
+        CREATED,    //!< A new component was created.
+        FAILED      //!< The file could not be imported.
+    };
+
+    //! The import of one source file.
+    struct ImportJob
+    {
+        //! The absolute path of the source file.
+        QString filePath;
+
+        //! The VLNV of the target component. The name is taken from the module, if not given.
+        VLNV vlnv;
+
+        //! The name of the module or entity to import. The first one in the file is used, if not given.
+        QString moduleName;
+
+        //! The importer to run the import with.
+        QSharedPointer<ImportPlugin> importer;
+
+        //! Flag for indicating that the importer is not shared with other imports.
+        bool concurrent = false;
+
+        //! The content of the source file.
+        QString fileContent;
+
+        //! The declaration of the imported module or entity.
+        QString declaration;
+
+        //! The component in the library before the import.
+        QSharedPointer<Component const> existingComponent;
+
+        //! The component to import into.
+        QSharedPointer<Component> importComponent;
+
+        //! The outcome of the import.
+        ImportResult result = UNCHANGED;
+
+        //! The description of the outcome.
+        QString message;
+
+        //! The time spent in reading and importing the file in milliseconds.
+        qint64 elapsedTime = 0;
+    };
+
+    /*!
+     *  Creates the import jobs for the source files given in the arguments and in the manifest.
+     *
+     *      @param [in] utility     Utilities for user notifications.
+     *
+     *      @return The import jobs.
+     */
+    QVector<ImportJob> createJobs(IPluginUtility* utility);
+
+    /*!
+     *  Reads the source file entries from a manifest.
+     *
+     *      @param [in]  manifestPath       The path of the manifest.
+     *      @param [in]  defaultVLNV        The VLNV for the entries without one.
+     *      @param [out] jobs               The jobs for the read entries.
+     *
+     *      @return True, if the manifest could be read, otherwise false.
+     */
+    bool readManifest(QString const& manifestPath, VLNV const& defaultVLNV, QVector<ImportJob>& jobs) const;
+
+    /*!
+     *  Finds the importer for the given source file.
+     *
+     *      @param [in/out] job     The job whose importer to find.
+     */
+    void findImporter(ImportJob& job) const;
+
+    /*!
+     *  Runs the given task for the jobs. The jobs with their own importer are run concurrently.
+     *
+     *      @param [in/out] jobs            The jobs to run the task for.
+     *      @param [in]     threadCount     The maximum number of concurrent tasks.
+     *      @param [in]     task            The task to run.
+     */
+    static void runJobs(QVector<ImportJob>& jobs, int threadCount, std::function<void(ImportJob&)> const& task);
+
+    /*!
+     *  Reads the source file and finds the declaration to import.
+     *
+     *      @param [in/out] job     The job whose declaration to find.
+     */
+    static void readDeclaration(ImportJob& job);
+
+    /*!
+     *  Finds the component to import into from the library.
+     *
+     *      @param [in/out] job             The job whose component to find.
+     *      @param [in]     library         The library containing the components.
+     *      @param [in/out] targetVLNVs     The VLNVs already imported into.
+     */
+    static void findTargetComponent(ImportJob& job, LibraryInterface* library, QSet<QString>& targetVLNVs);
+
+    /*!
+     *  Imports the declaration into the target component and compares the result to the library.
+     *
+     *      @param [in/out] job     The job to import.
+     */
+    static void importDeclaration(ImportJob& job);
+
+    /*!
+     *  Compares the imported component to the one in the library.
+     *
+     *      @param [in/out] job     The job whose component to compare.
+     */
+    static void compareToLibrary(ImportJob& job);
+
+    /*!
+     *  Writes the created and the changed components to the library.
+     *
+     *      @param [in/out] jobs                The completed jobs.
+     *      @param [in]     library             The library to write to.
+     *      @param [in]     newComponentPath    The root directory for the created components.
+     */
+    static void writeComponents(QVector<ImportJob>& jobs, LibraryInterface* library,
+        QString const& newComponentPath);
+
+    /*!
+     *  Prints the outcome and the time of each import and a summary of all the imports.
+     *
+     *      @param [in] jobs            The completed jobs.
+     *      @param [in] totalTime       The time of the whole run in milliseconds.
+     *      @param [in] utility         Utilities for user notifications.
+     */
+    static void printReport(QVector<ImportJob> const& jobs, qint64 totalTime, IPluginUtility* utility);
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! Parser for the command options.
+    QCommandLineParser optionParser_;
+
+    //! The available import plugins.
+    QList<ImportPlugin*> importPlugins_;
+
+    //! The file types of the known file suffixes.
+    QMap<QString, QString> fileSuffixTable_;
+};
+
+#endif // IMPORTCOMMAND_H
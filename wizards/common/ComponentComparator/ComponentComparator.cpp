@@ -19,11 +19,16 @@
 #include <IPXACTmodels/common/VLNV.h>
 #include <IPXACTmodels/Component/Port.h>
 #include <IPXACTmodels/Component/View.h>
+#include <IPXACTmodels/common/Parameter.h>
+
+#include <QSet>
+#include <QVector>
 
 //-----------------------------------------------------------------------------
 // Function: ComponentComparator::ComponentComparator()
 //-----------------------------------------------------------------------------
-ComponentComparator::ComponentComparator()
+ComponentComparator::ComponentComparator():
+contentHashes_()
 {
 
 }
@@ -42,7 +47,28 @@ ComponentComparator::~ComponentComparator()
 QList<QSharedPointer<IPXactDiff> > ComponentComparator::diff(QSharedPointer<const Component> reference, 
     QSharedPointer<const Component> subject) const
 {
-    return IPXactElementComparator::diff(reference, subject);
+    if (reference == subject)
+    {
+        return noChangeDiff();
+    }
+
+    if (subject.isNull())
+    {
+        return removeDiff();
+    }
+
+    if (reference.isNull())
+    {
+        return addDiff();
+    }
+
+    QList<QSharedPointer<IPXactDiff> > diffResult = diffFields(reference, subject);
+    if (diffResult.isEmpty())
+    {
+        return noChangeDiff();
+    }
+
+    return diffResult;
 }
 
 //-----------------------------------------------------------------------------
@@ -123,23 +149,94 @@ QList<QSharedPointer<IPXactDiff> > ComponentComparator::diffFields(QSharedPointe
         diffResult.append(vlnvComparator.diff(referenceVLNV, otherVLNV));
     }
 
-    if (!compareParameters(reference, subject))
+    if (contentHashes_.componentHash(reference) == contentHashes_.componentHash(subject))
     {
-        ParameterComparator parameterComparator;
-        diffResult.append(parameterComparator.diff(*reference->getParameters(), *subject->getParameters()));
+        return diffResult;
     }
 
-    if (!comparePorts(reference, subject))
+    // Only the elements without an identical counterpart are diffed by name.
+    QList<QSharedPointer<Parameter> > referenceParameters = *reference->getParameters();
+    QList<QSharedPointer<Parameter> > subjectParameters = *subject->getParameters();
+    removeUnchanged(referenceParameters, subjectParameters, &StructuralHash::parameterHash);
+
+    ParameterComparator parameterComparator;
+    appendChanges(diffResult, parameterComparator.diff(referenceParameters, subjectParameters));
+
+    QList<QSharedPointer<Port> > referencePorts = *reference->getPorts();
+    QList<QSharedPointer<Port> > subjectPorts = *subject->getPorts();
+    removeUnchanged(referencePorts, subjectPorts, &StructuralHash::portHash);
+
+    PortComparator portComparator;
+    appendChanges(diffResult, portComparator.diff(referencePorts, subjectPorts));
+
+    QList<QSharedPointer<View> > referenceViews = *reference->getViews();
+    QList<QSharedPointer<View> > subjectViews = *subject->getViews();
+    removeUnchanged(referenceViews, subjectViews, &StructuralHash::viewHash);
+
+    ViewComparator viewComparator;
+    appendChanges(diffResult, viewComparator.diff(referenceViews, subjectViews));
+
+    return diffResult;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentComparator::removeUnchanged()
+//-----------------------------------------------------------------------------
+template <class T>
+void ComponentComparator::removeUnchanged(QList<QSharedPointer<T> >& references,
+    QList<QSharedPointer<T> >& subjects,
+    StructuralHash::Digest (StructuralHash::*elementHash)(QSharedPointer<T const>)) const
+{
+    QVector<StructuralHash::Digest> referenceHashes;
+    referenceHashes.reserve(references.size());
+    QSet<StructuralHash::Digest> referenceSet;
+    referenceSet.reserve(references.size());
+    for (QSharedPointer<T> const& reference : references)
     {
-        PortComparator portComparator;
-        diffResult.append(portComparator.diff(*reference->getPorts().data(), *subject->getPorts().data()));
+        referenceHashes.append((contentHashes_.*elementHash)(reference));
+        referenceSet.insert(referenceHashes.last());
     }
 
-    if (!compareViews(reference, subject))
+    QVector<StructuralHash::Digest> subjectHashes;
+    subjectHashes.reserve(subjects.size());
+    QSet<StructuralHash::Digest> subjectSet;
+    subjectSet.reserve(subjects.size());
+    for (QSharedPointer<T> const& subject : subjects)
     {
-        ViewComparator viewComparator;
-        diffResult.append(viewComparator.diff(*reference->getViews().data(), *subject->getViews().data()));
+        subjectHashes.append((contentHashes_.*elementHash)(subject));
+        subjectSet.insert(subjectHashes.last());
     }
 
-    return diffResult;
+    QList<QSharedPointer<T> > changedReferences;
+    for (int i = 0; i < references.size(); ++i)
+    {
+        if (!subjectSet.contains(referenceHashes.at(i)))
+        {
+            changedReferences.append(references.at(i));
+        }
+    }
+
+    QList<QSharedPointer<T> > changedSubjects;
+    for (int i = 0; i < subjects.size(); ++i)
+    {
+        if (!referenceSet.contains(subjectHashes.at(i)))
+        {
+            changedSubjects.append(subjects.at(i));
+        }
+    }
+
+    references = changedReferences;
+    subjects = changedSubjects;
+}
+
+//-----------------------------------------------------------------------------
+// Function: ComponentComparator::appendChanges()
+//-----------------------------------------------------------------------------
+void ComponentComparator::appendChanges(QList<QSharedPointer<IPXactDiff> >& diffResult,
+    QList<QSharedPointer<IPXactDiff> > const& listDiff) const
+{
+    if (listDiff.size() != 1 || listDiff.first()->changeType() != IPXactDiff::NO_CHANGE)
+    {
+        diffResult.append(listDiff);
+    }
 }
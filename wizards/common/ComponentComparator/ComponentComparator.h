@@ -15,6 +15,8 @@
 #include <wizards/common/IPXactDiff.h>
 #include <wizards/common/IPXactElementComparator.h>
 
+#include <IPXACTmodels/utilities/StructuralHash.h>
+
 #include <QSharedPointer>
 
 class Component;
@@ -48,6 +50,8 @@ public:
     /*!
      *  Finds the differences between the two given components.
      *
+     *      The components are diffed in a single pass without comparing them first.
+     *
      *      @param [in] reference   The component to compare to.
      *      @param [in] subject     The component to compare against the reference.
      *
@@ -121,6 +125,35 @@ private:
      *      @return True, if the views are similar, otherwise false.
      */  
     bool compareViews(QSharedPointer<const Component> first, QSharedPointer<const Component> second) const;
+
+    /*!
+     *  Removes the elements that have an identical element in the other list.
+     *
+     *      The content hash of an element covers its name, so equal hashes are equal elements of the same name.
+     *
+     *      @param [in/out] references  The reference elements.
+     *      @param [in/out] subjects    The subject elements.
+     *      @param [in] elementHash     The hash function for the elements.
+     */
+    template <class T>
+    void removeUnchanged(QList<QSharedPointer<T> >& references, QList<QSharedPointer<T> >& subjects,
+        StructuralHash::Digest (StructuralHash::*elementHash)(QSharedPointer<T const>)) const;
+
+    /*!
+     *  Appends the changes found in a list of sub-elements to the diff result.
+     *
+     *      @param [in/out] diffResult  The diff result to append to.
+     *      @param [in] listDiff        The differences found in the list of sub-elements.
+     */
+    void appendChanges(QList<QSharedPointer<IPXactDiff> >& diffResult,
+        QList<QSharedPointer<IPXactDiff> > const& listDiff) const;
+
+    //-----------------------------------------------------------------------------
+    // Data.
+    //-----------------------------------------------------------------------------
+
+    //! The content hashes of the diffed components and their elements, kept between the diffs.
+    mutable StructuralHash contentHashes_;
 };
 
 #endif // COMPONENTCOMPARATOR_H
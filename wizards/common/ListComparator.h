@@ -16,8 +16,8 @@
 #include "IPXactDiff.h"
 
 #include <QSharedPointer>
+#include <QHash>
 #include <QList>
-#include <QMap>
 
 //-----------------------------------------------------------------------------
 //! Base class for all IP-XACT comparators comparing lists of elements.
@@ -38,7 +38,7 @@ public:
      *
      *      @return True, if the lists are similar, otherwise false.
      */
-    virtual bool compare(QList<QSharedPointer<T> > const first, QList<QSharedPointer<T> > const second) const;    
+    virtual bool compare(QList<QSharedPointer<T> > const& first, QList<QSharedPointer<T> > const& second) const;
     
     /*!
      *  Finds the differences between the two given lists.
@@ -48,8 +48,8 @@ public:
      *
      *      @return Set of differences between the references and subjects.
      */
-    virtual QList<QSharedPointer<IPXactDiff> > diff(QList<QSharedPointer<T> > const references, 
-        QList<QSharedPointer<T> > const subjects) const;
+    virtual QList<QSharedPointer<IPXactDiff> > diff(QList<QSharedPointer<T> > const& references, 
+        QList<QSharedPointer<T> > const& subjects) const;
 
     /*!
      *  Returns the type for the element.
@@ -61,13 +61,13 @@ public:
 protected:
 
     /*!
-     *  Creates a map of elements where the name of the element is the key.
+     *  Creates a hash of elements where the name of the element is the key.
      *
-     *      @param [in] list   The elements to include in the map.
+     *      @param [in] list   The elements to include in the hash.
      *
-     *      @return Map of elements.
+     *      @return Hash of elements.
      */
-    virtual QMap<QString, QSharedPointer<const T> > mapByName(QList<QSharedPointer<T> > const list) const;
+    virtual QHash<QString, QSharedPointer<const T> > mapByName(QList<QSharedPointer<T> > const& list) const;
 
 };
 
@@ -22,24 +22,20 @@ ListComparator<T>::~ListComparator()
 // Function: ListComparator<T>::compare()
 //-----------------------------------------------------------------------------
 template <class T>
-bool ListComparator<T>::compare(QList<QSharedPointer<T> > const first,
-    QList<QSharedPointer<T> > const second) const
+bool ListComparator<T>::compare(QList<QSharedPointer<T> > const& first,
+    QList<QSharedPointer<T> > const& second) const
 {
     if (first.count() != second.count())
     {
         return false;
     }
 
-    QMap<QString, QSharedPointer<const T> > const sortedSubjects = mapByName(second);
+    QHash<QString, QSharedPointer<const T> > const sortedSubjects = mapByName(second);
 
-    foreach(QSharedPointer<const T> reference, first)
-    {    
-        if (!sortedSubjects.contains(reference->name()))
-        {
-            return false;
-        }
-
-        if (!IPXactElementComparator<T>::compare(reference, sortedSubjects.value(reference->name())))
+    for (QSharedPointer<const T> reference : first)
+    {
+        auto subject = sortedSubjects.constFind(reference->name());
+        if (subject == sortedSubjects.constEnd() || !IPXactElementComparator<T>::compare(reference, subject.value()))
         {
             return false;
         }
@@ -52,21 +48,21 @@ bool ListComparator<T>::compare(QList<QSharedPointer<T> > const first,
 // Function: ListComparator<T>::diff()
 //-----------------------------------------------------------------------------
 template <class T>
-QList<QSharedPointer<IPXactDiff> > ListComparator<T>::diff(QList<QSharedPointer<T> > const references, 
-    QList<QSharedPointer<T> > const subjects) const
+QList<QSharedPointer<IPXactDiff> > ListComparator<T>::diff(QList<QSharedPointer<T> > const& references, 
+    QList<QSharedPointer<T> > const& subjects) const
 {
     QList<QSharedPointer<IPXactDiff> > diffResult;
 
-    QMap<QString, QSharedPointer<const T> > subjectMap = mapByName(subjects);
+    QHash<QString, QSharedPointer<const T> > const subjectMap = mapByName(subjects);
 
-    foreach(QSharedPointer<const T> reference, references)
-    {    
-        if (subjectMap.contains(reference->name()))
+    for (QSharedPointer<const T> reference : references)
+    {
+        auto subject = subjectMap.constFind(reference->name());
+        if (subject != subjectMap.constEnd())
         {
-            QSharedPointer<const T> subject = subjectMap.value(reference->name());
-            if (!IPXactElementComparator<T>::compare(reference, subject))
+            if (!IPXactElementComparator<T>::compare(reference, subject.value()))
             {
-                diffResult.append(IPXactElementComparator<T>::diff(reference, subject));
+                diffResult.append(this->diffFields(reference, subject.value()));
             }
         }
         else
@@ -77,10 +73,10 @@ QList<QSharedPointer<IPXactDiff> > ListComparator<T>::diff(QList<QSharedPointer<
         }
     }
 
-    QMap<QString, QSharedPointer<const T> > referenceMap = mapByName(references);
+    QHash<QString, QSharedPointer<const T> > const referenceMap = mapByName(references);
 
-    foreach(QSharedPointer<const T> subject, subjects)
-    {    
+    for (QSharedPointer<const T> subject : subjects)
+    {
         if (!referenceMap.contains(subject->name()))
         {
             QSharedPointer<IPXactDiff> add(new IPXactDiff(elementType(), subject->name()));
@@ -103,11 +99,12 @@ QList<QSharedPointer<IPXactDiff> > ListComparator<T>::diff(QList<QSharedPointer<
 // Function: ListComparator<T>::mapByName()
 //-----------------------------------------------------------------------------
 template <class T> 
-QMap<QString, QSharedPointer<const T> > ListComparator<T>::mapByName(QList<QSharedPointer<T> > const list) const
+QHash<QString, QSharedPointer<const T> > ListComparator<T>::mapByName(QList<QSharedPointer<T> > const& list) const
 {
-    QMap<QString, QSharedPointer<const T> > mappedResult;
+    QHash<QString, QSharedPointer<const T> > mappedResult;
+    mappedResult.reserve(list.count());
 
-    foreach(QSharedPointer<const T> element, list)
+    for (QSharedPointer<const T> element : list)
     {
         mappedResult.insert(element->name(), element);
     }
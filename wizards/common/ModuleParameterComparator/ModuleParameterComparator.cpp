@@ -52,8 +52,8 @@ bool ModuleParameterComparator::compareFields(QSharedPointer<const ModuleParamet
 //-----------------------------------------------------------------------------
 // Function: ModuleParameterComparator::compare()
 //-----------------------------------------------------------------------------
-bool ModuleParameterComparator::compare(QList<QSharedPointer<ModuleParameter> > const references,
-    QList<QSharedPointer<ModuleParameter> > const subjects)
+bool ModuleParameterComparator::compare(QList<QSharedPointer<ModuleParameter> > const& references,
+    QList<QSharedPointer<ModuleParameter> > const& subjects)
 {
     return ListComparator::compare(references, subjects);
 }
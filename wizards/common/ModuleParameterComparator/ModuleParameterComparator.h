@@ -60,8 +60,8 @@ public:
      *
      *      @return True, if the lists are similar, otherwise false.
      */
-    bool compare(QList<QSharedPointer<ModuleParameter> > const first, 
-        QList<QSharedPointer<ModuleParameter> > const second) ;
+    bool compare(QList<QSharedPointer<ModuleParameter> > const& first, 
+        QList<QSharedPointer<ModuleParameter> > const& second) ;
     
     /*!
      *  Finds the differences between the sub-elements of two given module parameters.
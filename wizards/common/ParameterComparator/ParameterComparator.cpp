@@ -49,8 +49,8 @@ bool ParameterComparator::compareFields(QSharedPointer<const Parameter> first,
 //-----------------------------------------------------------------------------
 // Function: ParameterComparator::compare()
 //-----------------------------------------------------------------------------
-bool ParameterComparator::compare(QList<QSharedPointer<Parameter> > const references,
-    QList<QSharedPointer<Parameter> > const subjects)
+bool ParameterComparator::compare(QList<QSharedPointer<Parameter> > const& references,
+    QList<QSharedPointer<Parameter> > const& subjects)
 {
     return ListComparator::compare(references, subjects);
 }
@@ -61,7 +61,7 @@ public:
      *
      *      @return True, if the lists are similar, otherwise false.
      */
-    bool compare(QList<QSharedPointer<Parameter> > const first, QList<QSharedPointer<Parameter> > const second);
+    bool compare(QList<QSharedPointer<Parameter> > const& first, QList<QSharedPointer<Parameter> > const& second);
     
     /*!
      *  Finds the differences between the sub-elements of two given model parameters.
@@ -54,8 +54,8 @@ bool PortComparator::compareFields(QSharedPointer<const Port> first, QSharedPoin
 //-----------------------------------------------------------------------------
 // Function: PortComparator::compare()
 //-----------------------------------------------------------------------------
-bool PortComparator::compare(QList<QSharedPointer<Port> > const first, 
-    QList<QSharedPointer<Port> > const second) const
+bool PortComparator::compare(QList<QSharedPointer<Port> > const& first, 
+    QList<QSharedPointer<Port> > const& second) const
 {
     return ListComparator::compare(first, second);
 }
@@ -98,8 +98,8 @@ QList<QSharedPointer<IPXactDiff> > PortComparator::diffFields(QSharedPointer<con
 //-----------------------------------------------------------------------------
 // Function: PortComparator::diff()
 //-----------------------------------------------------------------------------
-QList<QSharedPointer<IPXactDiff> > PortComparator::diff(QList<QSharedPointer<Port> > const references, 
-    QList<QSharedPointer<Port> > const subjects) const
+QList<QSharedPointer<IPXactDiff> > PortComparator::diff(QList<QSharedPointer<Port> > const& references, 
+    QList<QSharedPointer<Port> > const& subjects) const
 {
     return ListComparator::diff(references, subjects);
 }
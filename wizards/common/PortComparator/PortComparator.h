@@ -59,7 +59,7 @@ public:
      *
      *      @return True, if the lists are similar, otherwise false.
      */
-    virtual bool compare(QList<QSharedPointer<Port> > const first, QList<QSharedPointer<Port> > const second) const;
+    virtual bool compare(QList<QSharedPointer<Port> > const& first, QList<QSharedPointer<Port> > const& second) const;
 
     /*!
      *  Finds the differences between the two ports.
@@ -91,8 +91,8 @@ public:
      *
      *      @return Set of differences between the reference and subject.
      */
-    virtual QList<QSharedPointer<IPXactDiff> > diff(QList<QSharedPointer<Port> > const reference, 
-        QList<QSharedPointer<Port> > const subject) const;
+    virtual QList<QSharedPointer<IPXactDiff> > diff(QList<QSharedPointer<Port> > const& reference, 
+        QList<QSharedPointer<Port> > const& subject) const;
     
     /*!
      *  Returns the type for the element.
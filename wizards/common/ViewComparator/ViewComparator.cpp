@@ -51,8 +51,8 @@ bool ViewComparator::compareFields(QSharedPointer<const View> first, QSharedPoin
 //-----------------------------------------------------------------------------
 // Function: ViewComparator::compare()
 //-----------------------------------------------------------------------------
-bool ViewComparator::compare(QList<QSharedPointer<View> > const first, 
-    QList<QSharedPointer<View> > const second) const
+bool ViewComparator::compare(QList<QSharedPointer<View> > const& first, 
+    QList<QSharedPointer<View> > const& second) const
 {
     return ListComparator::compare(first, second);
 }
@@ -110,8 +110,8 @@ QList<QSharedPointer<IPXactDiff> > ViewComparator::diffFields(QSharedPointer<con
 //-----------------------------------------------------------------------------
 // Function: ViewComparator::diff()
 //-----------------------------------------------------------------------------
-QList<QSharedPointer<IPXactDiff> > ViewComparator::diff(QList<QSharedPointer<View> > const references, 
-    QList<QSharedPointer<View> > const subjects) const
+QList<QSharedPointer<IPXactDiff> > ViewComparator::diff(QList<QSharedPointer<View> > const& references, 
+    QList<QSharedPointer<View> > const& subjects) const
 {
     return ListComparator::diff(references, subjects);
 }
@@ -58,7 +58,7 @@ public:
      *
      *      @return True, if the lists are similar, otherwise false.
      */
-    virtual bool compare(QList<QSharedPointer<View> > const first, QList<QSharedPointer<View> > const second) const;
+    virtual bool compare(QList<QSharedPointer<View> > const& first, QList<QSharedPointer<View> > const& second) const;
 
     /*!
      *  Finds the differences between two views.
@@ -90,8 +90,8 @@ public:
      *
      *      @return Set of differences between the reference and subject.
      */
-    virtual QList<QSharedPointer<IPXactDiff> > diff(QList<QSharedPointer<View> > const reference, 
-        QList<QSharedPointer<View> > const subject) const;
+    virtual QList<QSharedPointer<IPXactDiff> > diff(QList<QSharedPointer<View> > const& reference, 
+        QList<QSharedPointer<View> > const& subject) const;
     
     /*!
      *  Returns the type for the element.